@@ -14,6 +14,7 @@
 #include <QtCore/QVariantList>
 #include <QtQmlIntegration/QtQmlIntegration>
 
+#include "MAVLinkMessageDispatcher.h"
 #include "QGCPalette.h"
 
 class FactMetaData;
@@ -119,6 +120,10 @@ class QGCCorePlugin : public QObject
     /// @return true: Allow vehicle to continue processing, false: Vehicle should not process message
     virtual bool mavlinkMessage(Vehicle *vehicle, LinkInterface *link, const mavlink_message_t &message) { Q_UNUSED(vehicle); Q_UNUSED(link); Q_UNUSED(message); return true; }
 
+    /// Message ids which are passed through mavlinkMessage. Plugins which only look at specific messages should
+    /// narrow this down so the remaining traffic skips the plugin.
+    virtual QList<uint32_t> mavlinkMessageIds() const { return { MAVLinkMessageDispatcher::allMessageIds }; }
+
     /// Allows custom builds to add custom items to the FlightMap. Objects put into QmlObjectListModel should derive from QmlComponentInfo and set the url property.
     virtual const QmlObjectListModel *customMapItems();
 
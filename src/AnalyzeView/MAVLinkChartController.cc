@@ -74,6 +74,34 @@ void MAVLinkChartController::setRangeXIndex(quint32 index)
     emit rangeXIndexChanged();
 
     updateXRange();
+
+    // Downsampled series only cover the visible time range
+    for (const QVariant &field : _chartFields) {
+        QObject *const object = qvariant_cast<QObject*>(field);
+        QGCMAVLinkMessageField *const pField = qobject_cast<QGCMAVLinkMessageField*>(object);
+        if (pField) {
+            pField->invalidateSeries();
+        }
+    }
+}
+
+void MAVLinkChartController::setHistorySize(int samples)
+{
+    samples = qMax(samples, 2);
+    if (samples == _historySize) {
+        return;
+    }
+
+    _historySize = samples;
+    emit historySizeChanged();
+
+    for (const QVariant &field : _chartFields) {
+        QObject *const object = qvariant_cast<QObject*>(field);
+        QGCMAVLinkMessageField *const pField = qobject_cast<QGCMAVLinkMessageField*>(object);
+        if (pField) {
+            pField->setHistorySize(_historySize);
+        }
+    }
 }
 
 void MAVLinkChartController::updateXRange()
@@ -150,6 +178,7 @@ void MAVLinkChartController::addSeries(QGCMAVLinkMessageField *field, QAbstractS
     }
 
     _chartFields.append(f);
+    field->setHistorySize(_historySize);
     field->addSeries(this, series);
     emit chartFieldsChanged();
 
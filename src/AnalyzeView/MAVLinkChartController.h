@@ -19,6 +19,8 @@
 #include <QtCore/QVariantList>
 #include <QtQmlIntegration/QtQmlIntegration>
 
+#include "MAVLinkSeriesBuffer.h"
+
 Q_DECLARE_LOGGING_CATEGORY(MAVLinkChartControllerLog)
 
 class MAVLinkInspectorController;
@@ -42,6 +44,7 @@ class MAVLinkChartController : public QObject
     Q_PROPERTY(int          chartIndex  READ chartIndex                             CONSTANT)
     Q_PROPERTY(quint32      rangeYIndex READ rangeYIndex    WRITE setRangeYIndex    NOTIFY rangeYIndexChanged)
     Q_PROPERTY(quint32      rangeXIndex READ rangeXIndex    WRITE setRangeXIndex    NOTIFY rangeXIndexChanged)
+    Q_PROPERTY(int          historySize READ historySize    WRITE setHistorySize    NOTIFY historySizeChanged)
 
 public:
     explicit MAVLinkChartController(MAVLinkInspectorController *controller, int index, QObject *parent = nullptr);
@@ -59,9 +62,12 @@ class MAVLinkChartController : public QObject
     quint32 rangeXIndex() const { return _rangeXIndex; }
     quint32 rangeYIndex() const { return _rangeYIndex; }
     int chartIndex() const { return _index; }
+    int historySize() const { return _historySize; }
 
     void setRangeXIndex(quint32 index);
     void setRangeYIndex(quint32 index);
+    /// Number of samples kept per field, older samples are dropped
+    void setHistorySize(int samples);
     void updateXRange();
     void updateYRange();
 
@@ -73,6 +79,7 @@ class MAVLinkChartController : public QObject
     void rangeYMaxChanged();
     void rangeYIndexChanged();
     void rangeXIndexChanged();
+    void historySizeChanged();
 
 private slots:
     void _refreshSeries();
@@ -88,6 +95,7 @@ private slots:
     qreal _rangeYMax = 1;
     quint32 _rangeXIndex = 0;   ///< 5 Seconds
     quint32 _rangeYIndex = 0;   ///< Auto Range
+    int _historySize = static_cast<int>(MAVLinkSeriesBuffer::kDefaultCapacity);
     QVariantList _chartFields;
 
     static constexpr int kUpdateFrequency = 1000 / 15;  ///< 15Hz
@@ -65,6 +65,10 @@ MAVLinkInspectorController::MAVLinkInspectorController(QObject *parent)
     _timeScaleSt.append(new TimeScale_st(tr("10 Sec"), 10 * 1000));
     _timeScaleSt.append(new TimeScale_st(tr("30 Sec"), 30 * 1000));
     _timeScaleSt.append(new TimeScale_st(tr("60 Sec"), 60 * 1000));
+    _timeScaleSt.append(new TimeScale_st(tr("2 Min"),  2 * 60 * 1000));
+    _timeScaleSt.append(new TimeScale_st(tr("5 Min"),  5 * 60 * 1000));
+    _timeScaleSt.append(new TimeScale_st(tr("10 Min"), 10 * 60 * 1000));
+    _timeScaleSt.append(new TimeScale_st(tr("30 Min"), 30 * 60 * 1000));
     emit timeScalesChanged();
 
     _rangeSt.append(new Range_st(tr("Auto"),    0));
@@ -44,7 +44,8 @@ void QGCMAVLinkMessageField::addSeries(MAVLinkChartController *chart, QAbstractS
     _pSeries = series;
     emit seriesChanged();
 
-    _dataIndex = 0;
+    _values.clear();
+    _seriesAppended = 0;
     _msg->updateFieldSelection();
 }
 
@@ -55,8 +56,10 @@ void QGCMAVLinkMessageField::delSeries()
     }
 
     _values.clear();
+    _seriesAppended = 0;
+    _seriesDownsampled = false;
     QLineSeries *const lineSeries = static_cast<QLineSeries*>(_pSeries);
-    lineSeries->replace(_values);
+    lineSeries->clear();
     _pSeries = nullptr;
     _chart = nullptr;
     emit seriesChanged();
@@ -76,6 +79,18 @@ void QGCMAVLinkMessageField::setSelectable(bool sel)
     }
 }
 
+void QGCMAVLinkMessageField::setHistorySize(qsizetype samples)
+{
+    if (samples == _values.capacity()) {
+        return;
+    }
+
+    _values.setCapacity(samples);
+
+    // Forces the next series update to replace everything
+    _seriesAppended = 0;
+}
+
 int QGCMAVLinkMessageField::chartIndex() const
 {
     if (_chart) {
@@ -96,33 +111,18 @@ void QGCMAVLinkMessageField::updateValue(const QString &newValue, qreal v)
         return;
     }
 
-    const int count = _values.count();
-    if (count < (50 * 60)) { ///< Arbitrary limit of 1 minute of data at 50Hz for now
-        const QPointF p(qgcApp()->msecsSinceBoot(), v);
-        _values.append(p);
-    } else {
-        if (_dataIndex >= count) {
-            _dataIndex = 0;
-        }
-        _values[_dataIndex].setX(qgcApp()->msecsSinceBoot());
-        _values[_dataIndex].setY(v);
-        _dataIndex++;
-    }
+    _values.append(QPointF(qgcApp()->msecsSinceBoot(), v));
 
     if (_chart->rangeYIndex() != 0) {
         return;
     }
 
-    qreal vmin = std::numeric_limits<qreal>::max();
-    qreal vmax = std::numeric_limits<qreal>::min();
-    for (const QPointF &point : _values) {
-        const qreal v = point.y();
-        if (vmax < v) {
-            vmax = v;
-        }
-        if (vmin > v) {
-            vmin = v;
-        }
+    // The history reaches back further than the plot, only the visible samples count towards the auto range
+    const qsizetype first = _values.lowerBound(static_cast<qreal>(_chart->rangeXMin().toMSecsSinceEpoch()));
+    qreal vmin = 0;
+    qreal vmax = 0;
+    if (!_values.range(first, vmin, vmax)) {
+        return;
     }
 
     bool changed = false;
@@ -143,23 +143,43 @@ void QGCMAVLinkMessageField::updateValue(const QString &newValue, qreal v)
 
 void QGCMAVLinkMessageField::updateSeries()
 {
-    const int count = _values.count();
+    const qsizetype count = _values.count();
     if (count <= 1) {
         return;
     }
 
-    QList<QPointF> s;
-    s.reserve(count);
-    int idx = _dataIndex;
-    for (int i = 0; i < count; i++, idx++) {
-        if (idx >= count) {
-            idx = 0;
+    const quint64 newCount = _values.totalAppended() - _seriesAppended;
+    if (newCount == 0) {
+        return;
+    }
+
+    QLineSeries *const lineSeries = static_cast<QLineSeries*>(_pSeries);
+    if (count > kMaxSeriesPoints) {
+        // Only the visible part of the history is downsampled. It is redone once at least a full bucket of new samples
+        // has arrived, before that the new samples would not move the plot by more than a single point.
+        const qsizetype first = _values.lowerBound(static_cast<qreal>(_chart->rangeXMin().toMSecsSinceEpoch()));
+        const qsizetype visible = count - first;
+        if (_seriesDownsampled && ((newCount * kMaxSeriesPoints) < static_cast<quint64>(visible))) {
+            return;
         }
 
-        const QPointF p(_values[idx]);
-        s.append(p);
+        _seriesAppended = _values.totalAppended();
+        _seriesDownsampled = true;
+        lineSeries->replace(_values.downsample(first, kMaxSeriesPoints));
+        return;
     }
 
-    QLineSeries *const lineSeries = static_cast<QLineSeries*>(_pSeries);
-    lineSeries->replace(s);
+    _seriesAppended = _values.totalAppended();
+    if (_seriesDownsampled || (newCount >= static_cast<quint64>(count))) {
+        _seriesDownsampled = false;
+        lineSeries->replace(_values.toList());
+        return;
+    }
+
+    // Only push what arrived since the last update and drop what the buffer has dropped
+    lineSeries->append(_values.newest(static_cast<qsizetype>(newCount)));
+    const qsizetype excess = lineSeries->count() - count;
+    if (excess > 0) {
+        lineSeries->removePoints(0, excess);
+    }
 }
@@ -15,6 +15,8 @@
 #include <QtCore/QString>
 #include <QtQmlIntegration/QtQmlIntegration>
 
+#include "MAVLinkSeriesBuffer.h"
+
 Q_DECLARE_LOGGING_CATEGORY(MAVLinkMessageFieldLog)
 
 class QGCMAVLinkMessage;
@@ -45,17 +47,22 @@ class QGCMAVLinkMessageField : public QObject
     bool selectable() const { return _selectable; }
     bool selected() const { return !!_pSeries; }
     const QAbstractSeries *series() const { return _pSeries; }
-    const QList<QPointF> *values() const { return &_values; }
+    const MAVLinkSeriesBuffer &values() const { return _values; }
     qreal rangeMin() const { return _rangeMin; }
     qreal rangeMax() const { return _rangeMax; }
     int chartIndex() const;
 
     void setSelectable(bool sel);
+    void setHistorySize(qsizetype samples);
     void updateValue(const QString &newValue, qreal v);
 
     void addSeries(MAVLinkChartController *chart, QAbstractSeries *series);
     void delSeries();
     void updateSeries();
+    /// Makes the next updateSeries rebuild the series, for example after the visible time range changed
+    void invalidateSeries() { _seriesAppended = 0; }
+
+    static constexpr qsizetype kMaxSeriesPoints = 2000; ///< Longer histories are downsampled to this many points
 
 signals:
     void seriesChanged();
@@ -69,10 +76,11 @@ class QGCMAVLinkMessageField : public QObject
 
     QString _value;
     bool _selectable = true;
-    int _dataIndex = 0;
     qreal _rangeMin = 0;
     qreal _rangeMax = 0;
-    QList<QPointF> _values;
+    MAVLinkSeriesBuffer _values;
+    quint64 _seriesAppended = 0;    ///< _values.totalAppended() as of the last series update
+    bool _seriesDownsampled = false;
 
     QAbstractSeries *_pSeries = nullptr;
     MAVLinkChartController *_chart = nullptr;
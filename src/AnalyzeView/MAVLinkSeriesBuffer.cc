@@ -0,0 +1,190 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkSeriesBuffer.h"
+
+#include <QtCore/QtNumeric>
+
+#include <algorithm>
+
+MAVLinkSeriesBuffer::MAVLinkSeriesBuffer(qsizetype capacity)
+    : _capacity(qMax<qsizetype>(capacity, 1))
+{
+
+}
+
+void MAVLinkSeriesBuffer::setCapacity(qsizetype capacity)
+{
+    capacity = qMax<qsizetype>(capacity, 1);
+    if (capacity == _capacity) {
+        return;
+    }
+
+    const QList<QPointF> kept = newest(qMin(_count, capacity));
+    clear();
+    _capacity = capacity;
+    for (const QPointF &point : kept) {
+        append(point);
+    }
+}
+
+void MAVLinkSeriesBuffer::append(const QPointF &point)
+{
+    const quint64 sequence = _totalAppended++;
+    if (_count < _capacity) {
+        _points.append(point);
+        _count++;
+    } else {
+        _points[_head] = point;
+        _head = (_head + 1) % _capacity;
+    }
+
+    // Drop the extremes which were just overwritten
+    const quint64 oldestSequence = _totalAppended - static_cast<quint64>(_count);
+    while (!_minDeque.empty() && (_minDeque.front().sequence < oldestSequence)) {
+        _minDeque.pop_front();
+    }
+    while (!_maxDeque.empty() && (_maxDeque.front().sequence < oldestSequence)) {
+        _maxDeque.pop_front();
+    }
+
+    // NaN would break the ordering of the deques, so non-finite values are plotted but don't affect the range
+    const qreal value = point.y();
+    if (!qIsFinite(value)) {
+        return;
+    }
+
+    // A value can never be the minimum again once a smaller or equal newer value arrives, same for the maximum
+    while (!_minDeque.empty() && (_minDeque.back().value >= value)) {
+        _minDeque.pop_back();
+    }
+    _minDeque.push_back({ sequence, value });
+
+    while (!_maxDeque.empty() && (_maxDeque.back().value <= value)) {
+        _maxDeque.pop_back();
+    }
+    _maxDeque.push_back({ sequence, value });
+}
+
+void MAVLinkSeriesBuffer::clear()
+{
+    _points.clear();
+    _head = 0;
+    _count = 0;
+    _totalAppended = 0;
+    _minDeque.clear();
+    _maxDeque.clear();
+}
+
+const QPointF &MAVLinkSeriesBuffer::at(qsizetype index) const
+{
+    Q_ASSERT((index >= 0) && (index < _count));
+
+    return _points[(_head + index) % _count];
+}
+
+QList<QPointF> MAVLinkSeriesBuffer::newest(qsizetype count) const
+{
+    count = qBound<qsizetype>(0, count, _count);
+
+    QList<QPointF> points;
+    points.reserve(count);
+    for (qsizetype index = _count - count; index < _count; index++) {
+        points.append(at(index));
+    }
+
+    return points;
+}
+
+qsizetype MAVLinkSeriesBuffer::lowerBound(qreal x) const
+{
+    qsizetype low = 0;
+    qsizetype high = _count;
+    while (low < high) {
+        const qsizetype mid = low + ((high - low) / 2);
+        if (at(mid).x() < x) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+bool MAVLinkSeriesBuffer::range(qsizetype first, qreal &minimum, qreal &maximum) const
+{
+    first = qBound<qsizetype>(0, first, _count);
+    const quint64 firstSequence = _totalAppended - static_cast<quint64>(_count - first);
+
+    const auto sequenceBefore = [](const Extreme &extreme, quint64 sequence) { return (extreme.sequence < sequence); };
+    const auto minIt = std::lower_bound(_minDeque.cbegin(), _minDeque.cend(), firstSequence, sequenceBefore);
+    const auto maxIt = std::lower_bound(_maxDeque.cbegin(), _maxDeque.cend(), firstSequence, sequenceBefore);
+    if ((minIt == _minDeque.cend()) || (maxIt == _maxDeque.cend())) {
+        return false;
+    }
+
+    minimum = minIt->value;
+    maximum = maxIt->value;
+    return true;
+}
+
+QList<QPointF> MAVLinkSeriesBuffer::downsample(qsizetype first, qsizetype maxPoints) const
+{
+    first = qBound<qsizetype>(0, first, _count);
+    const qsizetype count = _count - first;
+    if ((count <= maxPoints) || (maxPoints < 3)) {
+        return newest(count);
+    }
+
+    QList<QPointF> points;
+    points.reserve(maxPoints);
+    points.append(at(first));
+
+    // First and last sample are kept as is, everything in between is split into equally sized buckets
+    const double bucketSize = static_cast<double>(count - 2) / static_cast<double>(maxPoints - 2);
+    qsizetype picked = 0;
+    for (qsizetype bucket = 0; bucket < (maxPoints - 2); bucket++) {
+        const qsizetype bucketStart = static_cast<qsizetype>(bucket * bucketSize) + 1;
+        const qsizetype bucketEnd = static_cast<qsizetype>((bucket + 1) * bucketSize) + 1;
+        const qsizetype nextStart = bucketEnd;
+        const qsizetype nextEnd = qMin(static_cast<qsizetype>((bucket + 2) * bucketSize) + 1, count);
+
+        qreal avgX = 0;
+        qreal avgY = 0;
+        for (qsizetype i = nextStart; i < nextEnd; i++) {
+            const QPointF &point = at(first + i);
+            avgX += point.x();
+            avgY += point.y();
+        }
+        const qsizetype nextCount = nextEnd - nextStart;
+        avgX /= nextCount;
+        avgY /= nextCount;
+
+        const QPointF &a = at(first + picked);
+        qreal maxArea = -1;
+        qsizetype maxIndex = bucketStart;
+        for (qsizetype i = bucketStart; i < bucketEnd; i++) {
+            const QPointF &point = at(first + i);
+            // Twice the triangle area, only the comparison matters
+            const qreal area = qAbs(((a.x() - avgX) * (point.y() - a.y())) - ((a.x() - point.x()) * (avgY - a.y())));
+            if (area > maxArea) {
+                maxArea = area;
+                maxIndex = i;
+            }
+        }
+
+        points.append(at(first + maxIndex));
+        picked = maxIndex;
+    }
+
+    points.append(at(_count - 1));
+
+    return points;
+}
@@ -0,0 +1,82 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QList>
+#include <QtCore/QPointF>
+
+#include <deque>
+
+/// Fixed capacity ring buffer holding the chart history of a single MAVLink message field.
+/// Once full the oldest sample is overwritten. The minimum and maximum y value of the samples held are tracked with
+/// monotonic deques, so appending a sample and reading the range are both amortized O(1) regardless of the capacity.
+class MAVLinkSeriesBuffer
+{
+public:
+    explicit MAVLinkSeriesBuffer(qsizetype capacity = kDefaultCapacity);
+
+    qsizetype capacity() const { return _capacity; }
+
+    /// Keeps the newest samples which still fit, totalAppended restarts at the number of samples kept
+    void setCapacity(qsizetype capacity);
+
+    qsizetype count() const { return _count; }
+    bool isEmpty() const { return (_count == 0); }
+
+    /// Number of samples appended since the last clear, including the ones which have been overwritten since
+    quint64 totalAppended() const { return _totalAppended; }
+
+    void append(const QPointF &point);
+    void clear();
+
+    /// @param index 0 is the oldest sample
+    const QPointF &at(qsizetype index) const;
+
+    /// @return The newest count samples, oldest first
+    QList<QPointF> newest(qsizetype count) const;
+    QList<QPointF> toList() const { return newest(_count); }
+
+    /// Samples must be appended in x order for this to work
+    /// @return Index of the first sample with an x value of at least x, count() if there is none
+    qsizetype lowerBound(qreal x) const;
+
+    /// Reduces the samples from index first to the newest to at most maxPoints using Largest-Triangle-Three-Buckets.
+    /// The first and newest sample are always kept, each bucket in between contributes the sample which forms the
+    /// largest triangle with the previously picked sample and the average of the next bucket. That keeps the peaks and
+    /// the overall shape of the plot at a fixed point count.
+    /// @return All samples from first if there are no more than maxPoints
+    QList<QPointF> downsample(qsizetype first, qsizetype maxPoints) const;
+
+    /// @return false: no finite y values are held, minimum and maximum are 0
+    bool hasRange() const { return !_minDeque.empty(); }
+    qreal minimum() const { return (hasRange() ? _minDeque.front().value : 0); }
+    qreal maximum() const { return (hasRange() ? _maxDeque.front().value : 0); }
+
+    /// Range of the samples from index first to the newest, used to limit it to the visible part of the history.
+    /// The deques hold the minimum and maximum of every suffix of the samples, so this is a binary search.
+    /// @return false: no finite y values in that range, minimum and maximum are not set
+    bool range(qsizetype first, qreal &minimum, qreal &maximum) const;
+
+    static constexpr qsizetype kDefaultCapacity = 50 * 60 * 30; ///< 30 minutes of data at 50Hz
+
+private:
+    struct Extreme {
+        quint64 sequence;   ///< Value of totalAppended when the sample was appended
+        qreal value;
+    };
+
+    QList<QPointF> _points;
+    qsizetype _capacity = 0;
+    qsizetype _head = 0;                ///< Index of the oldest sample in _points
+    qsizetype _count = 0;
+    quint64 _totalAppended = 0;
+    std::deque<Extreme> _minDeque;      ///< Increasing values, front is the minimum
+    std::deque<Extreme> _maxDeque;      ///< Decreasing values, front is the maximum
+};
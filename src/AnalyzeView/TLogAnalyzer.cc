@@ -0,0 +1,312 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "TLogAnalyzer.h"
+#include "Fact.h"
+#include "FactGroup.h"
+#include "LinkManager.h"
+#include "LogReplayLink.h"
+#include "MAVLinkLib.h"
+#include "MultiVehicleManager.h"
+#include "QGCLoggingCategory.h"
+#include "QmlObjectListModel.h"
+#include "Vehicle.h"
+
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtCore/QTimer>
+
+#include <algorithm>
+
+QGC_LOGGING_CATEGORY(TLogAnalyzerLog, "qgc.analyzeview.tloganalyzer")
+
+TLogAnalyzer::TLogAnalyzer(const QStringList &logFilenames, const QString &outputDir, uint intervalMSecs, QObject *parent)
+    : QObject(parent)
+    , _logFilenames(logFilenames)
+    , _outputDir(outputDir)
+    , _intervalUSecs(static_cast<quint64>(qMax(intervalMSecs, 1U)) * 1000)
+{
+    // qCDebug(TLogAnalyzerLog) << Q_FUNC_INFO << this;
+}
+
+TLogAnalyzer::~TLogAnalyzer()
+{
+    qDeleteAll(_seriesOrder);
+
+    // qCDebug(TLogAnalyzerLog) << Q_FUNC_INFO << this;
+}
+
+void TLogAnalyzer::start()
+{
+    QTimer::singleShot(0, this, &TLogAnalyzer::_startNextLog);
+}
+
+void TLogAnalyzer::_startNextLog()
+{
+    // Replay refuses to start while the vehicle from the previous log is still around
+    if (MultiVehicleManager::instance()->vehicles()->count() > 0) {
+        QTimer::singleShot(kVehicleRemovedPollMSecs, this, &TLogAnalyzer::_startNextLog);
+        return;
+    }
+
+    if (_nextLog >= _logFilenames.count()) {
+        qCInfo(TLogAnalyzerLog) << "Analyzed" << _logFilenames.count() << "logs, failed:" << _failedLogs;
+        emit finished(_failedLogs);
+        return;
+    }
+
+    _logFilename = _logFilenames[_nextLog++];
+    const QFileInfo logFileInfo(_logFilename);
+
+    if (!_logIndex.load(logFileInfo.absoluteFilePath())) {
+        qCWarning(TLogAnalyzerLog) << "Unable to read log" << _logFilename;
+        _finishLog(false);
+        return;
+    }
+
+    const QDir baseDir(_outputDir.isEmpty() ? logFileInfo.absolutePath() : _outputDir);
+    _logOutputDir.setPath(baseDir.filePath(logFileInfo.completeBaseName()));
+    if (!_logOutputDir.mkpath(QStringLiteral("."))) {
+        qCWarning(TLogAnalyzerLog) << "Unable to create output directory" << _logOutputDir.absolutePath();
+        _finishLog(false);
+        return;
+    }
+
+    _nextSampleUSecs = _logIndex.startTimeUSecs();
+    _lastSampleUSecs = 0;
+
+    _link = LinkManager::instance()->startLogReplay(logFileInfo.absoluteFilePath(), true /* fastReplay */);
+    if (!_link) {
+        qCWarning(TLogAnalyzerLog) << "Unable to start replay" << _logFilename;
+        _finishLog(false);
+        return;
+    }
+
+    (void) connect(_link, &LogReplayLink::dataReplayed, this, &TLogAnalyzer::_dataReplayed);
+    (void) connect(_link, &LogReplayLink::playbackAtEnd, this, &TLogAnalyzer::_playbackAtEnd);
+    (void) connect(_link, &LinkInterface::communicationError, this, &TLogAnalyzer::_communicationError);
+
+    qCInfo(TLogAnalyzerLog) << "Analyzing" << _logFilename << "duration secs:" << (_logIndex.durationUSecs() / 1000000) << "output:" << _logOutputDir.absolutePath();
+}
+
+void TLogAnalyzer::_dataReplayed(quint64 logTimeUSecs)
+{
+    if (logTimeUSecs < _nextSampleUSecs) {
+        return;
+    }
+
+    _sample(logTimeUSecs);
+
+    const quint64 startTimeUSecs = _logIndex.startTimeUSecs();
+    const quint64 elapsedUSecs = (logTimeUSecs > startTimeUSecs) ? (logTimeUSecs - startTimeUSecs) : 0;
+    _nextSampleUSecs = startTimeUSecs + (((elapsedUSecs / _intervalUSecs) + 1) * _intervalUSecs);
+}
+
+void TLogAnalyzer::_playbackAtEnd()
+{
+    if (_lastSampleUSecs < _logIndex.endTimeUSecs()) {
+        _sample(_logIndex.endTimeUSecs());
+    }
+
+    _finishLog(true);
+}
+
+void TLogAnalyzer::_communicationError(const QString &title, const QString &error)
+{
+    qCWarning(TLogAnalyzerLog) << title << error;
+    _finishLog(false);
+}
+
+void TLogAnalyzer::_sample(quint64 logTimeUSecs)
+{
+    _lastSampleUSecs = logTimeUSecs;
+
+    const double logTimeSecs = static_cast<double>(logTimeUSecs - _logIndex.startTimeUSecs()) / 1e6;
+    QmlObjectListModel *const vehicles = MultiVehicleManager::instance()->vehicles();
+    for (int i = 0; i < vehicles->count(); i++) {
+        Vehicle *const vehicle = qobject_cast<Vehicle*>(vehicles->get(i));
+        if (!vehicle) {
+            continue;
+        }
+
+        const QString vehicleName = QStringLiteral("vehicle%1").arg(vehicle->id());
+        _sampleGroup(vehicleName, QStringLiteral("vehicle"), vehicle, logTimeSecs);
+        for (const QString &groupName : vehicle->factGroupNames()) {
+            _sampleGroup(vehicleName, groupName, vehicle->getFactGroup(groupName), logTimeSecs);
+        }
+    }
+}
+
+void TLogAnalyzer::_sampleGroup(const QString &vehicleName, const QString &groupName, FactGroup *factGroup, double logTimeSecs)
+{
+    if (!factGroup) {
+        return;
+    }
+
+    GroupSeries *series = _series.value(vehicleName + QLatin1Char('/') + groupName);
+    if (!series) {
+        series = _openSeries(vehicleName, groupName, factGroup);
+    }
+
+    if (series->factGroup != factGroup) {
+        series->factGroup = factGroup;
+        series->facts.clear();
+        for (const QString &factName : series->factNames) {
+            series->facts.append(factGroup->getFact(factName));
+        }
+    }
+
+    series->stream << QString::number(logTimeSecs, 'f', 3);
+    for (qsizetype i = 0; i < series->facts.count(); i++) {
+        const Fact *const fact = series->facts[i];
+        series->stream << ',';
+        if (!fact) {
+            continue;
+        }
+
+        series->stream << _csvField(fact->cookedValueString());
+
+        bool ok = false;
+        const double value = fact->cookedValue().toDouble(&ok);
+        if (!ok || !qIsFinite(value)) {
+            continue;
+        }
+
+        FactStats &stats = series->stats[i];
+        if (stats.count == 0) {
+            stats.min = value;
+            stats.max = value;
+        } else {
+            stats.min = qMin(stats.min, value);
+            stats.max = qMax(stats.max, value);
+        }
+        stats.sum += value;
+        stats.count++;
+    }
+    series->stream << '\n';
+}
+
+TLogAnalyzer::GroupSeries *TLogAnalyzer::_openSeries(const QString &vehicleName, const QString &groupName, FactGroup *factGroup)
+{
+    GroupSeries *const series = new GroupSeries;
+    series->vehicleName = vehicleName;
+    series->groupName = groupName;
+    series->factNames = factGroup->factNames();
+    series->stats.resize(series->factNames.count());
+
+    (void) _logOutputDir.mkpath(vehicleName);
+    series->file.setFileName(_logOutputDir.filePath(QStringLiteral("%1/%2.csv").arg(vehicleName, groupName)));
+    if (!series->file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        qCWarning(TLogAnalyzerLog) << "Unable to create" << series->file.fileName() << series->file.errorString();
+    }
+    series->stream.setDevice(&series->file);
+
+    series->stream << "log_time_s";
+    for (const QString &factName : series->factNames) {
+        series->stream << ',' << factName;
+    }
+    series->stream << '\n';
+
+    _series.insert(vehicleName + QLatin1Char('/') + groupName, series);
+    _seriesOrder.append(series);
+
+    return series;
+}
+
+void TLogAnalyzer::_finishLog(bool success)
+{
+    if (_link) {
+        (void) disconnect(_link, nullptr, this, nullptr);
+        LinkManager::instance()->removeConfiguration(_link->linkConfiguration().get());
+        _link.clear();
+    }
+
+    if (success) {
+        success = _writeSummary() && _writeMessageCounts();
+    }
+
+    for (GroupSeries *series : _seriesOrder) {
+        series->stream.flush();
+        series->file.close();
+    }
+    qDeleteAll(_seriesOrder);
+    _seriesOrder.clear();
+    _series.clear();
+
+    if (success) {
+        qCInfo(TLogAnalyzerLog) << "Finished" << _logFilename;
+    } else {
+        _failedLogs++;
+    }
+
+    QTimer::singleShot(0, this, &TLogAnalyzer::_startNextLog);
+}
+
+bool TLogAnalyzer::_writeSummary()
+{
+    QSaveFile file(_logOutputDir.filePath(QStringLiteral("summary.csv")));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qCWarning(TLogAnalyzerLog) << "Unable to create" << file.fileName() << file.errorString();
+        return false;
+    }
+
+    QTextStream stream(&file);
+    stream.setRealNumberPrecision(10);
+    stream << "vehicle,group,fact,units,samples,min,max,mean\n";
+    for (const GroupSeries *series : _seriesOrder) {
+        for (qsizetype i = 0; i < series->factNames.count(); i++) {
+            const FactStats &stats = series->stats[i];
+            const Fact *const fact = (i < series->facts.count()) ? series->facts[i] : nullptr;
+            stream << series->vehicleName << ',' << series->groupName << ',' << series->factNames[i] << ',' << _csvField(fact ? fact->cookedUnits() : QString()) << ',' << stats.count;
+            if (stats.count > 0) {
+                stream << ',' << stats.min << ',' << stats.max << ',' << (stats.sum / static_cast<double>(stats.count));
+            } else {
+                stream << ",,,";
+            }
+            stream << '\n';
+        }
+    }
+    stream.flush();
+
+    return file.commit();
+}
+
+bool TLogAnalyzer::_writeMessageCounts()
+{
+    QSaveFile file(_logOutputDir.filePath(QStringLiteral("messages.csv")));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qCWarning(TLogAnalyzerLog) << "Unable to create" << file.fileName() << file.errorString();
+        return false;
+    }
+
+    const QHash<uint32_t, quint64> &messageCounts = _logIndex.messageCounts();
+    QList<uint32_t> msgIds = messageCounts.keys();
+    std::sort(msgIds.begin(), msgIds.end());
+
+    QTextStream stream(&file);
+    stream << "msgid,name,count\n";
+    for (const uint32_t msgId : msgIds) {
+        const mavlink_message_info_t *const msgInfo = mavlink_get_message_info_by_id(msgId);
+        stream << msgId << ',' << (msgInfo ? msgInfo->name : "") << ',' << messageCounts.value(msgId) << '\n';
+    }
+    stream.flush();
+
+    return file.commit();
+}
+
+QString TLogAnalyzer::_csvField(const QString &value)
+{
+    if (!value.contains(QLatin1Char(',')) && !value.contains(QLatin1Char('"')) && !value.contains(QLatin1Char('\n'))) {
+        return value;
+    }
+
+    QString quoted = value;
+    (void) quoted.replace(QLatin1Char('"'), QStringLiteral("\"\""));
+    return (QLatin1Char('"') + quoted + QLatin1Char('"'));
+}
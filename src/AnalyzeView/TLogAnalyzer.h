@@ -0,0 +1,102 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+
+#include "TLogIndex.h"
+
+class Fact;
+class FactGroup;
+class LogReplayLink;
+class Vehicle;
+
+Q_DECLARE_LOGGING_CATEGORY(TLogAnalyzerLog)
+
+/// Headless batch analysis of telemetry logs.
+/// Each log is replayed as fast as the vehicle can process it and every FactGroup of every vehicle is sampled at a
+/// fixed log time interval. The results are written to <outputDir>/<log name>/:
+///     vehicle<id>/<group>.csv     Time series of the group facts, first column is the log time in seconds
+///     summary.csv                 Sample count and min/max/mean of every numeric fact
+///     messages.csv                Number of messages per message id in the log
+class TLogAnalyzer : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// @param outputDir Results are written next to each log if empty
+    TLogAnalyzer(const QStringList &logFilenames, const QString &outputDir, uint intervalMSecs, QObject *parent = nullptr);
+    ~TLogAnalyzer();
+
+    /// Starts analyzing the logs once the event loop runs
+    void start();
+
+signals:
+    /// @param failedLogs Number of logs which could not be analyzed
+    void finished(int failedLogs);
+
+private slots:
+    void _startNextLog();
+    void _dataReplayed(quint64 logTimeUSecs);
+    void _playbackAtEnd();
+    void _communicationError(const QString &title, const QString &error);
+
+private:
+    struct FactStats {
+        quint64 count = 0;
+        double min = 0;
+        double max = 0;
+        double sum = 0;
+    };
+
+    struct GroupSeries {
+        QString vehicleName;
+        QString groupName;
+        QPointer<FactGroup> factGroup;
+        QStringList factNames;
+        QList<Fact*> facts;         ///< Resolved from factGroup, which is replaced if the vehicle reconnects
+        QList<FactStats> stats;
+        QFile file;
+        QTextStream stream;
+    };
+
+    void _sample(quint64 logTimeUSecs);
+    void _sampleGroup(const QString &vehicleName, const QString &groupName, FactGroup *factGroup, double logTimeSecs);
+    GroupSeries *_openSeries(const QString &vehicleName, const QString &groupName, FactGroup *factGroup);
+    void _finishLog(bool success);
+    bool _writeSummary();
+    bool _writeMessageCounts();
+    static QString _csvField(const QString &value);
+
+    const QStringList _logFilenames;
+    const QString _outputDir;
+    const quint64 _intervalUSecs;
+
+    qsizetype _nextLog = 0;
+    int _failedLogs = 0;
+
+    QString _logFilename;
+    QDir _logOutputDir;
+    TLogIndex _logIndex;
+    QPointer<LogReplayLink> _link;
+    quint64 _nextSampleUSecs = 0;
+    quint64 _lastSampleUSecs = 0;
+    QHash<QString, GroupSeries*> _series;
+    QList<GroupSeries*> _seriesOrder;
+
+    static constexpr int kVehicleRemovedPollMSecs = 100;
+};
@@ -10,6 +10,7 @@
 #include "BluetoothLink.h"
 
 #include "DeviceInfo.h"
+#include "LinkMetrics.h"
 #include "QGCLoggingCategory.h"
 
 #include <QtCore/QCoreApplication>
@@ -307,10 +308,11 @@ void BluetoothWorker::_onSocketDisconnected()
 
 void BluetoothWorker::_onSocketReadyRead()
 {
+    const qint64 readTimeNSecs = LinkMetrics::timestampNSecs();
     const QByteArray data = _socket->readAll();
     if (!data.isEmpty()) {
         // qCDebug(BluetoothLinkLog) << "_onSocketReadyRead:" << data.size();
-        emit dataReceived(data);
+        emit dataReceived(data, readTimeNSecs);
     }
 }
 
@@ -431,9 +433,9 @@ void BluetoothLink::_onErrorOccurred(const QString &errorString)
     emit communicationError(tr("Bluetooth Link Error"), tr("Link %1: (Device: %2) %3").arg(_bluetoothConfig->name(), _bluetoothConfig->device().name, errorString));
 }
 
-void BluetoothLink::_onDataReceived(const QByteArray &data)
+void BluetoothLink::_onDataReceived(const QByteArray &data, qint64 readTimeNSecs)
 {
-    emit bytesReceived(this, data);
+    _emitBytesReceived(data, readTimeNSecs);
 }
 
 void BluetoothLink::_onDataSent(const QByteArray &data)
@@ -38,6 +38,7 @@ LinkConfiguration::LinkConfiguration(const LinkConfiguration *copy, QObject *par
     , _dynamic(copy->isDynamic())
     , _autoConnect(copy->isAutoConnect())
     , _highLatency(copy->isHighLatency())
+    , _sendByteRate(copy->sendByteRate())
 {
     // qCDebug(AudioOutputLog) << Q_FUNC_INFO << this;
 
@@ -58,6 +59,7 @@ void LinkConfiguration::copyFrom(const LinkConfiguration *source)
     setDynamic(source->isDynamic());
     setAutoConnect(source->isAutoConnect());
     setHighLatency(source->isHighLatency());
+    setSendByteRate(source->sendByteRate());
 }
 
 LinkConfiguration *LinkConfiguration::createSettings(int type, const QString &name)
@@ -185,3 +187,12 @@ void LinkConfiguration::setHighLatency(bool hl)
         emit highLatencyChanged();
     }
 }
+
+void LinkConfiguration::setSendByteRate(qint64 sendByteRate)
+{
+    sendByteRate = qMax<qint64>(sendByteRate, 0);
+    if (sendByteRate != _sendByteRate) {
+        _sendByteRate = sendByteRate;
+        emit sendByteRateChanged();
+    }
+}
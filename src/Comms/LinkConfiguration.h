@@ -31,6 +31,7 @@ class LinkConfiguration : public QObject
     Q_PROPERTY(QString          settingsURL     READ settingsURL                            CONSTANT)
     Q_PROPERTY(QString          settingsTitle   READ settingsTitle                          CONSTANT)
     Q_PROPERTY(bool             highLatency     READ isHighLatency  WRITE setHighLatency    NOTIFY highLatencyChanged)
+    Q_PROPERTY(qint64           sendByteRate    READ sendByteRate   WRITE setSendByteRate   NOTIFY sendByteRateChanged)
 
 public:
     LinkConfiguration(const QString &name, QObject *parent = nullptr);
@@ -69,6 +70,11 @@ class LinkConfiguration : public QObject
     /// Set if this is this an High Latency configuration.
     void setHighLatency(bool hl = false);
 
+    /// Outbound bandwidth of the link in bytes per second, such as the air data rate of a telemetry radio.
+    ///     @return 0: use the link type default (the baud rate for serial links, otherwise unlimited)
+    qint64 sendByteRate() const { return _sendByteRate; }
+    void setSendByteRate(qint64 sendByteRate);
+
     /// Copy instance data, When manipulating data, you create a copy of the configuration using the copy constructor,
     /// edit it and then transfer its content to the original using this method.
     ///     @param[in] source The source instance (the edited copy)
@@ -134,6 +140,7 @@ class LinkConfiguration : public QObject
     void dynamicChanged();
     void autoConnectChanged();
     void highLatencyChanged();
+    void sendByteRateChanged();
 
 protected:
     std::weak_ptr<LinkInterface> _link; ///< Link currently using this configuration (if any)
@@ -144,6 +151,7 @@ class LinkConfiguration : public QObject
     bool _forwarding = false;  ///< Automatically added Mavlink forwarding connection
     bool _autoConnect = false; ///< This connection is started automatically at boot
     bool _highLatency = false;
+    qint64 _sendByteRate = 0;
 };
 
 typedef std::shared_ptr<LinkConfiguration> SharedLinkConfigurationPtr;
@@ -9,12 +9,15 @@
 
 #include "LinkInterface.h"
 #include "LinkManager.h"
+#include "LinkMetrics.h"
 #include "QGCApplication.h"
 #include "QGCLoggingCategory.h"
 #include "MAVLinkSigning.h"
 #include "SettingsManager.h"
 #include "MavlinkSettings.h"
 
+#include <QtCore/QThread>
+#include <QtCore/QTimer>
 #include <QtQml/QQmlEngine>
 
 QGC_LOGGING_CATEGORY(LinkInterfaceLog, "qgc.comms.linkinterface")
@@ -22,8 +25,16 @@ QGC_LOGGING_CATEGORY(LinkInterfaceLog, "qgc.comms.linkinterface")
 LinkInterface::LinkInterface(SharedLinkConfigurationPtr &config, QObject *parent)
     : QObject(parent)
     , _config(config)
+    , _metrics(new LinkMetrics(this))
+    , _sendTimer(new QTimer(this))
 {
     QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
+
+    _sendTimer->setSingleShot(true);
+    _sendTimer->setTimerType(Qt::PreciseTimer);
+    (void) connect(_sendTimer, &QTimer::timeout, this, &LinkInterface::_drainSendQueue);
+
+    (void) connect(_config.get(), &LinkConfiguration::sendByteRateChanged, this, &LinkInterface::_updateSendByteRate);
 }
 
 LinkInterface::~LinkInterface()
@@ -60,6 +71,7 @@ bool LinkInterface::initMavlinkSigning()
             } else {
                 qCDebug(LinkInterfaceLog) << "Signing enabled on channel" << _mavlinkChannel;
             }
+            emit signingChanged();
         } else {
             qCWarning(LinkInterfaceLog) << Q_FUNC_INFO << "Failed To enable Signing on channel" << _mavlinkChannel;
             // FIXME: What should we do here?
@@ -105,10 +117,48 @@ void LinkInterface::_freeMavlinkChannel()
     _mavlinkChannel = LinkManager::invalidMavlinkChannel();
 }
 
-void LinkInterface::writeBytesThreadSafe(const char *bytes, int length)
+void LinkInterface::writeBytesThreadSafe(const char *bytes, int length, LinkSendQueue::Priority priority)
 {
     const QByteArray data(bytes, length);
-    (void) QMetaObject::invokeMethod(this, "_writeBytes", Qt::AutoConnection, data);
+    if (!_sendQueue.enqueue(data, priority, LinkMetrics::timestampNSecs())) {
+        return;
+    }
+
+    if (QThread::currentThread() == thread()) {
+        _drainSendQueue();
+    } else if (!_drainScheduled.exchange(true)) {
+        (void) QMetaObject::invokeMethod(this, &LinkInterface::_drainSendQueue, Qt::QueuedConnection);
+    }
+}
+
+void LinkInterface::_drainSendQueue()
+{
+    _drainScheduled = false;
+
+    // The timer fires once the budget allows sending again
+    if (_sendTimer->isActive()) {
+        return;
+    }
+
+    QByteArray data;
+    qint64 retryNSecs = 0;
+    while (_sendQueue.dequeue(LinkMetrics::timestampNSecs(), data, retryNSecs)) {
+        _writeBytes(data);
+    }
+
+    if (retryNSecs > 0) {
+        _sendTimer->start(static_cast<int>((retryNSecs + 999999) / 1000000));
+    }
+}
+
+void LinkInterface::_updateSendByteRate()
+{
+    const qint64 configuredByteRate = _config->sendByteRate();
+    const qint64 byteRate = (configuredByteRate > 0) ? configuredByteRate : _defaultSendByteRate();
+    if (byteRate != _sendQueue.byteRate()) {
+        qCDebug(LinkInterfaceLog) << "Send byte rate" << _config->name() << byteRate;
+        _sendQueue.setByteRate(byteRate);
+    }
 }
 
 void LinkInterface::removeVehicleReference()
@@ -140,3 +190,8 @@ void LinkInterface::setSigningSignatureFailure(bool failure)
         }
     }
 }
+
+void LinkInterface::_emitBytesReceived(const QByteArray &data, qint64 readTimeNSecs)
+{
+    emit bytesReceived(this, data, readTimeNSecs);
+}
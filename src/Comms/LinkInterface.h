@@ -12,9 +12,14 @@
 #include <QtCore/QLoggingCategory>
 #include <QtQmlIntegration/QtQmlIntegration>
 
+#include <atomic>
+
 #include "LinkConfiguration.h"
+#include "LinkSendQueue.h"
 
 class LinkManager;
+class LinkMetrics;
+class QTimer;
 
 Q_DECLARE_LOGGING_CATEGORY(LinkInterfaceLog)
 
@@ -24,6 +29,8 @@ class LinkInterface : public QObject
     Q_OBJECT
     QML_ELEMENT
     QML_UNCREATABLE("")
+    Q_MOC_INCLUDE("LinkMetrics.h")
+    Q_PROPERTY(LinkMetrics *metrics READ metrics CONSTANT)
     friend class LinkManager;
 
 public:
@@ -41,17 +48,27 @@ class LinkInterface : public QObject
     bool mavlinkChannelIsSet() const;
     bool decodedFirstMavlinkPacket() const { return _decodedFirstMavlinkPacket; }
     void setDecodedFirstMavlinkPacket(bool decodedFirstMavlinkPacket) { _decodedFirstMavlinkPacket = decodedFirstMavlinkPacket; }
-    void writeBytesThreadSafe(const char *bytes, int length);
+    /// Queues the data for sending, higher priority data goes out first if the link is short on bandwidth
+    void writeBytesThreadSafe(const char *bytes, int length, LinkSendQueue::Priority priority = LinkSendQueue::PriorityRequest);
     void addVehicleReference() { ++_vehicleReferenceCount; }
     void removeVehicleReference();
     bool initMavlinkSigning();
     void setSigningSignatureFailure(bool failure);
 
+    /// Receive statistics, only accessed from the GUI thread
+    LinkMetrics *metrics() const { return _metrics; }
+
+    /// Outbound queue depth and wait time statistics
+    const LinkSendQueue &sendQueue() const { return _sendQueue; }
+
 signals:
-    void bytesReceived(LinkInterface *link, const QByteArray &data);
+    /// @param readTimeNSecs When the data was read from the device (see LinkMetrics::timestampNSecs), 0 if unknown
+    void bytesReceived(LinkInterface *link, const QByteArray &data, qint64 readTimeNSecs = 0);
     void bytesSent(LinkInterface *link, const QByteArray &data);
     void connected();
     void disconnected();
+    /// The signing state of the mavlink channel was (re)initialized
+    void signingChanged();
     void communicationError(const QString &title, const QString &error);
 
 protected:
@@ -66,12 +83,24 @@ class LinkInterface : public QObject
 
     void _connectionRemoved();
 
+    /// Byte rate the link can send at when the configuration doesn't specify one, 0 for unlimited
+    virtual qint64 _defaultSendByteRate() const { return 0; }
+
+    /// Applies the configured send byte rate, called by LinkManager once the link is connected
+    void _updateSendByteRate();
+
+    /// Emits bytesReceived for data which was read from the device at readTimeNSecs (see LinkMetrics::timestampNSecs)
+    void _emitBytesReceived(const QByteArray &data, qint64 readTimeNSecs);
+
     SharedLinkConfigurationPtr _config;
 
 private slots:
     /// Not thread safe if called directly, only writeBytesThreadSafe is thread safe
     virtual void _writeBytes(const QByteArray &bytes) = 0;
 
+    /// Sends queued data as the byte rate budget allows, runs on the link thread
+    void _drainSendQueue();
+
 private:
     /// connect is private since all links should be created through LinkManager::createConnectedLink calls
     virtual bool _connect() = 0;
@@ -80,6 +109,10 @@ private slots:
     bool _decodedFirstMavlinkPacket = false;
     int _vehicleReferenceCount = 0;
     bool _signingSignatureFailure = false;
+    LinkMetrics *_metrics = nullptr;
+    LinkSendQueue _sendQueue;
+    QTimer *_sendTimer = nullptr;               ///< Waits for the byte rate budget
+    std::atomic_bool _drainScheduled = false;
 };
 
 typedef std::shared_ptr<LinkInterface> SharedLinkInterfacePtr;
@@ -9,6 +9,7 @@
 
 #include "LinkManager.h"
 #include "DeviceInfo.h"
+#include "LinkMetrics.h"
 #include "LogReplayLink.h"
 #include "MAVLinkProtocol.h"
 #include "MultiVehicleManager.h"
@@ -50,6 +51,8 @@
 #endif
 
 #include <QtCore/QApplicationStatic>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QSaveFile>
 #include <QtCore/QTimer>
 
 QGC_LOGGING_CATEGORY(LinkManagerLog, "qgc.comms.linkmanager")
@@ -160,20 +163,23 @@ bool LinkManager::createConnectedLink(SharedLinkConfigurationPtr &config)
     config->setLink(link);
 
     (void) connect(link.get(), &LinkInterface::communicationError, this, &LinkManager::_communicationError);
-    (void) connect(link.get(), &LinkInterface::bytesReceived, MAVLinkProtocol::instance(), &MAVLinkProtocol::receiveBytes);
     (void) connect(link.get(), &LinkInterface::bytesSent, MAVLinkProtocol::instance(), &MAVLinkProtocol::logSentBytes);
     (void) connect(link.get(), &LinkInterface::disconnected, this, &LinkManager::_linkDisconnected);
 
+    MAVLinkProtocol::instance()->addLink(link.get());
     MAVLinkProtocol::instance()->resetMetadataForLink(link.get());
     MAVLinkProtocol::instance()->setVersion(MAVLinkProtocol::instance()->getCurrentVersion());
 
     if (!link->_connect()) {
+        MAVLinkProtocol::instance()->removeLink(link.get());
         link->_freeMavlinkChannel();
         _rgLinks.removeAt(_rgLinks.indexOf(link));
         config->setLink(nullptr);
         return false;
     }
 
+    link->_updateSendByteRate();
+
     return true;
 }
 
@@ -223,10 +229,10 @@ void LinkManager::_linkDisconnected()
     }
 
     (void) disconnect(link, &LinkInterface::communicationError, qgcApp(), &QGCApplication::showAppMessage);
-    (void) disconnect(link, &LinkInterface::bytesReceived, MAVLinkProtocol::instance(), &MAVLinkProtocol::receiveBytes);
     (void) disconnect(link, &LinkInterface::bytesSent, MAVLinkProtocol::instance(), &MAVLinkProtocol::logSentBytes);
     (void) disconnect(link, &LinkInterface::disconnected, this, &LinkManager::_linkDisconnected);
 
+    MAVLinkProtocol::instance()->removeLink(link);
     link->_freeMavlinkChannel();
 
     for (auto it = _rgLinks.begin(); it != _rgLinks.end(); ++it) {
@@ -282,6 +288,7 @@ void LinkManager::saveLinkConfigurationList()
         settings.setValue(root + "/type", linkConfig->type());
         settings.setValue(root + "/auto", linkConfig->isAutoConnect());
         settings.setValue(root + "/high_latency", linkConfig->isHighLatency());
+        settings.setValue(root + "/send_byte_rate", linkConfig->sendByteRate());
         linkConfig->saveSettings(settings, root);
     }
 
@@ -361,6 +368,7 @@ void LinkManager::loadLinkConfigurationList()
                 link->setAutoConnect(autoConnect);
                 const bool highLatency = settings.value(root + "/high_latency").toBool();
                 link->setHighLatency(highLatency);
+                link->setSendByteRate(settings.value(root + "/send_byte_rate", 0).toLongLong());
                 link->loadSettings(settings, root);
                 addConfiguration(link);
             }
@@ -716,11 +724,13 @@ void LinkManager::freeMavlinkChannel(uint8_t channel)
     _mavlinkChannelsUsedBitMask &= ~(1 << channel);
 }
 
-LogReplayLink *LinkManager::startLogReplay(const QString &logFile)
+LogReplayLink *LinkManager::startLogReplay(const QString &logFile, bool fastReplay)
 {
     LogReplayConfiguration* const linkConfig = new LogReplayConfiguration(tr("Log Replay"));
     linkConfig->setLogFilename(logFile);
     linkConfig->setName(linkConfig->logFilenameShort());
+    linkConfig->setFastReplay(fastReplay);
+    linkConfig->setDynamic(fastReplay);
 
     SharedLinkConfigurationPtr sharedConfig = addConfiguration(linkConfig);
     if (createConnectedLink(sharedConfig)) {
@@ -730,6 +740,30 @@ LogReplayLink *LinkManager::startLogReplay(const QString &logFile)
     return nullptr;
 }
 
+QJsonObject LinkManager::linkMetricsJson() const
+{
+    QJsonObject json;
+    for (const SharedLinkInterfacePtr &link : _rgLinks) {
+        QJsonObject linkJson = link->metrics()->toJson();
+        linkJson[QStringLiteral("sendQueue")] = link->sendQueue().toJson();
+        json[link->linkConfiguration()->name()] = linkJson;
+    }
+
+    return json;
+}
+
+bool LinkManager::saveLinkMetrics(const QString &filename) const
+{
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(LinkManagerLog) << "Unable to write link metrics" << filename << file.errorString();
+        return false;
+    }
+
+    (void) file.write(QJsonDocument(linkMetricsJson()).toJson());
+    return file.commit();
+}
+
 void LinkManager::_createDynamicForwardLink(const char *linkName, const QString &hostName)
 {
     UDPConfiguration* const udpConfig = new UDPConfiguration(linkName);
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <QtCore/QJsonObject>
 #include <QtCore/QList>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QStringList>
@@ -70,7 +71,15 @@ class LinkManager : public QObject
     Q_INVOKABLE void createMavlinkForwardingSupportLink();
     /// Called to signal app shutdown. Disconnects all links while turning off auto-connect.
     Q_INVOKABLE void shutdown();
-    Q_INVOKABLE LogReplayLink *startLogReplay(const QString &logFile);
+    /// @param fastReplay Replay as fast as the data can be processed, see LogReplayConfiguration::fastReplay
+    Q_INVOKABLE LogReplayLink *startLogReplay(const QString &logFile, bool fastReplay = false);
+
+    /// Receive statistics for all links keyed by link name, see LinkMetrics
+    Q_INVOKABLE QJsonObject linkMetricsJson() const;
+
+    /// Writes linkMetricsJson() to a file
+    ///     @return false: File could not be written
+    Q_INVOKABLE bool saveLinkMetrics(const QString &filename) const;
 
     QList<SharedLinkInterfacePtr> links() { return _rgLinks; }
     QStringList linkTypeStrings() const;
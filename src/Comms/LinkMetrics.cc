@@ -0,0 +1,227 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "LinkMetrics.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QTimer>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+
+QGC_LOGGING_CATEGORY(LinkMetricsLog, "qgc.comms.linkmetrics")
+
+LinkMetrics::LinkMetrics(QObject *parent)
+    : QObject(parent)
+    , _updateTimer(new QTimer(this))
+{
+    // qCDebug(LinkMetricsLog) << Q_FUNC_INFO << this;
+
+    _lastUpdateNSecs = timestampNSecs();
+
+    _updateTimer->setInterval(kUpdateIntervalMSecs);
+    (void) connect(_updateTimer, &QTimer::timeout, this, &LinkMetrics::_updateRates);
+    _updateTimer->start();
+}
+
+LinkMetrics::~LinkMetrics()
+{
+    // qCDebug(LinkMetricsLog) << Q_FUNC_INFO << this;
+}
+
+qint64 LinkMetrics::timestampNSecs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void LinkMetrics::recordBytes(qsizetype bytes)
+{
+    _bytesReceived += static_cast<quint64>(bytes);
+}
+
+void LinkMetrics::recordMessage(const mavlink_message_t &message, quint32 lost, bool superseded, qint64 readTimeNSecs, qint64 dispatchStartNSecs, qint64 dispatchEndNSecs)
+{
+    _messagesReceived++;
+    if (superseded) {
+        _messagesSuperseded++;
+    }
+    _sequenceGaps += lost;
+
+    const bool mavlink1 = (message.magic == MAVLINK_STX_MAVLINK1);
+    const qsizetype headerLength = mavlink1 ? (MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1) : (MAVLINK_CORE_HEADER_LEN + 1);
+    const qsizetype signatureLength = (!mavlink1 && (message.incompat_flags & MAVLINK_IFLAG_SIGNED)) ? MAVLINK_SIGNATURE_BLOCK_LEN : 0;
+
+    MessageStats &stats = _messageStats[messageKey(message.sysid, message.compid, message.msgid)];
+    stats.count++;
+    if (superseded) {
+        stats.superseded++;
+    }
+    stats.bytes += static_cast<quint64>(headerLength + message.len + MAVLINK_NUM_CHECKSUM_BYTES + signatureLength);
+
+    if (stats.lastArrivalNSecs != 0) {
+        stats.arrivalHistogram[arrivalBucket(readTimeNSecs - stats.lastArrivalNSecs)]++;
+    }
+    stats.lastArrivalNSecs = readTimeNSecs;
+
+    const qint64 latencyNSecs = dispatchEndNSecs - readTimeNSecs;
+    stats.latencyTotalNSecs += latencyNSecs;
+    stats.latencyMaxNSecs = qMax(stats.latencyMaxNSecs, latencyNSecs);
+
+    const qint64 dispatchNSecs = dispatchEndNSecs - dispatchStartNSecs;
+    stats.dispatchTotalNSecs += dispatchNSecs;
+    stats.dispatchMaxNSecs = qMax(stats.dispatchMaxNSecs, dispatchNSecs);
+
+    _intervalLatencyTotalNSecs += latencyNSecs;
+    _intervalLatencyMaxNSecs = qMax(_intervalLatencyMaxNSecs, latencyNSecs);
+    _intervalLatencyCount++;
+}
+
+void LinkMetrics::recordDecodeErrors(uint32_t crcErrors, uint32_t signatureErrors, uint32_t parseErrors)
+{
+    _crcErrors += crcErrors;
+    _signatureErrors += signatureErrors;
+    _parseErrors += parseErrors;
+}
+
+int LinkMetrics::arrivalBucket(qint64 intervalNSecs)
+{
+    const quint64 intervalMSecs = static_cast<quint64>(qMax<qint64>(intervalNSecs, 0)) / 1000000;
+    return qMin(static_cast<int>(std::bit_width(intervalMSecs)), kIntervalBuckets - 1);
+}
+
+void LinkMetrics::_updateRates()
+{
+    const qint64 nowNSecs = timestampNSecs();
+    const double elapsedSecs = static_cast<double>(nowNSecs - _lastUpdateNSecs) / 1e9;
+    _lastUpdateNSecs = nowNSecs;
+    if (elapsedSecs <= 0) {
+        return;
+    }
+
+    _messageRate = static_cast<double>(_messagesReceived - _intervalStartMessages) / elapsedSecs;
+    _byteRate = static_cast<double>(_bytesReceived - _intervalStartBytes) / elapsedSecs;
+    _intervalStartMessages = _messagesReceived;
+    _intervalStartBytes = _bytesReceived;
+
+    _latencyAvgMSecs = (_intervalLatencyCount > 0) ? ((static_cast<double>(_intervalLatencyTotalNSecs) / _intervalLatencyCount) / 1e6) : 0;
+    _latencyMaxMSecs = static_cast<double>(_intervalLatencyMaxNSecs) / 1e6;
+    _intervalLatencyTotalNSecs = 0;
+    _intervalLatencyMaxNSecs = 0;
+    _intervalLatencyCount = 0;
+
+    for (MessageStats &stats : _messageStats) {
+        stats.rate = static_cast<double>(stats.count - stats.intervalStartCount) / elapsedSecs;
+        stats.byteRate = static_cast<double>(stats.bytes - stats.intervalStartBytes) / elapsedSecs;
+        stats.intervalStartCount = stats.count;
+        stats.intervalStartBytes = stats.bytes;
+    }
+
+    emit updated();
+}
+
+void LinkMetrics::reset()
+{
+    _lastUpdateNSecs = timestampNSecs();
+
+    _messagesReceived = 0;
+    _messagesSuperseded = 0;
+    _bytesReceived = 0;
+    _intervalStartMessages = 0;
+    _intervalStartBytes = 0;
+    _messageRate = 0;
+    _byteRate = 0;
+
+    _crcErrors = 0;
+    _signatureErrors = 0;
+    _parseErrors = 0;
+    _sequenceGaps = 0;
+
+    _intervalLatencyTotalNSecs = 0;
+    _intervalLatencyMaxNSecs = 0;
+    _intervalLatencyCount = 0;
+    _latencyAvgMSecs = 0;
+    _latencyMaxMSecs = 0;
+
+    _messageStats.clear();
+
+    emit updated();
+}
+
+QVariantList LinkMetrics::messages() const
+{
+    QVariantList messageList;
+
+    const QJsonArray messageArray = toJson().value(QStringLiteral("messages")).toArray();
+    messageList.reserve(messageArray.count());
+    for (const QJsonValue &message : messageArray) {
+        messageList.append(message.toObject().toVariantMap());
+    }
+
+    return messageList;
+}
+
+QJsonObject LinkMetrics::toJson() const
+{
+    QList<quint64> keys = _messageStats.keys();
+    std::sort(keys.begin(), keys.end());
+
+    QJsonArray messageArray;
+    for (const quint64 key : keys) {
+        messageArray.append(_messageJson(key, _messageStats[key]));
+    }
+
+    QJsonObject json;
+    json[QStringLiteral("messagesReceived")] = static_cast<qint64>(_messagesReceived);
+    json[QStringLiteral("messagesSuperseded")] = static_cast<qint64>(_messagesSuperseded);
+    json[QStringLiteral("bytesReceived")] = static_cast<qint64>(_bytesReceived);
+    json[QStringLiteral("messageRate")] = _messageRate;
+    json[QStringLiteral("byteRate")] = _byteRate;
+    json[QStringLiteral("crcErrors")] = static_cast<qint64>(_crcErrors);
+    json[QStringLiteral("signatureErrors")] = static_cast<qint64>(_signatureErrors);
+    json[QStringLiteral("parseErrors")] = static_cast<qint64>(_parseErrors);
+    json[QStringLiteral("sequenceGaps")] = static_cast<qint64>(_sequenceGaps);
+    json[QStringLiteral("latencyAvgMSecs")] = _latencyAvgMSecs;
+    json[QStringLiteral("latencyMaxMSecs")] = _latencyMaxMSecs;
+    json[QStringLiteral("messages")] = messageArray;
+
+    return json;
+}
+
+QJsonObject LinkMetrics::_messageJson(quint64 key, const MessageStats &stats)
+{
+    const uint32_t msgid = static_cast<uint32_t>(key & 0xFFFFFF);
+    const mavlink_message_info_t *const msgInfo = mavlink_get_message_info_by_id(msgid);
+
+    QJsonArray histogram;
+    for (const quint32 bucket : stats.arrivalHistogram) {
+        histogram.append(static_cast<qint64>(bucket));
+    }
+
+    const double count = static_cast<double>(qMax<quint64>(stats.count, 1));
+
+    QJsonObject json;
+    json[QStringLiteral("sysid")] = static_cast<int>((key >> 32) & 0xFF);
+    json[QStringLiteral("compid")] = static_cast<int>((key >> 24) & 0xFF);
+    json[QStringLiteral("msgid")] = static_cast<qint64>(msgid);
+    json[QStringLiteral("name")] = msgInfo ? QString::fromLatin1(msgInfo->name) : QString::number(msgid);
+    json[QStringLiteral("count")] = static_cast<qint64>(stats.count);
+    json[QStringLiteral("superseded")] = static_cast<qint64>(stats.superseded);
+    json[QStringLiteral("bytes")] = static_cast<qint64>(stats.bytes);
+    json[QStringLiteral("rate")] = stats.rate;
+    json[QStringLiteral("byteRate")] = stats.byteRate;
+    json[QStringLiteral("latencyAvgMSecs")] = (static_cast<double>(stats.latencyTotalNSecs) / count) / 1e6;
+    json[QStringLiteral("latencyMaxMSecs")] = static_cast<double>(stats.latencyMaxNSecs) / 1e6;
+    json[QStringLiteral("dispatchAvgMSecs")] = (static_cast<double>(stats.dispatchTotalNSecs) / count) / 1e6;
+    json[QStringLiteral("dispatchMaxMSecs")] = static_cast<double>(stats.dispatchMaxNSecs) / 1e6;
+    json[QStringLiteral("arrivalHistogram")] = histogram;
+
+    return json;
+}
@@ -0,0 +1,137 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QObject>
+#include <QtCore/QVariantList>
+#include <QtQmlIntegration/QtQmlIntegration>
+
+#include <array>
+
+#include "MAVLinkLib.h"
+
+class QTimer;
+
+Q_DECLARE_LOGGING_CATEGORY(LinkMetricsLog)
+
+/// Receive statistics for a single link.
+/// Tracks totals and rates for the link as a whole and for each (sysid, compid, msgid), decode errors, sequence gaps
+/// per sending component, message inter-arrival histograms and the latency from the time the data was read from the
+/// device until the message was dispatched to the vehicle. Rates and the link latency cover the last update interval.
+/// All recording happens on the GUI thread as decoded messages are dispatched. Messages superseded by a newer copy in
+/// the same batch are dispatched like any other and counted apart, since the Vehicle FactGroups skip them.
+class LinkMetrics : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("")
+    Q_PROPERTY(quint64      messagesReceived    READ messagesReceived   NOTIFY updated)
+    Q_PROPERTY(quint64      bytesReceived       READ bytesReceived      NOTIFY updated)
+    Q_PROPERTY(double       messageRate         READ messageRate        NOTIFY updated)
+    Q_PROPERTY(double       byteRate            READ byteRate           NOTIFY updated)
+    Q_PROPERTY(quint64      crcErrors           READ crcErrors          NOTIFY updated)
+    Q_PROPERTY(quint64      signatureErrors     READ signatureErrors    NOTIFY updated)
+    Q_PROPERTY(quint64      parseErrors         READ parseErrors        NOTIFY updated)
+    Q_PROPERTY(quint64      sequenceGaps        READ sequenceGaps       NOTIFY updated)
+    Q_PROPERTY(double       latencyAvgMSecs     READ latencyAvgMSecs    NOTIFY updated)
+    Q_PROPERTY(double       latencyMaxMSecs     READ latencyMaxMSecs    NOTIFY updated)
+    Q_PROPERTY(QVariantList messages            READ messages           NOTIFY updated)
+
+public:
+    static constexpr int kIntervalBuckets = 12;     ///< Bucket 0 is < 1ms, bucket n is [2^(n-1), 2^n) ms, the last is open ended
+    static constexpr int kUpdateIntervalMSecs = 1000;
+
+    struct MessageStats {
+        quint64 count = 0;
+        quint64 superseded = 0;                     ///< Followed by a newer copy in the same batch
+        quint64 bytes = 0;
+        double rate = 0;                            ///< Messages per second over the last update interval
+        double byteRate = 0;
+        quint64 intervalStartCount = 0;
+        quint64 intervalStartBytes = 0;
+        qint64 lastArrivalNSecs = 0;
+        std::array<quint32, kIntervalBuckets> arrivalHistogram{};
+        qint64 latencyTotalNSecs = 0;               ///< Device read until the end of dispatch
+        qint64 latencyMaxNSecs = 0;
+        qint64 dispatchTotalNSecs = 0;              ///< Time spent processing the message on the receive thread
+        qint64 dispatchMaxNSecs = 0;
+    };
+
+    explicit LinkMetrics(QObject *parent = nullptr);
+    ~LinkMetrics();
+
+    /// Monotonic clock used for all timestamps
+    static qint64 timestampNSecs();
+
+    static quint64 messageKey(uint8_t sysid, uint8_t compid, uint32_t msgid) { return ((static_cast<quint64>(sysid) << 32) | (static_cast<quint64>(compid) << 24) | msgid); }
+
+    void recordBytes(qsizetype bytes);
+
+    /// @param lost Messages lost from the sending component before it
+    /// @param superseded A newer copy of the message follows in the same batch
+    void recordMessage(const mavlink_message_t &message, quint32 lost, bool superseded, qint64 readTimeNSecs, qint64 dispatchStartNSecs, qint64 dispatchEndNSecs);
+    void recordDecodeErrors(uint32_t crcErrors, uint32_t signatureErrors, uint32_t parseErrors);
+
+    quint64 messagesReceived() const { return _messagesReceived; }
+    quint64 messagesSuperseded() const { return _messagesSuperseded; }
+    quint64 bytesReceived() const { return _bytesReceived; }
+    double messageRate() const { return _messageRate; }
+    double byteRate() const { return _byteRate; }
+    quint64 crcErrors() const { return _crcErrors; }
+    quint64 signatureErrors() const { return _signatureErrors; }
+    quint64 parseErrors() const { return _parseErrors; }
+    quint64 sequenceGaps() const { return _sequenceGaps; }
+    double latencyAvgMSecs() const { return _latencyAvgMSecs; }
+    double latencyMaxMSecs() const { return _latencyMaxMSecs; }
+    QVariantList messages() const;
+
+    const QHash<quint64, MessageStats> &messageStats() const { return _messageStats; }
+
+    Q_INVOKABLE QJsonObject toJson() const;
+    Q_INVOKABLE void reset();
+
+    static int arrivalBucket(qint64 intervalNSecs);
+
+signals:
+    void updated();
+
+private slots:
+    void _updateRates();
+
+private:
+    static QJsonObject _messageJson(quint64 key, const MessageStats &stats);
+
+    QTimer *_updateTimer = nullptr;
+    qint64 _lastUpdateNSecs = 0;
+
+    quint64 _messagesReceived = 0;
+    quint64 _messagesSuperseded = 0;
+    quint64 _bytesReceived = 0;
+    quint64 _intervalStartMessages = 0;
+    quint64 _intervalStartBytes = 0;
+    double _messageRate = 0;
+    double _byteRate = 0;
+
+    quint64 _crcErrors = 0;
+    quint64 _signatureErrors = 0;
+    quint64 _parseErrors = 0;
+    quint64 _sequenceGaps = 0;
+
+    qint64 _intervalLatencyTotalNSecs = 0;
+    qint64 _intervalLatencyMaxNSecs = 0;
+    quint64 _intervalLatencyCount = 0;
+    double _latencyAvgMSecs = 0;
+    double _latencyMaxMSecs = 0;
+
+    QHash<quint64, MessageStats> _messageStats;
+};
@@ -0,0 +1,225 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "LinkSendQueue.h"
+#include "MAVLinkLib.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QJsonArray>
+
+QGC_LOGGING_CATEGORY(LinkSendQueueLog, "qgc.comms.linksendqueue")
+
+LinkSendQueue::Priority LinkSendQueue::priorityForMessage(uint32_t msgid)
+{
+    switch (msgid) {
+    case MAVLINK_MSG_ID_HEARTBEAT:
+    case MAVLINK_MSG_ID_MANUAL_CONTROL:
+    case MAVLINK_MSG_ID_RC_CHANNELS_OVERRIDE:
+    case MAVLINK_MSG_ID_SET_POSITION_TARGET_LOCAL_NED:
+    case MAVLINK_MSG_ID_SET_POSITION_TARGET_GLOBAL_INT:
+    case MAVLINK_MSG_ID_SET_ATTITUDE_TARGET:
+        return PriorityControl;
+    case MAVLINK_MSG_ID_COMMAND_LONG:
+    case MAVLINK_MSG_ID_COMMAND_INT:
+    case MAVLINK_MSG_ID_COMMAND_ACK:
+    case MAVLINK_MSG_ID_COMMAND_CANCEL:
+    case MAVLINK_MSG_ID_SET_MODE:
+    case MAVLINK_MSG_ID_MISSION_SET_CURRENT:
+        return PriorityCommand;
+    case MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL:
+    case MAVLINK_MSG_ID_PARAM_REQUEST_LIST:
+    case MAVLINK_MSG_ID_PARAM_REQUEST_READ:
+    case MAVLINK_MSG_ID_PARAM_SET:
+    case MAVLINK_MSG_ID_MISSION_COUNT:
+    case MAVLINK_MSG_ID_MISSION_REQUEST_LIST:
+    case MAVLINK_MSG_ID_MISSION_REQUEST_INT:
+    case MAVLINK_MSG_ID_MISSION_ITEM_INT:
+    case MAVLINK_MSG_ID_MISSION_ACK:
+    case MAVLINK_MSG_ID_LOG_REQUEST_LIST:
+    case MAVLINK_MSG_ID_LOG_REQUEST_DATA:
+    case MAVLINK_MSG_ID_GPS_RTCM_DATA:
+    case MAVLINK_MSG_ID_GPS_INJECT_DATA:
+    case MAVLINK_MSG_ID_TERRAIN_DATA:
+        return PriorityBulk;
+    default:
+        return PriorityRequest;
+    }
+}
+
+QString LinkSendQueue::priorityName(Priority priority)
+{
+    switch (priority) {
+    case PriorityControl:
+        return QStringLiteral("control");
+    case PriorityCommand:
+        return QStringLiteral("command");
+    case PriorityRequest:
+        return QStringLiteral("request");
+    case PriorityBulk:
+        return QStringLiteral("bulk");
+    default:
+        return QString::number(priority);
+    }
+}
+
+void LinkSendQueue::setByteRate(qint64 bytesPerSecond)
+{
+    QMutexLocker locker(&_mutex);
+
+    _byteRate = qMax<qint64>(bytesPerSecond, 0);
+    _tokens = static_cast<double>(_burstBytes());
+    _lastRefillNSecs = 0;
+}
+
+qint64 LinkSendQueue::byteRate() const
+{
+    QMutexLocker locker(&_mutex);
+
+    return _byteRate;
+}
+
+bool LinkSendQueue::enqueue(const QByteArray &data, Priority priority, qint64 nowNSecs)
+{
+    Q_ASSERT((priority >= 0) && (priority < PriorityCount));
+
+    QMutexLocker locker(&_mutex);
+
+    Stats &stats = _stats[priority];
+    if ((static_cast<qint64>(stats.queuedBytes) + data.size()) > kMaxQueuedBytes) {
+        stats.dropped++;
+        qCDebug(LinkSendQueueLog) << "Queue full, dropping" << priorityName(priority) << data.size() << "bytes";
+        return false;
+    }
+
+    _queues[priority].enqueue({ data, nowNSecs });
+    stats.queued++;
+    stats.queuedBytes += static_cast<quint64>(data.size());
+    stats.maxQueued = qMax(stats.maxQueued, stats.queued);
+
+    return true;
+}
+
+bool LinkSendQueue::dequeue(qint64 nowNSecs, QByteArray &data, qint64 &retryNSecs)
+{
+    QMutexLocker locker(&_mutex);
+
+    retryNSecs = 0;
+
+    int priority = 0;
+    while ((priority < PriorityCount) && _queues[priority].isEmpty()) {
+        priority++;
+    }
+    if (priority == PriorityCount) {
+        return false;
+    }
+
+    if (_byteRate > 0) {
+        _refill(nowNSecs);
+        if (_tokens < 1.0) {
+            retryNSecs = qMax<qint64>(static_cast<qint64>(((1.0 - _tokens) * 1e9) / static_cast<double>(_byteRate)), 1);
+            return false;
+        }
+    }
+
+    const Entry entry = _queues[priority].dequeue();
+    data = entry.data;
+
+    // Anything larger than the budget still goes out, which puts the budget into debt until it has been paid off
+    if (_byteRate > 0) {
+        _tokens -= static_cast<double>(data.size());
+    }
+
+    Stats &stats = _stats[priority];
+    const qint64 waitNSecs = qMax<qint64>(nowNSecs - entry.enqueueNSecs, 0);
+    stats.queued--;
+    stats.queuedBytes -= static_cast<quint64>(data.size());
+    stats.sent++;
+    stats.sentBytes += static_cast<quint64>(data.size());
+    stats.waitTotalNSecs += waitNSecs;
+    stats.waitMaxNSecs = qMax(stats.waitMaxNSecs, waitNSecs);
+
+    return true;
+}
+
+void LinkSendQueue::_refill(qint64 nowNSecs)
+{
+    if (_lastRefillNSecs != 0) {
+        const qint64 elapsedNSecs = qMax<qint64>(nowNSecs - _lastRefillNSecs, 0);
+        _tokens += (static_cast<double>(elapsedNSecs) * static_cast<double>(_byteRate)) / 1e9;
+    }
+    _tokens = qMin(_tokens, static_cast<double>(_burstBytes()));
+    _lastRefillNSecs = nowNSecs;
+}
+
+qint64 LinkSendQueue::_burstBytes() const
+{
+    return qMax<qint64>((_byteRate * kBurstMSecs) / 1000, MAVLINK_MAX_PACKET_LEN);
+}
+
+bool LinkSendQueue::isEmpty() const
+{
+    QMutexLocker locker(&_mutex);
+
+    for (const QQueue<Entry> &queue : _queues) {
+        if (!queue.isEmpty()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+LinkSendQueue::Stats LinkSendQueue::stats(Priority priority) const
+{
+    Q_ASSERT((priority >= 0) && (priority < PriorityCount));
+
+    QMutexLocker locker(&_mutex);
+
+    return _stats[priority];
+}
+
+QJsonObject LinkSendQueue::toJson() const
+{
+    QMutexLocker locker(&_mutex);
+
+    QJsonArray priorityArray;
+    for (int priority = 0; priority < PriorityCount; priority++) {
+        const Stats &stats = _stats[priority];
+        const double sent = static_cast<double>(qMax<quint64>(stats.sent, 1));
+
+        QJsonObject json;
+        json[QStringLiteral("priority")] = priorityName(static_cast<Priority>(priority));
+        json[QStringLiteral("queued")] = static_cast<qint64>(stats.queued);
+        json[QStringLiteral("queuedBytes")] = static_cast<qint64>(stats.queuedBytes);
+        json[QStringLiteral("maxQueued")] = static_cast<qint64>(stats.maxQueued);
+        json[QStringLiteral("sent")] = static_cast<qint64>(stats.sent);
+        json[QStringLiteral("sentBytes")] = static_cast<qint64>(stats.sentBytes);
+        json[QStringLiteral("dropped")] = static_cast<qint64>(stats.dropped);
+        json[QStringLiteral("waitAvgMSecs")] = (static_cast<double>(stats.waitTotalNSecs) / sent) / 1e6;
+        json[QStringLiteral("waitMaxMSecs")] = static_cast<double>(stats.waitMaxNSecs) / 1e6;
+        priorityArray.append(json);
+    }
+
+    QJsonObject json;
+    json[QStringLiteral("byteRate")] = _byteRate;
+    json[QStringLiteral("priorities")] = priorityArray;
+
+    return json;
+}
+
+void LinkSendQueue::clear()
+{
+    QMutexLocker locker(&_mutex);
+
+    for (int priority = 0; priority < PriorityCount; priority++) {
+        _queues[priority].clear();
+        _stats[priority].queued = 0;
+        _stats[priority].queuedBytes = 0;
+    }
+}
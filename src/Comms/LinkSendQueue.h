@@ -0,0 +1,96 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QMutex>
+#include <QtCore/QQueue>
+
+#include <array>
+#include <cstdint>
+
+Q_DECLARE_LOGGING_CATEGORY(LinkSendQueueLog)
+
+/// Outbound queue for a single link.
+/// Data is queued in one of four priority classes and always taken from the highest priority class with data waiting.
+/// If the link has a byte rate budget data is only taken while the budget allows it, so data which does not fit is held
+/// here instead of in the device buffers. That way control traffic only ever waits for the single message already sent
+/// ahead of it rather than for everything a bulk transfer has queued. Enqueue is thread safe, dequeue is expected to be
+/// called from the link thread only.
+class LinkSendQueue
+{
+public:
+    enum Priority {
+        PriorityControl,    ///< Heartbeats and manual control, must not wait behind anything else
+        PriorityCommand,    ///< Commands and their acks
+        PriorityRequest,    ///< Telemetry and other requests, the default
+        PriorityBulk,       ///< Parameter, mission, FTP, log and RTCM transfers
+        PriorityCount
+    };
+
+    struct Stats {
+        quint64 queued = 0;             ///< Messages currently waiting
+        quint64 queuedBytes = 0;
+        quint64 maxQueued = 0;
+        quint64 sent = 0;
+        quint64 sentBytes = 0;
+        quint64 dropped = 0;            ///< Messages refused because the queue was full
+        qint64 waitTotalNSecs = 0;      ///< Time from enqueue until dequeue for all sent messages
+        qint64 waitMaxNSecs = 0;
+    };
+
+    static constexpr qint64 kMaxQueuedBytes = 256 * 1024;  ///< Per priority class
+    static constexpr qint64 kBurstMSecs = 20;                ///< Budget which can build up while the link is idle
+
+    LinkSendQueue() = default;
+
+    /// Picks the priority class for an outgoing message
+    static Priority priorityForMessage(uint32_t msgid);
+
+    static QString priorityName(Priority priority);
+
+    /// @param bytesPerSecond 0: unlimited
+    void setByteRate(qint64 bytesPerSecond);
+    qint64 byteRate() const;
+
+    /// @param nowNSecs see LinkMetrics::timestampNSecs
+    /// @return false: queue for this priority is full, data was dropped
+    bool enqueue(const QByteArray &data, Priority priority, qint64 nowNSecs);
+
+    /// Takes the next data to send if the byte rate budget allows it
+    ///     @param[out] retryNSecs When nothing was taken: time until the budget allows the next data, 0 if the queue is empty
+    ///     @return false: nothing to send now
+    bool dequeue(qint64 nowNSecs, QByteArray &data, qint64 &retryNSecs);
+
+    bool isEmpty() const;
+    Stats stats(Priority priority) const;
+    QJsonObject toJson() const;
+
+    /// Drops everything still queued, counters are kept
+    void clear();
+
+private:
+    struct Entry {
+        QByteArray data;
+        qint64 enqueueNSecs = 0;
+    };
+
+    void _refill(qint64 nowNSecs);
+    qint64 _burstBytes() const;
+
+    mutable QMutex _mutex;
+    std::array<QQueue<Entry>, PriorityCount> _queues;
+    std::array<Stats, PriorityCount> _stats{};
+    qint64 _byteRate = 0;
+    double _tokens = 0;                 ///< Available budget in bytes, may go negative after a large write
+    qint64 _lastRefillNSecs = 0;
+};
@@ -9,12 +9,12 @@
 
 #include "LogReplayLink.h"
 #include "LinkManager.h"
+#include "MAVLinkLib.h"
 #include "MAVLinkProtocol.h"
 #include "MultiVehicleManager.h"
 #include "QGCLoggingCategory.h"
 
 #include <QtCore/QFileInfo>
-#include <QtCore/QtEndian>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
 
@@ -31,6 +31,7 @@ LogReplayConfiguration::LogReplayConfiguration(const QString &name, QObject *par
 LogReplayConfiguration::LogReplayConfiguration(const LogReplayConfiguration *copy, QObject *parent)
     : LinkConfiguration(copy, parent)
     , _logFilename(copy->logFilename())
+    , _fastReplay(copy->fastReplay())
 {
     // qCDebug(LogReplayLinkLog) << Q_FUNC_INFO << this;
 }
@@ -49,6 +50,7 @@ void LogReplayConfiguration::copyFrom(const LinkConfiguration *source)
     Q_ASSERT(logReplaySource);
 
     setLogFilename(logReplaySource->logFilename());
+    setFastReplay(logReplaySource->fastReplay());
 }
 
 void LogReplayConfiguration::loadSettings(QSettings &settings, const QString &root)
@@ -140,6 +142,7 @@ void LogReplayWorker::disconnectFromLog()
     emit disconnected();
 
     _readTickTimer->stop();
+    _closeLogFile();
 }
 
 bool LogReplayWorker::isPlaying() const
@@ -152,7 +155,7 @@ void LogReplayWorker::play()
     LinkManager::instance()->setConnectionsSuspended(tr("Connect not allowed during Flight Data replay."));
     MAVLinkProtocol::instance()->suspendLogForReplay(true);
 
-    if (_logFile.atEnd()) {
+    if (_atEnd()) {
         _resetPlaybackToBeginning();
     }
 
@@ -191,73 +194,115 @@ void LogReplayWorker::movePlayhead(qreal percentComplete)
     }
 
     percentComplete = qBound(0., percentComplete, 100.);
-    const qreal percentCompleteMult = percentComplete / 100.0;
-    const qint64 newFilePos = static_cast<qint64>(percentCompleteMult * static_cast<qreal>(_logFile.size()));
-    if (!_logFile.seek(newFilePos)) {
-        emit errorOccurred(tr("Unable to seek to new position"));
-        return;
-    }
-
-    mavlink_message_t dummy{};
-    _logCurrentTimeUSecs = _seekToNextMavlinkMessage(dummy);
+    const quint64 desiredTimeUSecs = _logStartTimeUSecs + static_cast<quint64>((percentComplete / 100.0) * _logDurationUSecs);
+    const TLogIndex::Entry entry = _logIndex.entryForTimestamp(desiredTimeUSecs);
 
-    qreal newRelativeTimeUSecs = static_cast<qreal>(_logCurrentTimeUSecs - _logStartTimeUSecs);
-    const qreal baudRate = _logFile.size() / static_cast<qreal>(_logDurationUSecs) / 1e6;
-    const qreal desiredTimeUSecs = percentCompleteMult * _logDurationUSecs;
-    const qint64 offset = (newRelativeTimeUSecs - desiredTimeUSecs) * baudRate;
-    if (!_logFile.seek(_logFile.pos() + offset)) {
-        emit errorOccurred(tr("Unable to seek to new position"));
-        return;
-    }
+    _logPos = entry.offset;
+    _logCurrentTimeUSecs = entry.timestampUSecs;
 
-    _logCurrentTimeUSecs = _seekToNextMavlinkMessage(dummy);
     _signalCurrentLogTimeSecs();
-
-    newRelativeTimeUSecs = static_cast<qreal>(_logCurrentTimeUSecs - _logStartTimeUSecs);
-    percentComplete = ((newRelativeTimeUSecs / _logDurationUSecs) * 100);
-    emit playbackPercentCompleteChanged(percentComplete);
+    _signalPercentComplete();
 }
 
 void LogReplayWorker::_resetPlaybackToBeginning()
 {
-    if (_logFile.isOpen()) {
-        if (!_logFile.reset()) {
-            qCWarning(LogReplayLinkLog) << "failed to reset log file:" << _logFile.error() << _logFile.errorString();
-        }
-    }
-
+    _logPos = 0;
     _playbackStartTimeMSecs = 0;
     _playbackStartLogTimeUSecs = 0;
     _logCurrentTimeUSecs = _logStartTimeUSecs;
 }
 
+/// Sends all records which are due within the next few msecs as a single batch straight out of the mapped log
 void LogReplayWorker::_readNextLogEntry()
 {
-    int timeToNextExecutionMSecs = 0;
-    while (timeToNextExecutionMSecs < 3) {
-        QByteArray bytes;
-        bytes.reserve(_logFile.bytesAvailable());
-        const qint64 nextTimeUSecs = _readNextMavlinkMessage(bytes);
-        emit dataReceived(bytes);
-        emit playbackPercentCompleteChanged((static_cast<float>(_logCurrentTimeUSecs - _logStartTimeUSecs) / static_cast<float>(_logDurationUSecs)) * 100);
-
-        if (_logFile.atEnd()) {
-            pause();
-            emit playbackAtEnd();
-            return;
+    if (_logReplayConfig->fastReplay()) {
+        _readNextFastReplayBatch();
+        return;
+    }
+
+    const qint64 currentTimeMSecs = QDateTime::currentMSecsSinceEpoch();
+
+    QByteArray bytes;
+    qint64 timeToNextExecutionMSecs = 0;
+    qsizetype frameLength = 0;
+    while (TLogIndex::findRecord(_logData, _logFileSize, _logPos, frameLength)) {
+        const quint64 timestampUSecs = TLogIndex::parseTimestamp(reinterpret_cast<const char*>(_logData + _logPos));
+        const qint64 playheadMovementUSecs = static_cast<qint64>(timestampUSecs - _playbackStartLogTimeUSecs);
+        const qint64 desiredTimeMSecs = static_cast<qint64>(_playbackStartTimeMSecs) + static_cast<qint64>((playheadMovementUSecs / 1000) / _playbackSpeed);
+        timeToNextExecutionMSecs = desiredTimeMSecs - currentTimeMSecs;
+        if ((timeToNextExecutionMSecs >= kMinTickMSecs) || (bytes.size() >= kMaxBatchBytes)) {
+            break;
+        }
+
+        if (bytes.isEmpty()) {
+            bytes.reserve(kMaxBatchBytes + MAVLINK_MAX_PACKET_LEN);
         }
+        (void) bytes.append(reinterpret_cast<const char*>(_logData + _logPos + TLogIndex::kTimestampSize), frameLength);
 
-        _logCurrentTimeUSecs = nextTimeUSecs;
+        _logCurrentTimeUSecs = timestampUSecs;
+        _logPos += TLogIndex::kTimestampSize + frameLength;
+    }
 
-        const quint64 currentTimeMSecs = static_cast<quint64>(QDateTime::currentMSecsSinceEpoch());
-        const quint64 desiredPlayheadMovementTimeMSecs = ((_logCurrentTimeUSecs - _playbackStartLogTimeUSecs) / 1000) / _playbackSpeed;
-        const quint64 desiredCurrentTimeMSecs = _playbackStartTimeMSecs + desiredPlayheadMovementTimeMSecs;
-        timeToNextExecutionMSecs = desiredCurrentTimeMSecs - currentTimeMSecs;
+    if (!bytes.isEmpty()) {
+        _sendBatch(bytes);
     }
 
-    _signalCurrentLogTimeSecs();
+    if (frameLength == 0) {
+        _logPos = _logFileSize;
+        pause();
+        emit playbackAtEnd();
+        return;
+    }
+
+    _readTickTimer->start(static_cast<int>(qMax<qint64>(timeToNextExecutionMSecs, 0)));
+}
+
+/// Sends the log without wall clock pacing. Each batch covers a fixed slice of log time so consumers can sample
+/// by log time, and only a few batches are queued to the link at once to keep memory bounded.
+void LogReplayWorker::_readNextFastReplayBatch()
+{
+    if (_pendingBatches.load(std::memory_order_relaxed) >= kMaxPendingBatches) {
+        _readTickTimer->start(1);
+        return;
+    }
+
+    QByteArray bytes;
+    quint64 batchEndUSecs = 0;
+    qsizetype frameLength = 0;
+    while (TLogIndex::findRecord(_logData, _logFileSize, _logPos, frameLength)) {
+        const quint64 timestampUSecs = TLogIndex::parseTimestamp(reinterpret_cast<const char*>(_logData + _logPos));
+        if (bytes.isEmpty()) {
+            bytes.reserve(kMaxBatchBytes + MAVLINK_MAX_PACKET_LEN);
+            batchEndUSecs = timestampUSecs + kFastReplayBatchUSecs;
+        } else if ((timestampUSecs >= batchEndUSecs) || (bytes.size() >= kMaxBatchBytes)) {
+            break;
+        }
+        (void) bytes.append(reinterpret_cast<const char*>(_logData + _logPos + TLogIndex::kTimestampSize), frameLength);
+
+        _logCurrentTimeUSecs = timestampUSecs;
+        _logPos += TLogIndex::kTimestampSize + frameLength;
+    }
+
+    if (!bytes.isEmpty()) {
+        _sendBatch(bytes);
+    }
+
+    if (frameLength == 0) {
+        _logPos = _logFileSize;
+        pause();
+        emit playbackAtEnd();
+        return;
+    }
 
-    _readTickTimer->start(timeToNextExecutionMSecs);
+    _readTickTimer->start(0);
+}
+
+void LogReplayWorker::_sendBatch(const QByteArray &bytes)
+{
+    (void) _pendingBatches.fetch_add(1, std::memory_order_relaxed);
+    emit dataReceived(bytes, _logCurrentTimeUSecs);
+    _signalPercentComplete();
+    _signalCurrentLogTimeSecs();
 }
 
 void LogReplayWorker::_signalCurrentLogTimeSecs()
@@ -265,10 +310,15 @@ void LogReplayWorker::_signalCurrentLogTimeSecs()
     emit currentLogTimeSecs((_logCurrentTimeUSecs - _logStartTimeUSecs) / 1000000);
 }
 
+void LogReplayWorker::_signalPercentComplete()
+{
+    emit playbackPercentCompleteChanged((static_cast<qreal>(_logCurrentTimeUSecs - _logStartTimeUSecs) / static_cast<qreal>(_logDurationUSecs)) * 100);
+}
+
 bool LogReplayWorker::_loadLogFile()
 {
     if (_logFile.isOpen()) {
-        _logFile.close();
+        _closeLogFile();
         emit errorOccurred(tr("Attempt to load new log while log being played"));
         return false;
     }
@@ -280,26 +330,26 @@ bool LogReplayWorker::_loadLogFile()
         return false;
     }
 
-    QFileInfo logFileInfo;
-    logFileInfo.setFile(logFilename);
-    _logFileSize = logFileInfo.size();
+    _logFileSize = _logFile.size();
+    _logData = _logFile.map(0, _logFileSize);
+    if (!_logData) {
+        qCDebug(LogReplayLinkLog) << "Unable to map log file, reading it into memory:" << _logFile.errorString();
+        _logBuffer = _logFile.readAll();
+        _logData = reinterpret_cast<const uchar*>(_logBuffer.constData());
+        _logFileSize = _logBuffer.size();
+    }
 
-    const quint64 startTimeUSecs = _parseTimestamp(_logFile.read(kTimestamp));
-    const quint64 endTimeUSecs = _findLastTimestamp();
-    if (endTimeUSecs <= startTimeUSecs) {
-        _logFile.close();
+    if (!_logIndex.load(logFilename) || (_logIndex.endTimeUSecs() <= _logIndex.startTimeUSecs())) {
+        _closeLogFile();
         emit errorOccurred(tr("The log file '%1' is corrupt or empty.").arg(logFilename));
         return false;
     }
 
-    _logEndTimeUSecs = endTimeUSecs;
-    _logStartTimeUSecs = startTimeUSecs;
-    _logDurationUSecs = endTimeUSecs - startTimeUSecs;
-    _logCurrentTimeUSecs = startTimeUSecs;
-
-    if (!_logFile.reset()) {
-        qCWarning(LogReplayLinkLog) << "failed to reset log file:" << _logFile.error() << _logFile.errorString();
-    }
+    _logEndTimeUSecs = _logIndex.endTimeUSecs();
+    _logStartTimeUSecs = _logIndex.startTimeUSecs();
+    _logDurationUSecs = _logEndTimeUSecs - _logStartTimeUSecs;
+    _logCurrentTimeUSecs = _logStartTimeUSecs;
+    _logPos = 0;
 
     const quint64 logDurationSecondsTotal = _logDurationUSecs / 1000000;
     emit logFileStats(logDurationSecondsTotal);
@@ -307,92 +357,17 @@ bool LogReplayWorker::_loadLogFile()
     return true;
 }
 
-quint64 LogReplayWorker::_parseTimestamp(const QByteArray &bytes)
-{
-    const quint64 currentTimestamp = static_cast<quint64>(QDateTime::currentMSecsSinceEpoch()) * 1000;
-    quint64 timestamp = qFromBigEndian(*reinterpret_cast<const quint64*>(bytes.constData()));
-    if (timestamp > currentTimestamp) {
-        timestamp = qbswap(timestamp);
-    }
-
-    return timestamp;
-}
-
-quint64 LogReplayWorker::_readNextMavlinkMessage(QByteArray &bytes)
-{
-    bytes.clear();
-
-    char nextByte;
-    while (_logFile.getChar(&nextByte)) {
-        mavlink_message_t message{};
-        mavlink_status_t status{};
-        const bool messageFound = mavlink_parse_char(_mavlinkChannel, nextByte, &message, &status);
-
-        if (status.parse_state == MAVLINK_PARSE_STATE_GOT_STX) {
-            bytes.clear();
-        }
-        (void) bytes.append(nextByte);
-
-        if (messageFound) {
-            const QByteArray rawTime = _logFile.read(kTimestamp);
-            return _parseTimestamp(rawTime);
-        }
-    }
-
-    return 0;
-}
-
-quint64 LogReplayWorker::_seekToNextMavlinkMessage(mavlink_message_t &nextMsg)
-{
-    mavlink_reset_channel_status(_mavlinkChannel);
-
-    qint64 messageStartPos = -1;
-    char nextByte;
-    while (_logFile.getChar(&nextByte)) {
-        mavlink_status_t status{};
-        const bool messageFound = mavlink_parse_char(_mavlinkChannel, nextByte, &nextMsg, &status);
-
-        if (status.parse_state == MAVLINK_PARSE_STATE_GOT_STX) {
-            messageStartPos = _logFile.pos() - 1;
-        }
-
-        if (messageFound && (messageStartPos != -1)) {
-            if (!_logFile.seek(messageStartPos - kTimestamp)) {
-                qCWarning(LogReplayLinkLog) << "Failed to seek next message:" << _logFile.error() << _logFile.errorString();
-                break;
-            }
-
-            const QByteArray rawTime = _logFile.read(kTimestamp);
-            return _parseTimestamp(rawTime);
-        }
-    }
-
-    return 0;
-}
-
-quint64 LogReplayWorker::_findLastTimestamp()
+void LogReplayWorker::_closeLogFile()
 {
-    if (!_logFile.reset()) {
-        qCWarning(LogReplayLinkLog) << "failed to reset log file:" << _logFile.error() << _logFile.errorString();
-    }
-
-    mavlink_reset_channel_status(_mavlinkChannel);
-
-    quint64 lastTimestamp = 0;
-
-    while (_logFile.bytesAvailable() > kTimestamp) {
-        lastTimestamp = _parseTimestamp(_logFile.read(kTimestamp));
-
-        bool endOfMessage = false;
-        char nextByte;
-        while (!endOfMessage && _logFile.getChar(&nextByte)) {
-            mavlink_message_t msg{};
-            mavlink_status_t status{};
-            endOfMessage = mavlink_parse_char(_mavlinkChannel, nextByte, &msg, &status);
-        }
+    if (_logData && _logBuffer.isEmpty()) {
+        (void) _logFile.unmap(const_cast<uchar*>(_logData));
     }
 
-    return lastTimestamp;
+    _logData = nullptr;
+    _logBuffer.clear();
+    _logFileSize = 0;
+    _logPos = 0;
+    _logFile.close();
 }
 
 /*===========================================================================*/
@@ -455,9 +430,11 @@ void LogReplayLink::_onErrorOccurred(const QString &errorString)
     emit communicationError(tr("Log Replay Link Error"), tr("Link: %1, %2.").arg(_logReplayConfig->name(), errorString));
 }
 
-void LogReplayLink::_onDataReceived(const QByteArray &data)
+void LogReplayLink::_onDataReceived(const QByteArray &data, quint64 logTimeUSecs)
 {
     emit bytesReceived(this, data);
+    _worker->batchConsumed();
+    emit dataReplayed(logTimeUSecs);
 }
 
 void LogReplayLink::play()
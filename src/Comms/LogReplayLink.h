@@ -13,13 +13,14 @@
 #include <QtCore/QLoggingCategory>
 #include <QtQmlIntegration/QtQmlIntegration>
 
+#include <atomic>
+
 #include "LinkConfiguration.h"
 #include "LinkInterface.h"
+#include "TLogIndex.h"
 
 class QTimer;
 
-typedef struct __mavlink_message mavlink_message_t;
-
 Q_DECLARE_LOGGING_CATEGORY(LogReplayLinkLog)
 
 /*===========================================================================*/
@@ -47,11 +48,16 @@ class LogReplayConfiguration : public LinkConfiguration
     QString logFilename() const { return _logFilename; }
     void setLogFilename(const QString &logFilename);
 
+    /// Replays the log as fast as it can be processed instead of in real time. Not saved to settings.
+    bool fastReplay() const { return _fastReplay; }
+    void setFastReplay(bool fastReplay) { _fastReplay = fastReplay; }
+
 signals:
     void filenameChanged();
 
 private:
     QString _logFilename;
+    bool _fastReplay = false;
 };
 
 /*===========================================================================*/
@@ -67,11 +73,15 @@ class LogReplayWorker : public QObject
     bool isConnected() const { return _isConnected; }
     bool isPlaying() const;
 
+    /// Called by the link once a batch has been handed on. Thread safe.
+    void batchConsumed() { (void) _pendingBatches.fetch_sub(1, std::memory_order_relaxed); }
+
 signals:
     void connected();
     void disconnected();
     void errorOccurred(const QString &errorString);
-    void dataReceived(const QByteArray &data);
+    /// @param logTimeUSecs Timestamp of the last record in data
+    void dataReceived(const QByteArray &data, quint64 logTimeUSecs);
     void logFileStats(uint32_t logDurationSecs);
     void playbackStarted();
     void playbackPaused();
@@ -90,21 +100,21 @@ public slots:
 
 private slots:
     void _readNextLogEntry();
+    void _readNextFastReplayBatch();
 
 private:
-    quint64 _parseTimestamp(const QByteArray &bytes);
-    quint64 _seekToNextMavlinkMessage(mavlink_message_t &nextMsg);
-    quint64 _findLastTimestamp();
-    quint64 _readNextMavlinkMessage(QByteArray &bytes);
     bool _loadLogFile();
+    void _closeLogFile();
     void _resetPlaybackToBeginning();
     void _signalCurrentLogTimeSecs();
+    void _signalPercentComplete();
+    bool _atEnd() const { return (_logPos >= _logFileSize); }
+    void _sendBatch(const QByteArray &bytes);
 
     const LogReplayConfiguration *_logReplayConfig = nullptr;
     QTimer *_readTickTimer = nullptr;
 
     bool _isConnected = false;
-    uint8_t _mavlinkChannel = 0;
 
     quint64 _logCurrentTimeUSecs = 0;
     quint64 _logStartTimeUSecs = 0;
@@ -116,9 +126,17 @@ private slots:
     quint64 _playbackStartLogTimeUSecs = 0;
 
     QFile _logFile;
-    quint64 _logFileSize = 0;
-
-    static constexpr size_t kTimestamp = sizeof(quint64);
+    const uchar *_logData = nullptr;    ///< Mapped log file contents
+    QByteArray _logBuffer;              ///< Holds the log contents if the file can't be mapped
+    qint64 _logFileSize = 0;
+    qint64 _logPos = 0;                 ///< Offset of the next record to replay
+    TLogIndex _logIndex;
+    std::atomic<int> _pendingBatches = 0;   ///< Batches sent which the link has not handed on yet
+
+    static constexpr int kMinTickMSecs = 3;                 ///< Records due within this time are sent in the current tick
+    static constexpr qsizetype kMaxBatchBytes = 64 * 1024;  ///< Limits the data sent per tick when replay falls behind
+    static constexpr quint64 kFastReplayBatchUSecs = 100000;///< Log time covered by a single fast replay batch
+    static constexpr int kMaxPendingBatches = 4;            ///< Fast replay waits for the link once this many batches are queued
 };
 
 /*===========================================================================*/
@@ -149,12 +167,15 @@ class LogReplayLink : public LinkInterface
     void playbackPercentCompleteChanged(qreal percentComplete);
     void currentLogTimeSecs(uint32_t secs);
 
+    /// Emitted after all data up to the log time has been passed on through bytesReceived
+    void dataReplayed(quint64 logTimeUSecs);
+
 private slots:
     void _writeBytes(const QByteArray &bytes) override { Q_UNUSED(bytes); }
     void _onConnected() { emit connected(); }
     void _onDisconnected() { emit disconnected(); }
     void _onErrorOccurred(const QString &errorString);
-    void _onDataReceived(const QByteArray &data);
+    void _onDataReceived(const QByteArray &data, quint64 logTimeUSecs);
 
 private:
     bool _connect() override;
@@ -0,0 +1,273 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkDecodeWorker.h"
+#include "LinkMetrics.h"
+#include "MAVLinkFrameDecoder.h"
+#include "MAVLinkProtocol.h"
+#include "MAVLinkSigning.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QTimer>
+
+#include <cstring>
+
+QGC_LOGGING_CATEGORY(MAVLinkDecodeWorkerLog, "qgc.comms.mavlinkdecodeworker")
+
+MAVLinkDecodeWorker::MAVLinkDecodeWorker(LinkInterface *link, uint8_t channel, bool forwardingLink, bool coalesce, quint64 generation, QObject *parent)
+    : QObject(parent)
+    , _link(link)
+    , _forwardingLink(forwardingLink)
+    , _coalesce(coalesce)
+    , _generation(generation)
+    , _deliveryTimer(new QTimer(this))
+{
+    // qCDebug(MAVLinkDecodeWorkerLog) << Q_FUNC_INFO << this;
+
+    (void) qRegisterMetaType<MAVLinkDecodedBatch>("MAVLinkDecodedBatch");
+
+    setSigning(MAVLinkSigning::channelSigning(static_cast<mavlink_channel_t>(channel)));
+
+    _deliveryTimer->setSingleShot(true);
+    (void) connect(_deliveryTimer, &QTimer::timeout, this, &MAVLinkDecodeWorker::_deliver);
+    _sinceDelivery.start();
+}
+
+MAVLinkDecodeWorker::~MAVLinkDecodeWorker()
+{
+    // qCDebug(MAVLinkDecodeWorkerLog) << Q_FUNC_INFO << this;
+}
+
+bool MAVLinkDecodeWorker::isCoalescable(uint32_t msgid)
+{
+    // Only streams where each message replaces the previous state of its instance
+    switch (msgid) {
+    case MAVLINK_MSG_ID_ALTITUDE:
+    case MAVLINK_MSG_ID_ATTITUDE:
+    case MAVLINK_MSG_ID_ATTITUDE_QUATERNION:
+    case MAVLINK_MSG_ID_ATTITUDE_TARGET:
+    case MAVLINK_MSG_ID_GLOBAL_POSITION_INT:
+    case MAVLINK_MSG_ID_HIGHRES_IMU:
+    case MAVLINK_MSG_ID_LOCAL_POSITION_NED:
+    case MAVLINK_MSG_ID_NAV_CONTROLLER_OUTPUT:
+    case MAVLINK_MSG_ID_POSITION_TARGET_GLOBAL_INT:
+    case MAVLINK_MSG_ID_POSITION_TARGET_LOCAL_NED:
+    case MAVLINK_MSG_ID_RAW_IMU:
+    case MAVLINK_MSG_ID_RC_CHANNELS:
+    case MAVLINK_MSG_ID_RC_CHANNELS_RAW:
+    case MAVLINK_MSG_ID_SCALED_IMU:
+    case MAVLINK_MSG_ID_SCALED_IMU2:
+    case MAVLINK_MSG_ID_SCALED_IMU3:
+    case MAVLINK_MSG_ID_SCALED_PRESSURE:
+    case MAVLINK_MSG_ID_SCALED_PRESSURE2:
+    case MAVLINK_MSG_ID_SCALED_PRESSURE3:
+    case MAVLINK_MSG_ID_SERVO_OUTPUT_RAW:
+    case MAVLINK_MSG_ID_VFR_HUD:
+    case MAVLINK_MSG_ID_VIBRATION:
+        return true;
+    default:
+        return false;
+    }
+}
+
+quint64 MAVLinkDecodeWorker::coalesceKey(const mavlink_message_t &message)
+{
+    quint64 instance = 0;
+    switch (message.msgid) {
+    case MAVLINK_MSG_ID_HIGHRES_IMU:
+        instance = mavlink_msg_highres_imu_get_id(&message);
+        break;
+    case MAVLINK_MSG_ID_SERVO_OUTPUT_RAW:
+        instance = mavlink_msg_servo_output_raw_get_port(&message);
+        break;
+    default:
+        break;
+    }
+
+    return ((instance << 40) | LinkMetrics::messageKey(message.sysid, message.compid, message.msgid));
+}
+
+void MAVLinkDecodeWorker::receiveBytes(LinkInterface *link, const QByteArray &data, qint64 readTimeNSecs)
+{
+    Q_UNUSED(link);
+
+    if (readTimeNSecs == 0) {
+        readTimeNSecs = LinkMetrics::timestampNSecs();
+    }
+
+    decode(data, readTimeNSecs, _pending);
+
+    if (!_coalesce || _pendingUrgent || (_sinceDelivery.elapsed() >= kDeliveryIntervalMSecs)) {
+        _deliver();
+    } else if (!_deliveryTimer->isActive()) {
+        _deliveryTimer->start(kDeliveryIntervalMSecs - static_cast<int>(_sinceDelivery.elapsed()));
+    }
+}
+
+void MAVLinkDecodeWorker::decode(const QByteArray &data, qint64 readTimeNSecs, MAVLinkDecodedBatch &batch)
+{
+    batch.bytes += data.size();
+
+    MAVLinkProtocol *const mavlinkProtocol = MAVLinkProtocol::instance();
+
+    // Settings are picked up once per chunk instead of once per message
+    const std::shared_ptr<const MAVLinkProtocol::ForwardingState> forwarding = _forwardingLink ? nullptr : mavlinkProtocol->forwardingState();
+
+    MAVLinkFrameDecoder decoder(&_status, &_rxBuffer, data);
+    mavlink_message_t message{};
+    while (decoder.next(message)) {
+        const uint32_t lost = _updateCounters(message);
+        if ((_totalReceived % 31) == 0) {
+            batch.statusSysid = message.sysid;
+        }
+
+        if (forwarding && (message.msgid != MAVLINK_MSG_ID_SETUP_SIGNING)) {
+            _appendForwardFrame(decoder, message, *forwarding);
+        }
+        mavlinkProtocol->logMessage(message);
+
+        if (_coalesce && isCoalescable(message.msgid)) {
+            // The older copy is still delivered for consumers which need every message, like the inspector
+            const quint64 key = coalesceKey(message);
+            const auto it = _coalescedIndex.find(key);
+            if (it != _coalescedIndex.end()) {
+                batch.messages[it.value()].superseded = true;
+                it.value() = batch.messages.size();
+            } else {
+                (void) _coalescedIndex.insert(key, batch.messages.size());
+            }
+        } else {
+            _pendingUrgent = true;
+        }
+
+        batch.messages.append({message, readTimeNSecs, lost});
+    }
+
+    if (forwarding) {
+        _flushForwardFrames(*forwarding);
+    }
+
+    batch.crcErrors += decoder.crcErrors();
+    batch.signatureErrors += decoder.signatureErrors();
+    batch.parseErrors += decoder.parseErrors();
+    batch.totalReceived = _totalReceived;
+    batch.totalLost = _totalLost;
+    batch.lossPercent = _runningLossPercent;
+}
+
+/// Frames for every active forwarding link go to _forwardAll, frames which only passed the forwarding filter go to
+/// _forwardFiltered. The received bytes are passed on unchanged, only frames the byte-wise parser reassembled from
+/// several chunks have to be serialized again.
+void MAVLinkDecodeWorker::_appendForwardFrame(const MAVLinkFrameDecoder &decoder, const mavlink_message_t &message, const MAVLinkProtocol::ForwardingState &forwarding)
+{
+    QByteArrayView frame = decoder.frame();
+    uint8_t buf[MAVLINK_MAX_PACKET_LEN];
+    if (frame.isEmpty()) {
+        frame = QByteArrayView(buf, mavlink_msg_to_send_buffer(buf, &message));
+    }
+
+    if (((_forwardAll.size() + frame.size()) > kMaxForwardWriteBytes) || ((_forwardFiltered.size() + frame.size()) > kMaxForwardWriteBytes)) {
+        _flushForwardFrames(forwarding);
+    }
+
+    if (_forwardFilterActive(forwarding)) {
+        if (forwarding.filter.matches(message.sysid, message.compid, message.msgid)) {
+            (void) _forwardFiltered.append(frame);
+        }
+        if (forwarding.support) {
+            (void) _forwardAll.append(frame);
+        }
+    } else {
+        (void) _forwardAll.append(frame);
+    }
+}
+
+void MAVLinkDecodeWorker::_flushForwardFrames(const MAVLinkProtocol::ForwardingState &forwarding)
+{
+    MAVLinkProtocol::instance()->forwardFrames(_forwardFilterActive(forwarding) ? _forwardFiltered : _forwardAll, _forwardAll);
+
+    // Keeps the capacity for the next chunk
+    _forwardAll.resize(0);
+    _forwardFiltered.resize(0);
+}
+
+void MAVLinkDecodeWorker::_deliver()
+{
+    if (_pending.messages.isEmpty() && (_pending.bytes == 0)) {
+        return;
+    }
+
+    if (_batchesInFlight.load(std::memory_order_acquire) > 0) {
+        // Keep accumulating until the receiver has caught up
+        if (!_deliveryTimer->isActive()) {
+            _deliveryTimer->start(kDeliveryIntervalMSecs);
+        }
+        return;
+    }
+
+    (void) _batchesInFlight.fetch_add(1, std::memory_order_acq_rel);
+    _pending.generation = _generation;
+    emit batchDecoded(_link, _pending);
+
+    _pending = MAVLinkDecodedBatch();
+    _coalescedIndex.clear();
+    _pendingUrgent = false;
+    _deliveryTimer->stop();
+    (void) _sinceDelivery.restart();
+}
+
+void MAVLinkDecodeWorker::reset()
+{
+    (void) memset(_lastSeq, 0, sizeof(_lastSeq));
+    (void) memset(_seqSeen, 0, sizeof(_seqSeen));
+    _totalReceived = 0;
+    _totalLost = 0;
+    _runningLossPercent = 0;
+}
+
+void MAVLinkDecodeWorker::setSigning(const std::optional<mavlink_signing_t> &signing)
+{
+    if (!signing) {
+        _status.signing = nullptr;
+        _status.signing_streams = nullptr;
+        return;
+    }
+
+    // Stream timestamps are kept so replayed frames are still rejected after a key update
+    _signing = *signing;
+    _status.signing = &_signing;
+    _status.signing_streams = &_signingStreams;
+}
+
+uint32_t MAVLinkDecodeWorker::_updateCounters(const mavlink_message_t &message)
+{
+    _totalReceived++;
+
+    uint8_t &lastSeq = _lastSeq[message.sysid][message.compid];
+    bool &seqSeen = _seqSeen[message.sysid][message.compid];
+
+    uint8_t expectedSeq;
+    if (!seqSeen) {
+        seqSeen = true;
+        expectedSeq = message.seq;
+    } else {
+        expectedSeq = lastSeq + 1;
+    }
+
+    // Wraps around modulo 256
+    const uint32_t lostMessages = static_cast<uint8_t>(message.seq - expectedSeq);
+    _totalLost += lostMessages;
+    lastSeq = message.seq;
+
+    const uint64_t totalSent = _totalReceived + _totalLost;
+    const float currentLossPercent = (static_cast<double>(_totalLost) / totalSent) * 100.0f;
+    _runningLossPercent = (currentLossPercent + _runningLossPercent) * 0.5f;
+
+    return lostMessages;
+}
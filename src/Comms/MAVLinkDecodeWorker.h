@@ -0,0 +1,143 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QObject>
+
+#include <atomic>
+#include <optional>
+
+#include "MAVLinkLib.h"
+#include "MAVLinkProtocol.h"
+
+class LinkInterface;
+class MAVLinkFrameDecoder;
+class QTimer;
+
+Q_DECLARE_LOGGING_CATEGORY(MAVLinkDecodeWorkerLog)
+
+struct MAVLinkDecodedMessage
+{
+    mavlink_message_t message;
+    qint64 readTimeNSecs = 0;   ///< When the message was read from the device (see LinkMetrics::timestampNSecs)
+    quint32 lost = 0;           ///< Messages lost from the sending component before this entry
+    bool superseded = false;    ///< A newer copy of this state message follows in the same batch
+};
+
+struct MAVLinkDecodedBatch
+{
+    QList<MAVLinkDecodedMessage> messages;
+    qsizetype bytes = 0;
+    uint32_t crcErrors = 0;
+    uint32_t signatureErrors = 0;
+    uint32_t parseErrors = 0;
+    uint64_t totalReceived = 0; ///< Link totals at the end of the batch
+    uint64_t totalLost = 0;
+    float lossPercent = 0;
+    int statusSysid = -1;       ///< System to report the link totals for, set every 31 messages
+    quint64 generation = 0;     ///< Decoder which produced the batch, see MAVLinkDecodeWorker::generation
+};
+Q_DECLARE_METATYPE(MAVLinkDecodedBatch)
+
+/// Decode stage for a single link.
+/// Parses the received bytes, tracks sequence loss, forwards and logs every message. Forwarded messages are passed on
+/// as the received frames with a single write per forwarding link for each received chunk. Everything which needs the GUI
+/// thread (vehicle dispatch, heartbeat handling, metrics) is left to MAVLinkProtocol which receives the messages in
+/// batches. Every message is delivered. When the worker runs on its own thread, deliveries of messages which only carry
+/// the latest state of a high rate stream are paced to the delivery interval and all but the newest copy of each stream
+/// instance in a batch are marked as superseded, so the Vehicle FactGroups only update their Facts from the newest copy.
+/// Batches are not delivered while the previous one is still waiting to be processed, so a busy GUI thread sees fewer,
+/// larger batches instead of a growing queue.
+/// The worker parses with its own receive status and a copy of the channel signing state, the channel status is
+/// left to the GUI thread which uses it for sending.
+class MAVLinkDecodeWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// @param link Only used to tag delivered batches, the link is never accessed
+    /// @param channel Mavlink channel of the link, the initial signing state is copied from it
+    /// @param forwardingLink true: messages received on this link are not forwarded
+    /// @param coalesce true: mark superseded copies of high rate state messages and pace deliveries
+    /// @param generation Tags every batch so the receiver can tell batches of a removed decoder apart
+    MAVLinkDecodeWorker(LinkInterface *link, uint8_t channel, bool forwardingLink, bool coalesce, quint64 generation = 0, QObject *parent = nullptr);
+
+    quint64 generation() const { return _generation; }
+    ~MAVLinkDecodeWorker();
+
+    /// Decodes data into batch, counting, forwarding and logging every message
+    void decode(const QByteArray &data, qint64 readTimeNSecs, MAVLinkDecodedBatch &batch);
+
+    /// Thread safe, called by the receiver once a delivered batch has been processed
+    void batchConsumed() { (void) _batchesInFlight.fetch_sub(1, std::memory_order_acq_rel); }
+
+    /// @return true: Only the latest copy of this message is needed to update the vehicle state
+    static bool isCoalescable(uint32_t msgid);
+
+    /// Identifies the stream a coalescable message belongs to, messages with several instances per component include
+    /// the instance
+    static quint64 coalesceKey(const mavlink_message_t &message);
+
+    static constexpr int kDeliveryIntervalMSecs = 20;
+    static constexpr qsizetype kMaxForwardWriteBytes = 16 * 1024;   ///< Larger chunks are forwarded in several writes
+
+signals:
+    void batchDecoded(LinkInterface *link, const MAVLinkDecodedBatch &batch);
+
+public slots:
+    void receiveBytes(LinkInterface *link, const QByteArray &data, qint64 readTimeNSecs);
+
+    /// Clears the sequence tracking and loss counters
+    void reset();
+
+    /// Replaces the signing state used to verify received signatures
+    ///     @param signing Copy of the channel signing state, no value: signing is disabled
+    void setSigning(const std::optional<mavlink_signing_t> &signing);
+
+private slots:
+    void _deliver();
+
+private:
+    uint32_t _updateCounters(const mavlink_message_t &message);
+    void _appendForwardFrame(const MAVLinkFrameDecoder &decoder, const mavlink_message_t &message, const MAVLinkProtocol::ForwardingState &forwarding);
+    void _flushForwardFrames(const MAVLinkProtocol::ForwardingState &forwarding);
+    static bool _forwardFilterActive(const MAVLinkProtocol::ForwardingState &forwarding) { return (forwarding.forward && !forwarding.filter.isEmpty()); }
+
+    LinkInterface *const _link = nullptr;
+    const bool _forwardingLink = false;
+    const bool _coalesce = false;
+    const quint64 _generation = 0;
+
+    QTimer *_deliveryTimer = nullptr;
+    QElapsedTimer _sinceDelivery;
+    MAVLinkDecodedBatch _pending;
+    bool _pendingUrgent = false;                    ///< Pending batch holds messages which must not wait
+    QHash<quint64, qsizetype> _coalescedIndex;      ///< coalesceKey to index of the newest copy in the pending batch
+    std::atomic<int> _batchesInFlight = 0;
+
+    mavlink_status_t _status{};                     ///< Receive status, never shared with the channel
+    mavlink_message_t _rxBuffer{};
+    mavlink_signing_t _signing{};
+    mavlink_signing_streams_t _signingStreams{};
+
+    QByteArray _forwardAll;                         ///< Frames for all forwarding links
+    QByteArray _forwardFiltered;                    ///< Frames which passed the forwarding filter
+
+    uint8_t _lastSeq[256][256]{};                   ///< Last received sequence number for each system/component pair
+    bool _seqSeen[256][256]{};
+    uint64_t _totalReceived = 0;
+    uint64_t _totalLost = 0;
+    float _runningLossPercent = 0;
+};
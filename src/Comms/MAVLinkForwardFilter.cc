@@ -0,0 +1,100 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkForwardFilter.h"
+#include "MAVLinkLib.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QRegularExpression>
+
+QGC_LOGGING_CATEGORY(MAVLinkForwardFilterLog, "qgc.comms.mavlinkforwardfilter")
+
+bool MAVLinkForwardFilter::parse(const QString &filter)
+{
+    _rules.clear();
+    _invalid = false;
+    _errorString.clear();
+
+    static const QRegularExpression separators(QStringLiteral("[,\\s]+"));
+    const QStringList ruleTexts = filter.split(separators, Qt::SkipEmptyParts);
+    for (const QString &ruleText : ruleTexts) {
+        Rule rule;
+        if (!_parseRule(ruleText, rule)) {
+            _rules.clear();
+            _invalid = true;
+            _errorString = QStringLiteral("Invalid forwarding filter rule: %1").arg(ruleText);
+            qCWarning(MAVLinkForwardFilterLog) << _errorString;
+            return false;
+        }
+        _rules.append(rule);
+    }
+
+    return true;
+}
+
+bool MAVLinkForwardFilter::_parseRule(const QString &text, Rule &rule)
+{
+    const QStringList parts = text.split(QLatin1Char('/'));
+    if (parts.count() > 3) {
+        return false;
+    }
+
+    int *const ids[2] = { &rule.sysid, &rule.compid };
+    for (qsizetype i = 0; i < qMin(parts.count(), qsizetype(2)); i++) {
+        if (parts[i] == QStringLiteral("*")) {
+            continue;
+        }
+
+        bool ok = false;
+        const uint id = parts[i].toUInt(&ok);
+        if (!ok || (id > UINT8_MAX)) {
+            return false;
+        }
+        *ids[i] = static_cast<int>(id);
+    }
+
+    if ((parts.count() < 3) || (parts[2] == QStringLiteral("*"))) {
+        return true;
+    }
+
+    bool ok = false;
+    const uint msgid = parts[2].toUInt(&ok);
+    if (ok) {
+        if (msgid > 0xFFFFFF) {
+            return false;
+        }
+        rule.msgid = msgid;
+        return true;
+    }
+
+    const mavlink_message_info_t *const msgInfo = mavlink_get_message_info_by_name(parts[2].toUpper().toLatin1().constData());
+    if (!msgInfo) {
+        return false;
+    }
+    rule.msgid = msgInfo->msgid;
+
+    return true;
+}
+
+bool MAVLinkForwardFilter::matches(uint8_t sysid, uint8_t compid, uint32_t msgid) const
+{
+    if (_rules.isEmpty()) {
+        return !_invalid;
+    }
+
+    for (const Rule &rule : _rules) {
+        if (((rule.sysid < 0) || (rule.sysid == sysid)) &&
+            ((rule.compid < 0) || (rule.compid == compid)) &&
+            ((rule.msgid < 0) || (rule.msgid == msgid))) {
+            return true;
+        }
+    }
+
+    return false;
+}
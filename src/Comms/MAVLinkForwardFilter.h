@@ -0,0 +1,53 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QList>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QString>
+
+#include <cstdint>
+
+Q_DECLARE_LOGGING_CATEGORY(MAVLinkForwardFilterLog)
+
+/// Selects which received messages are forwarded.
+/// A filter is a list of rules separated by commas or whitespace. Each rule is sysid/compid/msgid where any part may be
+/// '*' and trailing parts may be left out. The message part also accepts a message name. A message is forwarded if it
+/// matches any rule, an empty filter forwards everything.
+///     i.e: "1" everything from system 1, "1/1" the autopilot of system 1, "*/*/HEARTBEAT" all heartbeats
+class MAVLinkForwardFilter
+{
+public:
+    MAVLinkForwardFilter() = default;
+
+    /// Replaces the rules with the ones in filter
+    ///     @return false: filter has errors, see errorString(). The filter then matches nothing.
+    bool parse(const QString &filter);
+
+    bool matches(uint8_t sysid, uint8_t compid, uint32_t msgid) const;
+
+    /// @return true: no rules, everything matches
+    bool isEmpty() const { return _rules.isEmpty() && !_invalid; }
+
+    QString errorString() const { return _errorString; }
+
+private:
+    struct Rule {
+        int sysid = -1;         ///< -1: any
+        int compid = -1;
+        qint64 msgid = -1;
+    };
+
+    static bool _parseRule(const QString &text, Rule &rule);
+
+    QList<Rule> _rules;
+    bool _invalid = false;
+    QString _errorString;
+};
@@ -0,0 +1,193 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkLogWriter.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QDeadlineTimer>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QtMath>
+#include <QtCore/QtEndian>
+
+QGC_LOGGING_CATEGORY(MAVLinkLogWriterLog, "qgc.comms.mavlinklogwriter")
+
+MAVLinkLogWriter::MAVLinkLogWriter(qsizetype capacity, QObject *parent)
+    : QThread(parent)
+    , _capacity(static_cast<qsizetype>(qNextPowerOfTwo(static_cast<quint64>(qMax(capacity, kMinCapacity) - 1))))
+    , _mask(_capacity - 1)
+    , _ring(std::make_unique<char[]>(_capacity))
+{
+    setObjectName(QStringLiteral("MAVLinkLogWriter"));
+    setFlushSize(kDefaultFlushSize);
+
+    qCDebug(MAVLinkLogWriterLog) << this << "capacity" << _capacity;
+}
+
+MAVLinkLogWriter::~MAVLinkLogWriter()
+{
+    stopWriting();
+
+    qCDebug(MAVLinkLogWriterLog) << this;
+}
+
+void MAVLinkLogWriter::startWriting(QFile *file)
+{
+    if (writing()) {
+        qCWarning(MAVLinkLogWriterLog) << "Already writing" << _file->fileName();
+        return;
+    }
+
+    _head.store(0, std::memory_order_relaxed);
+    _tail.store(0, std::memory_order_relaxed);
+    _bytesWritten.store(0, std::memory_order_relaxed);
+    _overruns.store(0, std::memory_order_relaxed);
+    _droppedBytes.store(0, std::memory_order_relaxed);
+    _writeErrors.store(0, std::memory_order_relaxed);
+    _errorReported.store(false, std::memory_order_relaxed);
+    _stopRequested.store(false, std::memory_order_relaxed);
+    _wakePending.store(false, std::memory_order_relaxed);
+
+    _file = file;
+    start(QThread::LowPriority);
+}
+
+void MAVLinkLogWriter::stopWriting()
+{
+    if (!writing()) {
+        return;
+    }
+
+    {
+        QMutexLocker locker(&_wakeMutex);
+        _stopRequested.store(true, std::memory_order_release);
+        _wakeCondition.wakeOne();
+    }
+    (void) wait();
+
+    qCDebug(MAVLinkLogWriterLog) << "Stopped" << _file->fileName() << "written:" << bytesWritten() << "overruns:" << overruns() << "dropped:" << droppedBytes();
+
+    _file = nullptr;
+}
+
+bool MAVLinkLogWriter::write(quint64 timestamp, const char *data, qsizetype length)
+{
+    const qsizetype recordLength = static_cast<qsizetype>(sizeof(timestamp)) + length;
+    const quint64 head = _head.load(std::memory_order_relaxed);
+    const quint64 tail = _tail.load(std::memory_order_acquire);
+
+    if ((_capacity - static_cast<qsizetype>(head - tail)) < recordLength) {
+        (void) _overruns.fetch_add(1, std::memory_order_relaxed);
+        (void) _droppedBytes.fetch_add(recordLength, std::memory_order_relaxed);
+        return false;
+    }
+
+    char timestampBytes[sizeof(timestamp)];
+    qToBigEndian(timestamp, timestampBytes);
+    _copyToRing(head, timestampBytes, sizeof(timestampBytes));
+    _copyToRing(head + sizeof(timestampBytes), data, length);
+    _head.store(head + recordLength, std::memory_order_release);
+
+    // Only wake the writer once per commit cycle, everything else happens on the flush interval
+    if ((static_cast<qsizetype>(head + recordLength - tail) >= _flushSize.load(std::memory_order_relaxed)) && !_wakePending.exchange(true, std::memory_order_acq_rel)) {
+        QMutexLocker locker(&_wakeMutex);
+        _wakeCondition.wakeOne();
+    }
+
+    return true;
+}
+
+void MAVLinkLogWriter::_copyToRing(quint64 position, const char *data, qsizetype length)
+{
+    const qsizetype offset = static_cast<qsizetype>(position & _mask);
+    const qsizetype firstLength = qMin(length, _capacity - offset);
+
+    (void) memcpy(_ring.get() + offset, data, firstLength);
+    if (firstLength < length) {
+        (void) memcpy(_ring.get(), data + firstLength, length - firstLength);
+    }
+}
+
+qsizetype MAVLinkLogWriter::_queuedBytes() const
+{
+    return static_cast<qsizetype>(_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_relaxed));
+}
+
+void MAVLinkLogWriter::run()
+{
+    QElapsedTimer lastCommit;
+    lastCommit.start();
+
+    while (true) {
+        {
+            QMutexLocker locker(&_wakeMutex);
+            while (!_stopRequested.load(std::memory_order_acquire) && (_queuedBytes() < _flushSize.load(std::memory_order_relaxed))) {
+                const qint64 remaining = _flushIntervalMsecs.load(std::memory_order_relaxed) - lastCommit.elapsed();
+                if (remaining <= 0) {
+                    break;
+                }
+                (void) _wakeCondition.wait(&_wakeMutex, QDeadlineTimer(remaining));
+            }
+            _wakePending.store(false, std::memory_order_release);
+        }
+
+        _commit();
+        lastCommit.restart();
+
+        if (_stopRequested.load(std::memory_order_acquire)) {
+            // The producer has stopped writing by now, pick up anything queued while committing
+            _commit();
+            break;
+        }
+    }
+}
+
+/// Writes everything currently queued using at most two writes (ring wrap around) followed by a single flush
+void MAVLinkLogWriter::_commit()
+{
+    const quint64 head = _head.load(std::memory_order_acquire);
+    const quint64 tail = _tail.load(std::memory_order_relaxed);
+    if (head == tail) {
+        return;
+    }
+
+    const qsizetype length = static_cast<qsizetype>(head - tail);
+    const qsizetype offset = static_cast<qsizetype>(tail & _mask);
+    const qsizetype firstLength = qMin(length, _capacity - offset);
+
+    _writeBlock(_ring.get() + offset, firstLength);
+    if (firstLength < length) {
+        _writeBlock(_ring.get(), length - firstLength);
+    }
+    _tail.store(head, std::memory_order_release);
+
+    (void) _file->flush();
+}
+
+void MAVLinkLogWriter::_writeBlock(const char *data, qsizetype length)
+{
+    const qint64 written = _file->write(data, length);
+    if (written > 0) {
+        (void) _bytesWritten.fetch_add(written, std::memory_order_relaxed);
+    }
+
+    if (written == length) {
+        return;
+    }
+
+    (void) _writeErrors.fetch_add(1, std::memory_order_relaxed);
+    (void) _droppedBytes.fetch_add(length - qMax<qint64>(written, 0), std::memory_order_relaxed);
+
+    const QString errorString = _file->errorString();
+    qCWarning(MAVLinkLogWriterLog) << "Write failed" << _file->fileName() << errorString;
+    if (!_errorReported.exchange(true, std::memory_order_relaxed)) {
+        emit writeFailed(errorString);
+    }
+}
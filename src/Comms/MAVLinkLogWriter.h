@@ -0,0 +1,115 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QMutex>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
+
+#include <atomic>
+#include <memory>
+
+class QFile;
+
+Q_DECLARE_LOGGING_CATEGORY(MAVLinkLogWriterLog)
+
+/// Writes telemetry log records on a dedicated thread.
+/// Records are queued through a lock-free single producer/single consumer byte ring, so the producer never blocks on
+/// file I/O. The writer thread group commits everything queued in one write once the flush size is reached or the
+/// flush interval expires. If the ring is full the record is dropped and counted as an overrun instead of stalling
+/// the producer.
+/// The ring has a single producer side. MAVLinkProtocol logs from the GUI thread and the decode threads and serializes
+/// them with a mutex in front of write(). The lock never covers file I/O, so a producer can only wait for another one
+/// to copy a single record into the ring. A multi producer ring would have to reserve and publish slots separately and
+/// would still need a way to keep the records in timestamp order.
+class MAVLinkLogWriter : public QThread
+{
+    Q_OBJECT
+
+public:
+    /// @param capacity Ring buffer size in bytes, rounded up to a power of two
+    explicit MAVLinkLogWriter(qsizetype capacity = kDefaultCapacity, QObject *parent = nullptr);
+    ~MAVLinkLogWriter();
+
+    /// Starts the writer thread on an already opened file and clears the counters.
+    /// The file must not be accessed by anyone else until stopWriting() returns.
+    void startWriting(QFile *file);
+
+    /// Writes everything still queued, flushes the file and stops the writer thread.
+    /// Must be called from the producer thread.
+    void stopWriting();
+
+    bool writing() const { return (_file != nullptr); }
+
+    /// Queues a timestamped log record. Calls from more than one thread must be serialized by the caller.
+    ///     @param timestamp Microseconds since epoch, written big endian in front of the data
+    ///     @return false: Ring buffer full, record was dropped
+    bool write(quint64 timestamp, const char *data, qsizetype length);
+
+    /// Maximum time in msecs between group commits
+    void setFlushInterval(int msecs) { _flushIntervalMsecs.store(qMax(1, msecs), std::memory_order_relaxed); }
+
+    /// Number of queued bytes which triggers a group commit before the flush interval expires
+    void setFlushSize(qsizetype bytes) { _flushSize.store(qBound<qsizetype>(1, bytes, _capacity / 2), std::memory_order_relaxed); }
+
+    quint64 bytesWritten() const { return _bytesWritten.load(std::memory_order_relaxed); }
+
+    /// Number of records dropped because the ring buffer was full
+    quint64 overruns() const { return _overruns.load(std::memory_order_relaxed); }
+
+    /// Number of bytes lost due to overruns and file write errors
+    quint64 droppedBytes() const { return _droppedBytes.load(std::memory_order_relaxed); }
+
+    /// Number of file writes which failed
+    quint64 writeErrors() const { return _writeErrors.load(std::memory_order_relaxed); }
+
+    static constexpr qsizetype kDefaultCapacity = 4 * 1024 * 1024;
+    static constexpr int kDefaultFlushIntervalMsecs = 1000;
+    static constexpr qsizetype kDefaultFlushSize = 256 * 1024;
+    static constexpr qsizetype kMinCapacity = 1024;
+
+signals:
+    /// Emitted from the writer thread the first time a file write fails after startWriting()
+    void writeFailed(const QString &errorString);
+
+protected:
+    void run() final;
+
+private:
+    qsizetype _queuedBytes() const;
+    void _copyToRing(quint64 position, const char *data, qsizetype length);
+    void _commit();
+    void _writeBlock(const char *data, qsizetype length);
+
+    const qsizetype _capacity;
+    const qsizetype _mask;
+    const std::unique_ptr<char[]> _ring;
+
+    /// Producer owns _head, consumer owns _tail. Both only ever increase, positions are masked on access.
+    alignas(64) std::atomic<quint64> _head = 0;
+    alignas(64) std::atomic<quint64> _tail = 0;
+
+    QFile *_file = nullptr;
+    std::atomic<bool> _stopRequested = false;
+    std::atomic<bool> _wakePending = false;
+    std::atomic<bool> _errorReported = false;
+    std::atomic<int> _flushIntervalMsecs = kDefaultFlushIntervalMsecs;
+    std::atomic<qsizetype> _flushSize = kDefaultFlushSize;
+
+    std::atomic<quint64> _bytesWritten = 0;
+    std::atomic<quint64> _overruns = 0;
+    std::atomic<quint64> _droppedBytes = 0;
+    std::atomic<quint64> _writeErrors = 0;
+
+    /// Only used to park the writer thread, the data path is lock free
+    QMutex _wakeMutex;
+    QWaitCondition _wakeCondition;
+};
@@ -8,7 +8,11 @@
  ****************************************************************************/
 
 #include "MAVLinkProtocol.h"
+#include "MAVLinkDecodeWorker.h"
+#include "MAVLinkLogWriter.h"
+#include "MAVLinkSigning.h"
 #include "LinkManager.h"
+#include "LinkMetrics.h"
 #include "MultiVehicleManager.h"
 #include "QGCApplication.h"
 #include "QGCLoggingCategory.h"
@@ -16,6 +20,7 @@
 #include "SettingsManager.h"
 #include "MavlinkSettings.h"
 #include "AppSettings.h"
+#include "Fact.h"
 #include "QmlObjectListModel.h"
 
 #include <QtCore/QApplicationStatic>
@@ -24,6 +29,7 @@
 #include <QtCore/QMetaType>
 #include <QtCore/QSettings>
 #include <QtCore/QStandardPaths>
+#include <QtCore/QThread>
 
 QGC_LOGGING_CATEGORY(MAVLinkProtocolLog, "qgc.comms.mavlinkprotocol")
 
@@ -32,12 +38,20 @@ Q_APPLICATION_STATIC(MAVLinkProtocol, _mavlinkProtocolInstance);
 MAVLinkProtocol::MAVLinkProtocol(QObject *parent)
     : QObject(parent)
     , _tempLogFile(new QGCTemporaryFile(QStringLiteral("%2.%3").arg(_tempLogFileTemplate, _logFileExtension), this))
+    , _logWriter(new MAVLinkLogWriter(MAVLinkLogWriter::kDefaultCapacity, this))
 {
+    (void) connect(_logWriter, &MAVLinkLogWriter::writeFailed, this, &MAVLinkProtocol::_logWriteFailed, Qt::QueuedConnection);
+
     qCDebug(MAVLinkProtocolLog) << this;
 }
 
 MAVLinkProtocol::~MAVLinkProtocol()
 {
+    for (const LinkDecoder &decoder : std::as_const(_linkDecoders)) {
+        _stopDecoder(decoder);
+    }
+    _linkDecoders.clear();
+
     _closeLogFile();
 
     qCDebug(MAVLinkProtocolLog) << this;
@@ -55,6 +69,15 @@ void MAVLinkProtocol::init()
     }
 
     (void) connect(MultiVehicleManager::instance(), &MultiVehicleManager::vehicleRemoved, this, &MAVLinkProtocol::_vehicleCountChanged);
+    (void) connect(SettingsManager::instance()->mavlinkSettings()->forwardMavlink(), &Fact::rawValueChanged, this, [this]() {
+        _updateForwardingLinks();
+    });
+    (void) connect(SettingsManager::instance()->mavlinkSettings()->forwardMavlinkFilter(), &Fact::rawValueChanged, this, [this]() {
+        _updateForwardingLinks();
+    });
+    (void) connect(LinkManager::instance(), &LinkManager::mavlinkSupportForwardingEnabledChanged, this, [this]() {
+        _updateForwardingLinks();
+    });
 
     _initialized = true;
 }
@@ -71,185 +94,278 @@ void MAVLinkProtocol::setVersion(unsigned version)
 
 void MAVLinkProtocol::resetMetadataForLink(LinkInterface *link)
 {
-    const uint8_t channel = link->mavlinkChannel();
-    _totalReceiveCounter[channel] = 0;
-    _totalLossCounter[channel] = 0;
-    _runningLossPercent[channel] = 0.f;
-
     link->setDecodedFirstMavlinkPacket(false);
+    link->metrics()->reset();
+
+    MAVLinkDecodeWorker *const worker = _linkDecoders.value(link).worker;
+    if (worker) {
+        (void) QMetaObject::invokeMethod(worker, &MAVLinkDecodeWorker::reset);
+    }
 }
 
-void MAVLinkProtocol::logSentBytes(const LinkInterface *link, const QByteArray &data)
+void MAVLinkProtocol::addLink(LinkInterface *link)
 {
-    Q_UNUSED(link);
-
-    if (_logSuspendError || _logSuspendReplay || !_tempLogFile->isOpen()) {
+    if (_linkDecoders.contains(link)) {
         return;
     }
 
-    const quint64 time = static_cast<quint64>(QDateTime::currentMSecsSinceEpoch() * 1000);
-    uint8_t bytes_time[sizeof(quint64)]{};
-    qToBigEndian(time, bytes_time);
+    LinkDecoder decoder;
+    const bool threaded = !link->isLogReplay();
+    decoder.generation = _nextDecoderGeneration++;
+    decoder.worker = new MAVLinkDecodeWorker(link, link->mavlinkChannel(), link->linkConfiguration()->isForwarding(), threaded, decoder.generation);
+    if (threaded) {
+        decoder.thread = new QThread(this);
+        decoder.thread->setObjectName(QStringLiteral("MAVLinkDecode_%1").arg(link->linkConfiguration()->name()));
+        decoder.worker->moveToThread(decoder.thread);
 
-    QByteArray logData = data;
-    QByteArray timeData = QByteArray::fromRawData(reinterpret_cast<const char*>(bytes_time), sizeof(bytes_time));
-    (void) logData.prepend(timeData);
-    if (_tempLogFile->write(logData) != logData.length()) {
-        const QString message = QStringLiteral("MAVLink Logging failed. Could not write to file %1, logging disabled.").arg(_tempLogFile->fileName());
-        qgcApp()->showAppMessage(message, getName());
-        _stopLogging();
-        _logSuspendError = true;
+        (void) connect(decoder.thread, &QThread::finished, decoder.worker, &QObject::deleteLater);
+        (void) connect(link, &LinkInterface::bytesReceived, decoder.worker, &MAVLinkDecodeWorker::receiveBytes, Qt::QueuedConnection);
+        (void) connect(decoder.worker, &MAVLinkDecodeWorker::batchDecoded, this, &MAVLinkProtocol::_batchDecoded, Qt::QueuedConnection);
+
+        decoder.thread->start();
+    } else {
+        (void) connect(link, &LinkInterface::bytesReceived, this, &MAVLinkProtocol::receiveBytes);
     }
+
+    // The worker verifies signatures against its own copy of the signing state
+    (void) connect(link, &LinkInterface::signingChanged, this, [this, link]() {
+        _updateSigning(link);
+    });
+
+    _linkDecoders.insert(link, decoder);
+    _updateForwardingLinks();
 }
 
-void MAVLinkProtocol::receiveBytes(LinkInterface *link, const QByteArray &data)
+void MAVLinkProtocol::_updateSigning(LinkInterface *link)
 {
-    const SharedLinkInterfacePtr linkPtr = LinkManager::instance()->sharedLinkInterfacePointerForLink(link);
-    if (!linkPtr) {
-        qCDebug(MAVLinkProtocolLog) << "receiveBytes: link gone!" << data.size() << "bytes arrived too late";
+    MAVLinkDecodeWorker *const worker = _linkDecoders.value(link).worker;
+    if (!worker) {
         return;
     }
 
-    for (const uint8_t &byte: data) {
-        const uint8_t mavlinkChannel = link->mavlinkChannel();
-        mavlink_message_t message{};
-        mavlink_status_t status{};
-
-        if (mavlink_parse_char(mavlinkChannel, byte, &message, &status) != MAVLINK_FRAMING_OK) {
-            continue;
-        }
-
-        _updateVersion(link, mavlinkChannel);
-        _updateCounters(mavlinkChannel, message);
-        if (!linkPtr->linkConfiguration()->isForwarding()) {
-            _forward(message);
-            _forwardSupport(message);
-        }
-        _logData(link, message);
-
-        if (!_updateStatus(link, linkPtr, mavlinkChannel, message)) {
-            break;
-        }
-    }
+    const std::optional<mavlink_signing_t> signing = MAVLinkSigning::channelSigning(static_cast<mavlink_channel_t>(link->mavlinkChannel()));
+    (void) QMetaObject::invokeMethod(worker, [worker, signing]() {
+        worker->setSigning(signing);
+    });
 }
 
-void MAVLinkProtocol::_updateVersion(LinkInterface *link, uint8_t mavlinkChannel)
+void MAVLinkProtocol::removeLink(LinkInterface *link)
 {
-    if (link->decodedFirstMavlinkPacket()) {
+    if (!_linkDecoders.contains(link)) {
         return;
     }
 
-    link->setDecodedFirstMavlinkPacket(true);
-    const mavlink_status_t *const mavlinkStatus = mavlink_get_channel_status(mavlinkChannel);
+    const LinkDecoder decoder = _linkDecoders.take(link);
+    (void) disconnect(link, &LinkInterface::bytesReceived, this, &MAVLinkProtocol::receiveBytes);
+    (void) disconnect(link, &LinkInterface::bytesReceived, decoder.worker, &MAVLinkDecodeWorker::receiveBytes);
+    (void) disconnect(link, &LinkInterface::signingChanged, this, nullptr);
+    _stopDecoder(decoder);
+
+    _updateForwardingLinks(link);
+}
 
-    if (mavlinkStatus->flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1) {
+void MAVLinkProtocol::_stopDecoder(const LinkDecoder &decoder)
+{
+    if (!decoder.thread) {
+        delete decoder.worker;
         return;
     }
 
-    if (mavlink_get_proto_version(mavlinkChannel) == 1) {
-        qCDebug(MAVLinkProtocolLog) << "Switching outbound to mavlink 2.0 due to incoming mavlink 2.0 packet:" << mavlinkChannel;
-        setVersion(200);
+    // The worker is deleted by the thread finishing
+    decoder.thread->quit();
+    if (!decoder.thread->wait()) {
+        qCWarning(MAVLinkProtocolLog) << "Failed to wait for decode thread to finish" << decoder.thread->objectName();
     }
+    delete decoder.thread;
 }
 
-void MAVLinkProtocol::_updateCounters(uint8_t mavlinkChannel, const mavlink_message_t &message)
+void MAVLinkProtocol::_updateForwardingLinks(const LinkInterface *removedLink)
 {
-    _totalReceiveCounter[mavlinkChannel]++;
+    LinkManager *const linkManager = LinkManager::instance();
+    MavlinkSettings *const mavlinkSettings = SettingsManager::instance()->mavlinkSettings();
 
-    uint8_t &lastSeq = _lastIndex[message.sysid][message.compid];
+    LinkInterface *forwardingLink = nullptr;
+    if (mavlinkSettings->forwardMavlink()->rawValue().toBool()) {
+        forwardingLink = linkManager->mavlinkForwardingLink().get();
+    }
+    if (forwardingLink == removedLink) {
+        forwardingLink = nullptr;
+    }
 
-    const QPair<uint8_t,uint8_t> key(message.sysid, message.compid);
-    uint8_t expectedSeq;
-    if (!_firstMessageSeen.contains(key)) {
-        _firstMessageSeen.insert(key);
-        expectedSeq = message.seq;
-    } else {
-        expectedSeq = lastSeq + 1;
+    LinkInterface *forwardingSupportLink = nullptr;
+    if (linkManager->mavlinkSupportForwardingEnabled()) {
+        forwardingSupportLink = linkManager->mavlinkForwardingSupportLink().get();
+    }
+    if (forwardingSupportLink == removedLink) {
+        forwardingSupportLink = nullptr;
     }
 
-    uint64_t lostMessages;
-    if (message.seq >= expectedSeq) {
-        lostMessages = message.seq - expectedSeq;
-    } else {
-        lostMessages = static_cast<uint64_t>(message.seq) + 256ULL - expectedSeq;
+    std::shared_ptr<ForwardingState> forwardingState;
+    if (forwardingLink || forwardingSupportLink) {
+        forwardingState = std::make_shared<ForwardingState>();
+        forwardingState->forward = (forwardingLink != nullptr);
+        forwardingState->support = (forwardingSupportLink != nullptr);
+        (void) forwardingState->filter.parse(mavlinkSettings->forwardMavlinkFilter()->rawValue().toString());
     }
-    _totalLossCounter[mavlinkChannel] += lostMessages;
 
-    lastSeq = message.seq;
+    QMutexLocker locker(&_forwardingMutex);
+    _forwardingLink = forwardingLink;
+    _forwardingSupportLink = forwardingSupportLink;
+    _forwardingState = forwardingState;
+}
 
-    const uint64_t totalSent = _totalReceiveCounter[mavlinkChannel] + _totalLossCounter[mavlinkChannel];
-    const float currentLossPercent = (static_cast<double>(_totalLossCounter[mavlinkChannel]) / totalSent) * 100.0f;
-    _runningLossPercent[mavlinkChannel] = (currentLossPercent + _runningLossPercent[mavlinkChannel]) * 0.5f;
+std::shared_ptr<const MAVLinkProtocol::ForwardingState> MAVLinkProtocol::forwardingState()
+{
+    QMutexLocker locker(&_forwardingMutex);
+    return _forwardingState;
 }
 
-void MAVLinkProtocol::_forward(const mavlink_message_t &message)
+void MAVLinkProtocol::logSentBytes(const LinkInterface *link, const QByteArray &data)
 {
-    if (message.msgid == MAVLINK_MSG_ID_SETUP_SIGNING) {
+    Q_UNUSED(link);
+
+    QMutexLocker locker(&_logMutex);
+    if (_logSuspendError || _logSuspendReplay || !_logWriter->writing()) {
         return;
     }
 
-    if (!SettingsManager::instance()->mavlinkSettings()->forwardMavlink()->rawValue().toBool()) {
+    const quint64 timestamp = static_cast<quint64>(QDateTime::currentMSecsSinceEpoch() * 1000);
+    if (!_logWriter->write(timestamp, data.constData(), data.size())) {
+        _logOverrun();
+    }
+}
+
+void MAVLinkProtocol::receiveBytes(LinkInterface *link, const QByteArray &data, qint64 readTimeNSecs)
+{
+    MAVLinkDecodeWorker *const worker = _linkDecoders.value(link).worker;
+    if (!worker) {
+        qCDebug(MAVLinkProtocolLog) << "receiveBytes: link gone!" << data.size() << "bytes arrived too late";
         return;
     }
 
-    SharedLinkInterfacePtr forwardingLink = LinkManager::instance()->mavlinkForwardingLink();
-    if (!forwardingLink) {
+    if (readTimeNSecs == 0) {
+        readTimeNSecs = LinkMetrics::timestampNSecs();
+    }
+
+    MAVLinkDecodedBatch batch;
+    worker->decode(data, readTimeNSecs, batch);
+    _dispatchBatch(link, batch);
+}
+
+void MAVLinkProtocol::_batchDecoded(LinkInterface *link, const MAVLinkDecodedBatch &batch)
+{
+    // Batches still queued from a decoder which has been removed are dropped. The worker which sent them may already
+    // be deleted, so they are matched by generation instead of by sender.
+    const LinkDecoder decoder = _linkDecoders.value(link);
+    if (!decoder.worker || (decoder.generation != batch.generation)) {
         return;
     }
 
-    uint8_t buf[MAVLINK_MAX_PACKET_LEN]{};
-    const uint16_t len = mavlink_msg_to_send_buffer(buf, &message);
-    (void) forwardingLink->writeBytesThreadSafe(reinterpret_cast<const char*>(buf), len);
+    _dispatchBatch(link, batch);
+
+    // Dispatch may have removed the link and stopped its decoder
+    const LinkDecoder current = _linkDecoders.value(link);
+    if (current.generation == batch.generation) {
+        current.worker->batchConsumed();
+    }
 }
 
-void MAVLinkProtocol::_forwardSupport(const mavlink_message_t &message)
+void MAVLinkProtocol::_dispatchBatch(LinkInterface *link, const MAVLinkDecodedBatch &batch)
 {
-    if (message.msgid == MAVLINK_MSG_ID_SETUP_SIGNING) {
+    const SharedLinkInterfacePtr linkPtr = LinkManager::instance()->sharedLinkInterfacePointerForLink(link);
+    if (!linkPtr) {
+        qCDebug(MAVLinkProtocolLog) << "_dispatchBatch: link gone!" << batch.messages.count() << "messages arrived too late";
         return;
     }
 
-    if (!LinkManager::instance()->mavlinkSupportForwardingEnabled()) {
+    LinkMetrics *const metrics = link->metrics();
+    metrics->recordBytes(batch.bytes);
+
+    if (batch.statusSysid >= 0) {
+        emit mavlinkMessageStatus(batch.statusSysid, batch.totalReceived + batch.totalLost, batch.totalReceived, batch.totalLost, batch.lossPercent);
+    }
+
+    qint64 dispatchStartNSecs = LinkMetrics::timestampNSecs();
+    for (const MAVLinkDecodedMessage &decoded : batch.messages) {
+        const mavlink_message_t &message = decoded.message;
+
+        _updateVersion(link, message);
+        _handleHeartbeat(link, message);
+
+        _receivedSuperseded = decoded.superseded;
+        _receivedLost = decoded.lost;
+        emit messageReceived(link, message);
+        _receivedSuperseded = false;
+        _receivedLost = 0;
+
+        // Dispatch to the vehicle is synchronous, so this covers the full handling of the message
+        const qint64 dispatchEndNSecs = LinkMetrics::timestampNSecs();
+        metrics->recordMessage(message, decoded.lost, decoded.superseded, decoded.readTimeNSecs, dispatchStartNSecs, dispatchEndNSecs);
+        dispatchStartNSecs = dispatchEndNSecs;
+
+        if (linkPtr.use_count() == 1) {
+            // The link was removed while handling the message
+            break;
+        }
+    }
+
+    metrics->recordDecodeErrors(batch.crcErrors, batch.signatureErrors, batch.parseErrors);
+}
+
+void MAVLinkProtocol::_updateVersion(LinkInterface *link, const mavlink_message_t &message)
+{
+    if (link->decodedFirstMavlinkPacket()) {
         return;
     }
 
-    SharedLinkInterfacePtr forwardingSupportLink = LinkManager::instance()->mavlinkForwardingSupportLink();
-    if (!forwardingSupportLink) {
+    link->setDecodedFirstMavlinkPacket(true);
+
+    if (message.magic == MAVLINK_STX_MAVLINK1) {
         return;
     }
 
-    uint8_t buf[MAVLINK_MAX_PACKET_LEN]{};
-    const uint16_t len = mavlink_msg_to_send_buffer(buf, &message);
-    (void) forwardingSupportLink->writeBytesThreadSafe(reinterpret_cast<const char*>(buf), len);
+    if (mavlink_get_proto_version(link->mavlinkChannel()) == 1) {
+        qCDebug(MAVLinkProtocolLog) << "Switching outbound to mavlink 2.0 due to incoming mavlink 2.0 packet:" << link->mavlinkChannel();
+        setVersion(200);
+    }
 }
 
-void MAVLinkProtocol::_logData(LinkInterface *link, const mavlink_message_t &message)
+void MAVLinkProtocol::forwardFrames(QByteArrayView frames, QByteArrayView supportFrames)
 {
-    if (!_logSuspendError && !_logSuspendReplay && _tempLogFile->isOpen()) {
-        const quint64 timestamp = static_cast<quint64>(QDateTime::currentMSecsSinceEpoch() * 1000);
-        uint8_t buf[MAVLINK_MAX_PACKET_LEN + sizeof(timestamp)]{};
-        qToBigEndian(timestamp, buf);
+    QMutexLocker locker(&_forwardingMutex);
+    if (_forwardingLink && !frames.isEmpty()) {
+        _forwardingLink->writeBytesThreadSafe(frames.data(), static_cast<int>(frames.size()));
+    }
+    if (_forwardingSupportLink && !supportFrames.isEmpty()) {
+        _forwardingSupportLink->writeBytesThreadSafe(supportFrames.data(), static_cast<int>(supportFrames.size()));
+    }
+}
 
-        const qsizetype len = mavlink_msg_to_send_buffer(buf + sizeof(timestamp), &message) + sizeof(timestamp);
-        const QByteArray log_data(reinterpret_cast<const char*>(buf), len);
-        if (_tempLogFile->write(log_data) != len) {
-            const QString message = QStringLiteral("MAVLink Logging failed. Could not write to file %1, logging disabled.").arg(_tempLogFile->fileName());
-            qgcApp()->showAppMessage(message, getName());
-            _stopLogging();
-            _logSuspendError = true;
-        }
+void MAVLinkProtocol::logMessage(const mavlink_message_t &message)
+{
+    QMutexLocker locker(&_logMutex);
+    if (_logSuspendError || _logSuspendReplay || !_logWriter->writing()) {
+        return;
+    }
 
-        if ((message.msgid == MAVLINK_MSG_ID_HEARTBEAT) && !_vehicleWasArmed) {
-            if (mavlink_msg_heartbeat_get_base_mode(&message) & MAV_MODE_FLAG_DECODE_POSITION_SAFETY) {
-                _vehicleWasArmed = true;
-            }
-        }
+    const quint64 timestamp = static_cast<quint64>(QDateTime::currentMSecsSinceEpoch() * 1000);
+    uint8_t buf[MAVLINK_MAX_PACKET_LEN]{};
+    const uint16_t len = mavlink_msg_to_send_buffer(buf, &message);
+    if (!_logWriter->write(timestamp, reinterpret_cast<const char*>(buf), len)) {
+        _logOverrun();
     }
+}
 
+void MAVLinkProtocol::_handleHeartbeat(LinkInterface *link, const mavlink_message_t &message)
+{
     switch (message.msgid) {
     case MAVLINK_MSG_ID_HEARTBEAT: {
         _startLogging();
         mavlink_heartbeat_t heartbeat{};
         mavlink_msg_heartbeat_decode(&message, &heartbeat);
+        if (!_vehicleWasArmed && _logWriter->writing() && (heartbeat.base_mode & MAV_MODE_FLAG_DECODE_POSITION_SAFETY)) {
+            _vehicleWasArmed = true;
+        }
         emit vehicleHeartbeatInfo(link, message.sysid, message.compid, heartbeat.autopilot, heartbeat.type);
         break;
     }
@@ -273,20 +389,30 @@ void MAVLinkProtocol::_logData(LinkInterface *link, const mavlink_message_t &mes
     }
 }
 
-bool MAVLinkProtocol::_updateStatus(LinkInterface *link, const SharedLinkInterfacePtr linkPtr, uint8_t mavlinkChannel, const mavlink_message_t &message)
+void MAVLinkProtocol::_logOverrun()
 {
-    if ((_totalReceiveCounter[mavlinkChannel] % 31) == 0) {
-        const uint64_t totalSent = _totalReceiveCounter[mavlinkChannel] + _totalLossCounter[mavlinkChannel];
-        emit mavlinkMessageStatus(message.sysid, totalSent, _totalReceiveCounter[mavlinkChannel], _totalLossCounter[mavlinkChannel], _runningLossPercent[mavlinkChannel]);
+    if (_logOverrunReported) {
+        return;
     }
+    _logOverrunReported = true;
 
-    emit messageReceived(link, message);
+    qCWarning(MAVLinkProtocolLog) << "Telemetry log writer is falling behind, dropping log data" << _tempLogFile->fileName();
+}
 
-    if (linkPtr.use_count() == 1) {
-        return false;
-    }
+void MAVLinkProtocol::_logWriteFailed(const QString &errorString)
+{
+    const QString message = QStringLiteral("MAVLink Logging failed. Could not write to file %1 (%2), log data is being dropped.").arg(_tempLogFile->fileName(), errorString);
+    qgcApp()->showAppMessage(message, getName());
+}
 
-    return true;
+quint64 MAVLinkProtocol::logOverruns() const
+{
+    return _logWriter->overruns();
+}
+
+quint64 MAVLinkProtocol::logDroppedBytes() const
+{
+    return _logWriter->droppedBytes();
 }
 
 bool MAVLinkProtocol::_closeLogFile()
@@ -295,6 +421,14 @@ bool MAVLinkProtocol::_closeLogFile()
         return false;
     }
 
+    QMutexLocker locker(&_logMutex);
+    _logWriter->stopWriting();
+    locker.unlock();
+
+    if (_logWriter->droppedBytes() > 0) {
+        qCWarning(MAVLinkProtocolLog) << "Telemetry log" << _tempLogFile->fileName() << "overruns:" << _logWriter->overruns() << "write errors:" << _logWriter->writeErrors() << "dropped bytes:" << _logWriter->droppedBytes();
+    }
+
     if (_tempLogFile->size() == 0) {
         (void) _tempLogFile->remove();
         return false;
@@ -341,6 +475,14 @@ void MAVLinkProtocol::_startLogging()
     qCDebug(MAVLinkProtocolLog) << "Temp log" << _tempLogFile->fileName();
     (void) _checkTelemetrySavePath();
 
+    MavlinkSettings *const mavlinkSettings = SettingsManager::instance()->mavlinkSettings();
+    _logWriter->setFlushInterval(mavlinkSettings->telemetryLogFlushInterval()->rawValue().toInt());
+    _logWriter->setFlushSize(mavlinkSettings->telemetryLogFlushSize()->rawValue().toInt() * 1024);
+    QMutexLocker locker(&_logMutex);
+    _logWriter->startWriting(_tempLogFile);
+    _logOverrunReported = false;
+    locker.unlock();
+
     _logSuspendError = false;
 }
 
@@ -10,23 +10,37 @@
 #pragma once
 
 #include <QtCore/QByteArray>
+#include <QtCore/QByteArrayView>
+#include <QtCore/QHash>
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
 #include <QtCore/QString>
 
+#include <atomic>
+#include <memory>
+
 #include "LinkInterface.h"
+#include "MAVLinkForwardFilter.h"
 #include "MAVLinkLib.h"
 
+class MAVLinkDecodeWorker;
+class MAVLinkLogWriter;
 class QGCTemporaryFile;
+class QThread;
+struct MAVLinkDecodedBatch;
 
 Q_DECLARE_LOGGING_CATEGORY(MAVLinkProtocolLog)
 
 /// MAVLink micro air vehicle protocol reference implementation.
 /// MAVLink is a generic communication protocol for micro air vehicles.
 /// for more information, please see the official website: https://mavlink.io
+/// Received bytes are decoded, counted, forwarded and logged by a MAVLinkDecodeWorker per link. Decoded messages are
+/// dispatched through messageReceived on the GUI thread.
 class MAVLinkProtocol : public QObject
 {
     Q_OBJECT
+    Q_MOC_INCLUDE("MAVLinkDecodeWorker.h")
 
 public:
     /// Constructs an MAVLinkProtocol object.
@@ -60,9 +74,48 @@ class MAVLinkProtocol : public QObject
     /// Reset the counters for all metadata for this link.
     void resetMetadataForLink(LinkInterface *link);
 
+    /// Starts decoding the bytes received on the link. Log replay links are decoded synchronously so replay pacing
+    /// and seeking keep working against processed data, all other links are decoded on their own thread.
+    void addLink(LinkInterface *link);
+
+    /// Stops decoding for the link. Must be called before the link mavlink channel is released.
+    void removeLink(LinkInterface *link);
+
+    /// true: A newer copy of the high rate state message currently being emitted through messageReceived follows in the
+    /// same batch. Consumers which only need the latest state, like the Vehicle FactGroups, can skip the message.
+    bool receivedSuperseded() const { return _receivedSuperseded; }
+
+    /// Messages lost from the sending component before the message currently being emitted through messageReceived
+    quint32 receivedLost() const { return _receivedLost; }
+
+    /// Forwarding configuration used by the decode threads
+    struct ForwardingState {
+        bool forward = false;           ///< Forwarding link is active
+        bool support = false;           ///< Ardupilot support forwarding link is active
+        MAVLinkForwardFilter filter;    ///< Only applies to the forwarding link
+    };
+
+    /// Snapshot of the forwarding configuration, the decode threads take one per received chunk. Thread safe.
+    ///     @return nullptr: no forwarding link is active
+    std::shared_ptr<const ForwardingState> forwardingState();
+
+    /// Writes received frames unchanged to the active forwarding links, a single write per link. Thread safe.
+    ///     @param frames Frames for the forwarding link
+    ///     @param supportFrames Frames for the Ardupilot support forwarding link
+    void forwardFrames(QByteArrayView frames, QByteArrayView supportFrames);
+
+    /// Writes a received message to the telemetry log. Thread safe.
+    void logMessage(const mavlink_message_t &message);
+
     /// Suspend/Restart logging during replay.
     void suspendLogForReplay(bool suspend) { _logSuspendReplay = suspend; }
 
+    /// Number of telemetry log records dropped since logging started because the log writer fell behind
+    quint64 logOverruns() const;
+
+    /// Number of telemetry log bytes lost since logging started due to overruns or file write errors
+    quint64 logDroppedBytes() const;
+
     /// Set protocol version
     void setVersion(unsigned version);
 
@@ -81,9 +134,10 @@ class MAVLinkProtocol : public QObject
     void mavlinkMessageStatus(int sysid, uint64_t totalSent, uint64_t totalReceived, uint64_t totalLoss, float lossPercent);
 
 public slots:
-    /// Receive bytes from a communication interface and constructs a MAVLink packet
+    /// Decodes and dispatches bytes from a link which is decoded synchronously (see addLink)
     ///     @param link The interface to read from
-    void receiveBytes(LinkInterface *link, const QByteArray &data);
+    ///     @param readTimeNSecs When the data was read from the device, 0 if unknown
+    void receiveBytes(LinkInterface *link, const QByteArray &data, qint64 readTimeNSecs = 0);
 
     /// Log bytes sent from a communication interface and logs a MAVLink packet.
     /// It can handle multiple links in parallel, as each link has it's own buffer/parsing state machine.
@@ -95,34 +149,54 @@ public slots:
 
 private slots:
     void _vehicleCountChanged();
+    void _logWriteFailed(const QString &errorString);
+    void _batchDecoded(LinkInterface *link, const MAVLinkDecodedBatch &batch);
 
 private:
-    void _logData(LinkInterface *link, const mavlink_message_t &message);
+    struct LinkDecoder {
+        MAVLinkDecodeWorker *worker = nullptr;
+        QThread *thread = nullptr;  ///< nullptr: decoded synchronously on the GUI thread
+        quint64 generation = 0;     ///< Unique per decoder, a new link may reuse the address of a removed one
+    };
+
+    void _dispatchBatch(LinkInterface *link, const MAVLinkDecodedBatch &batch);
+    void _handleHeartbeat(LinkInterface *link, const mavlink_message_t &message);
+    void _stopDecoder(const LinkDecoder &decoder);
+    void _updateSigning(LinkInterface *link);
+    void _updateForwardingLinks(const LinkInterface *removedLink = nullptr);
+    void _logOverrun();
     bool _closeLogFile();
     void _startLogging();
     void _stopLogging();
 
-    void _forward(const mavlink_message_t &message);
-    void _forwardSupport(const mavlink_message_t &message);
-
-    void _updateCounters(uint8_t mavlinkChannel, const mavlink_message_t &message);
-    bool _updateStatus(LinkInterface *link, const SharedLinkInterfacePtr linkPtr, uint8_t mavlinkChannel, const mavlink_message_t &message);
-    void _updateVersion(LinkInterface *link, uint8_t mavlinkChannel);
+    void _updateVersion(LinkInterface *link, const mavlink_message_t &message);
 
     void _saveTelemetryLog(const QString &tempLogfile);
     bool _checkTelemetrySavePath();
 
     QGCTemporaryFile * const _tempLogFile = nullptr;
-
-    bool _logSuspendError = false;  ///< true: Logging suspended due to error
-    bool _logSuspendReplay = false; ///< true: Logging suspended due to replay
+    MAVLinkLogWriter * const _logWriter = nullptr;
+
+    /// Serializes the telemetry log producers onto the single producer side of MAVLinkLogWriter. Received messages are
+    /// logged from the decode thread of each link and sent bytes from the GUI thread. Taking the timestamp under the
+    /// lock also keeps the records of all links in time order.
+    QMutex _logMutex;
+    std::atomic<bool> _logSuspendError = false;  ///< true: Logging suspended due to error
+    std::atomic<bool> _logSuspendReplay = false; ///< true: Logging suspended due to replay
     bool _vehicleWasArmed = false;  ///< true: Vehicle was armed during log sequence
-
-    uint8_t _lastIndex[256][256]{};                             ///< Store the last received sequence ID for each system/component pair
-    QSet<QPair<uint8_t,uint8_t>> _firstMessageSeen;
-    uint64_t _totalReceiveCounter[MAVLINK_COMM_NUM_BUFFERS]{};  ///< The total number of successfully received messages
-    uint64_t _totalLossCounter[MAVLINK_COMM_NUM_BUFFERS]{};     ///< Total messages lost during transmission.
-    float _runningLossPercent[MAVLINK_COMM_NUM_BUFFERS]{};      ///< Loss rate
+    bool _logOverrunReported = false; ///< true: Dropped log data was already logged as a warning for this log
+
+    /// Forwarding targets are resolved on the GUI thread whenever links or settings change and used from the decode
+    /// threads. The links are guaranteed to outlive their entry here since removeLink clears it first.
+    QMutex _forwardingMutex;
+    LinkInterface *_forwardingLink = nullptr;
+    LinkInterface *_forwardingSupportLink = nullptr;
+    std::shared_ptr<const ForwardingState> _forwardingState;
+
+    QHash<const LinkInterface*, LinkDecoder> _linkDecoders;
+    quint64 _nextDecoderGeneration = 1;
+    bool _receivedSuperseded = false;
+    quint32 _receivedLost = 0;
 
     unsigned _currentVersion = 100;
     bool _initialized = false;
@@ -51,6 +51,9 @@ class MockConfiguration : public LinkConfiguration
     void setVehicleType(MAV_TYPE vehicleType) { _vehicleType = vehicleType; emit vehicleChanged(); }
     bool sendStatusText() const { return _sendStatusText; }
     void setSendStatusText(bool sendStatusText) { _sendStatusText = sendStatusText; emit sendStatusChanged(); }
+    /// true: The link never sends anything for its own vehicle, used for links carrying MockLinkSwarm traffic
+    bool silent() const { return _silent; }
+    void setSilent(bool silent) { _silent = silent; }
 
     enum FailureMode_t {
         FailNone,                                                   // No failures
@@ -61,6 +64,7 @@ class MockConfiguration : public LinkConfiguration
         FailInitialConnectRequestMessageAutopilotVersionLost,       // REQUEST_MESSAGE:AUTOPILOT_VERSION success, AUTOPILOT_VERSION never sent
         FailInitialConnectRequestMessageProtocolVersionFailure,     // REQUEST_MESSAGE:PROTOCOL_VERSION returns failure
         FailInitialConnectRequestMessageProtocolVersionLost,        // REQUEST_MESSAGE:PROTOCOL_VERSION success, PROTOCOL_VERSION never sent
+        FailParamLossy,                                             // Every 10th PARAM_VALUE response is dropped, should still succeed since QGC will re-query missing params
     };
     FailureMode_t failureMode() const { return _failureMode; }
     void setFailureMode(FailureMode_t failureMode) { _failureMode = failureMode; }
@@ -77,6 +81,7 @@ class MockConfiguration : public LinkConfiguration
     bool _sendStatusText = false;
     FailureMode_t _failureMode = FailNone;
     bool _incrementVehicleId = true;
+    bool _silent = false;
     uint16_t _boardVendorId = 0;
     uint16_t _boardProductId = 0;
 
@@ -9,6 +9,7 @@
 
 #include "MockLink.h"
 #include "LinkManager.h"
+#include "LinkMetrics.h"
 #include "MockLinkFTP.h"
 #include "MockLinkWorker.h"
 #include "QGCApplication.h"
@@ -83,6 +84,7 @@ MockLink::MockLink(SharedLinkConfigurationPtr &config, QObject *parent)
 
     (void) QObject::connect(this, &MockLink::writeBytesQueuedSignal, this, &MockLink::_writeBytesQueued, Qt::QueuedConnection);
 
+    _commLost = _mockConfig->silent();
     _loadParams();
     _runningTime.start();
 
@@ -509,10 +511,23 @@ void MockLink::respondWithMavlinkMessage(const mavlink_message_t &msg)
         uint8_t buffer[MAVLINK_MAX_PACKET_LEN]{};
         const int cBuffer = mavlink_msg_to_send_buffer(buffer, &msg);
         const QByteArray bytes(reinterpret_cast<char*>(buffer), cBuffer);
-        emit bytesReceived(this, bytes);
+        if (_responseLatencyMSecs > 0) {
+            QTimer::singleShot(_responseLatencyMSecs, Qt::PreciseTimer, this, [this, bytes]() {
+                if (!_commLost) {
+                    emit bytesReceived(this, bytes);
+                }
+            });
+        } else {
+            emit bytesReceived(this, bytes);
+        }
     }
 }
 
+void MockLink::injectReceivedBytes(const QByteArray &bytes)
+{
+    _emitBytesReceived(bytes, LinkMetrics::timestampNSecs());
+}
+
 void MockLink::_writeBytes(const QByteArray &bytes)
 {
     // This prevents the responses to mavlink messages from being sent until the _writeBytes returns.
@@ -701,6 +716,25 @@ void MockLink::_setParamFloatUnionIntoMap(int componentId, const QString &paramN
     _mapParamName2Value[componentId][paramName] = paramVariant;
 }
 
+bool MockLink::setParamValue(int componentId, const QString &paramName, const QVariant &value)
+{
+    if (!_mapParamName2Value.contains(componentId) || !_mapParamName2Value[componentId].contains(paramName)) {
+        qCWarning(MockLinkLog) << "setParamValue: Unknown param" << componentId << paramName;
+        return false;
+    }
+
+    // Keep the type the param was loaded with
+    QVariant paramVariant = value;
+    if (!paramVariant.convert(_mapParamName2Value[componentId][paramName].metaType())) {
+        qCWarning(MockLinkLog) << "setParamValue: Invalid value" << paramName << value;
+        return false;
+    }
+
+    qCDebug(MockLinkLog) << "setParamValue" << paramName << paramVariant;
+    _mapParamName2Value[componentId][paramName] = paramVariant;
+    return true;
+}
+
 float MockLink::_floatUnionForParam(int componentId, const QString &paramName)
 {
     Q_ASSERT(_mapParamName2Value.contains(componentId));
@@ -799,6 +833,8 @@ void MockLink::_paramRequestListWorker()
 
     if (((_failureMode == MockConfiguration::FailMissingParamOnInitialReqest) || (_failureMode == MockConfiguration::FailMissingParamOnAllRequests)) && (paramName == _failParam)) {
         qCDebug(MockLinkLog) << "Skipping param send:" << paramName;
+    } else if (_paramValueLost()) {
+        qCDebug(MockLinkLog) << "Dropping param send:" << paramName;
     } else {
         char paramId[MAVLINK_MSG_ID_PARAM_VALUE_LEN]{};
         mavlink_message_t responseMsg{};
@@ -839,6 +875,15 @@ void MockLink::_paramRequestListWorker()
     }
 }
 
+bool MockLink::_paramValueLost()
+{
+    if (_failureMode != MockConfiguration::FailParamLossy) {
+        return false;
+    }
+
+    return (((_paramValueCount.fetch_add(1) + 1) % _paramLossInterval) == 0);
+}
+
 void MockLink::_handleParamSet(const mavlink_message_t &msg)
 {
     mavlink_param_set_t request{};
@@ -862,6 +907,10 @@ void MockLink::_handleParamSet(const mavlink_message_t &msg)
     // Save the new value
     _setParamFloatUnionIntoMap(componentId, paramId, request.param_value);
 
+    if (_paramValueLost()) {
+        return;
+    }
+
     // Respond with a param_value to ack
     mavlink_message_t responseMsg;
     mavlink_msg_param_value_pack_chan(
@@ -936,6 +985,11 @@ void MockLink::_handleParamRequestRead(const mavlink_message_t &msg)
         return;
     }
 
+    if (_paramValueLost()) {
+        qCDebug(MockLinkLog) << "Dropping request read response for" << paramId;
+        return;
+    }
+
     (void) mavlink_msg_param_value_pack_chan(
         _vehicleSystemId,
         componentId,                                               // component id
@@ -1206,7 +1260,7 @@ void MockLink::_respondWithAutopilotVersion()
 #endif
 
     const uint8_t customVersion[8]{};
-    const uint64_t capabilities = MAV_PROTOCOL_CAPABILITY_MAVLINK2 | MAV_PROTOCOL_CAPABILITY_MISSION_FENCE | MAV_PROTOCOL_CAPABILITY_MISSION_RALLY | MAV_PROTOCOL_CAPABILITY_MISSION_INT | ((_firmwareType == MAV_AUTOPILOT_ARDUPILOTMEGA) ? MAV_PROTOCOL_CAPABILITY_TERRAIN : 0);
+    const uint64_t capabilities = MAV_PROTOCOL_CAPABILITY_MAVLINK2 | MAV_PROTOCOL_CAPABILITY_MISSION_FENCE | MAV_PROTOCOL_CAPABILITY_MISSION_RALLY | MAV_PROTOCOL_CAPABILITY_MISSION_INT | ((_firmwareType == MAV_AUTOPILOT_ARDUPILOTMEGA) ? (MAV_PROTOCOL_CAPABILITY_TERRAIN | MAV_PROTOCOL_CAPABILITY_FTP) : 0);
 
     mavlink_message_t msg{};
     (void) mavlink_msg_autopilot_version_pack_chan(
@@ -21,6 +21,8 @@
 #include <QtCore/QMutex>
 #include <QtPositioning/QGeoCoordinate>
 
+#include <atomic>
+
 class MockLinkFTP;
 class MockLinkWorker;
 class QThread;
@@ -47,6 +49,8 @@ class MockLink : public LinkInterface
     void disconnect() final;
 
     Q_INVOKABLE void setCommLost(bool commLost) { _commLost = commLost; }
+    /// Delays everything the vehicle sends by msecs, simulating the round trip time of a slow link
+    void setResponseLatencyMSecs(int msecs) { _responseLatencyMSecs = msecs; }
     Q_INVOKABLE void simulateConnectionRemoved();
 
     int vehicleId() const { return _vehicleSystemId; }
@@ -57,7 +61,12 @@ class MockLink : public LinkInterface
     /// Sends the specified mavlink message to QGC
     void respondWithMavlinkMessage(const mavlink_message_t &msg);
 
+    /// Delivers bytes to QGC as if they were read from the vehicle, regardless of setCommLost. Thread safe.
+    /// Used by MockLinkSwarm to feed traffic from simulated vehicles through the link.
+    void injectReceivedBytes(const QByteArray &bytes);
+
     MockLinkFTP *mockLinkFTP() const;
+    MockLinkMissionItemHandler *missionItemHandler() const { return _missionItemHandler; }
 
     /// Sets a failure mode for unit testingqgcm
     ///     @param failureMode Type of failure to simulate
@@ -84,6 +93,11 @@ class MockLink : public LinkInterface
     void clearReceivedMavCommandCounts() { _receivedMavCommandCountMap.clear(); }
     int receivedMavCommandCount(MAV_CMD command) const { return _receivedMavCommandCountMap[command]; }
 
+    QVariant paramValue(int componentId, const QString &paramName) const { return _mapParamName2Value.value(componentId).value(paramName); }
+    /// Sets a param without sending PARAM_VALUE, like a param file written over FTP
+    ///     @return false: unknown param
+    bool setParamValue(int componentId, const QString &paramName, const QVariant &value);
+
     enum RequestMessageFailureMode_t {
         FailRequestMessageNone,
         FailRequestMessageCommandAcceptedMsgNotSent,
@@ -183,6 +197,8 @@ private slots:
     void _sendAvailableModesMonitor();
 
     void _paramRequestListWorker();
+    /// @return true: Simulate the loss of a PARAM_VALUE message
+    bool _paramValueLost();
     void _logDownloadWorker();
     void _availableModesWorker();
     void _sendAvailableMode(uint8_t modeIndexOneBased);
@@ -204,6 +220,7 @@ private slots:
     const MAV_TYPE _vehicleType = MAV_TYPE_QUADROTOR;
     const bool _sendStatusText = false;
     const MockConfiguration::FailureMode_t _failureMode = MockConfiguration::FailNone;
+    std::atomic<int> _paramValueCount = 0;      ///< PARAM_VALUE messages considered for FailParamLossy, sent from the link and worker threads
     const uint8_t _vehicleSystemId = 0;
     const double _vehicleLatitude = 0.0;
     const double _vehicleLongitude = 0.0;
@@ -236,6 +253,7 @@ private slots:
 
     double _vehicleAltitudeAMSL = _defaultVehicleHomeAltitude;
     bool _commLost = false;
+    int _responseLatencyMSecs = 0;
     bool _highLatencyTransmissionEnabled = true;
 
     int _sendHomePositionDelayCount = 10;               ///< No home position for 4 seconds
@@ -277,6 +295,7 @@ private slots:
     static constexpr double _defaultVehicleHomeAltitude = 488.056;
 
     static constexpr const char *_failParam = "COM_FLTMODE6";
+    static constexpr int _paramLossInterval = 10;  ///< FailParamLossy drops every n-th PARAM_VALUE, so test runs are reproducible
 
     static constexpr uint8_t _vehicleComponentId = MAV_COMP_ID_AUTOPILOT1;
 
@@ -9,9 +9,12 @@
 
 #include "MockLinkFTP.h"
 #include "MockLink.h"
+#include "PlanFTPFile.h"
 #include "QGCLoggingCategory.h"
 #include "QGCTemporaryFile.h"
 
+#include <QtCore/QDataStream>
+
 QGC_LOGGING_CATEGORY(MockLinkFTPLog, "MockLinkMissionItemHandlerLog")
 
 MockLinkFTP::MockLinkFTP(uint8_t systemIdServer, uint8_t componentIdServer, MockLink *mockLink)
@@ -112,6 +115,7 @@ void MockLinkFTP::_openCommand(uint8_t senderSystemId, uint8_t senderComponentId
     _currentFile.close();
 
     QString tmpFilename;
+    MAV_MISSION_TYPE missionType = MAV_MISSION_TYPE_MISSION;
     const QString sizePrefix = sizeFilenamePrefix;
     if (path.startsWith(sizePrefix)) {
         const QString sizeString = path.right(path.length() - sizePrefix.length());
@@ -126,6 +130,8 @@ void MockLinkFTP::_openCommand(uint8_t senderSystemId, uint8_t senderComponentId
         tmpFilename = QStringLiteral(":MockLink/Parameter.MetaData.json.xz");
     } else if (_BinParamFileEnabled && (path == "@PARAM/param.pck")) {
         tmpFilename = ":MockLink/Arduplane.params.ftp.bin";
+    } else if (_missionFilesEnabled && PlanFTPFile::planTypeFromVehiclePath(path, missionType)) {
+        tmpFilename = _createMissionTempFile(missionType);
     }
 
     if (!tmpFilename.isEmpty()) {
@@ -241,6 +247,71 @@ void MockLinkFTP::_burstReadCommand(uint8_t senderSystemId, uint8_t senderCompon
     }
 }
 
+void MockLinkFTP::_createCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber)
+{
+    ensureNullTemination(request);
+    const QString path = reinterpret_cast<char*>(request->data);
+
+    const uint16_t outgoingSeqNumber = _nextSeqNumber(seqNumber);
+
+    if (_writingMissionFile || _writingParamFile) {
+        // Like ArduPilot there is a single session, a write which was never terminated blocks the next one
+        _sendNak(senderSystemId, senderComponentId, MavlinkFTP::kErrNoSessionsAvailable, outgoingSeqNumber, MavlinkFTP::kCmdCreateFile);
+        return;
+    }
+
+    MAV_MISSION_TYPE missionType = MAV_MISSION_TYPE_MISSION;
+    const bool paramFile = (_BinParamFileEnabled && (path == "@PARAM/param.pck"));
+    if (!paramFile && (!_missionFilesEnabled || !PlanFTPFile::planTypeFromVehiclePath(path, missionType))) {
+        _sendNak(senderSystemId, senderComponentId, MavlinkFTP::kErrFail, outgoingSeqNumber, MavlinkFTP::kCmdCreateFile);
+        return;
+    }
+
+    _currentFile.close();
+
+    QGCTemporaryFile tmpFile("MockLinkFTPMission");
+    if (!tmpFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        _sendNakErrno(senderSystemId, senderComponentId, tmpFile.error(), outgoingSeqNumber, MavlinkFTP::kCmdCreateFile);
+        return;
+    }
+    tmpFile.close();
+
+    _currentFile.setFileName(tmpFile.fileName());
+    if (!_currentFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        _sendNakErrno(senderSystemId, senderComponentId, _currentFile.error(), outgoingSeqNumber, MavlinkFTP::kCmdCreateFile);
+        return;
+    }
+    _writingMissionFile = !paramFile;
+    _writingParamFile = paramFile;
+    _writeMissionType = missionType;
+
+    _sendAck(senderSystemId, senderComponentId, outgoingSeqNumber, MavlinkFTP::kCmdCreateFile);
+}
+
+void MockLinkFTP::_writeCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber)
+{
+    const uint16_t outgoingSeqNumber = _nextSeqNumber(seqNumber);
+
+    if ((request->hdr.session != _sessionId) || (!_writingMissionFile && !_writingParamFile)) {
+        _sendNak(senderSystemId, senderComponentId, MavlinkFTP::kErrInvalidSession, outgoingSeqNumber, MavlinkFTP::kCmdWriteFile);
+        return;
+    }
+
+    if (_errMode == errModeNakWriteOnce) {
+        _errMode = errModeNone;
+        _sendNak(senderSystemId, senderComponentId, MavlinkFTP::kErrFail, outgoingSeqNumber, MavlinkFTP::kCmdWriteFile);
+        return;
+    }
+
+    (void) _currentFile.seek(request->hdr.offset);
+    if (_currentFile.write(reinterpret_cast<const char*>(request->data), request->hdr.size) != request->hdr.size) {
+        _sendNakErrno(senderSystemId, senderComponentId, _currentFile.error(), outgoingSeqNumber, MavlinkFTP::kCmdWriteFile);
+        return;
+    }
+
+    _sendAck(senderSystemId, senderComponentId, outgoingSeqNumber, MavlinkFTP::kCmdWriteFile);
+}
+
 void MockLinkFTP::_terminateCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber)
 {
     const uint16_t outgoingSeqNumber = _nextSeqNumber(seqNumber);
@@ -250,6 +321,41 @@ void MockLinkFTP::_terminateCommand(uint8_t senderSystemId, uint8_t senderCompon
         return;
     }
 
+    if (_writingMissionFile) {
+        // Like ArduPilot the new items only take effect once the file is closed
+        _writingMissionFile = false;
+        _currentFile.close();
+
+        QByteArray bytes;
+        if (_currentFile.open(QIODevice::ReadOnly)) {
+            bytes = _currentFile.readAll();
+        }
+        (void) _currentFile.remove();
+
+        QList<mavlink_mission_item_int_t> missionItems;
+        QString errorString;
+        if (!PlanFTPFile::decode(bytes, _writeMissionType, missionItems, errorString)) {
+            qCWarning(MockLinkFTPLog) << "Invalid plan file written" << errorString;
+            _sendNak(senderSystemId, senderComponentId, MavlinkFTP::kErrFail, outgoingSeqNumber, MavlinkFTP::kCmdTerminateSession);
+            return;
+        }
+        _mockLink->missionItemHandler()->setMissionItems(_writeMissionType, missionItems);
+    } else if (_writingParamFile) {
+        _writingParamFile = false;
+        _currentFile.close();
+
+        QByteArray bytes;
+        if (_currentFile.open(QIODevice::ReadOnly)) {
+            bytes = _currentFile.readAll();
+        }
+        (void) _currentFile.remove();
+
+        if (!_setParamsFromFile(bytes)) {
+            _sendNak(senderSystemId, senderComponentId, MavlinkFTP::kErrFail, outgoingSeqNumber, MavlinkFTP::kCmdTerminateSession);
+            return;
+        }
+    }
+
     _sendAck(senderSystemId, senderComponentId, outgoingSeqNumber, MavlinkFTP::kCmdTerminateSession);
 
     emit terminateCommandReceived();
@@ -259,6 +365,8 @@ void MockLinkFTP::_resetCommand(uint8_t senderSystemId, uint8_t senderComponentI
 {
     const uint16_t outgoingSeqNumber = _nextSeqNumber(seqNumber);
 
+    _writingMissionFile = false;
+    _writingParamFile = false;
     _currentFile.close();
     _currentFile.remove();
     _sendAck(senderSystemId, senderComponentId, outgoingSeqNumber, MavlinkFTP::kCmdResetSessions);
@@ -281,8 +389,8 @@ void MockLinkFTP::mavlinkMessageReceived(const mavlink_message_t &message)
 
     MavlinkFTP::Request *request = reinterpret_cast<MavlinkFTP::Request*>(&requestFTP.payload[0]);
 
-    // kCmdOpenFileRO and kCmdResetSessions don't support retry so we can't drop those
-    if (_randomDropsEnabled && (request->hdr.opcode != MavlinkFTP::kCmdOpenFileRO) && (request->hdr.opcode != MavlinkFTP::kCmdResetSessions)) {
+    // kCmdOpenFileRO, kCmdCreateFile and kCmdResetSessions don't support retry so we can't drop those
+    if (_randomDropsEnabled && (request->hdr.opcode != MavlinkFTP::kCmdOpenFileRO) && (request->hdr.opcode != MavlinkFTP::kCmdCreateFile) && (request->hdr.opcode != MavlinkFTP::kCmdResetSessions)) {
         if ((rand() % 5) == 0) {
             qCDebug(MockLinkFTPLog) << "MockLinkFTP: Random drop of incoming packet";
             return;
@@ -334,6 +442,12 @@ void MockLinkFTP::mavlinkMessageReceived(const mavlink_message_t &message)
     case MavlinkFTP::kCmdBurstReadFile:
         _burstReadCommand(message.sysid, message.compid, request, incomingSeqNumber);
         break;
+    case MavlinkFTP::kCmdCreateFile:
+        _createCommand(message.sysid, message.compid, request, incomingSeqNumber);
+        break;
+    case MavlinkFTP::kCmdWriteFile:
+        _writeCommand(message.sysid, message.compid, request, incomingSeqNumber);
+        break;
     case MavlinkFTP::kCmdTerminateSession:
         _terminateCommand(message.sysid, message.compid, request, incomingSeqNumber);
         break;
@@ -404,8 +518,8 @@ void MockLinkFTP::_sendResponse(uint8_t targetSystemId, uint8_t targetComponentI
         reinterpret_cast<uint8_t*>(request) // Payload
     );
 
-    // kCmdOpenFileRO and kCmdResetSessions don't support retry so we can't drop those
-    if (_randomDropsEnabled && (request->hdr.req_opcode != MavlinkFTP::kCmdOpenFileRO) && (request->hdr.req_opcode != MavlinkFTP::kCmdResetSessions)) {
+    // kCmdOpenFileRO, kCmdCreateFile and kCmdResetSessions don't support retry so we can't drop those
+    if (_randomDropsEnabled && (request->hdr.req_opcode != MavlinkFTP::kCmdOpenFileRO) && (request->hdr.req_opcode != MavlinkFTP::kCmdCreateFile) && (request->hdr.req_opcode != MavlinkFTP::kCmdResetSessions)) {
         if ((rand() % 5) == 0) {
             qCDebug(MockLinkFTPLog) << "MockLinkFTP: Random drop of outgoing packet";
             return;
@@ -440,3 +554,94 @@ QString MockLinkFTP::_createTestTempFile(int size)
 
     return tmpFile.fileName();
 }
+
+QString MockLinkFTP::_createMissionTempFile(MAV_MISSION_TYPE missionType) const
+{
+    QGCTemporaryFile tmpFile("MockLinkFTPMission");
+
+    if (tmpFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        (void) tmpFile.write(PlanFTPFile::encode(missionType, _mockLink->missionItemHandler()->missionItems(missionType)));
+        tmpFile.close();
+    }
+
+    return tmpFile.fileName();
+}
+
+bool MockLinkFTP::_setParamsFromFile(const QByteArray &bytes) const
+{
+    QDataStream in(bytes);
+    in.setByteOrder(QDataStream::LittleEndian);
+    in.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    quint16 magic = 0;
+    quint16 numParams = 0;
+    quint16 totalParams = 0;
+    in >> magic >> numParams >> totalParams;
+    if ((in.status() != QDataStream::Ok) || ((magic != 0x671B) && (magic != 0x671C))) {
+        qCWarning(MockLinkFTPLog) << "Invalid param file header";
+        return false;
+    }
+
+    QMap<QString, QVariant> params;
+    char name[17] = {};
+    for (quint16 i = 0; i < numParams; i++) {
+        quint8 typeFlags = 0;
+        while ((typeFlags == 0) && (in.status() == QDataStream::Ok)) { // Eat padding bytes
+            in >> typeFlags;
+        }
+        quint8 lengths = 0;
+        in >> lengths;
+        const int nameLength = ((lengths >> 4) & 0x0F) + 1;
+        const int commonLength = lengths & 0x0F;
+        if ((in.status() != QDataStream::Ok) || ((nameLength + commonLength) > 16) || (in.readRawData(&name[commonLength], nameLength) != nameLength)) {
+            qCWarning(MockLinkFTPLog) << "Invalid param file entry" << i;
+            return false;
+        }
+        name[commonLength + nameLength] = '\0';
+
+        // With defaults each value is followed by its default, which is skipped
+        const int valueCount = (((typeFlags >> 4) & 0x01) ? 2 : 1);
+        QVariant value;
+        for (int valueIndex = 0; valueIndex < valueCount; valueIndex++) {
+            qint8 data8 = 0;
+            qint16 data16 = 0;
+            qint32 data32 = 0;
+            float dfloat = 0;
+            switch (typeFlags & 0x0F) {
+            case 1:
+                in >> data8;
+                value = (valueIndex == 0) ? QVariant(data8) : value;
+                break;
+            case 2:
+                in >> data16;
+                value = (valueIndex == 0) ? QVariant(data16) : value;
+                break;
+            case 3:
+                in >> data32;
+                value = (valueIndex == 0) ? QVariant(data32) : value;
+                break;
+            case 4:
+                in >> dfloat;
+                value = (valueIndex == 0) ? QVariant(dfloat) : value;
+                break;
+            default:
+                qCWarning(MockLinkFTPLog) << "Invalid param type" << name << (typeFlags & 0x0F);
+                return false;
+            }
+        }
+        params[QString(name)] = value;
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        qCWarning(MockLinkFTPLog) << "Param file too short";
+        return false;
+    }
+
+    for (auto it = params.constBegin(); it != params.constEnd(); ++it) {
+        if (!_mockLink->setParamValue(MAV_COMP_ID_AUTOPILOT1, it.key(), it.value())) {
+            return false;
+        }
+    }
+
+    return true;
+}
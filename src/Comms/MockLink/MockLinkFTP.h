@@ -37,8 +37,13 @@ class MockLinkFTP : public QObject
     void mavlinkMessageReceived(const mavlink_message_t &message);
 
     void enableRandromDrops(bool enable) { _randomDropsEnabled = enable; }
+    /// Serves @PARAM/param.pck. Writing it sets the params it contains once the session is terminated.
     void enableBinParamFile(bool enable) { _BinParamFileEnabled = enable; }
 
+    /// Serves the ArduPilot plan files @MISSION/mission.dat, fence.dat and rally.dat from the items held by the
+    /// MockLinkMissionItemHandler. Writing one of the files replaces the items once the session is terminated.
+    void enableMissionFiles(bool enable) { _missionFilesEnabled = enable; }
+
     /// By calling setErrorMode with one of these modes you can cause the server to simulate an error.
     enum ErrorMode_t {
         errModeNone,                        ///< No error, respond correctly
@@ -47,7 +52,8 @@ class MockLinkFTP : public QObject
         errModeNoSecondResponse,            ///< No response to subsequent request to initial command
         errModeNoSecondResponseAllowRetry,  ///< No response to subsequent request to initial command, error will be cleared after this so retry will succeed
         errModeNakSecondResponse,           ///< Nak subsequent request to initial command
-        errModeBadSequence                  ///< Return response with bad sequence number
+        errModeBadSequence,                 ///< Return response with bad sequence number
+        errModeNakWriteOnce                 ///< Nak the next write request, error will be cleared after this
     };
 
     /// Sets the error mode for command responses. This allows you to simulate various server errors.
@@ -89,12 +95,18 @@ class MockLinkFTP : public QObject
     void _openCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
     void _readCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
     void _burstReadCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
+    /// Only supports the plan files and the param file, see enableMissionFiles and enableBinParamFile
+    void _createCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
+    void _writeCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
     void _terminateCommand(uint8_t senderSystemId, uint8_t senderComponentId, MavlinkFTP::Request *request, uint16_t seqNumber);
     void _resetCommand(uint8_t senderSystemId, uint8_t senderComponentId, uint16_t seqNumber);
     /// Generates the next sequence number given an incoming sequence number. Handles generating
     /// bad sequence numbers when errModeBadSequence is set.
     uint16_t _nextSeqNumber(uint16_t seqNumber) const;
     static QString _createTestTempFile(int size);
+    QString _createMissionTempFile(MAV_MISSION_TYPE missionType) const;
+    /// Sets the params of an uploaded @PARAM/param.pck
+    bool _setParamsFromFile(const QByteArray &bytes) const;
 
     /// if request is a string, this ensures it's null-terminated
     static void ensureNullTemination(MavlinkFTP::Request *request);
@@ -104,6 +116,10 @@ class MockLinkFTP : public QObject
     MockLink *_mockLink;                        ///< MockLink to communicate through
 
     bool _BinParamFileEnabled = false;
+    bool _missionFilesEnabled = false;
+    bool _writingMissionFile = false;           ///< _currentFile is a plan file being written
+    bool _writingParamFile = false;             ///< _currentFile is a param file being written
+    MAV_MISSION_TYPE _writeMissionType = MAV_MISSION_TYPE_MISSION;
     bool _lastReplyValid = false;
     bool _randomDropsEnabled = false;
     ErrorMode_t _errMode = errModeNone;         ///< Currently set error mode, as specified by setErrorMode
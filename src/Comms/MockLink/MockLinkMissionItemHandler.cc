@@ -124,6 +124,7 @@ void MockLinkMissionItemHandler::_handleMissionRequestList(const mavlink_message
     Q_ASSERT(request.target_system == _mockLink->vehicleId());
 
     _requestType = static_cast<MAV_MISSION_TYPE>(request.mission_type);
+    _readSequenceIndex = 0;
 
     int itemCount;
     switch (_requestType) {
@@ -184,7 +185,16 @@ void MockLinkMissionItemHandler::_handleMissionRequest(const mavlink_message_t &
         return;
     }
 
-    // FIXME: Track whether all items are requested, or requested in sequence
+    // Like PX4 only the next item or a repeat of the previous one may be requested
+    if (_mockLink->getFirmwareType() == MAV_AUTOPILOT_PX4) {
+        if (request.seq == _readSequenceIndex) {
+            _readSequenceIndex++;
+        } else if (request.seq != (_readSequenceIndex - 1)) {
+            qCWarning(MockLinkMissionItemHandlerLog) << "_handleMissionRequest seq not in sequence expected:actual" << _readSequenceIndex << request.seq;
+            _sendAck(MAV_MISSION_ERROR);
+            return;
+        }
+    }
 
     if (((_failureMode == FailReadRequest0IncorrectSequence) && (request.seq == 0)) ||
             ((_failureMode == FailReadRequest1IncorrectSequence) && (request.seq == 1))) {
@@ -431,6 +441,44 @@ void MockLinkMissionItemHandler::setFailureMode(FailureMode_t failureMode, MAV_M
     _failureAckResult = failureAckResult;
 }
 
+QList<mavlink_mission_item_int_t> MockLinkMissionItemHandler::missionItems(MAV_MISSION_TYPE missionType) const
+{
+    switch (missionType) {
+    case MAV_MISSION_TYPE_MISSION:
+        return _missionItems.values();
+    case MAV_MISSION_TYPE_FENCE:
+        return _fenceItems.values();
+    case MAV_MISSION_TYPE_RALLY:
+        return _rallyItems.values();
+    default:
+        qCWarning(MockLinkMissionItemHandlerLog) << "Internal error";
+        return QList<mavlink_mission_item_int_t>();
+    }
+}
+
+void MockLinkMissionItemHandler::setMissionItems(MAV_MISSION_TYPE missionType, const QList<mavlink_mission_item_int_t> &missionItems)
+{
+    MissionItemList_t itemList;
+    for (const mavlink_mission_item_int_t &missionItem : missionItems) {
+        itemList[missionItem.seq] = missionItem;
+    }
+
+    switch (missionType) {
+    case MAV_MISSION_TYPE_MISSION:
+        _missionItems = itemList;
+        break;
+    case MAV_MISSION_TYPE_FENCE:
+        _fenceItems = itemList;
+        break;
+    case MAV_MISSION_TYPE_RALLY:
+        _rallyItems = itemList;
+        break;
+    default:
+        qCWarning(MockLinkMissionItemHandlerLog) << "Internal error";
+        break;
+    }
+}
+
 void MockLinkMissionItemHandler::shutdown()
 {
     _missionItemResponseTimer.stop();
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <QtCore/QList>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QMap>
 #include <QtCore/QObject>
@@ -78,6 +79,12 @@ class MockLinkMissionItemHandler : public QObject
 
     void setSendHomePositionOnEmptyList(bool sendHomePositionOnEmptyList) { _sendHomePositionOnEmptyList = sendHomePositionOnEmptyList; }
 
+    /// Items of the specified type ordered by sequence number. Used by MockLinkFTP to serve the plan files.
+    QList<mavlink_mission_item_int_t> missionItems(MAV_MISSION_TYPE missionType) const;
+
+    /// Replaces all items of the specified type. Used by MockLinkFTP when a plan file is written.
+    void setMissionItems(MAV_MISSION_TYPE missionType, const QList<mavlink_mission_item_int_t> &missionItems);
+
 private slots:
     void _missionItemResponseTimeout();
 
@@ -95,6 +102,7 @@ private slots:
 
     int _writeSequenceCount = 0;    ///< Numbers of items about to be written
     int _writeSequenceIndex = 0;    ///< Current index being reqested
+    int _readSequenceIndex = 0;     ///< Next index a PX4 vehicle expects to be requested
 
     typedef QMap<uint16_t, mavlink_mission_item_int_t> MissionItemList_t;
 
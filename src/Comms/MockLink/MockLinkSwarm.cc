@@ -0,0 +1,297 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MockLinkSwarm.h"
+#include "LinkManager.h"
+#include "MockConfiguration.h"
+#include "MockLink.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QThread>
+#include <QtCore/QTimer>
+
+#include <cmath>
+#include <cstring>
+#include <numbers>
+
+QGC_LOGGING_CATEGORY(MockLinkSwarmLog, "qgc.comms.mocklink.mocklinkswarm")
+
+QList<MockLinkSwarmConfig::Stream> MockLinkSwarmConfig::defaultStreams()
+{
+    return {
+        { MAVLINK_MSG_ID_HEARTBEAT,             1 },
+        { MAVLINK_MSG_ID_SYS_STATUS,            2 },
+        { MAVLINK_MSG_ID_BATTERY_STATUS,        1 },
+        { MAVLINK_MSG_ID_GPS_RAW_INT,           5 },
+        { MAVLINK_MSG_ID_GLOBAL_POSITION_INT,   10 },
+        { MAVLINK_MSG_ID_VFR_HUD,               4 },
+        { MAVLINK_MSG_ID_ATTITUDE,              20 },
+    };
+}
+
+/*===========================================================================*/
+
+MockLinkSwarmWorker::MockLinkSwarmWorker(const MockLinkSwarmConfig &config, const QList<MockLink*> &links, QObject *parent)
+    : QObject(parent)
+    , _config(config)
+    , _links(links)
+    , _random(config.seed)
+{
+    // qCDebug(MockLinkSwarmLog) << Q_FUNC_INFO << this;
+
+    _pending.resize(_links.count());
+
+    _vehicles.resize(_config.vehicleCount);
+    for (int i = 0; i < _vehicles.count(); i++) {
+        SimVehicle &vehicle = _vehicles[i];
+        vehicle.sysid = static_cast<uint8_t>(_config.firstSystemId + i);
+        vehicle.linkIndex = i % _links.count();
+
+        // Random phase so the vehicles don't all send in the same tick
+        vehicle.due.resize(_config.streams.count());
+        for (double &due : vehicle.due) {
+            due = _random.generateDouble();
+        }
+    }
+}
+
+MockLinkSwarmWorker::~MockLinkSwarmWorker()
+{
+    // qCDebug(MockLinkSwarmLog) << Q_FUNC_INFO << this;
+}
+
+void MockLinkSwarmWorker::startWork()
+{
+    _timer = new QTimer(this);
+    _timer->setTimerType(Qt::PreciseTimer);
+    (void) connect(_timer, &QTimer::timeout, this, &MockLinkSwarmWorker::_tick);
+
+    _runningTime.start();
+    _lastTickMSecs = 0;
+    _lastFlushMSecs = 0;
+    _timer->start(kTickMSecs);
+}
+
+void MockLinkSwarmWorker::stopWork()
+{
+    if (_timer) {
+        _timer->stop();
+    }
+}
+
+void MockLinkSwarmWorker::_tick()
+{
+    const qint64 nowMSecs = _runningTime.elapsed();
+    const double elapsedSecs = static_cast<double>(nowMSecs - _lastTickMSecs) / 1000.0;
+    _lastTickMSecs = nowMSecs;
+
+    for (SimVehicle &vehicle : _vehicles) {
+        QByteArray &out = _pending[vehicle.linkIndex];
+        for (qsizetype i = 0; i < _config.streams.count(); i++) {
+            const MockLinkSwarmConfig::Stream &stream = _config.streams[i];
+            double &due = vehicle.due[i];
+            due += stream.rateHz * elapsedSecs;
+            while (due >= 1.0) {
+                due -= 1.0;
+                _sendStream(vehicle, stream, out);
+            }
+        }
+    }
+
+    if ((_config.burstIntervalMSecs <= 0) || ((nowMSecs - _lastFlushMSecs) >= _config.burstIntervalMSecs)) {
+        _flush();
+        _lastFlushMSecs = nowMSecs;
+    }
+}
+
+void MockLinkSwarmWorker::_sendStream(SimVehicle &vehicle, const MockLinkSwarmConfig::Stream &stream, QByteArray &out)
+{
+    mavlink_message_t message{};
+    _packMessage(vehicle, stream.msgid, message);
+
+    // The sequence number is used up either way so the receiver sees the gap
+    if ((_config.lossPercent > 0) && (_random.bounded(100.0) < _config.lossPercent)) {
+        (void) _messagesDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
+    const uint16_t len = mavlink_msg_to_send_buffer(buffer, &message);
+    if (!vehicle.heldFrame.isEmpty()) {
+        (void) out.append(reinterpret_cast<const char*>(buffer), len);
+        (void) out.append(vehicle.heldFrame);
+        vehicle.heldFrame.clear();
+    } else if ((_config.reorderPercent > 0) && (_random.bounded(100.0) < _config.reorderPercent)) {
+        vehicle.heldFrame = QByteArray(reinterpret_cast<const char*>(buffer), len);
+    } else {
+        (void) out.append(reinterpret_cast<const char*>(buffer), len);
+    }
+
+    (void) _messagesSent.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// Messages without simulated contents are sent zero filled
+void MockLinkSwarmWorker::_packMessage(SimVehicle &vehicle, uint32_t msgid, mavlink_message_t &message)
+{
+    const mavlink_msg_entry_t *const entry = mavlink_get_msg_entry(msgid);
+    uint8_t *const payload = reinterpret_cast<uint8_t*>(_MAV_PAYLOAD_NON_CONST(&message));
+    (void) memset(payload, 0, entry->max_msg_len);
+
+    const uint32_t bootMSecs = static_cast<uint32_t>(_runningTime.elapsed());
+    const double phase = (static_cast<double>(bootMSecs) / 1000.0) + vehicle.sysid;
+
+    switch (msgid) {
+    case MAVLINK_MSG_ID_HEARTBEAT: {
+        mavlink_heartbeat_t heartbeat{};
+        heartbeat.type = _config.vehicleType;
+        heartbeat.autopilot = _config.firmwareType;
+        heartbeat.base_mode = MAV_MODE_FLAG_CUSTOM_MODE_ENABLED;
+        heartbeat.system_status = MAV_STATE_STANDBY;
+        heartbeat.mavlink_version = 3;
+        (void) memcpy(payload, &heartbeat, sizeof(heartbeat));
+        break;
+    }
+    case MAVLINK_MSG_ID_ATTITUDE: {
+        mavlink_attitude_t attitude{};
+        attitude.time_boot_ms = bootMSecs;
+        attitude.roll = static_cast<float>(0.1 * std::sin(phase));
+        attitude.pitch = static_cast<float>(0.1 * std::cos(phase));
+        attitude.yaw = static_cast<float>(std::fmod(phase, 2 * std::numbers::pi) - std::numbers::pi);
+        (void) memcpy(payload, &attitude, sizeof(attitude));
+        break;
+    }
+    case MAVLINK_MSG_ID_GLOBAL_POSITION_INT: {
+        // Vehicles are spread out around the MockLink default location and fly small circles
+        mavlink_global_position_int_t position{};
+        position.time_boot_ms = bootMSecs;
+        position.lat = static_cast<int32_t>((47.397 + (vehicle.sysid * 0.0005) + (0.0001 * std::sin(phase))) * 1e7);
+        position.lon = static_cast<int32_t>((8.5455 + (0.0001 * std::cos(phase))) * 1e7);
+        position.alt = 538000;
+        position.relative_alt = 50000;
+        position.hdg = static_cast<uint16_t>(std::fmod(phase * 5729.58, 36000.0));
+        (void) memcpy(payload, &position, sizeof(position));
+        break;
+    }
+    default:
+        break;
+    }
+
+    message.msgid = msgid;
+    (void) mavlink_finalize_message_buffer(&message, vehicle.sysid, MAV_COMP_ID_AUTOPILOT1, &vehicle.status, entry->min_msg_len, entry->max_msg_len, entry->crc_extra);
+}
+
+void MockLinkSwarmWorker::_flush()
+{
+    for (qsizetype i = 0; i < _pending.count(); i++) {
+        if (!_pending[i].isEmpty()) {
+            _links[i]->injectReceivedBytes(_pending[i]);
+            _pending[i].clear();
+        }
+    }
+}
+
+/*===========================================================================*/
+
+MockLinkSwarm::MockLinkSwarm(const MockLinkSwarmConfig &config, QObject *parent)
+    : QObject(parent)
+    , _config(config)
+{
+    // qCDebug(MockLinkSwarmLog) << Q_FUNC_INFO << this;
+
+    // 255 is used by QGC itself
+    _config.firstSystemId = qMax<uint8_t>(_config.firstSystemId, 1);
+    _config.vehicleCount = qBound(1, _config.vehicleCount, 255 - _config.firstSystemId);
+    _config.linkCount = qBound(1, _config.linkCount, _config.vehicleCount);
+
+    for (qsizetype i = _config.streams.count() - 1; i >= 0; i--) {
+        const MockLinkSwarmConfig::Stream &stream = _config.streams[i];
+        if (!mavlink_get_msg_entry(stream.msgid) || (stream.rateHz <= 0)) {
+            qCWarning(MockLinkSwarmLog) << "Ignoring stream msgid:rate" << stream.msgid << stream.rateHz;
+            _config.streams.removeAt(i);
+        }
+    }
+}
+
+MockLinkSwarm::~MockLinkSwarm()
+{
+    stop();
+
+    // qCDebug(MockLinkSwarmLog) << Q_FUNC_INFO << this;
+}
+
+bool MockLinkSwarm::start()
+{
+    if (!_links.isEmpty()) {
+        return true;
+    }
+
+    for (int i = 0; i < _config.linkCount; i++) {
+        MockConfiguration *const mockConfig = new MockConfiguration(QStringLiteral("Swarm MockLink %1").arg(i + 1));
+        mockConfig->setFirmwareType(_config.firmwareType);
+        mockConfig->setVehicleType(_config.vehicleType);
+        mockConfig->setIncrementVehicleId(false);
+        mockConfig->setSilent(true);
+        mockConfig->setDynamic(true);
+
+        SharedLinkConfigurationPtr config = LinkManager::instance()->addConfiguration(mockConfig);
+        if (!LinkManager::instance()->createConnectedLink(config)) {
+            qCWarning(MockLinkSwarmLog) << "Failed to create swarm link" << (i + 1) << "of" << _config.linkCount;
+            stop();
+            return false;
+        }
+
+        MockLink *const link = qobject_cast<MockLink*>(config->link());
+        _sharedLinks.append(LinkManager::instance()->sharedLinkInterfacePointerForLink(link));
+        _links.append(link);
+    }
+
+    qCDebug(MockLinkSwarmLog) << "Starting swarm vehicles:links:streams" << _config.vehicleCount << _config.linkCount << _config.streams.count();
+
+    _workerThread = new QThread(this);
+    _workerThread->setObjectName(QStringLiteral("MockLinkSwarm"));
+    _worker = new MockLinkSwarmWorker(_config, _links);
+    _worker->moveToThread(_workerThread);
+    (void) connect(_workerThread, &QThread::started, _worker, &MockLinkSwarmWorker::startWork);
+    _workerThread->start();
+
+    return true;
+}
+
+void MockLinkSwarm::stop()
+{
+    if (_worker) {
+        (void) QMetaObject::invokeMethod(_worker, &MockLinkSwarmWorker::stopWork, Qt::BlockingQueuedConnection);
+        _workerThread->quit();
+        (void) _workerThread->wait();
+
+        _messagesSent = _worker->messagesSent();
+        _messagesDropped = _worker->messagesDropped();
+
+        delete _worker;
+        _worker = nullptr;
+        delete _workerThread;
+        _workerThread = nullptr;
+    }
+
+    for (MockLink *link : _links) {
+        link->disconnect();
+    }
+    _links.clear();
+    _sharedLinks.clear();
+}
+
+quint64 MockLinkSwarm::messagesSent() const
+{
+    return (_worker ? _worker->messagesSent() : _messagesSent);
+}
+
+quint64 MockLinkSwarm::messagesDropped() const
+{
+    return (_worker ? _worker->messagesDropped() : _messagesDropped);
+}
@@ -0,0 +1,132 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QObject>
+#include <QtCore/QRandomGenerator>
+
+#include <atomic>
+
+#include "LinkInterface.h"
+#include "MAVLinkLib.h"
+
+class MockLink;
+class QThread;
+class QTimer;
+
+Q_DECLARE_LOGGING_CATEGORY(MockLinkSwarmLog)
+
+struct MockLinkSwarmConfig
+{
+    struct Stream {
+        uint32_t msgid = 0;
+        double rateHz = 0;
+    };
+
+    int vehicleCount = 100;                 ///< Limited to the system ids from firstSystemId to 254
+    int linkCount = 1;                      ///< Vehicles are spread round robin, each link uses two mavlink channels
+    uint8_t firstSystemId = 1;
+    MAV_AUTOPILOT firmwareType = MAV_AUTOPILOT_PX4;
+    MAV_TYPE vehicleType = MAV_TYPE_QUADROTOR;
+    QList<Stream> streams = defaultStreams();
+    double lossPercent = 0;                 ///< Messages dropped after the sequence number was used
+    double reorderPercent = 0;              ///< Messages delivered after the next message from the same vehicle
+    int burstIntervalMSecs = 0;             ///< 0: deliver every tick, otherwise hold traffic back and deliver it all at once
+    quint32 seed = 1;
+
+    /// Rough PX4 telemetry mix, 43 messages per second per vehicle
+    static QList<Stream> defaultStreams();
+};
+
+/// Generates the traffic for the swarm on its own thread
+class MockLinkSwarmWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    MockLinkSwarmWorker(const MockLinkSwarmConfig &config, const QList<MockLink*> &links, QObject *parent = nullptr);
+    ~MockLinkSwarmWorker();
+
+    quint64 messagesSent() const { return _messagesSent.load(std::memory_order_relaxed); }
+    quint64 messagesDropped() const { return _messagesDropped.load(std::memory_order_relaxed); }
+
+    static constexpr int kTickMSecs = 10;
+
+public slots:
+    void startWork();
+    void stopWork();
+
+private slots:
+    void _tick();
+
+private:
+    struct SimVehicle {
+        uint8_t sysid = 0;
+        int linkIndex = 0;
+        mavlink_status_t status{};          ///< Outgoing sequence numbers for this vehicle
+        QList<double> due;                  ///< Messages owed for each stream
+        QByteArray heldFrame;               ///< Frame waiting to be delivered out of order
+    };
+
+    void _sendStream(SimVehicle &vehicle, const MockLinkSwarmConfig::Stream &stream, QByteArray &out);
+    void _packMessage(SimVehicle &vehicle, uint32_t msgid, mavlink_message_t &message);
+    void _flush();
+
+    const MockLinkSwarmConfig _config;
+    const QList<MockLink*> _links;
+    QList<SimVehicle> _vehicles;
+    QList<QByteArray> _pending;             ///< Traffic waiting for delivery, one buffer per link
+    QRandomGenerator _random;
+    QTimer *_timer = nullptr;
+    QElapsedTimer _runningTime;
+    qint64 _lastTickMSecs = 0;
+    qint64 _lastFlushMSecs = 0;
+
+    std::atomic<quint64> _messagesSent = 0;
+    std::atomic<quint64> _messagesDropped = 0;
+};
+
+/// Simulates a swarm of vehicles for load testing.
+/// Each vehicle streams a configurable message mix through one of the swarm MockLinks, so everything from
+/// MAVLinkProtocol on is exercised the same way as with real vehicles. The MockLinks themselves are silent and never
+/// answer requests, the swarm vehicles only produce telemetry. Loss, reordering and bursty delivery can be injected.
+class MockLinkSwarm : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit MockLinkSwarm(const MockLinkSwarmConfig &config, QObject *parent = nullptr);
+    ~MockLinkSwarm();
+
+    /// Creates the links and starts generating traffic
+    ///     @return false: not all links could be created, see the log
+    bool start();
+
+    /// Stops the traffic and disconnects the links, which removes the swarm vehicles
+    void stop();
+
+    const QList<MockLink*> &links() const { return _links; }
+    int vehicleCount() const { return _config.vehicleCount; }
+    quint64 messagesSent() const;
+    quint64 messagesDropped() const;
+
+private:
+    MockLinkSwarmConfig _config;
+    QList<MockLink*> _links;
+    QList<SharedLinkInterfacePtr> _sharedLinks;     ///< Keeps the links alive while the worker uses them
+    QThread *_workerThread = nullptr;
+    MockLinkSwarmWorker *_worker = nullptr;
+    quint64 _messagesSent = 0;                      ///< Totals of the last run once stopped
+    quint64 _messagesDropped = 0;
+};
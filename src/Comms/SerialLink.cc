@@ -8,6 +8,7 @@
  ****************************************************************************/
 
 #include "SerialLink.h"
+#include "LinkMetrics.h"
 #include "QGCLoggingCategory.h"
 #include "QGCSerialPortInfo.h"
 #include <QtCore/QSettings>
@@ -332,10 +333,11 @@ void SerialWorker::_onPortDisconnected()
 
 void SerialWorker::_onPortReadyRead()
 {
+    const qint64 readTimeNSecs = LinkMetrics::timestampNSecs();
     const QByteArray data = _port->readAll();
     if (!data.isEmpty()) {
         // qCDebug(SerialLinkLog) << data.size();
-        emit dataReceived(data);
+        emit dataReceived(data, readTimeNSecs);
     }
 }
 
@@ -460,9 +462,9 @@ void SerialLink::_onErrorOccurred(const QString &errorString)
     emit communicationError(tr("Serial Link Error"), tr("Link %1: (Port: %2) %3").arg(_serialConfig->name(), _serialConfig->portName(), errorString));
 }
 
-void SerialLink::_onDataReceived(const QByteArray &data)
+void SerialLink::_onDataReceived(const QByteArray &data, qint64 readTimeNSecs)
 {
-    emit bytesReceived(this, data);
+    _emitBytesReceived(data, readTimeNSecs);
 }
 
 void SerialLink::_onDataSent(const QByteArray &data)
@@ -474,3 +476,9 @@ void SerialLink::_writeBytes(const QByteArray &data)
 {
     (void) QMetaObject::invokeMethod(_worker, "writeData", Qt::QueuedConnection, Q_ARG(QByteArray, data));
 }
+
+qint64 SerialLink::_defaultSendByteRate() const
+{
+    // 8N1 framing, ten bits on the wire for every byte
+    return (_serialConfig->baud() / 10);
+}
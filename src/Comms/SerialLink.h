@@ -116,7 +116,8 @@ class SerialWorker : public QObject
 signals:
     void connected();
     void disconnected();
-    void dataReceived(const QByteArray &data);
+    /// @param readTimeNSecs Time the data was read, see LinkMetrics::timestampNSecs
+    void dataReceived(const QByteArray &data, qint64 readTimeNSecs);
     void dataSent(const QByteArray &data);
     void errorOccurred(const QString &errorString);
 
@@ -162,13 +163,14 @@ public slots:
 private slots:
     void _onConnected();
     void _onDisconnected();
-    void _onDataReceived(const QByteArray &data);
+    void _onDataReceived(const QByteArray &data, qint64 readTimeNSecs);
     void _onDataSent(const QByteArray &data);
     void _onErrorOccurred(const QString &errorString);
 
 private:
     bool _connect() override;
     void _writeBytes(const QByteArray &data) override;
+    qint64 _defaultSendByteRate() const override;
 
     const SerialConfiguration *_serialConfig = nullptr;
     SerialWorker *_worker = nullptr;
@@ -9,6 +9,7 @@
 
 #include "TCPLink.h"
 #include "DeviceInfo.h"
+#include "LinkMetrics.h"
 #include "QGCLoggingCategory.h"
 
 #include <QtCore/QThread>
@@ -231,9 +232,10 @@ void TCPWorker::_onSocketDisconnected()
 
 void TCPWorker::_onSocketReadyRead()
 {
+    const qint64 readTimeNSecs = LinkMetrics::timestampNSecs();
     const QByteArray data = _socket->readAll();
     if (!data.isEmpty()) {
-        emit dataReceived(data);
+        emit dataReceived(data, readTimeNSecs);
     }
 }
 
@@ -353,9 +355,9 @@ void TCPLink::_onErrorOccurred(const QString &errorString)
     emit communicationError(tr("TCP Link Error"), tr("Link %1: (Host: %2 Port: %3) %4").arg(_tcpConfig->name(), _tcpConfig->host()).arg(_tcpConfig->port()).arg(errorString));
 }
 
-void TCPLink::_onDataReceived(const QByteArray &data)
+void TCPLink::_onDataReceived(const QByteArray &data, qint64 readTimeNSecs)
 {
-    emit bytesReceived(this, data);
+    _emitBytesReceived(data, readTimeNSecs);
 }
 
 void TCPLink::_onDataSent(const QByteArray &data)
@@ -76,7 +76,8 @@ class TCPWorker : public QObject
     void connected();
     void disconnected();
     void errorOccurred(const QString &errorString);
-    void dataReceived(const QByteArray &data);
+    /// @param readTimeNSecs Time the data was read, see LinkMetrics::timestampNSecs
+    void dataReceived(const QByteArray &data, qint64 readTimeNSecs);
     void dataSent(const QByteArray &data);
 
 public slots:
@@ -119,7 +120,7 @@ private slots:
     void _onConnected();
     void _onDisconnected();
     void _onErrorOccurred(const QString &errorString);
-    void _onDataReceived(const QByteArray &data);
+    void _onDataReceived(const QByteArray &data, qint64 readTimeNSecs);
     void _onDataSent(const QByteArray &data);
 
 private:
@@ -0,0 +1,294 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "TLogIndex.h"
+#include "MAVLinkLib.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+#include <QtCore/QtEndian>
+
+#include <algorithm>
+
+QGC_LOGGING_CATEGORY(TLogIndexLog, "qgc.comms.tlogindex")
+
+bool TLogIndex::load(const QString &logFilename)
+{
+    for (const QString &indexFilename : { sidecarFilename(logFilename), cacheFilename(logFilename) }) {
+        _logFilename = logFilename;
+        if (_read(indexFilename)) {
+            qCDebug(TLogIndexLog) << "Loaded index" << indexFilename << "entries:" << _entries.count();
+            return true;
+        }
+    }
+
+    if (!build(logFilename)) {
+        return false;
+    }
+
+    (void) save();
+    return true;
+}
+
+bool TLogIndex::build(const QString &logFilename)
+{
+    _clear();
+    _logFilename = logFilename;
+
+    QFile file(logFilename);
+    if (!file.open(QFile::ReadOnly)) {
+        qCWarning(TLogIndexLog) << "Unable to open log" << logFilename << file.errorString();
+        return false;
+    }
+
+    const QFileInfo logFileInfo(file);
+    _logSize = logFileInfo.size();
+    _logModifiedMSecs = logFileInfo.lastModified().toMSecsSinceEpoch();
+    if (_logSize <= kTimestampSize) {
+        return false;
+    }
+
+    const uchar *const data = file.map(0, _logSize);
+    if (!data) {
+        qCWarning(TLogIndexLog) << "Unable to map log" << logFilename << file.errorString();
+        return false;
+    }
+
+    qint64 pos = 0;
+    qsizetype length = 0;
+    while (findRecord(data, _logSize, pos, length)) {
+        const uchar *const frame = data + pos + kTimestampSize;
+        const quint64 timestamp = parseTimestamp(reinterpret_cast<const char*>(data + pos));
+        if (_messageCount == 0) {
+            _startTimeUSecs = timestamp;
+        }
+        _endTimeUSecs = timestamp;
+
+        const uint32_t msgid = (frame[0] == MAVLINK_STX_MAVLINK1) ? frame[5] : (frame[7] | (frame[8] << 8) | (static_cast<uint32_t>(frame[9]) << 16));
+        _messageCounts[msgid]++;
+        _messageCount++;
+
+        if (_entries.isEmpty() || (timestamp >= (_entries.constLast().timestampUSecs + kIntervalUSecs))) {
+            _entries.append({timestamp, pos});
+        }
+
+        pos += kTimestampSize + length;
+    }
+
+    (void) file.unmap(const_cast<uchar*>(data));
+
+    qCDebug(TLogIndexLog) << "Built index" << logFilename << "messages:" << _messageCount << "entries:" << _entries.count();
+
+    return isValid();
+}
+
+bool TLogIndex::save() const
+{
+    if (!isValid()) {
+        return false;
+    }
+
+    if (_write(sidecarFilename(_logFilename))) {
+        return true;
+    }
+
+    const QString indexFilename = cacheFilename(_logFilename);
+    if (!QDir().mkpath(QFileInfo(indexFilename).absolutePath())) {
+        return false;
+    }
+
+    return _write(indexFilename);
+}
+
+TLogIndex::Entry TLogIndex::entryForTimestamp(quint64 timestampUSecs) const
+{
+    if (_entries.isEmpty()) {
+        return Entry();
+    }
+
+    auto it = std::upper_bound(_entries.constBegin(), _entries.constEnd(), timestampUSecs, [](quint64 timestamp, const Entry &entry) {
+        return (timestamp < entry.timestampUSecs);
+    });
+    if (it != _entries.constBegin()) {
+        --it;
+    }
+
+    return *it;
+}
+
+quint64 TLogIndex::parseTimestamp(const char *bytes)
+{
+    const quint64 currentTimestamp = static_cast<quint64>(QDateTime::currentMSecsSinceEpoch()) * 1000;
+    quint64 timestamp = qFromBigEndian<quint64>(bytes);
+    if (timestamp > currentTimestamp) {
+        timestamp = qbswap(timestamp);
+    }
+
+    return timestamp;
+}
+
+bool TLogIndex::findRecord(const uchar *data, qint64 size, qint64 &pos, qsizetype &length)
+{
+    while ((pos + kTimestampSize) < size) {
+        const qsizetype available = size - pos - kTimestampSize;
+        length = frameLength(data + pos + kTimestampSize, available);
+
+        // A record is only accepted if the next record (or the end of the log) follows it
+        const qint64 nextFrame = pos + kTimestampSize + length + kTimestampSize;
+        if ((length > 0) && (length <= available) && ((nextFrame >= size) || (frameLength(data + nextFrame, size - nextFrame) > 0))) {
+            return true;
+        }
+
+        // Not at a record boundary, resync on the next STX leaving room for the timestamp in front of it
+        qint64 next = pos + kTimestampSize + 1;
+        while ((next < size) && (data[next] != MAVLINK_STX) && (data[next] != MAVLINK_STX_MAVLINK1)) {
+            next++;
+        }
+        pos = next - kTimestampSize;
+    }
+
+    length = 0;
+    return false;
+}
+
+qsizetype TLogIndex::frameLength(const uchar *data, qsizetype available)
+{
+    if (available < 3) {
+        return 0;
+    }
+
+    if (data[0] == MAVLINK_STX_MAVLINK1) {
+        return (MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1 + data[1] + MAVLINK_NUM_CHECKSUM_BYTES);
+    }
+
+    if (data[0] == MAVLINK_STX) {
+        const qsizetype signatureLength = (data[2] & MAVLINK_IFLAG_SIGNED) ? MAVLINK_SIGNATURE_BLOCK_LEN : 0;
+        return (MAVLINK_CORE_HEADER_LEN + 1 + data[1] + MAVLINK_NUM_CHECKSUM_BYTES + signatureLength);
+    }
+
+    return 0;
+}
+
+QString TLogIndex::sidecarFilename(const QString &logFilename)
+{
+    return (logFilename + QStringLiteral(".idx"));
+}
+
+QString TLogIndex::cacheFilename(const QString &logFilename)
+{
+    const QByteArray pathHash = QCryptographicHash::hash(QFileInfo(logFilename).absoluteFilePath().toUtf8(), QCryptographicHash::Sha1).toHex();
+    return QStringLiteral("%1/TLogIndex/%2.idx").arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation), QString::fromLatin1(pathHash));
+}
+
+bool TLogIndex::_read(const QString &indexFilename)
+{
+    const QString logFilename = _logFilename;
+    _clear();
+    _logFilename = logFilename;
+
+    QFile file(indexFilename);
+    if (!file.open(QFile::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    stream >> magic >> version;
+    if ((magic != kMagic) || (version != kVersion)) {
+        qCDebug(TLogIndexLog) << "Ignoring index with unknown format" << indexFilename;
+        return false;
+    }
+
+    const QFileInfo logFileInfo(_logFilename);
+    stream >> _logSize >> _logModifiedMSecs;
+    if ((_logSize != logFileInfo.size()) || (_logModifiedMSecs != logFileInfo.lastModified().toMSecsSinceEpoch())) {
+        qCDebug(TLogIndexLog) << "Ignoring stale index" << indexFilename;
+        _clear();
+        return false;
+    }
+
+    quint32 countsSize = 0;
+    stream >> _startTimeUSecs >> _endTimeUSecs >> _messageCount >> countsSize;
+    for (quint32 i = 0; (i < countsSize) && (stream.status() == QDataStream::Ok); i++) {
+        uint32_t msgid = 0;
+        quint64 count = 0;
+        stream >> msgid >> count;
+        _messageCounts[msgid] = count;
+    }
+
+    quint32 entriesSize = 0;
+    stream >> entriesSize;
+    _entries.reserve(entriesSize);
+    for (quint32 i = 0; (i < entriesSize) && (stream.status() == QDataStream::Ok); i++) {
+        Entry entry;
+        stream >> entry.timestampUSecs >> entry.offset;
+        _entries.append(entry);
+    }
+
+    if ((stream.status() != QDataStream::Ok) || !isValid()) {
+        qCWarning(TLogIndexLog) << "Corrupt index" << indexFilename;
+        _clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool TLogIndex::_write(const QString &indexFilename) const
+{
+    QSaveFile file(indexFilename);
+    if (!file.open(QFile::WriteOnly)) {
+        qCDebug(TLogIndexLog) << "Unable to write index" << indexFilename << file.errorString();
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    stream << kMagic << kVersion << _logSize << _logModifiedMSecs;
+    stream << _startTimeUSecs << _endTimeUSecs << _messageCount << static_cast<quint32>(_messageCounts.count());
+    for (auto it = _messageCounts.constBegin(); it != _messageCounts.constEnd(); ++it) {
+        stream << it.key() << it.value();
+    }
+
+    stream << static_cast<quint32>(_entries.count());
+    for (const Entry &entry : _entries) {
+        stream << entry.timestampUSecs << entry.offset;
+    }
+
+    if ((stream.status() != QDataStream::Ok) || !file.commit()) {
+        qCWarning(TLogIndexLog) << "Unable to write index" << indexFilename << file.errorString();
+        return false;
+    }
+
+    qCDebug(TLogIndexLog) << "Saved index" << indexFilename;
+    return true;
+}
+
+void TLogIndex::_clear()
+{
+    _logFilename.clear();
+    _logSize = 0;
+    _logModifiedMSecs = 0;
+    _startTimeUSecs = 0;
+    _endTimeUSecs = 0;
+    _messageCount = 0;
+    _messageCounts.clear();
+    _entries.clear();
+}
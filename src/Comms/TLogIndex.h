@@ -0,0 +1,90 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QString>
+
+Q_DECLARE_LOGGING_CATEGORY(TLogIndexLog)
+
+/// Time index for a telemetry log (tlog) file.
+/// A tlog is a sequence of records made of a big endian microsecond timestamp followed by a MAVLink frame.
+/// The index maps timestamps to record offsets at fixed time intervals and holds the message counts per message id,
+/// which allows seeking and duration lookup without parsing the log. It is built once and cached in a sidecar file
+/// next to the log (or in the cache location if the log directory is not writable).
+class TLogIndex
+{
+public:
+    struct Entry {
+        quint64 timestampUSecs = 0;
+        qint64 offset = 0;          ///< Offset of the record, which starts with the timestamp
+    };
+
+    /// Loads the cached index for the log, building and caching it if it is missing or stale
+    ///     @return false: Log could not be read or contains no records
+    bool load(const QString &logFilename);
+
+    /// Builds the index by scanning the log
+    bool build(const QString &logFilename);
+
+    /// Writes the index to the sidecar file, falling back to the cache location
+    bool save() const;
+
+    bool isValid() const { return !_entries.isEmpty(); }
+
+    quint64 startTimeUSecs() const { return _startTimeUSecs; }
+    quint64 endTimeUSecs() const { return _endTimeUSecs; }
+    quint64 durationUSecs() const { return (_endTimeUSecs - _startTimeUSecs); }
+    quint64 messageCount() const { return _messageCount; }
+    const QHash<uint32_t, quint64> &messageCounts() const { return _messageCounts; }
+    const QList<Entry> &entries() const { return _entries; }
+
+    /// Binary searches the index for the last entry at or before the timestamp
+    Entry entryForTimestamp(quint64 timestampUSecs) const;
+
+    /// Converts a raw tlog timestamp, handling logs which were written with the wrong byte order
+    static quint64 parseTimestamp(const char *bytes);
+
+    /// @return Length of the MAVLink frame starting at data, 0 if data does not hold a complete frame header
+    static qsizetype frameLength(const uchar *data, qsizetype available);
+
+    /// Finds the next complete record at or after pos, skipping anything which is not at a record boundary
+    ///     @param data Log contents
+    ///     @param size Size of the log contents
+    ///     @param pos Updated to the offset of the record
+    ///     @param length Set to the length of the MAVLink frame following the record timestamp
+    ///     @return false: No more complete records
+    static bool findRecord(const uchar *data, qint64 size, qint64 &pos, qsizetype &length);
+
+    static QString sidecarFilename(const QString &logFilename);
+    static QString cacheFilename(const QString &logFilename);
+
+    static constexpr quint64 kIntervalUSecs = 250000;
+    static constexpr qsizetype kTimestampSize = sizeof(quint64);
+
+private:
+    bool _read(const QString &indexFilename);
+    bool _write(const QString &indexFilename) const;
+    void _clear();
+
+    QString _logFilename;
+    qint64 _logSize = 0;
+    qint64 _logModifiedMSecs = 0;
+    quint64 _startTimeUSecs = 0;
+    quint64 _endTimeUSecs = 0;
+    quint64 _messageCount = 0;
+    QHash<uint32_t, quint64> _messageCounts;
+    QList<Entry> _entries;
+
+    static constexpr quint32 kMagic = 0x51474958; // "QGIX"
+    static constexpr quint16 kVersion = 1;
+};
@@ -10,10 +10,14 @@
 #include "UDPLink.h"
 #include "AutoConnectSettings.h"
 #include "DeviceInfo.h"
+#include "LinkMetrics.h"
 #include "QGCLoggingCategory.h"
 #include "SettingsManager.h"
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QMutexLocker>
+#include <QtCore/QSignalBlocker>
+#include <QtCore/QSocketNotifier>
 #include <QtCore/QThread>
 #include <QtNetwork/QHostInfo>
 #include <QtNetwork/QNetworkDatagram>
@@ -21,6 +25,14 @@
 #include <QtNetwork/QNetworkProxy>
 #include <QtNetwork/QUdpSocket>
 
+#ifdef Q_OS_LINUX
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
 QGC_LOGGING_CATEGORY(UDPLinkLog, "qgc.comms.udplink")
 
 namespace {
@@ -279,8 +291,75 @@ UDPWorker::~UDPWorker()
     // qCDebug(UDPLinkLog) << Q_FUNC_INFO << this;
 }
 
+#ifdef Q_OS_LINUX
+/// Datagrams are received straight into a reusable pool with one slot per datagram. Slots are sized for the largest
+/// possible datagram so nothing is ever truncated, the pages backing unused space are never touched.
+struct UDPWorker::BatchedReceive
+{
+    BatchedReceive()
+        : pool(new char[kBatchSize * kSlotSize])
+    {
+        for (int i = 0; i < kBatchSize; i++) {
+            iovecs[i].iov_base = pool.get() + (i * kSlotSize);
+            iovecs[i].iov_len = kSlotSize;
+        }
+    }
+
+    /// @return Number of datagrams received, -1 on error with errno set
+    int receive(int descriptor)
+    {
+        for (int i = 0; i < kBatchSize; i++) {
+            (void) memset(&headers[i], 0, sizeof(headers[i]));
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+            headers[i].msg_hdr.msg_name = &senders[i];
+            headers[i].msg_hdr.msg_namelen = sizeof(senders[i]);
+        }
+
+        return ::recvmmsg(descriptor, headers, kBatchSize, MSG_DONTWAIT, nullptr);
+    }
+
+    const char *datagram(int index) const { return pool.get() + (index * kSlotSize); }
+
+    /// Key used to skip the session target lookup for senders which have been seen already
+    static quint64 senderKey(const sockaddr_storage &sender)
+    {
+        if (sender.ss_family != AF_INET) {
+            return 0;
+        }
+
+        const sockaddr_in *const sender4 = reinterpret_cast<const sockaddr_in*>(&sender);
+        return ((static_cast<quint64>(sender4->sin_addr.s_addr) << 16) | sender4->sin_port | (1ULL << 48));
+    }
+
+    static constexpr int kBatchSize = 32;
+    static constexpr qsizetype kSlotSize = 65536;
+
+    const std::unique_ptr<char[]> pool;
+    mmsghdr headers[kBatchSize];
+    iovec iovecs[kBatchSize];
+    sockaddr_storage senders[kBatchSize];
+    QSet<quint64> knownSenders;
+};
+#else
+struct UDPWorker::BatchedReceive {};
+#endif
+
+bool UDPWorker::batchedReceiveSupported()
+{
+#ifdef Q_OS_LINUX
+    return true;
+#else
+    return false;
+#endif
+}
+
 bool UDPWorker::isConnected() const
 {
+    if (_batchedDescriptor >= 0) {
+        return _isConnected;
+    }
+
     return (_socket && _socket->isValid() && _isConnected);
 }
 
@@ -331,6 +410,18 @@ void UDPWorker::connectLink()
 
     _errorEmitted = false;
 
+    const bool bound = (_batchedReceiveEnabled && _openBatchedSocket()) || _bindSocket();
+    if (!bound) {
+        return;
+    }
+
+#ifdef QGC_ZEROCONF_ENABLED
+    _registerZeroconf(_udpConfig->localPort());
+#endif
+}
+
+bool UDPWorker::_bindSocket()
+{
     qCDebug(UDPLinkLog) << "Attempting to bind to port:" << _udpConfig->localPort();
     const bool bindSuccess = _socket->bind(QHostAddress::AnyIPv4, _udpConfig->localPort(), QAbstractSocket::ReuseAddressHint | QAbstractSocket::ShareAddress);
     if (!bindSuccess) {
@@ -346,7 +437,7 @@ void UDPWorker::connectLink()
             _onSocketDisconnected();
         }*/
 
-        return;
+        return false;
     }
 
     qCDebug(UDPLinkLog) << "Attempting to join multicast group:" << _multicastGroup.toString();
@@ -355,9 +446,7 @@ void UDPWorker::connectLink()
         qCWarning(UDPLinkLog) << "Failed to join multicast group" << _multicastGroup.toString();
     }
 
-#ifdef QGC_ZEROCONF_ENABLED
-    _registerZeroconf(_udpConfig->localPort());
-#endif
+    return true;
 }
 
 void UDPWorker::disconnectLink()
@@ -366,7 +455,10 @@ void UDPWorker::disconnectLink()
     _deregisterZeroconf();
 #endif
 
-    if (isConnected()) {
+    if (_batchedDescriptor >= 0) {
+        _closeBatchedSocket();
+        _onSocketDisconnected();
+    } else if (isConnected()) {
         (void) _socket->leaveMulticastGroup(_multicastGroup);
         _socket->close();
     }
@@ -386,7 +478,7 @@ void UDPWorker::writeData(const QByteArray &data)
     // Send to all manually targeted systems
     for (const std::shared_ptr<UDPClient> &target : _udpConfig->targetHosts()) {
         if (!containsTarget(_sessionTargets, target->address, target->port)) {
-            if (_socket->writeDatagram(data, target->address, target->port) < 0) {
+            if (_writeDatagram(data, target->address, target->port) < 0) {
                 qCWarning(UDPLinkLog) << "Could Not Send Data - Write Failed!";
             }
         }
@@ -394,7 +486,7 @@ void UDPWorker::writeData(const QByteArray &data)
 
     // Send to all connected systems
     for (const std::shared_ptr<UDPClient> &target: _sessionTargets) {
-        if (_socket->writeDatagram(data, target->address, target->port) < 0) {
+        if (_writeDatagram(data, target->address, target->port) < 0) {
             qCWarning(UDPLinkLog) << "Could Not Send Data - Write Failed!";
         }
     }
@@ -404,6 +496,27 @@ void UDPWorker::writeData(const QByteArray &data)
     emit dataSent(data);
 }
 
+qint64 UDPWorker::_writeDatagram(const QByteArray &data, const QHostAddress &address, quint16 port)
+{
+#ifdef Q_OS_LINUX
+    if (_batchedDescriptor >= 0) {
+        bool isIPv4 = false;
+        const quint32 ipv4Address = address.toIPv4Address(&isIPv4);
+        if (!isIPv4) {
+            return -1;
+        }
+
+        sockaddr_in target{};
+        target.sin_family = AF_INET;
+        target.sin_addr.s_addr = htonl(ipv4Address);
+        target.sin_port = htons(port);
+        return ::sendto(_batchedDescriptor, data.constData(), static_cast<size_t>(data.size()), 0, reinterpret_cast<const sockaddr*>(&target), sizeof(target));
+    }
+#endif
+
+    return _socket->writeDatagram(data, address, port);
+}
+
 void UDPWorker::_onSocketConnected()
 {
     qCDebug(UDPLinkLog) << "UDP connected to" << _udpConfig->localPort();
@@ -435,6 +548,7 @@ void UDPWorker::_onSocketReadyRead()
 
     QByteArray buffer;
     buffer.reserve(BUFFER_TRIGGER_SIZE);
+    qint64 readTimeNSecs = 0;
     QElapsedTimer timer;
     timer.start();
     bool received = false;
@@ -444,24 +558,19 @@ void UDPWorker::_onSocketReadyRead()
             continue;
         }
 
+        if (buffer.isEmpty()) {
+            readTimeNSecs = LinkMetrics::timestampNSecs();
+        }
         (void) buffer.append(datagramIn.data());
 
         if ((buffer.size() > BUFFER_TRIGGER_SIZE) || (timer.elapsed() > RECEIVE_TIME_LIMIT_MS)) {
             received = true;
-            emit dataReceived(buffer);
+            emit dataReceived(buffer, readTimeNSecs);
             buffer.clear();
             (void) timer.restart();
         }
 
-        const bool ipLocal = datagramIn.senderAddress().isLoopback() || _localAddresses.contains(datagramIn.senderAddress());
-        const QHostAddress senderAddress = ipLocal ? QHostAddress(QHostAddress::SpecialAddress::LocalHost) : datagramIn.senderAddress();
-
-        QMutexLocker locker(&_sessionTargetsMutex);
-        if (!containsTarget(_sessionTargets, senderAddress, datagramIn.senderPort())) {
-            qCDebug(UDPLinkLog) << "UDP Adding target:" << senderAddress << datagramIn.senderPort();
-            _sessionTargets.append(std::make_shared<UDPClient>(senderAddress, datagramIn.senderPort()));
-        }
-        locker.unlock();
+        _addSessionTarget(datagramIn.senderAddress(), datagramIn.senderPort());
     }
 
     if (!received && buffer.isEmpty()) {
@@ -469,7 +578,159 @@ void UDPWorker::_onSocketReadyRead()
         return;
     }
 
-    emit dataReceived(buffer);
+    emit dataReceived(buffer, readTimeNSecs);
+}
+
+void UDPWorker::_addSessionTarget(const QHostAddress &address, quint16 port)
+{
+    const bool ipLocal = address.isLoopback() || _localAddresses.contains(address);
+    const QHostAddress senderAddress = ipLocal ? QHostAddress(QHostAddress::SpecialAddress::LocalHost) : address;
+
+    QMutexLocker locker(&_sessionTargetsMutex);
+    if (!containsTarget(_sessionTargets, senderAddress, port)) {
+        qCDebug(UDPLinkLog) << "UDP Adding target:" << senderAddress << port;
+        _sessionTargets.append(std::make_shared<UDPClient>(senderAddress, port));
+    }
+}
+
+/// Opens a socket of our own for the batched receive path, which is read with recvmmsg and written with sendto.
+/// The descriptor is never shared with the QUdpSocket, whose engine expects to do all reads on its descriptor itself.
+bool UDPWorker::_openBatchedSocket()
+{
+#ifdef Q_OS_LINUX
+    if (_batchedDescriptor >= 0) {
+        return true;
+    }
+
+    const int descriptor = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (descriptor < 0) {
+        qCWarning(UDPLinkLog) << "Failed to create batched receive socket:" << strerror(errno);
+        return false;
+    }
+
+    const int reuseAddress = 1;
+    (void) ::setsockopt(descriptor, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+    sockaddr_in localAddress{};
+    localAddress.sin_family = AF_INET;
+    localAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+    localAddress.sin_port = htons(_udpConfig->localPort());
+    if (::bind(descriptor, reinterpret_cast<const sockaddr*>(&localAddress), sizeof(localAddress)) < 0) {
+        qCWarning(UDPLinkLog) << "Failed to bind batched receive socket to port" << _udpConfig->localPort() << strerror(errno);
+        (void) ::close(descriptor);
+        return false;
+    }
+
+    ip_mreq membership{};
+    membership.imr_multiaddr.s_addr = htonl(_multicastGroup.toIPv4Address());
+    membership.imr_interface.s_addr = htonl(INADDR_ANY);
+    if (::setsockopt(descriptor, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) < 0) {
+        qCWarning(UDPLinkLog) << "Failed to join multicast group" << _multicastGroup.toString();
+    }
+
+    if (!_batchedReceive) {
+        _batchedReceive = std::make_unique<BatchedReceive>();
+    }
+
+    _batchedDescriptor = descriptor;
+    _readNotifier = new QSocketNotifier(descriptor, QSocketNotifier::Read, this);
+    (void) connect(_readNotifier, &QSocketNotifier::activated, this, &UDPWorker::_onBatchedReadyRead);
+
+    qCDebug(UDPLinkLog) << "Using batched receive on port" << _udpConfig->localPort();
+    _onSocketConnected();
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void UDPWorker::_closeBatchedSocket()
+{
+#ifdef Q_OS_LINUX
+    if (_batchedDescriptor < 0) {
+        return;
+    }
+
+    delete _readNotifier;
+    _readNotifier = nullptr;
+
+    (void) ::close(_batchedDescriptor);
+    _batchedDescriptor = -1;
+    _batchedReceive->knownSenders.clear();
+#endif
+}
+
+void UDPWorker::_onBatchedReadyRead()
+{
+#ifdef Q_OS_LINUX
+    if (!isConnected()) {
+        return;
+    }
+
+    QByteArray buffer;
+    qint64 readTimeNSecs = 0;
+    QElapsedTimer timer;
+    timer.start();
+    while (true) {
+        const int count = _batchedReceive->receive(_batchedDescriptor);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                qCWarning(UDPLinkLog) << "recvmmsg failed, falling back to QUdpSocket reads:" << strerror(errno);
+                _closeBatchedSocket();
+                _batchedReceiveEnabled = false;
+
+                // The link stays up across the switch, the QUdpSocket state changes must not report it
+                const QSignalBlocker blocker(_socket);
+                if (!_bindSocket()) {
+                    _onSocketDisconnected();
+                }
+            }
+            break;
+        }
+
+        if (buffer.isEmpty()) {
+            readTimeNSecs = LinkMetrics::timestampNSecs();
+            buffer.reserve(BUFFER_TRIGGER_SIZE + BatchedReceive::kSlotSize);
+        }
+
+        for (int i = 0; i < count; i++) {
+            const mmsghdr &header = _batchedReceive->headers[i];
+            if (header.msg_len > 0) {
+                (void) buffer.append(_batchedReceive->datagram(i), header.msg_len);
+            }
+
+            const sockaddr_storage &sender = _batchedReceive->senders[i];
+            const quint64 senderKey = BatchedReceive::senderKey(sender);
+            if ((senderKey == 0) || !_batchedReceive->knownSenders.contains(senderKey)) {
+                QHostAddress address(reinterpret_cast<const sockaddr*>(&sender));
+                const quint16 port = (sender.ss_family == AF_INET6) ? ntohs(reinterpret_cast<const sockaddr_in6*>(&sender)->sin6_port) : ntohs(reinterpret_cast<const sockaddr_in*>(&sender)->sin_port);
+                _addSessionTarget(address, port);
+                if (senderKey != 0) {
+                    _batchedReceive->knownSenders.insert(senderKey);
+                }
+            }
+        }
+
+        if ((buffer.size() > BUFFER_TRIGGER_SIZE) || (timer.elapsed() > RECEIVE_TIME_LIMIT_MS)) {
+            emit dataReceived(buffer, readTimeNSecs);
+            buffer = QByteArray();
+            (void) timer.restart();
+        }
+
+        if (count < BatchedReceive::kBatchSize) {
+            // Drained, the notifier fires again once more data arrives
+            break;
+        }
+    }
+
+    if (!buffer.isEmpty()) {
+        emit dataReceived(buffer, readTimeNSecs);
+    }
+#endif
 }
 
 void UDPWorker::_onSocketBytesWritten(qint64 bytes)
@@ -625,9 +886,9 @@ void UDPLink::_onErrorOccurred(const QString &errorString)
     emit communicationError(tr("UDP Link Error"), tr("Link %1: %2").arg(_udpConfig->name(), errorString));
 }
 
-void UDPLink::_onDataReceived(const QByteArray &data)
+void UDPLink::_onDataReceived(const QByteArray &data, qint64 readTimeNSecs)
 {
-    emit bytesReceived(this, data);
+    _emitBytesReceived(data, readTimeNSecs);
 }
 
 void UDPLink::_onDataSent(const QByteArray &data)
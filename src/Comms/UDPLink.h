@@ -16,6 +16,8 @@
 #include <QtCore/QString>
 #include <QtNetwork/QHostAddress>
 
+#include <memory>
+
 #ifdef QGC_ZEROCONF_ENABLED
 #ifdef Q_OS_WIN
 #define WIN32_LEAN_AND_MEAN
@@ -26,6 +28,7 @@
 #include "LinkConfiguration.h"
 #include "LinkInterface.h"
 
+class QSocketNotifier;
 class QUdpSocket;
 class QThread;
 
@@ -120,6 +123,12 @@ class UDPWorker : public QObject
 
     bool isConnected() const;
 
+    /// Selects the batched receive path, which reads many datagrams per system call on a socket owned by the worker
+    /// in place of the QUdpSocket. Takes effect on the next connectLink(). Enabled by default where supported.
+    void setBatchedReceive(bool enabled) { _batchedReceiveEnabled = enabled && batchedReceiveSupported(); }
+    bool batchedReceive() const { return _batchedReceiveEnabled; }
+    static bool batchedReceiveSupported();
+
 public slots:
     void setupSocket();
     void connectLink();
@@ -130,17 +139,28 @@ public slots:
     void connected();
     void disconnected();
     void errorOccurred(const QString &errorString);
-    void dataReceived(const QByteArray &data);
+    /// @param readTimeNSecs Time the data was read, see LinkMetrics::timestampNSecs
+    void dataReceived(const QByteArray &data, qint64 readTimeNSecs);
     void dataSent(const QByteArray &data);
 
 private slots:
     void _onSocketConnected();
     void _onSocketDisconnected();
     void _onSocketReadyRead();
+    void _onBatchedReadyRead();
     void _onSocketBytesWritten(qint64 bytes);
     void _onSocketErrorOccurred(QAbstractSocket::SocketError socketError);
 
 private:
+    bool _bindSocket();
+    qint64 _writeDatagram(const QByteArray &data, const QHostAddress &address, quint16 port);
+    void _addSessionTarget(const QHostAddress &address, quint16 port);
+    bool _openBatchedSocket();
+    void _closeBatchedSocket();
+
+    /// recvmmsg buffers, only allocated when the batched receive path is used
+    struct BatchedReceive;
+
     const UDPConfiguration *_udpConfig = nullptr;
     QUdpSocket *_socket = nullptr;
     QMutex _sessionTargetsMutex;
@@ -149,6 +169,11 @@ private slots:
     bool _errorEmitted = false;
     QSet<QHostAddress> _localAddresses;
 
+    bool _batchedReceiveEnabled = batchedReceiveSupported();
+    std::unique_ptr<BatchedReceive> _batchedReceive;
+    int _batchedDescriptor = -1;
+    QSocketNotifier *_readNotifier = nullptr;
+
     static const QHostAddress _multicastGroup;
 
 #ifdef QGC_ZEROCONF_ENABLED
@@ -182,7 +207,7 @@ private slots:
     void _onConnected();
     void _onDisconnected();
     void _onErrorOccurred(const QString &errorString);
-    void _onDataReceived(const QByteArray &data);
+    void _onDataReceived(const QByteArray &data, qint64 readTimeNSecs);
     void _onDataSent(const QByteArray &data);
 
 private:
@@ -8,11 +8,15 @@
  ****************************************************************************/
 
 #include "Fact.h"
+#include "FactUpdateScheduler.h"
 #include "FactValueSliderListModel.h"
 #include "QGCApplication.h"
 #include "QGCCorePlugin.h"
 #include "QGCLoggingCategory.h"
 
+#include <cmath>
+#include <type_traits>
+
 QGC_LOGGING_CATEGORY(FactLog, "qgc.factsystem.fact")
 
 Fact::Fact(QObject *parent)
@@ -67,6 +71,10 @@ Fact::Fact(const Fact &other, QObject *parent)
 Fact::~Fact()
 {
     // qCDebug(FactLog) << Q_FUNC_INFO << this;
+
+    if (_deferredUpdateScheduled) {
+        FactUpdateScheduler::instance()->cancelDeferredUpdate(this, _deferredUpdateRateMSecs);
+    }
 }
 
 void Fact::_init()
@@ -100,7 +108,7 @@ void Fact::forceSetRawValue(const QVariant &value)
 
         if (_metaData->convertAndValidateRaw(value, true /* convertOnly */, typedValue, errorString)) {
             _rawValue.setValue(typedValue);
-            _sendValueChangedSignal(cookedValue());
+            _sendValueChangedSignal();
             //-- Must be in this order
             emit containerRawValueChanged(rawValue());
             emit rawValueChanged(_rawValue);
@@ -119,7 +127,7 @@ void Fact::setRawValue(const QVariant &value)
         if (_metaData->convertAndValidateRaw(value, true /* convertOnly */, typedValue, errorString)) {
             if (typedValue != _rawValue) {
                 _rawValue.setValue(typedValue);
-                _sendValueChangedSignal(cookedValue());
+                _sendValueChangedSignal();
                 //-- Must be in this order
                 emit containerRawValueChanged(rawValue());
                 emit rawValueChanged(_rawValue);
@@ -130,6 +138,98 @@ void Fact::setRawValue(const QVariant &value)
     }
 }
 
+template<typename T>
+void Fact::_setRawValueTyped(T value)
+{
+    if (_rawValue.metaType() == QMetaType::fromType<T>()) {
+        const T currentValue = *static_cast<const T*>(_rawValue.constData());
+        if (currentValue == value) {
+            return;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            // Stale telemetry is usually reported as NaN, don't resend it on every update
+            if (std::isnan(currentValue) && std::isnan(value)) {
+                return;
+            }
+        }
+    }
+
+    // Reuses the storage when the type is unchanged
+    _rawValue.setValue(value);
+    _sendValueChangedSignal();
+    emit rawValueChanged(_rawValue);
+}
+
+void Fact::setRawValueDouble(double value)
+{
+    // The meta data type is what setRawValue converts to
+    switch (_metaData ? _metaData->type() : _type) {
+    case FactMetaData::valueTypeFloat:
+        _setRawValueTyped<float>(static_cast<float>(value));
+        return;
+    case FactMetaData::valueTypeDouble:
+    case FactMetaData::valueTypeElapsedTimeInSeconds:
+        _setRawValueTyped<double>(value);
+        return;
+    case FactMetaData::valueTypeBool:
+        _setRawValueTyped<bool>(value != 0);
+        return;
+    default:
+        break;
+    }
+
+    if (std::isfinite(value)) {
+        // Rounded the same way as the QVariant conversion in setRawValue
+        setRawValueInt(qRound64(value));
+    } else {
+        setRawValue(value);
+    }
+}
+
+void Fact::setRawValueInt(qint64 value)
+{
+    switch (_metaData ? _metaData->type() : _type) {
+    case FactMetaData::valueTypeInt8:
+    case FactMetaData::valueTypeInt16:
+    case FactMetaData::valueTypeInt32:
+        _setRawValueTyped<int>(static_cast<int>(value));
+        break;
+    case FactMetaData::valueTypeInt64:
+        _setRawValueTyped<qint64>(value);
+        break;
+    case FactMetaData::valueTypeUint8:
+    case FactMetaData::valueTypeUint16:
+    case FactMetaData::valueTypeUint32:
+        _setRawValueTyped<uint>(static_cast<uint>(value));
+        break;
+    case FactMetaData::valueTypeUint64:
+        _setRawValueTyped<quint64>(static_cast<quint64>(value));
+        break;
+    case FactMetaData::valueTypeFloat:
+        _setRawValueTyped<float>(static_cast<float>(value));
+        break;
+    case FactMetaData::valueTypeDouble:
+    case FactMetaData::valueTypeElapsedTimeInSeconds:
+        _setRawValueTyped<double>(static_cast<double>(value));
+        break;
+    case FactMetaData::valueTypeBool:
+        _setRawValueTyped<bool>(value != 0);
+        break;
+    default:
+        setRawValue(value);
+        break;
+    }
+}
+
+void Fact::setRawValueBool(bool value)
+{
+    if ((_metaData ? _metaData->type() : _type) == FactMetaData::valueTypeBool) {
+        _setRawValueTyped<bool>(value);
+    } else {
+        setRawValueInt(value ? 1 : 0);
+    }
+}
+
 void Fact::setCookedValue(const QVariant& value)
 {
     if (_metaData) {
@@ -169,7 +269,7 @@ void Fact::containerSetRawValue(const QVariant &value)
 {
     if (_rawValue != value) {
         _rawValue = value;
-        _sendValueChangedSignal(cookedValue());
+        _sendValueChangedSignal();
         emit rawValueChanged(_rawValue);
     }
 
@@ -636,13 +736,27 @@ void Fact::setSendValueChangedSignals(bool sendValueChangedSignals)
     }
 }
 
-void Fact::_sendValueChangedSignal(const QVariant &value)
+void Fact::setDeferredUpdateRate(int rateMSecs)
+{
+    if (_deferredUpdateScheduled) {
+        FactUpdateScheduler::instance()->cancelDeferredUpdate(this, _deferredUpdateRateMSecs);
+        _deferredUpdateScheduled = false;
+    }
+
+    _deferredUpdateRateMSecs = qMax(rateMSecs, 0);
+}
+
+void Fact::_sendValueChangedSignal()
 {
     if (_sendValueChangedSignals) {
-        emit valueChanged(value);
+        emit valueChanged(cookedValue());
         _deferredValueChangeSignal = false;
     } else {
         _deferredValueChangeSignal = true;
+        if ((_deferredUpdateRateMSecs > 0) && !_deferredUpdateScheduled) {
+            _deferredUpdateScheduled = true;
+            FactUpdateScheduler::instance()->scheduleDeferredUpdate(this, _deferredUpdateRateMSecs);
+        }
     }
 }
 
@@ -137,6 +137,13 @@ class Fact : public QObject
     QString rawValueStringFullPrecision() const;
 
     void setRawValue(const QVariant &value);
+
+    /// Fast setters for telemetry values from trusted sources such as FactGroups. The value is stored as the Fact type
+    /// without going through the meta data conversion and validation, and the cooked value is only computed when the
+    /// valueChanged signal goes out. Like containerSetRawValue these do not signal containerRawValueChanged.
+    void setRawValueDouble(double value);
+    void setRawValueInt(qint64 value);
+    void setRawValueBool(bool value);
     void setCookedValue(const QVariant &value);
     void setEnumIndex(int index);
     void setEnumStringValue(const QString &value);
@@ -150,6 +157,9 @@ class Fact : public QObject
     void clearDeferredValueChangeSignal() { _deferredValueChangeSignal = false; }
     void sendDeferredValueChangedSignal();
 
+    /// Deferred valueChanged signals are sent by FactUpdateScheduler at this rate, 0: only when sendDeferredValueChangedSignal is called
+    void setDeferredUpdateRate(int rateMSecs);
+
     /// Sets and sends new value to vehicle even if value is the same
     void forceSetRawValue(const QVariant &value);
 
@@ -187,7 +197,7 @@ class Fact : public QObject
 
 protected:
     QString _variantToString(const QVariant &variant, int decimalPlaces) const;
-    void _sendValueChangedSignal(const QVariant &value);
+    void _sendValueChangedSignal();
 
     QString _name;
     int _componentId = -1;
@@ -196,6 +206,8 @@ class Fact : public QObject
     FactMetaData *_metaData = nullptr;
     bool _sendValueChangedSignals = true;
     bool _deferredValueChangeSignal = false;
+    int _deferredUpdateRateMSecs = 0;
+    bool _deferredUpdateScheduled = false;      ///< Queued with FactUpdateScheduler
     FactValueSliderListModel *_valueSliderModel = nullptr;
 
     static constexpr const char *kMissingMetadata = "Meta data pointer missing";
@@ -204,5 +216,10 @@ private slots:
     void _checkForRebootMessaging();
 
 private:
+    friend class FactUpdateScheduler;
+
     void _init();
+
+    template<typename T>
+    void _setRawValueTyped(T value);
 };
@@ -8,6 +8,7 @@
  ****************************************************************************/
 
 #include "FactGroup.h"
+#include "FactUpdateScheduler.h"
 #include "QGCLoggingCategory.h"
 
 QGC_LOGGING_CATEGORY(FactGroupLog, "qgc.factsystem.factgroup")
@@ -18,7 +19,6 @@ FactGroup::FactGroup(int updateRateMsecs, const QString &metaDataFile, QObject *
     , _ignoreCamelCase(ignoreCamelCase)
 {
     // qCDebug(FactGroupLog) << Q_FUNC_INFO << this;
-    _setupTimer();
     _nameToFactMetaDataMap = FactMetaData::createMapFromJsonFile(metaDataFile, this);
 }
 
@@ -28,12 +28,13 @@ FactGroup::FactGroup(int updateRateMsecs, QObject *parent, bool ignoreCamelCase)
     , _ignoreCamelCase(ignoreCamelCase)
 {
     // qCDebug(FactGroupLog) << Q_FUNC_INFO << this;
-    _setupTimer();
 }
 
 FactGroup::~FactGroup()
 {
     // qCDebug(FactGroupLog) << Q_FUNC_INFO << this;
+
+    _setPeriodicUpdates(false);
 }
 
 void FactGroup::_loadFromJsonArray(const QJsonArray &jsonArray)
@@ -42,16 +43,6 @@ void FactGroup::_loadFromJsonArray(const QJsonArray &jsonArray)
     _nameToFactMetaDataMap = FactMetaData::createMapFromJsonArray(jsonArray, defineMap, this);
 }
 
-void FactGroup::_setupTimer()
-{
-    if (_updateRateMSecs > 0) {
-        (void) connect(&_updateTimer, &QTimer::timeout, this, &FactGroup::_updateAllValues);
-        _updateTimer.setSingleShot(false);
-        _updateTimer.setInterval(_updateRateMSecs);
-        _updateTimer.start();
-    }
-}
-
 bool FactGroup::factExists(const QString &name) const
 {
     if (name.contains(".")) {
@@ -127,6 +118,7 @@ void FactGroup::_addFact(Fact *fact, const QString &name)
     }
 
     fact->setSendValueChangedSignals(_updateRateMSecs == 0);
+    fact->setDeferredUpdateRate(_updateRateMSecs);
     if (_nameToFactMetaDataMap.contains(name)) {
         fact->setMetaData(_nameToFactMetaDataMap[name], true /* setDefaultFromMetaData */);
     }
@@ -148,24 +140,28 @@ void FactGroup::_addFactGroup(FactGroup *factGroup, const QString &name)
     emit factGroupNamesChanged();
 }
 
-void FactGroup::_updateAllValues()
+void FactGroup::_setPeriodicUpdates(bool periodicUpdates)
 {
-    for (Fact *fact: _nameToFactMap) {
-        fact->sendDeferredValueChangedSignal();
+    if (_updateRateMSecs == 0) {
+        return;
+    }
+
+    _periodicUpdates = periodicUpdates;
+    if (_periodicUpdates && !_liveUpdates) {
+        FactUpdateScheduler::instance()->addPeriodicUpdate(this, _updateRateMSecs);
+    } else {
+        FactUpdateScheduler::instance()->removePeriodicUpdate(this, _updateRateMSecs);
     }
 }
 
 void FactGroup::setLiveUpdates(bool liveUpdates)
 {
-    if (_updateTimer.interval() == 0) {
+    if (_updateRateMSecs == 0) {
         return;
     }
 
-    if (liveUpdates) {
-        _updateTimer.stop();
-    } else {
-        _updateTimer.start();
-    }
+    _liveUpdates = liveUpdates;
+    _setPeriodicUpdates(_periodicUpdates);
 
     for (Fact *fact: _nameToFactMap) {
         fact->setSendValueChangedSignals(liveUpdates);
@@ -18,6 +18,7 @@
 
 #include "Fact.h"
 #include "MAVLinkLib.h"
+#include "MAVLinkMessageDispatcher.h"
 
 class Vehicle;
 
@@ -32,6 +33,7 @@ class FactGroup : public QObject
     Q_PROPERTY(QStringList  factNames           READ factNames          NOTIFY factNamesChanged)
     Q_PROPERTY(QStringList  factGroupNames      READ factGroupNames     NOTIFY factGroupNamesChanged)
     Q_PROPERTY(bool         telemetryAvailable  READ telemetryAvailable NOTIFY telemetryAvailableChanged)   ///< false: No telemetry for these values has been received
+    friend class FactUpdateScheduler;
 
 public:
     explicit FactGroup(int updateRateMsecs, const QString &metaDataFile, QObject *parent = nullptr, bool ignoreCamelCase = false);
@@ -60,13 +62,19 @@ class FactGroup : public QObject
     /// Allows a FactGroup to parse incoming messages and fill in values
     virtual void handleMessage(Vehicle *vehicle, const mavlink_message_t &message) {}
 
+    /// Message ids consumed by handleMessage, Vehicle only routes these messages to the FactGroup.
+    /// FactGroups which do not specify their message ids receive all messages.
+    virtual QList<uint32_t> handledMessageIds() const { return { MAVLinkMessageDispatcher::allMessageIds }; }
+
 signals:
     void factNamesChanged();
     void factGroupNamesChanged();
     void telemetryAvailableChanged(bool telemetryAvailable);
 
 protected slots:
-    virtual void _updateAllValues();
+    /// Called every update interval once _setPeriodicUpdates is turned on, for FactGroups which compute their values
+    /// rather than receive them. Changed values are sent by FactUpdateScheduler, this doesn't need to do it.
+    virtual void _updateAllValues() {}
 
 protected:
     void _addFact(Fact *fact, const QString &name);
@@ -75,6 +83,7 @@ protected slots:
     void _addFactGroup(FactGroup *factGroup) { _addFactGroup(factGroup, factGroup->objectName()); }
     void _loadFromJsonArray(const QJsonArray &jsonArray);
     void _setTelemetryAvailable(bool telemetryAvailable);
+    void _setPeriodicUpdates(bool periodicUpdates);
 
     const int _updateRateMSecs = 0;   ///< Update rate for Fact::valueChanged signals, 0: immediate update
 
@@ -84,10 +93,10 @@ protected slots:
     QStringList _factNames;
 
 private:
-    void _setupTimer();
     static QString _camelCase(const QString &text);
 
-    QTimer _updateTimer;
     const bool _ignoreCamelCase = false;
     bool _telemetryAvailable = false;
+    bool _periodicUpdates = false;
+    bool _liveUpdates = false;
 };
@@ -28,6 +28,9 @@ class FactGroupListModel : public QmlObjectListModel
     /// Allows for creation/updating of dynamic FactGroups based on incoming messages
     void handleMessageForFactGroupCreation(Vehicle *vehicle, const mavlink_message_t &message);
 
+    /// Message ids which can result in the creation of a new FactGroup
+    virtual QList<uint32_t> creationMessageIds() const = 0;
+
 protected:
     virtual bool _shouldHandleMessage(const mavlink_message_t &message, QList<uint32_t> &ids) const = 0;
     virtual FactGroupWithId *_createFactGroupWithId(uint32_t id) = 0;
@@ -227,6 +227,8 @@ class FactMetaData : public QObject
     static constexpr const char *qgcFileType = "FactMetaData";
 
 private:
+    friend class ParamMetaDataBlob;
+
     QVariant _minForType() const { return minForType(_type); };
     QVariant _maxForType() const { return maxForType(_type); };
     /// Set translators according to app settings
@@ -0,0 +1,191 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "FactUpdateScheduler.h"
+#include "Fact.h"
+#include "FactGroup.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QApplicationStatic>
+#include <QtCore/QTimer>
+#include <QtGui/QGuiApplication>
+#include <QtGui/QScreen>
+
+QGC_LOGGING_CATEGORY(FactUpdateSchedulerLog, "qgc.factsystem.factupdatescheduler")
+
+Q_APPLICATION_STATIC(FactUpdateScheduler, _factUpdateSchedulerInstance);
+
+FactUpdateScheduler::FactUpdateScheduler(QObject *parent)
+    : QObject(parent)
+    , _tickTimer(new QTimer(this))
+{
+    // qCDebug(FactUpdateSchedulerLog) << Q_FUNC_INFO << this;
+
+    const QScreen *const screen = QGuiApplication::primaryScreen();
+    if (screen && (screen->refreshRate() > 0)) {
+        _tickIntervalMSecs = qBound(4, qRound(1000.0 / screen->refreshRate()), 50);
+    }
+    qCDebug(FactUpdateSchedulerLog) << "Tick interval" << _tickIntervalMSecs;
+
+    _clock.start();
+
+    _tickTimer->setTimerType(Qt::PreciseTimer);
+    _tickTimer->setInterval(_tickIntervalMSecs);
+    (void) connect(_tickTimer, &QTimer::timeout, this, &FactUpdateScheduler::_tick);
+}
+
+FactUpdateScheduler::~FactUpdateScheduler()
+{
+    // qCDebug(FactUpdateSchedulerLog) << Q_FUNC_INFO << this;
+}
+
+FactUpdateScheduler *FactUpdateScheduler::instance()
+{
+    return _factUpdateSchedulerInstance();
+}
+
+void FactUpdateScheduler::scheduleDeferredUpdate(Fact *fact, int rateMSecs)
+{
+    Q_ASSERT(rateMSecs > 0);
+
+    RateClass &rateClass = _rateClasses[rateMSecs];
+    _start(rateClass, rateMSecs);
+    rateClass.pending.append(fact);
+}
+
+void FactUpdateScheduler::cancelDeferredUpdate(Fact *fact, int rateMSecs)
+{
+    const auto it = _rateClasses.find(rateMSecs);
+    if (it == _rateClasses.end()) {
+        return;
+    }
+
+    // Not removed since a flush may be walking the list
+    const qsizetype index = it->pending.indexOf(fact);
+    if (index >= 0) {
+        it->pending[index] = nullptr;
+    }
+}
+
+void FactUpdateScheduler::addPeriodicUpdate(FactGroup *factGroup, int rateMSecs)
+{
+    Q_ASSERT(rateMSecs > 0);
+
+    RateClass &rateClass = _rateClasses[rateMSecs];
+    if (!rateClass.periodicGroups.contains(factGroup)) {
+        _start(rateClass, rateMSecs);
+        rateClass.periodicGroups.append(factGroup);
+    }
+}
+
+void FactUpdateScheduler::removePeriodicUpdate(FactGroup *factGroup, int rateMSecs)
+{
+    const auto it = _rateClasses.find(rateMSecs);
+    if (it != _rateClasses.end()) {
+        (void) it->periodicGroups.removeOne(factGroup);
+    }
+}
+
+void FactUpdateScheduler::_start(RateClass &rateClass, int rateMSecs)
+{
+    if (rateClass.pending.isEmpty() && rateClass.periodicGroups.isEmpty()) {
+        // Align to multiples of the rate so all rate classes stay in phase with each other
+        const qint64 nowMSecs = _clock.elapsed();
+        rateClass.nextFlushMSecs = ((nowMSecs / rateMSecs) + 1) * rateMSecs;
+    }
+
+    if (!_tickTimer->isActive()) {
+        _rateWindowStartMSecs = _clock.elapsed();
+        _rateWindowStartSignals = _signalsEmitted;
+        _tickTimer->start();
+    }
+}
+
+void FactUpdateScheduler::_tick()
+{
+    const qint64 nowMSecs = _clock.elapsed();
+
+    bool active = false;
+    for (auto it = _rateClasses.begin(); it != _rateClasses.end(); ++it) {
+        RateClass &rateClass = it.value();
+        if (rateClass.pending.isEmpty() && rateClass.periodicGroups.isEmpty()) {
+            continue;
+        }
+
+        active = true;
+        if (nowMSecs >= rateClass.nextFlushMSecs) {
+            _flush(rateClass);
+            rateClass.nextFlushMSecs = ((nowMSecs / it.key()) + 1) * it.key();
+        }
+    }
+
+    _updateRate(nowMSecs);
+
+    if (!active) {
+        _tickTimer->stop();
+        _signalsPerSecond = 0;
+    }
+}
+
+void FactUpdateScheduler::_flush(RateClass &rateClass)
+{
+    _flushes++;
+
+    // Periodic updates go first so the values they compute are sent in this flush
+    for (qsizetype i = 0; i < rateClass.periodicGroups.count(); i++) {
+        rateClass.periodicGroups[i]->_updateAllValues();
+    }
+
+    // Facts which change again while their signals are being sent are appended and go out with the next flush
+    const qsizetype count = rateClass.pending.count();
+    for (qsizetype i = 0; i < count; i++) {
+        Fact *const fact = rateClass.pending[i];
+        if (!fact) {
+            continue;
+        }
+
+        fact->_deferredUpdateScheduled = false;
+        if (fact->deferredValueChangeSignal()) {
+            fact->sendDeferredValueChangedSignal();
+            _signalsEmitted++;
+        }
+    }
+    rateClass.pending.remove(0, count);
+}
+
+void FactUpdateScheduler::flush()
+{
+    for (RateClass &rateClass : _rateClasses) {
+        _flush(rateClass);
+    }
+}
+
+void FactUpdateScheduler::_updateRate(qint64 nowMSecs)
+{
+    const qint64 elapsedMSecs = nowMSecs - _rateWindowStartMSecs;
+    if (elapsedMSecs < kRateWindowMSecs) {
+        return;
+    }
+
+    _signalsPerSecond = (static_cast<double>(_signalsEmitted - _rateWindowStartSignals) * 1000.0) / static_cast<double>(elapsedMSecs);
+    _rateWindowStartSignals = _signalsEmitted;
+    _rateWindowStartMSecs = nowMSecs;
+
+    qCDebug(FactUpdateSchedulerLog) << "Signals per second" << _signalsPerSecond << "pending" << pendingCount();
+}
+
+qsizetype FactUpdateScheduler::pendingCount() const
+{
+    qsizetype count = 0;
+    for (const RateClass &rateClass : _rateClasses) {
+        count += rateClass.pending.count() - rateClass.pending.count(nullptr);
+    }
+
+    return count;
+}
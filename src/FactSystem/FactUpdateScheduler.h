@@ -0,0 +1,85 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+
+class Fact;
+class FactGroup;
+class QTimer;
+
+Q_DECLARE_LOGGING_CATEGORY(FactUpdateSchedulerLog)
+
+/// Sends the deferred valueChanged signals for all rate limited FactGroups.
+/// Facts register themselves here the first time their value changes after a flush, so a flush only touches the Facts
+/// which actually changed. A single timer ticks at the display refresh interval and each update rate is flushed on the
+/// first tick at or after its next multiple of the rate. That keeps all FactGroups with the same rate in phase, so the
+/// UI sees one batch of changes per rate instead of a stream of out of phase updates from every FactGroup. The timer
+/// only runs while there is something to flush. GUI thread only.
+class FactUpdateScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FactUpdateScheduler(QObject *parent = nullptr);
+    ~FactUpdateScheduler();
+
+    static FactUpdateScheduler *instance();
+
+    /// Queues the deferred valueChanged signal of fact for the next flush of rateMSecs
+    void scheduleDeferredUpdate(Fact *fact, int rateMSecs);
+
+    /// Removes a Fact which is going away from the pending flush
+    void cancelDeferredUpdate(Fact *fact, int rateMSecs);
+
+    /// FactGroups which compute values themselves get FactGroup::_updateAllValues called every rateMSecs
+    void addPeriodicUpdate(FactGroup *factGroup, int rateMSecs);
+    void removePeriodicUpdate(FactGroup *factGroup, int rateMSecs);
+
+    /// Sends everything pending right away
+    void flush();
+
+    int tickIntervalMSecs() const { return _tickIntervalMSecs; }
+    quint64 signalsEmitted() const { return _signalsEmitted; }
+    double signalsPerSecond() const { return _signalsPerSecond; }
+    quint64 flushes() const { return _flushes; }
+    qsizetype pendingCount() const;
+
+private slots:
+    void _tick();
+
+private:
+    struct RateClass {
+        qint64 nextFlushMSecs = 0;
+        QList<Fact*> pending;               ///< Facts removed while a flush is running are set to nullptr
+        QList<FactGroup*> periodicGroups;
+    };
+
+    void _start(RateClass &rateClass, int rateMSecs);
+    void _flush(RateClass &rateClass);
+    void _updateRate(qint64 nowMSecs);
+
+    QTimer *_tickTimer = nullptr;
+    QElapsedTimer _clock;
+    int _tickIntervalMSecs = 16;
+    QMap<int, RateClass> _rateClasses;      ///< Keyed by update rate
+
+    quint64 _signalsEmitted = 0;
+    quint64 _flushes = 0;
+    double _signalsPerSecond = 0;
+    quint64 _rateWindowStartSignals = 0;
+    qint64 _rateWindowStartMSecs = 0;
+
+    static constexpr int kRateWindowMSecs = 1000;
+};
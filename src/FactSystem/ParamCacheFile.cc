@@ -0,0 +1,378 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "ParamCacheFile.h"
+#include "QGC.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QSaveFile>
+#include <QtCore/QtEndian>
+
+#include <cstring>
+
+QGC_LOGGING_CATEGORY(ParamCacheFileLog, "qgc.factsystem.paramcachefile")
+
+ParamCacheFile::ParamCacheFile(const QString &fileName)
+    : _file(fileName)
+{
+    // qCDebug(ParamCacheFileLog) << Q_FUNC_INFO << this;
+}
+
+ParamCacheFile::~ParamCacheFile()
+{
+    close();
+
+    // qCDebug(ParamCacheFileLog) << Q_FUNC_INFO << this;
+}
+
+quint32 ParamCacheFile::packFirmwareVersion(int majorVersion, int minorVersion, int patchVersion)
+{
+    return ((static_cast<quint32>(qBound(0, majorVersion, 0xFFFF)) << 16) |
+            (static_cast<quint32>(qBound(0, minorVersion, 0xFF)) << 8) |
+            static_cast<quint32>(qBound(0, patchVersion, 0xFF)));
+}
+
+bool ParamCacheFile::_fillRecord(const Param &param, Record &record)
+{
+    (void) memset(&record, 0, sizeof(record));
+
+    const QByteArray name = param.name.toLatin1();
+    if (name.isEmpty() || (name.length() > kNameLength)) {
+        qCWarning(ParamCacheFileLog) << "Invalid param name" << param.name;
+        return false;
+    }
+    (void) memcpy(record.name, name.constData(), static_cast<size_t>(name.length()));
+
+    bool ok = false;
+    switch (param.type) {
+    case FactMetaData::valueTypeUint8:
+        qToLittleEndian(static_cast<quint8>(param.value.toUInt(&ok)), record.value);
+        break;
+    case FactMetaData::valueTypeInt8:
+        qToLittleEndian(static_cast<qint8>(param.value.toInt(&ok)), record.value);
+        break;
+    case FactMetaData::valueTypeUint16:
+        qToLittleEndian(static_cast<quint16>(param.value.toUInt(&ok)), record.value);
+        break;
+    case FactMetaData::valueTypeInt16:
+        qToLittleEndian(static_cast<qint16>(param.value.toInt(&ok)), record.value);
+        break;
+    case FactMetaData::valueTypeUint32:
+        qToLittleEndian(static_cast<quint32>(param.value.toUInt(&ok)), record.value);
+        break;
+    case FactMetaData::valueTypeInt32:
+        qToLittleEndian(static_cast<qint32>(param.value.toInt(&ok)), record.value);
+        break;
+    case FactMetaData::valueTypeUint64:
+        qToLittleEndian(static_cast<quint64>(param.value.toULongLong(&ok)), record.value);
+        break;
+    case FactMetaData::valueTypeInt64:
+        qToLittleEndian(static_cast<qint64>(param.value.toLongLong(&ok)), record.value);
+        break;
+    case FactMetaData::valueTypeFloat:
+        qToLittleEndian(param.value.toFloat(&ok), record.value);
+        break;
+    case FactMetaData::valueTypeDouble:
+        qToLittleEndian(param.value.toDouble(&ok), record.value);
+        break;
+    default:
+        break;
+    }
+
+    if (!ok) {
+        qCWarning(ParamCacheFileLog) << "Unsupported param value" << param.name << param.type << param.value;
+        return false;
+    }
+
+    record.type = static_cast<quint8>(param.type);
+    record.flags = param.volatileValue ? RecordFlagVolatile : 0;
+
+    return true;
+}
+
+quint32 ParamCacheFile::_hashRecord(const Record &record, quint32 hash)
+{
+    if (record.flags & RecordFlagVolatile) {
+        return hash;
+    }
+
+    const size_t nameLength = strnlen(record.name, kNameLength);
+    hash = QGC::crc32(reinterpret_cast<const quint8*>(record.name), static_cast<unsigned>(nameLength), hash);
+    hash = QGC::crc32(record.value, static_cast<unsigned>(FactMetaData::typeToSize(static_cast<FactMetaData::ValueType_t>(record.type))), hash);
+
+    return hash;
+}
+
+QVariant ParamCacheFile::_recordValue(const Record &record)
+{
+    switch (static_cast<FactMetaData::ValueType_t>(record.type)) {
+    case FactMetaData::valueTypeUint8:
+        return QVariant::fromValue(qFromLittleEndian<quint8>(record.value));
+    case FactMetaData::valueTypeInt8:
+        return QVariant::fromValue(qFromLittleEndian<qint8>(record.value));
+    case FactMetaData::valueTypeUint16:
+        return QVariant::fromValue(qFromLittleEndian<quint16>(record.value));
+    case FactMetaData::valueTypeInt16:
+        return QVariant::fromValue(qFromLittleEndian<qint16>(record.value));
+    case FactMetaData::valueTypeUint32:
+        return QVariant::fromValue(qFromLittleEndian<quint32>(record.value));
+    case FactMetaData::valueTypeInt32:
+        return QVariant::fromValue(qFromLittleEndian<qint32>(record.value));
+    case FactMetaData::valueTypeUint64:
+        return QVariant::fromValue(qFromLittleEndian<quint64>(record.value));
+    case FactMetaData::valueTypeInt64:
+        return QVariant::fromValue(qFromLittleEndian<qint64>(record.value));
+    case FactMetaData::valueTypeFloat:
+        return QVariant::fromValue(qFromLittleEndian<float>(record.value));
+    case FactMetaData::valueTypeDouble:
+        return QVariant::fromValue(qFromLittleEndian<double>(record.value));
+    default:
+        return QVariant();
+    }
+}
+
+quint32 ParamCacheFile::hash(const QList<Param> &params)
+{
+    quint32 hash = 0;
+    Record record{};
+    for (const Param &param : params) {
+        if (_fillRecord(param, record)) {
+            hash = _hashRecord(record, hash);
+        }
+    }
+
+    return hash;
+}
+
+bool ParamCacheFile::write(const QString &fileName, const QList<Param> &params, quint32 firmwareVersion)
+{
+    QByteArray bytes(static_cast<qsizetype>(sizeof(Header) + (params.count() * sizeof(Record))), Qt::Uninitialized);
+
+    quint32 hash = 0;
+    Record *const records = reinterpret_cast<Record*>(bytes.data() + sizeof(Header));
+    for (qsizetype i = 0; i < params.count(); i++) {
+        Q_ASSERT((i == 0) || (params[i - 1].name < params[i].name));
+        if (!_fillRecord(params[i], records[i])) {
+            return false;
+        }
+        hash = _hashRecord(records[i], hash);
+    }
+
+    Header header{};
+    qToLittleEndian(kMagic, &header.magic);
+    qToLittleEndian(kVersion, &header.version);
+    qToLittleEndian(static_cast<quint16>(sizeof(Record)), &header.recordSize);
+    qToLittleEndian(hash, &header.paramHash);
+    qToLittleEndian(static_cast<quint32>(params.count()), &header.count);
+    qToLittleEndian(firmwareVersion, &header.firmwareVersion);
+    (void) memcpy(bytes.data(), &header, sizeof(header));
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly) || (file.write(bytes) != bytes.size()) || !file.commit()) {
+        qCWarning(ParamCacheFileLog) << "Failed to write cache file" << fileName << file.errorString();
+        return false;
+    }
+
+    qCDebug(ParamCacheFileLog) << "Wrote" << params.count() << "params hash" << Qt::hex << hash << fileName;
+
+    return true;
+}
+
+bool ParamCacheFile::open(bool writable)
+{
+    close();
+
+    if (!_file.exists()) {
+        return false;
+    }
+
+    if (!_file.open(writable ? QIODevice::ReadWrite : QIODevice::ReadOnly)) {
+        qCWarning(ParamCacheFileLog) << "Failed to open cache file" << _file.fileName() << _file.errorString();
+        return false;
+    }
+
+    const qint64 size = _file.size();
+    if (size < static_cast<qint64>(sizeof(Header))) {
+        qCWarning(ParamCacheFileLog) << "Cache file too small" << _file.fileName();
+        _file.close();
+        return false;
+    }
+
+    _data = _file.map(0, size);
+    if (!_data) {
+        qCWarning(ParamCacheFileLog) << "Failed to map cache file" << _file.fileName() << _file.errorString();
+        _file.close();
+        return false;
+    }
+    _writable = writable;
+
+    const Header *const header = _header();
+    const bool valid = (qFromLittleEndian(header->magic) == kMagic) &&
+                       (qFromLittleEndian(header->version) == kVersion) &&
+                       (qFromLittleEndian(header->recordSize) == sizeof(Record)) &&
+                       (size == static_cast<qint64>(sizeof(Header) + (static_cast<qint64>(qFromLittleEndian(header->count)) * sizeof(Record))));
+    if (!valid) {
+        qCWarning(ParamCacheFileLog) << "Invalid cache file" << _file.fileName();
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void ParamCacheFile::close()
+{
+    if (_data) {
+        (void) _file.unmap(_data);
+        _data = nullptr;
+    }
+    _writable = false;
+    _file.close();
+}
+
+quint32 ParamCacheFile::paramHash() const
+{
+    Q_ASSERT(isOpen());
+
+    return qFromLittleEndian(_header()->paramHash);
+}
+
+quint32 ParamCacheFile::count() const
+{
+    Q_ASSERT(isOpen());
+
+    return qFromLittleEndian(_header()->count);
+}
+
+quint32 ParamCacheFile::firmwareVersion() const
+{
+    Q_ASSERT(isOpen());
+
+    return qFromLittleEndian(_header()->firmwareVersion);
+}
+
+QString ParamCacheFile::name(quint32 index) const
+{
+    Q_ASSERT(index < count());
+
+    const Record *const record = _record(index);
+    return QString::fromLatin1(record->name, static_cast<qsizetype>(strnlen(record->name, kNameLength)));
+}
+
+FactMetaData::ValueType_t ParamCacheFile::type(quint32 index) const
+{
+    Q_ASSERT(index < count());
+
+    return static_cast<FactMetaData::ValueType_t>(_record(index)->type);
+}
+
+QVariant ParamCacheFile::value(quint32 index) const
+{
+    Q_ASSERT(index < count());
+
+    return _recordValue(*_record(index));
+}
+
+bool ParamCacheFile::isVolatile(quint32 index) const
+{
+    Q_ASSERT(index < count());
+
+    return (_record(index)->flags & RecordFlagVolatile);
+}
+
+QList<ParamCacheFile::Param> ParamCacheFile::params() const
+{
+    Q_ASSERT(isOpen());
+
+    QList<Param> params;
+    const quint32 paramCount = count();
+    params.reserve(paramCount);
+    for (quint32 index = 0; index < paramCount; index++) {
+        params.append({ name(index), type(index), value(index), isVolatile(index) });
+    }
+
+    return params;
+}
+
+qint64 ParamCacheFile::indexOf(const QString &name) const
+{
+    Q_ASSERT(isOpen());
+
+    const QByteArray latin1 = name.toLatin1();
+    if (latin1.length() > kNameLength) {
+        return -1;
+    }
+
+    // Zero padding makes a plain memcmp order names the same way QString does for ASCII
+    char key[kNameLength]{};
+    (void) memcpy(key, latin1.constData(), static_cast<size_t>(latin1.length()));
+
+    qint64 low = 0;
+    qint64 high = static_cast<qint64>(count()) - 1;
+    while (low <= high) {
+        const qint64 mid = low + ((high - low) / 2);
+        const int result = memcmp(_record(static_cast<quint32>(mid))->name, key, kNameLength);
+        if (result == 0) {
+            return mid;
+        } else if (result < 0) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+bool ParamCacheFile::updateValue(const QString &name, FactMetaData::ValueType_t type, const QVariant &value)
+{
+    if (!isOpen() || !_writable) {
+        return false;
+    }
+
+    const qint64 index = indexOf(name);
+    if ((index < 0) || (this->type(static_cast<quint32>(index)) != type)) {
+        return false;
+    }
+
+    Record *const record = const_cast<Record*>(_record(static_cast<quint32>(index)));
+
+    Param param;
+    param.name = name;
+    param.type = type;
+    param.value = value;
+    param.volatileValue = (record->flags & RecordFlagVolatile);
+
+    Record updated{};
+    if (!_fillRecord(param, updated)) {
+        return false;
+    }
+
+    if (memcmp(record->value, updated.value, sizeof(updated.value)) == 0) {
+        return true;
+    }
+
+    (void) memcpy(record->value, updated.value, sizeof(updated.value));
+    qToLittleEndian(_computeHash(), &reinterpret_cast<Header*>(_data)->paramHash);
+
+    qCDebug(ParamCacheFileLog) << "Updated" << name << value << "hash" << Qt::hex << paramHash();
+
+    return true;
+}
+
+quint32 ParamCacheFile::_computeHash() const
+{
+    quint32 hash = 0;
+    const quint32 paramCount = count();
+    for (quint32 index = 0; index < paramCount; index++) {
+        hash = _hashRecord(*_record(index), hash);
+    }
+
+    return hash;
+}
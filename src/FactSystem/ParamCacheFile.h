@@ -0,0 +1,117 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QFile>
+#include <QtCore/QList>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QString>
+#include <QtCore/QVariant>
+
+#include "FactMetaData.h"
+
+Q_DECLARE_LOGGING_CATEGORY(ParamCacheFileLog)
+
+/// Binary parameter cache of a single vehicle component.
+/// The file is a fixed size header followed by one fixed width record per parameter, sorted by name. All values are
+/// little endian. The header holds the parameter set hash PX4 reports through _HASH_CHECK, so checking for a cache hit
+/// only reads the header from the memory mapped file. Records are read straight from the mapping and a single value can
+/// be updated in place, which also updates the hash in the header.
+class ParamCacheFile
+{
+public:
+    struct Param {
+        QString name;
+        FactMetaData::ValueType_t type = FactMetaData::valueTypeInt32;
+        QVariant value;
+        bool volatileValue = false;     ///< Volatile parameters are cached but don't take part in the hash
+    };
+
+    explicit ParamCacheFile(const QString &fileName);
+    ~ParamCacheFile();
+
+    /// Writes a complete cache file, replacing an existing one
+    ///     @param params Must be sorted by name
+    ///     @param firmwareVersion see packFirmwareVersion
+    static bool write(const QString &fileName, const QList<Param> &params, quint32 firmwareVersion);
+
+    /// Hash over the names and values of all non-volatile params, the same way PX4 computes it
+    ///     @param params Must be sorted by name
+    static quint32 hash(const QList<Param> &params);
+
+    /// @return 0: Version is not known
+    static quint32 packFirmwareVersion(int majorVersion, int minorVersion, int patchVersion);
+
+    /// Maps the file and validates the header
+    ///     @param writable true: updateValue can be used
+    bool open(bool writable = false);
+    void close();
+    bool isOpen() const { return (_data != nullptr); }
+
+    quint32 paramHash() const;
+    quint32 count() const;
+    quint32 firmwareVersion() const;
+
+    QString name(quint32 index) const;
+    FactMetaData::ValueType_t type(quint32 index) const;
+    QVariant value(quint32 index) const;
+    bool isVolatile(quint32 index) const;
+
+    /// Copies all records out of the mapping, for callers which must not keep the file open while using them
+    QList<Param> params() const;
+
+    /// @return -1: No param with this name
+    qint64 indexOf(const QString &name) const;
+
+    /// Updates the value of a single param in place and recomputes the hash
+    ///     @return false: param is not in the cache, has a different type or the file is not open writable
+    bool updateValue(const QString &name, FactMetaData::ValueType_t type, const QVariant &value);
+
+    static constexpr quint32 kMagic = 0x31435051;   ///< "QPC1"
+    static constexpr quint16 kVersion = 1;
+    static constexpr int kNameLength = 16;          ///< Same as the MAVLink param id
+
+private:
+    struct Header {
+        quint32 magic;
+        quint16 version;
+        quint16 recordSize;
+        quint32 paramHash;
+        quint32 count;
+        quint32 firmwareVersion;
+        quint32 reserved[3];
+    };
+    static_assert(sizeof(Header) == 32);
+
+    struct Record {
+        quint8 value[8];            ///< Little endian, only FactMetaData::typeToSize bytes are used
+        char name[kNameLength];     ///< Not null terminated if it uses all 16 characters
+        quint8 type;                ///< FactMetaData::ValueType_t
+        quint8 flags;
+        quint8 reserved[6];
+    };
+    static_assert(sizeof(Record) == 32);
+
+    enum RecordFlags {
+        RecordFlagVolatile = 0x01,
+    };
+
+    const Header *_header() const { return reinterpret_cast<const Header*>(_data); }
+    const Record *_record(quint32 index) const { return reinterpret_cast<const Record*>(_data + sizeof(Header)) + index; }
+    quint32 _computeHash() const;
+
+    static bool _fillRecord(const Param &param, Record &record);
+    static quint32 _hashRecord(const Record &record, quint32 hash);
+    static QVariant _recordValue(const Record &record);
+
+    QFile _file;
+    uchar *_data = nullptr;
+    bool _writable = false;
+};
@@ -0,0 +1,371 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "ParamMetaDataBlob.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QFileInfo>
+#include <QtCore/QLocale>
+#include <QtCore/QMap>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+#include <QtCore/QtEndian>
+
+#include <cstring>
+#include <limits>
+
+QGC_LOGGING_CATEGORY(ParamMetaDataBlobLog, "qgc.factsystem.parammetadatablob")
+
+static constexpr QDataStream::Version kStreamVersion = QDataStream::Qt_6_0;
+
+ParamMetaDataBlob::ParamMetaDataBlob(const QString &fileName)
+    : _file(fileName)
+{
+    // qCDebug(ParamMetaDataBlobLog) << Q_FUNC_INFO << this;
+}
+
+ParamMetaDataBlob::~ParamMetaDataBlob()
+{
+    close();
+
+    // qCDebug(ParamMetaDataBlobLog) << Q_FUNC_INFO << this;
+}
+
+QByteArray ParamMetaDataBlob::sourceKey(const QString &sourceFile)
+{
+    QFile file(sourceFile);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(ParamMetaDataBlobLog) << "Unable to open meta data source" << sourceFile << file.errorString();
+        return QByteArray();
+    }
+
+    // Descriptions of some meta data are translated while parsing, so the language is part of the key
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    hash.addData(QByteArray::number(kVersion));
+    hash.addData(QLocale().name().toUtf8());
+    if (!hash.addData(&file)) {
+        return QByteArray();
+    }
+
+    return hash.result();
+}
+
+QDir ParamMetaDataBlob::cacheDir()
+{
+    return (QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/ParamMetaData"));
+}
+
+QString ParamMetaDataBlob::cacheFileName(const QByteArray &sourceKey)
+{
+    return cacheDir().filePath(QStringLiteral("%1.blob").arg(QString::fromLatin1(sourceKey.toHex())));
+}
+
+QByteArray ParamMetaDataBlob::_serialize(const FactMetaData &metaData)
+{
+    quint8 flags = 0;
+    flags |= metaData._vehicleRebootRequired ? RecordFlagVehicleRebootRequired : 0;
+    flags |= metaData._qgcRebootRequired ? RecordFlagQGCRebootRequired : 0;
+    flags |= metaData._hasControl ? RecordFlagHasControl : 0;
+    flags |= metaData._readOnly ? RecordFlagReadOnly : 0;
+    flags |= metaData._writeOnly ? RecordFlagWriteOnly : 0;
+    flags |= metaData._volatile ? RecordFlagVolatile : 0;
+    if ((metaData._rawTranslator != FactMetaData::_defaultTranslator) || (metaData._cookedTranslator != FactMetaData::_defaultTranslator)) {
+        flags |= RecordFlagTranslated;
+    }
+
+    QByteArray bytes;
+    QDataStream stream(&bytes, QIODevice::WriteOnly);
+    stream.setVersion(kStreamVersion);
+    stream << static_cast<qint32>(metaData._type)
+           << flags
+           << metaData._name
+           << metaData._category
+           << metaData._group
+           << metaData._shortDescription
+           << metaData._longDescription
+           << metaData._rawUnits
+           << metaData._cookedUnits
+           << static_cast<qint32>(metaData._decimalPlaces)
+           << metaData._rawMin
+           << metaData._rawMax
+           << metaData._defaultValueAvailable
+           << metaData._rawDefaultValue
+           << metaData._rawIncrement
+           << metaData._enumStrings
+           << metaData._enumValues
+           << metaData._bitmaskStrings
+           << metaData._bitmaskValues;
+
+    return bytes;
+}
+
+bool ParamMetaDataBlob::write(const QString &fileName, const QByteArray &sourceKey, const FactMetaData::NameToMetaDataMap_t &metaDataMap)
+{
+    if (sourceKey.size() != static_cast<qsizetype>(sizeof(Header::sourceKey))) {
+        qCWarning(ParamMetaDataBlobLog) << "Invalid source key" << sourceKey.toHex();
+        return false;
+    }
+
+    // The index is searched with a byte wise compare of the utf8 names
+    QMap<QByteArray, const FactMetaData*> sortedMap;
+    for (auto it = metaDataMap.constBegin(); it != metaDataMap.constEnd(); ++it) {
+        if (it.value()) {
+            (void) sortedMap.insert(it.key().toUtf8(), it.value());
+        }
+    }
+
+    QByteArray index;
+    index.reserve(sortedMap.count() * static_cast<qsizetype>(sizeof(IndexEntry)));
+    QByteArray data;
+    for (auto it = sortedMap.constBegin(); it != sortedMap.constEnd(); ++it) {
+        const QByteArray record = _serialize(*it.value());
+
+        IndexEntry entry{};
+        qToLittleEndian(static_cast<quint32>(data.size()), &entry.nameOffset);
+        qToLittleEndian(static_cast<quint32>(it.key().size()), &entry.nameLength);
+        data.append(it.key());
+        qToLittleEndian(static_cast<quint32>(data.size()), &entry.recordOffset);
+        qToLittleEndian(static_cast<quint32>(record.size()), &entry.recordLength);
+        data.append(record);
+
+        index.append(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    }
+
+    if (data.size() > std::numeric_limits<quint32>::max()) {
+        qCWarning(ParamMetaDataBlobLog) << "Meta data too large" << data.size();
+        return false;
+    }
+
+    Header header{};
+    qToLittleEndian(kMagic, &header.magic);
+    qToLittleEndian(kVersion, &header.version);
+    qToLittleEndian(static_cast<quint16>(sizeof(IndexEntry)), &header.indexEntrySize);
+    qToLittleEndian(static_cast<quint32>(sortedMap.count()), &header.count);
+    qToLittleEndian(static_cast<quint32>(data.size()), &header.dataSize);
+    (void) memcpy(header.sourceKey, sourceKey.constData(), sizeof(header.sourceKey));
+
+    (void) QDir().mkpath(QFileInfo(fileName).absolutePath());
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly) ||
+            (file.write(reinterpret_cast<const char*>(&header), sizeof(header)) != static_cast<qint64>(sizeof(header))) ||
+            (file.write(index) != index.size()) ||
+            (file.write(data) != data.size()) ||
+            !file.commit()) {
+        qCWarning(ParamMetaDataBlobLog) << "Failed to write meta data blob" << fileName << file.errorString();
+        return false;
+    }
+
+    qCDebug(ParamMetaDataBlobLog) << "Wrote" << sortedMap.count() << "params" << fileName;
+
+    return true;
+}
+
+void ParamMetaDataBlob::setFileName(const QString &fileName)
+{
+    close();
+    _file.setFileName(fileName);
+}
+
+bool ParamMetaDataBlob::open(const QByteArray &sourceKey)
+{
+    close();
+
+    if ((sourceKey.size() != static_cast<qsizetype>(sizeof(Header::sourceKey))) || !_file.exists()) {
+        return false;
+    }
+
+    if (!_file.open(QIODevice::ReadOnly)) {
+        qCWarning(ParamMetaDataBlobLog) << "Failed to open meta data blob" << _file.fileName() << _file.errorString();
+        return false;
+    }
+
+    const qint64 size = _file.size();
+    if (size < static_cast<qint64>(sizeof(Header))) {
+        qCWarning(ParamMetaDataBlobLog) << "Meta data blob too small" << _file.fileName();
+        _file.close();
+        return false;
+    }
+
+    _data = _file.map(0, size);
+    if (!_data) {
+        qCWarning(ParamMetaDataBlobLog) << "Failed to map meta data blob" << _file.fileName() << _file.errorString();
+        _file.close();
+        return false;
+    }
+
+    const Header *const header = _header();
+    const qint64 expectedSize = static_cast<qint64>(sizeof(Header)) +
+                                (static_cast<qint64>(qFromLittleEndian(header->count)) * static_cast<qint64>(sizeof(IndexEntry))) +
+                                static_cast<qint64>(qFromLittleEndian(header->dataSize));
+    const bool valid = (qFromLittleEndian(header->magic) == kMagic) &&
+                       (qFromLittleEndian(header->version) == kVersion) &&
+                       (qFromLittleEndian(header->indexEntrySize) == sizeof(IndexEntry)) &&
+                       (size == expectedSize);
+    if (!valid) {
+        qCWarning(ParamMetaDataBlobLog) << "Invalid meta data blob" << _file.fileName();
+        close();
+        return false;
+    }
+
+    if (memcmp(header->sourceKey, sourceKey.constData(), sizeof(header->sourceKey)) != 0) {
+        qCDebug(ParamMetaDataBlobLog) << "Meta data blob is from a different source" << _file.fileName();
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void ParamMetaDataBlob::close()
+{
+    if (_data) {
+        (void) _file.unmap(_data);
+        _data = nullptr;
+    }
+    _file.close();
+}
+
+quint32 ParamMetaDataBlob::count() const
+{
+    Q_ASSERT(isOpen());
+
+    return qFromLittleEndian(_header()->count);
+}
+
+QByteArrayView ParamMetaDataBlob::_name(quint32 index) const
+{
+    const IndexEntry *const entry = _indexEntry(index);
+    const quint64 offset = qFromLittleEndian(entry->nameOffset);
+    const quint64 length = qFromLittleEndian(entry->nameLength);
+    if ((offset + length) > qFromLittleEndian(_header()->dataSize)) {
+        return QByteArrayView();
+    }
+
+    return QByteArrayView(_dataSection() + offset, static_cast<qsizetype>(length));
+}
+
+QString ParamMetaDataBlob::name(quint32 index) const
+{
+    Q_ASSERT(index < count());
+
+    return QString::fromUtf8(_name(index));
+}
+
+qint64 ParamMetaDataBlob::indexOf(const QString &name) const
+{
+    Q_ASSERT(isOpen());
+
+    const QByteArray key = name.toUtf8();
+
+    qint64 low = 0;
+    qint64 high = static_cast<qint64>(count()) - 1;
+    while (low <= high) {
+        const qint64 mid = low + ((high - low) / 2);
+        const int result = _name(static_cast<quint32>(mid)).compare(key);
+        if (result == 0) {
+            return mid;
+        } else if (result < 0) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+FactMetaData *ParamMetaDataBlob::createMetaData(quint32 index, QObject *parent) const
+{
+    Q_ASSERT(index < count());
+
+    const IndexEntry *const entry = _indexEntry(index);
+    const quint64 offset = qFromLittleEndian(entry->recordOffset);
+    const quint64 length = qFromLittleEndian(entry->recordLength);
+    if ((offset + length) > qFromLittleEndian(_header()->dataSize)) {
+        qCWarning(ParamMetaDataBlobLog) << "Record out of range" << index << _file.fileName();
+        return nullptr;
+    }
+
+    const QByteArray record = QByteArray::fromRawData(_dataSection() + offset, static_cast<qsizetype>(length));
+    QDataStream stream(record);
+    stream.setVersion(kStreamVersion);
+
+    qint32 type = 0;
+    quint8 flags = 0;
+    QString name, category, group, shortDescription, longDescription, rawUnits, cookedUnits;
+    qint32 decimalPlaces = 0;
+    QVariant rawMin, rawMax, rawDefaultValue;
+    bool defaultValueAvailable = false;
+    double rawIncrement = 0;
+    QStringList enumStrings, bitmaskStrings;
+    QVariantList enumValues, bitmaskValues;
+
+    stream >> type
+           >> flags
+           >> name
+           >> category
+           >> group
+           >> shortDescription
+           >> longDescription
+           >> rawUnits
+           >> cookedUnits
+           >> decimalPlaces
+           >> rawMin
+           >> rawMax
+           >> defaultValueAvailable
+           >> rawDefaultValue
+           >> rawIncrement
+           >> enumStrings
+           >> enumValues
+           >> bitmaskStrings
+           >> bitmaskValues;
+
+    if ((stream.status() != QDataStream::Ok) || (enumStrings.count() != enumValues.count()) || (bitmaskStrings.count() != bitmaskValues.count())) {
+        qCWarning(ParamMetaDataBlobLog) << "Corrupt record" << index << _file.fileName();
+        return nullptr;
+    }
+
+    // Values were validated when the meta data was parsed, so the fields are restored as is
+    FactMetaData *const metaData = new FactMetaData(static_cast<FactMetaData::ValueType_t>(type), parent);
+    metaData->_name = name;
+    metaData->_category = category;
+    metaData->_group = group;
+    metaData->_shortDescription = shortDescription;
+    metaData->_longDescription = longDescription;
+    metaData->_decimalPlaces = decimalPlaces;
+    metaData->_rawMin = rawMin;
+    metaData->_rawMax = rawMax;
+    metaData->_defaultValueAvailable = defaultValueAvailable;
+    metaData->_rawDefaultValue = rawDefaultValue;
+    metaData->_rawIncrement = rawIncrement;
+    metaData->_vehicleRebootRequired = (flags & RecordFlagVehicleRebootRequired);
+    metaData->_qgcRebootRequired = (flags & RecordFlagQGCRebootRequired);
+    metaData->_hasControl = (flags & RecordFlagHasControl);
+    metaData->_readOnly = (flags & RecordFlagReadOnly);
+    metaData->_writeOnly = (flags & RecordFlagWriteOnly);
+    metaData->_volatile = (flags & RecordFlagVolatile);
+
+    // Translators can't be stored. They are looked up again from the units before the enums are set, which is the
+    // order the parsers use. App settings translators then also follow the current settings.
+    metaData->_rawUnits = rawUnits;
+    if (flags & RecordFlagTranslated) {
+        metaData->setBuiltInTranslator();
+    } else {
+        metaData->_cookedUnits = cookedUnits;
+    }
+    metaData->_enumStrings = enumStrings;
+    metaData->_enumValues = enumValues;
+    metaData->_bitmaskStrings = bitmaskStrings;
+    metaData->_bitmaskValues = bitmaskValues;
+
+    return metaData;
+}
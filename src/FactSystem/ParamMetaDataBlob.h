@@ -0,0 +1,106 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QString>
+
+#include "FactMetaData.h"
+
+Q_DECLARE_LOGGING_CATEGORY(ParamMetaDataBlobLog)
+
+/// Precompiled parameter meta data.
+/// Parsing the parameter meta data XML/json and creating a FactMetaData for every parameter is a large part of the time
+/// it takes to connect to a vehicle, although most parameters are never looked at. The first load of a meta data file
+/// compiles the parsed FactMetaData into a binary blob in the cache directory. Later loads of the same file map the blob
+/// and only create a FactMetaData when a parameter is looked up.
+/// The blob is a fixed size header, an index sorted by parameter name and a data section which holds the names and one
+/// serialized record per parameter.
+class ParamMetaDataBlob
+{
+public:
+    explicit ParamMetaDataBlob(const QString &fileName = QString());
+    ~ParamMetaDataBlob();
+
+    /// Identifies the contents of a meta data source file, empty if the file can't be read
+    static QByteArray sourceKey(const QString &sourceFile);
+
+    /// ParamMetaData within the application cache location, the blobs can be rebuilt at any time
+    static QDir cacheDir();
+
+    /// @return Blob file for the specified source key within cacheDir
+    static QString cacheFileName(const QByteArray &sourceKey);
+
+    /// Compiles the meta data into a blob file, replacing an existing one
+    static bool write(const QString &fileName, const QByteArray &sourceKey, const FactMetaData::NameToMetaDataMap_t &metaDataMap);
+
+    void setFileName(const QString &fileName);
+    QString fileName() const { return _file.fileName(); }
+
+    /// Maps the file and validates it against the source key
+    bool open(const QByteArray &sourceKey);
+    void close();
+    bool isOpen() const { return (_data != nullptr); }
+
+    quint32 count() const;
+    QString name(quint32 index) const;
+
+    /// @return -1: No meta data for this name
+    qint64 indexOf(const QString &name) const;
+
+    /// Creates the FactMetaData of a single parameter from its record
+    ///     @return nullptr: record is corrupt
+    FactMetaData *createMetaData(quint32 index, QObject *parent) const;
+
+    static constexpr quint32 kMagic = 0x314D5051;   ///< "QPM1"
+    static constexpr quint16 kVersion = 1;
+
+private:
+    struct Header {
+        quint32 magic;
+        quint16 version;
+        quint16 indexEntrySize;
+        quint32 count;
+        quint32 dataSize;
+        char sourceKey[16];
+    };
+    static_assert(sizeof(Header) == 32);
+
+    struct IndexEntry {
+        quint32 nameOffset;         ///< Offsets are relative to the start of the data section
+        quint32 nameLength;         ///< Utf8
+        quint32 recordOffset;
+        quint32 recordLength;
+    };
+    static_assert(sizeof(IndexEntry) == 16);
+
+    enum RecordFlags {
+        RecordFlagVehicleRebootRequired = 0x01,
+        RecordFlagQGCRebootRequired     = 0x02,
+        RecordFlagHasControl            = 0x04,
+        RecordFlagReadOnly              = 0x08,
+        RecordFlagWriteOnly             = 0x10,
+        RecordFlagVolatile              = 0x20,
+        RecordFlagTranslated            = 0x40,     ///< Units have a built in or app settings translator
+    };
+
+    const Header *_header() const { return reinterpret_cast<const Header*>(_data); }
+    const IndexEntry *_indexEntry(quint32 index) const { return reinterpret_cast<const IndexEntry*>(_data + sizeof(Header)) + index; }
+    const char *_dataSection() const { return reinterpret_cast<const char*>(_data + sizeof(Header) + (count() * sizeof(IndexEntry))); }
+    QByteArrayView _name(quint32 index) const;
+
+    static QByteArray _serialize(const FactMetaData &metaData);
+
+    QFile _file;
+    uchar *_data = nullptr;
+};
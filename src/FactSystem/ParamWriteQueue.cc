@@ -0,0 +1,121 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "ParamWriteQueue.h"
+
+qsizetype ParamWriteQueue::_queueIndexOf(const QString &name) const
+{
+    for (qsizetype i = 0; i < _queue.count(); i++) {
+        if (_queue[i].name == name) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+bool ParamWriteQueue::contains(const QString &name) const
+{
+    return (_outstandingIds.contains(name) || (_queueIndexOf(name) >= 0));
+}
+
+void ParamWriteQueue::enqueue(const QString &name, FactMetaData::ValueType_t valueType, const QVariant &value)
+{
+    const Write write{ name, valueType, value, 0 };
+
+    if (_outstandingIds.contains(name)) {
+        _resendAfterAck[name] = write;
+        return;
+    }
+
+    const qsizetype index = _queueIndexOf(name);
+    if (index >= 0) {
+        _queue[index] = write;
+        return;
+    }
+
+    _queue.append(write);
+}
+
+QList<ParamWriteQueue::Write> ParamWriteQueue::takeSendable(qint64 nowMSecs)
+{
+    QList<Write> sendable;
+
+    while (!_queue.isEmpty() && _window.canSend()) {
+        const Write write = _queue.takeFirst();
+        const int requestId = _nextRequestId++;
+
+        _window.requestSent(requestId, nowMSecs, write.retryCount > 0);
+        _outstanding[requestId] = write;
+        _outstandingIds[write.name] = requestId;
+        sendable.append(write);
+    }
+
+    return sendable;
+}
+
+bool ParamWriteQueue::ackReceived(const QString &name, qint64 nowMSecs)
+{
+    const auto it = _outstandingIds.constFind(name);
+    if (it == _outstandingIds.constEnd()) {
+        // Unrequested param value, a queued write still has to go out
+        return !contains(name);
+    }
+
+    const int requestId = it.value();
+    (void) _outstandingIds.erase(it);
+    (void) _outstanding.remove(requestId);
+    (void) _window.responseReceived(requestId, nowMSecs);
+
+    if (_resendAfterAck.contains(name)) {
+        _queue.prepend(_resendAfterAck.take(name));
+        return false;
+    }
+
+    return true;
+}
+
+QStringList ParamWriteQueue::takeExpired(qint64 nowMSecs, int maxRetryCount)
+{
+    QStringList failed;
+    QList<Write> retries;
+
+    for (const int requestId : _window.takeExpired(nowMSecs)) {
+        Write write = _outstanding.take(requestId);
+        (void) _outstandingIds.remove(write.name);
+
+        // A newer value supersedes the write which was lost
+        if (_resendAfterAck.contains(write.name)) {
+            write = _resendAfterAck.take(write.name);
+        } else if (++write.retryCount > maxRetryCount) {
+            failed.append(write.name);
+            continue;
+        }
+        retries.append(write);
+    }
+
+    // Retries go out before writes which were never sent, in their original order
+    _queue = retries + _queue;
+
+    return failed;
+}
+
+QList<ParamWriteQueue::Write> ParamWriteQueue::takeQueued()
+{
+    return std::exchange(_queue, {});
+}
+
+void ParamWriteQueue::clear()
+{
+    _window = MAVLinkRequestWindow();
+    _queue.clear();
+    _outstanding.clear();
+    _outstandingIds.clear();
+    _resendAfterAck.clear();
+}
@@ -0,0 +1,76 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QVariant>
+
+#include "FactMetaData.h"
+#include "MAVLinkRequestWindow.h"
+
+/// Pipelines the PARAM_SET writes ParameterManager sends to a single component.
+/// Writes are queued in the order they are made and sent as the MAVLinkRequestWindow allows, so loading a parameter
+/// file doesn't flood the link with hundreds of PARAM_SETs at once. The PARAM_VALUE echo of a param acks its
+/// outstanding write. Writes which are not acked within the retransmission timeout are queued again up to the retry
+/// limit. A param which is written again while its previous write is still in flight is resent once that write was
+/// acked, so the vehicle always ends up with the latest value.
+class ParamWriteQueue
+{
+public:
+    ParamWriteQueue() = default;
+
+    struct Write {
+        QString name;
+        FactMetaData::ValueType_t valueType = FactMetaData::valueTypeInt32;
+        QVariant value;
+        int retryCount = 0;
+    };
+
+    /// Queues a write, replacing the value of a queued but not yet sent write of the same param
+    void enqueue(const QString &name, FactMetaData::ValueType_t valueType, const QVariant &value);
+
+    /// @return Writes which can be sent now, they are tracked as outstanding until acked or expired
+    QList<Write> takeSendable(qint64 nowMSecs);
+
+    /// Handles the PARAM_VALUE of a param
+    ///     @return true: no write of this param is pending any more
+    bool ackReceived(const QString &name, qint64 nowMSecs);
+
+    /// Queues the expired writes again
+    ///     @return Params which exceeded maxRetryCount, they are no longer pending
+    QStringList takeExpired(qint64 nowMSecs, int maxRetryCount);
+
+    /// Takes the writes which were not sent yet out of the queue, for sending them by other means
+    QList<Write> takeQueued();
+
+    /// Drops all queued and outstanding writes
+    void clear();
+
+    /// @return -1: nothing is outstanding
+    qint64 nextExpiryMSecs() const { return _window.nextExpiryMSecs(); }
+
+    bool contains(const QString &name) const;
+    bool isEmpty() const { return (_queue.isEmpty() && _outstanding.isEmpty()); }
+    qsizetype queuedCount() const { return _queue.count(); }
+    qsizetype outstandingCount() const { return _outstanding.count(); }
+    const MAVLinkRequestWindow &window() const { return _window; }
+
+private:
+    qsizetype _queueIndexOf(const QString &name) const;
+
+    MAVLinkRequestWindow _window;
+    QList<Write> _queue;
+    QHash<int /* request id */, Write> _outstanding;
+    QHash<QString, int /* request id */> _outstandingIds;
+    QHash<QString, Write> _resendAfterAck;      ///< Writes made while the previous write of the param was outstanding
+    int _nextRequestId = 0;
+};
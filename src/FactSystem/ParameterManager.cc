@@ -15,6 +15,7 @@
 #include "FirmwarePlugin.h"
 #include "FTPManager.h"
 #include "MAVLinkProtocol.h"
+#include "ParamCacheFile.h"
 #include "QGC.h"
 #include "QGCApplication.h"
 #include "QGCLoggingCategory.h"
@@ -30,11 +31,27 @@ QGC_LOGGING_CATEGORY(ParameterManagerVerbose1Log, "qgc.factsystem.parametermanag
 QGC_LOGGING_CATEGORY(ParameterManagerVerbose2Log, "qgc.factsystem.parametermanager2:verbose")
 QGC_LOGGING_CATEGORY(ParameterManagerDebugCacheFailureLog, "qgc.factsystem.parametermanager.debugcachefailure") // Turn on to debug parameter cache crc misses
 
+namespace {
+    // ArduPilot binary parameter file @PARAM/param.pck
+    constexpr quint16 magic_standard = 0x671B;
+    constexpr quint16 magic_withdefaults = 0x671C;
+    enum ap_var_type {
+        AP_PARAM_NONE = 0,
+        AP_PARAM_INT8,
+        AP_PARAM_INT16,
+        AP_PARAM_INT32,
+        AP_PARAM_FLOAT,
+        AP_PARAM_VECTOR3F,
+        AP_PARAM_GROUP
+    };
+}
+
 ParameterManager::ParameterManager(Vehicle *vehicle)
     : QObject(vehicle)
     , _vehicle(vehicle)
     , _logReplay(!vehicle->vehicleLinkManager()->primaryLink().expired() && vehicle->vehicleLinkManager()->primaryLink().lock()->isLogReplay())
     , _tryftp(vehicle->apmFirmware())
+    , _ftpParamWrite(vehicle->apmFirmware())
 {
     qCDebug(ParameterManagerLog) << this;
 
@@ -48,9 +65,24 @@ ParameterManager::ParameterManager(Vehicle *vehicle)
     (void) connect(&_initialRequestTimeoutTimer, &QTimer::timeout, this, &ParameterManager::_initialRequestTimeout);
 
     _waitingParamTimeoutTimer.setSingleShot(true);
-    _waitingParamTimeoutTimer.setInterval(3000);
+    _waitingParamTimeoutTimer.setInterval(kWaitingParamTimeoutMSecs);
     (void) connect(&_waitingParamTimeoutTimer, &QTimer::timeout, this, &ParameterManager::_waitingParamTimeout);
 
+    _indexRequestTimer.setSingleShot(true);
+    (void) connect(&_indexRequestTimer, &QTimer::timeout, this, &ParameterManager::_indexRequestTimeout);
+    _indexRequestClock.start();
+
+    _paramWriteTimer.setSingleShot(true);
+    (void) connect(&_paramWriteTimer, &QTimer::timeout, this, &ParameterManager::_paramWriteTimeout);
+
+    _paramWriteCollectTimer.setSingleShot(true);
+    _paramWriteCollectTimer.setInterval(0);
+    (void) connect(&_paramWriteCollectTimer, &QTimer::timeout, this, &ParameterManager::_sendQueuedParamWrites);
+
+    _paramCacheUpdateTimer.setSingleShot(true);
+    _paramCacheUpdateTimer.setInterval(kParamCacheUpdateDelayMSecs);
+    (void) connect(&_paramCacheUpdateTimer, &QTimer::timeout, this, &ParameterManager::_flushLocalParamCacheUpdates);
+
     // Ensure the cache directory exists
     (void) QFileInfo(QSettings().fileName()).dir().mkdir("ParamCache");
 }
@@ -90,6 +122,7 @@ void ParameterManager::_updateProgressBar()
 
     if (waitingWriteParamCount == 0) {
         if (_writeParamProgressActive) {
+            _paramWritesComplete();
             _writeParamProgressActive = false;
             _waitingWriteParamBatchCount = 0;
             _setLoadProgress(0.0);
@@ -218,6 +251,14 @@ void ParameterManager::_handleParamValue(int componentId, const QString &paramet
     _initialRequestTimeoutTimer.stop();
     _waitingParamTimeoutTimer.stop();
 
+    // Track the pace of the initial param stream, its end is detected by a gap which is much larger than usual
+    const qint64 nowMSecs = _indexRequestClock.elapsed();
+    if (!_indexBatchQueueActive && (_lastParamValueMSecs >= 0)) {
+        const double gapMSecs = static_cast<double>(nowMSecs - _lastParamValueMSecs);
+        _paramStreamGapMSecs = (_paramStreamGapMSecs > 0) ? ((0.9 * _paramStreamGapMSecs) + (0.1 * gapMSecs)) : gapMSecs;
+    }
+    _lastParamValueMSecs = nowMSecs;
+
     // Update our total parameter counts
     if (!_paramCountMap.contains(componentId)) {
         _paramCountMap[componentId] = parameterCount;
@@ -248,12 +289,20 @@ void ParameterManager::_handleParamValue(int componentId, const QString &paramet
     // Remove this parameter from the waiting lists
     if (_waitingReadParamIndexMap[componentId].contains(parameterIndex)) {
         _waitingReadParamIndexMap[componentId].remove(parameterIndex);
-        (void) _indexBatchQueue.removeOne(parameterIndex);
+        if (_indexRequestWindows.contains(componentId)) {
+            (void) _indexRequestWindows[componentId].responseReceived(parameterIndex, nowMSecs);
+        }
         _fillIndexBatchQueue(false /* waitingParamTimeout */);
     }
 
     (void) _waitingReadParamNameMap[componentId].remove(parameterName);
-    (void) _waitingWriteParamNameMap[componentId].remove(parameterName);
+    if (!_paramWriteQueues.contains(componentId) || _paramWriteQueues[componentId].ackReceived(parameterName, nowMSecs)) {
+        (void) _waitingWriteParamNameMap[componentId].remove(parameterName);
+    }
+    if (_paramWriteQueues.contains(componentId)) {
+        // The ack opened up the write window
+        _sendQueuedParamWrites();
+    }
     if (!_waitingReadParamIndexMap[componentId].isEmpty()) {
         qCDebug(ParameterManagerVerbose2Log) << _logVehiclePrefix(componentId) << "_waitingReadParamIndexMap:" << _waitingReadParamIndexMap[componentId];
     }
@@ -293,13 +342,18 @@ void ParameterManager::_handleParamValue(int componentId, const QString &paramet
     const int readWaitingParamCount = waitingReadParamIndexCount + waitingReadParamNameCount;
     const int totalWaitingParamCount = readWaitingParamCount + waitingWriteParamNameCount;
     if (totalWaitingParamCount) {
-        // More params to wait for, restart timer
-        _waitingParamTimeoutTimer.start();
+        // More params to wait for, restart timer. While the initial stream is running the timer detects the end of it.
+        if ((waitingReadParamIndexCount > 0) && !_indexBatchQueueActive) {
+            _waitingParamTimeoutTimer.setInterval(qBound(kMinStreamEndTimeoutMSecs, qRound(_paramStreamGapMSecs * 20), kWaitingParamTimeoutMSecs));
+            _waitingParamTimeoutTimer.start();
+        } else {
+            _restartWaitingParamTimeoutTimer();
+        }
         qCDebug(ParameterManagerVerbose1Log) << _logVehiclePrefix(-1) << "Restarting _waitingParamTimeoutTimer: totalWaitingParamCount:" << totalWaitingParamCount;
     } else if (!_mapCompId2FactMap.contains(_vehicle->defaultComponentId())) {
         // Still waiting for parameters from default component
         qCDebug(ParameterManagerLog) << _logVehiclePrefix(-1) << "Restarting _waitingParamTimeoutTimer (still waiting for default component params)";
-        _waitingParamTimeoutTimer.start();
+        _restartWaitingParamTimeoutTimer();
     } else {
         qCDebug(ParameterManagerVerbose1Log) << _logVehiclePrefix(-1) << "Not restarting _waitingParamTimeoutTimer (all requests satisfied)";
     }
@@ -307,8 +361,10 @@ void ParameterManager::_handleParamValue(int componentId, const QString &paramet
     _updateProgressBar();
 
     Fact *fact = nullptr;
+    bool cacheStale = true;
     if (_mapCompId2FactMap.contains(componentId) && _mapCompId2FactMap[componentId].contains(parameterName)) {
         fact = _mapCompId2FactMap[componentId][parameterName];
+        cacheStale = (fact->rawValue() != parameterValue);
     } else {
         qCDebug(ParameterManagerVerbose1Log) << _logVehiclePrefix(componentId) << "Adding new fact" << parameterName;
 
@@ -329,10 +385,13 @@ void ParameterManager::_handleParamValue(int componentId, const QString &paramet
     // Update param cache. The param cache is only used on PX4 Firmware since ArduPilot and Solo have volatile params
     // which invalidate the cache. The Solo also streams param updates in flight for things like gimbal values
     // which in turn causes a perf problem with all the param cache updates.
-    if (!_logReplay && _vehicle->px4Firmware()) {
+    if (_localParamCacheEnabled()) {
         if (((_prevWaitingReadParamIndexCount + _prevWaitingReadParamNameCount) != 0) && (readWaitingParamCount == 0)) {
             // All reads just finished, update the cache
             _writeLocalParamCache(_vehicle->id(), componentId);
+        } else if (_initialLoadComplete && (readWaitingParamCount == 0) && cacheStale) {
+            // Single value changed after the initial load, for example the ack of a param write
+            _updateLocalParamCache(componentId, fact);
         }
     }
 
@@ -355,14 +414,98 @@ void ParameterManager::_factRawValueUpdateWorker(int componentId, const QString
         }
         _waitingWriteParamNameMap[componentId][name] = 0; // Add new entry and set retry count
         _updateProgressBar();
-        _waitingParamTimeoutTimer.start();
         _saveRequired = true;
     } else {
         qCWarning(ParameterManagerLog) << "Internal error ParameterManager::_factValueUpdateWorker: component id not found" << componentId;
     }
 
-    _sendParamSetToVehicle(componentId, name, valueType, rawValue);
-    qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Update parameter (_waitingParamTimeoutTimer started) - compId:name:rawValue" << componentId << name << rawValue;
+    // Writes are pipelined through a window instead of all being sent at once, loading a param file can change hundreds of them
+    _paramWriteQueues[componentId].enqueue(name, valueType, rawValue);
+    if (_ftpParamWriteAvailable(componentId)) {
+        // Give the caller the chance to make more changes, enough of them go out as a single file upload
+        _paramWriteCollectTimer.start();
+    } else {
+        _sendQueuedParamWrites();
+    }
+    qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Update parameter (write queued) - compId:name:rawValue" << componentId << name << rawValue;
+}
+
+void ParameterManager::_sendQueuedParamWrites()
+{
+    const qint64 nowMSecs = _indexRequestClock.elapsed();
+
+    for (auto it = _paramWriteQueues.begin(); it != _paramWriteQueues.end(); ++it) {
+        const int componentId = it.key();
+        if (_ftpParamWriteAvailable(componentId)) {
+            if (!_ftpParamWrites.isEmpty()) {
+                // Upload in progress, anything queued meanwhile goes out once it completes
+                continue;
+            }
+            if ((it->outstandingCount() == 0) && (it->queuedCount() >= kFtpParamWriteMinCount) && _uploadParamWrites(*it)) {
+                continue;
+            }
+        }
+
+        for (const ParamWriteQueue::Write &write : it->takeSendable(nowMSecs)) {
+            _sendParamSetToVehicle(componentId, write.name, write.valueType, write.value);
+            qCDebug(ParameterManagerVerbose1Log) << _logVehiclePrefix(componentId) << "Write sent - name:retryCount:window" << write.name << write.retryCount << it->window().window();
+        }
+    }
+
+    _scheduleParamWriteTimer();
+}
+
+void ParameterManager::_scheduleParamWriteTimer()
+{
+    qint64 nextExpiryMSecs = -1;
+    for (const ParamWriteQueue &queue : _paramWriteQueues) {
+        const qint64 expiryMSecs = queue.nextExpiryMSecs();
+        if ((expiryMSecs >= 0) && ((nextExpiryMSecs < 0) || (expiryMSecs < nextExpiryMSecs))) {
+            nextExpiryMSecs = expiryMSecs;
+        }
+    }
+
+    if (nextExpiryMSecs < 0) {
+        _paramWriteTimer.stop();
+        return;
+    }
+
+    _paramWriteTimer.start(static_cast<int>(qMax<qint64>(nextExpiryMSecs - _indexRequestClock.elapsed(), 1)));
+}
+
+void ParameterManager::_paramWriteTimeout()
+{
+    const qint64 nowMSecs = _indexRequestClock.elapsed();
+
+    for (auto it = _paramWriteQueues.begin(); it != _paramWriteQueues.end(); ++it) {
+        const int componentId = it.key();
+        for (const QString &paramName : it->takeExpired(nowMSecs, _maxReadWriteRetry)) {
+            (void) _waitingWriteParamNameMap[componentId].remove(paramName);
+            _failedWriteParams.append(QStringLiteral("%1:%2").arg(componentId).arg(paramName));
+            qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Write failed, retries exhausted - name:" << paramName;
+        }
+    }
+
+    _sendQueuedParamWrites();
+    _updateProgressBar();
+}
+
+void ParameterManager::_paramWritesComplete()
+{
+    int sentCount = 0;
+    int lostCount = 0;
+    for (const ParamWriteQueue &queue : _paramWriteQueues) {
+        sentCount += static_cast<int>(queue.window().sentCount());
+        lostCount += static_cast<int>(queue.window().lostCount());
+    }
+    qCDebug(ParameterManagerLog) << _logVehiclePrefix(-1) << "Param writes complete - batch:failed:totalSent:totalLost" << _waitingWriteParamBatchCount << _failedWriteParams.count() << sentCount << lostCount;
+
+    if (!_failedWriteParams.isEmpty()) {
+        const QString errorMsg = tr("Parameter write failed: veh:%1 params:%2").arg(_vehicle->id()).arg(_failedWriteParams.join(QStringLiteral(", ")));
+        qCDebug(ParameterManagerLog) << errorMsg;
+        qgcApp()->showAppMessage(errorMsg);
+        _failedWriteParams.clear();
+    }
 }
 
 void ParameterManager::_factRawValueUpdated(const QVariant &rawValue)
@@ -433,6 +576,72 @@ void ParameterManager::_ftpDownloadProgress(float progress)
     }
 }
 
+bool ParameterManager::_ftpParamWriteAvailable(int componentId) const
+{
+    return (_ftpParamWrite && (componentId == MAV_COMP_ID_AUTOPILOT1) && !_logReplay);
+}
+
+bool ParameterManager::_uploadParamWrites(ParamWriteQueue &queue)
+{
+    const QList<ParamWriteQueue::Write> writes = queue.takeQueued();
+    const QString fileName = QDir(QStandardPaths::writableLocation(QStandardPaths::TempLocation)).filePath(QStringLiteral("ParamUpload%1.pck").arg(_vehicle->id()));
+
+    FTPManager *const ftpManager = _vehicle->ftpManager();
+    (void) connect(ftpManager, &FTPManager::uploadComplete, this, &ParameterManager::_ftpUploadComplete);
+    if (!_writeParamFile(fileName, writes) || !ftpManager->upload(MAV_COMP_ID_AUTOPILOT1, QStringLiteral("@PARAM/param.pck"), fileName)) {
+        // FTP may be busy with another transfer, the writes go out as PARAM_SETs
+        qCDebug(ParameterManagerLog) << _logVehiclePrefix(MAV_COMP_ID_AUTOPILOT1) << "Param file upload not started";
+        (void) disconnect(ftpManager, &FTPManager::uploadComplete, this, &ParameterManager::_ftpUploadComplete);
+        for (const ParamWriteQueue::Write &write : writes) {
+            queue.enqueue(write.name, write.valueType, write.value);
+        }
+        return false;
+    }
+
+    qCDebug(ParameterManagerLog) << _logVehiclePrefix(MAV_COMP_ID_AUTOPILOT1) << "Param file upload started - count:" << writes.count();
+    _ftpParamWrites = writes;
+    return true;
+}
+
+void ParameterManager::_ftpUploadComplete(const QString &fileName, const QString &errorMsg)
+{
+    (void) disconnect(_vehicle->ftpManager(), &FTPManager::uploadComplete, this, &ParameterManager::_ftpUploadComplete);
+    (void) QFile::remove(fileName);
+
+    constexpr int componentId = MAV_COMP_ID_AUTOPILOT1;
+    ParamWriteQueue &queue = _paramWriteQueues[componentId];
+    const QList<ParamWriteQueue::Write> writes = std::exchange(_ftpParamWrites, {});
+
+    if (errorMsg.isEmpty()) {
+        qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Param file upload complete - count:" << writes.count();
+        for (const ParamWriteQueue::Write &write : writes) {
+            // A param written again during the upload still waits for its own write
+            if (queue.contains(write.name)) {
+                continue;
+            }
+            (void) _waitingWriteParamNameMap[componentId].remove(write.name);
+
+            // No PARAM_VALUE echoes the uploaded values, so the cache is updated the same way as for one
+            const Fact *const fact = _mapCompId2FactMap[componentId].value(write.name, nullptr);
+            if (fact && _localParamCacheEnabled()) {
+                _updateLocalParamCache(componentId, fact);
+            }
+        }
+    } else {
+        // Firmware without param file upload support, don't try again
+        qCWarning(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Param file upload failed, falling back to PARAM_SET:" << errorMsg;
+        _ftpParamWrite = false;
+        for (const ParamWriteQueue::Write &write : writes) {
+            if (!queue.contains(write.name)) {
+                queue.enqueue(write.name, write.valueType, write.value);
+            }
+        }
+    }
+
+    _sendQueuedParamWrites();
+    _updateProgressBar();
+}
+
 void ParameterManager::refreshAllParameters(uint8_t componentId)
 {
     const SharedLinkInterfacePtr sharedLink = _vehicle->vehicleLinkManager()->primaryLink().lock();
@@ -454,6 +663,12 @@ void ParameterManager::refreshAllParameters(uint8_t componentId)
         _initialRequestTimeoutTimer.start();
     }
 
+    // A new param stream starts, its pace and the re-request flow control are measured from scratch
+    _indexRequestWindows.clear();
+    _indexRequestTimer.stop();
+    _paramStreamGapMSecs = 0;
+    _lastParamValueMSecs = -1;
+
     if (_tryftp && ((componentId == MAV_COMP_ID_ALL) || (componentId == MAV_COMP_ID_AUTOPILOT1))) {
         FTPManager *const ftpManager = _vehicle->ftpManager();
         (void) connect(ftpManager, &FTPManager::downloadComplete, this, &ParameterManager::_ftpDownloadComplete);
@@ -523,7 +738,7 @@ void ParameterManager::refreshParameter(int componentId, const QString &paramNam
         _waitingReadParamNameMap[componentId][mappedParamName] = 0;     // Add new wait entry and update retry count
         _updateProgressBar();
         qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "restarting _waitingParamTimeout";
-        _waitingParamTimeoutTimer.start();
+        _restartWaitingParamTimeoutTimer();
     } else {
         qCWarning(ParameterManagerLog) << "Internal error";
     }
@@ -587,48 +802,89 @@ bool ParameterManager::_fillIndexBatchQueue(bool waitingParamTimeout)
         return false;
     }
 
-    constexpr int maxBatchSize = 10;
-
     if (waitingParamTimeout) {
-        // We timed out, clear the queue and try again
+        // We timed out, everything still outstanding is lost
         qCDebug(ParameterManagerLog) << "Refilling index based batch queue due to timeout";
-        _indexBatchQueue.clear();
     } else {
-        qCDebug(ParameterManagerLog) << "Refilling index based batch queue due to received parameter";
+        qCDebug(ParameterManagerVerbose1Log) << "Refilling index based batch queue";
     }
 
+    const qint64 nowMSecs = _indexRequestClock.elapsed();
+    bool paramsRequested = false;
     for (const int componentId: _waitingReadParamIndexMap.keys()) {
-        if (_waitingReadParamIndexMap[componentId].count()) {
-            qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "_waitingReadParamIndexMap count" << _waitingReadParamIndexMap[componentId].count();
-            qCDebug(ParameterManagerVerbose1Log) << _logVehiclePrefix(componentId) << "_waitingReadParamIndexMap" << _waitingReadParamIndexMap[componentId];
+        QMap<int, int> &waitingIndexMap = _waitingReadParamIndexMap[componentId];
+        MAVLinkRequestWindow &window = _indexRequestWindows[componentId];
+
+        const QList<int> lost = waitingParamTimeout ? window.takeAll(nowMSecs) : window.takeExpired(nowMSecs);
+        if (!lost.isEmpty()) {
+            qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Index re-requests timed out" << lost << "window:" << window.window() << "srtt:" << window.srttMSecs() << "rto:" << window.rtoMSecs();
         }
 
-        for (const int paramIndex: _waitingReadParamIndexMap[componentId].keys()) {
-            if (_indexBatchQueue.contains(paramIndex)) {
-                // Don't add more than once
-                continue;
-            }
+        if (waitingIndexMap.count()) {
+            qCDebug(ParameterManagerVerbose1Log) << _logVehiclePrefix(componentId) << "_waitingReadParamIndexMap count" << waitingIndexMap.count();
+            qCDebug(ParameterManagerVerbose2Log) << _logVehiclePrefix(componentId) << "_waitingReadParamIndexMap" << waitingIndexMap;
+        }
 
-            if (_indexBatchQueue.count() > maxBatchSize) {
-                break;
+        // Only the indices which are still missing are requested, as many as the window allows
+        for (auto it = waitingIndexMap.begin(); (it != waitingIndexMap.end()) && window.canSend();) {
+            const int paramIndex = it.key();
+            if (window.isOutstanding(paramIndex)) {
+                ++it;
+                continue;
             }
 
-            _waitingReadParamIndexMap[componentId][paramIndex]++;   // Bump retry count
-            if (_disableAllRetries || (_waitingReadParamIndexMap[componentId][paramIndex] > _maxInitialLoadRetrySingleParam)) {
+            it.value()++;   // Bump retry count
+            if (_disableAllRetries || (it.value() > _maxInitialLoadRetrySingleParam)) {
                 // Give up on this index
                 _failedReadParamIndexMap[componentId] << paramIndex;
-                qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Giving up on (paramIndex:" << paramIndex << "retryCount:" << _waitingReadParamIndexMap[componentId][paramIndex] << ")";
-                (void) _waitingReadParamIndexMap[componentId].remove(paramIndex);
+                qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Giving up on (paramIndex:" << paramIndex << "retryCount:" << it.value() << ")";
+                it = waitingIndexMap.erase(it);
             } else {
                 // Retry again
-                _indexBatchQueue.append(paramIndex);
+                window.requestSent(paramIndex, nowMSecs, it.value() > 1);
                 _readParameterRaw(componentId, "", paramIndex);
-                qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Read re-request for (paramIndex:" << paramIndex << "retryCount:" << _waitingReadParamIndexMap[componentId][paramIndex] << ")";
+                qCDebug(ParameterManagerVerbose1Log) << _logVehiclePrefix(componentId) << "Read re-request for (paramIndex:" << paramIndex << "retryCount:" << it.value() << ")";
+                ++it;
             }
         }
+
+        if (window.outstandingCount() > 0) {
+            paramsRequested = true;
+        }
+    }
+
+    _scheduleIndexRequestTimer();
+
+    return paramsRequested;
+}
+
+void ParameterManager::_scheduleIndexRequestTimer()
+{
+    qint64 nextExpiryMSecs = -1;
+    for (const MAVLinkRequestWindow &window : _indexRequestWindows) {
+        const qint64 expiryMSecs = window.nextExpiryMSecs();
+        if ((expiryMSecs >= 0) && ((nextExpiryMSecs < 0) || (expiryMSecs < nextExpiryMSecs))) {
+            nextExpiryMSecs = expiryMSecs;
+        }
+    }
+
+    if (nextExpiryMSecs < 0) {
+        _indexRequestTimer.stop();
+    } else {
+        _indexRequestTimer.start(static_cast<int>(qMax<qint64>(nextExpiryMSecs - _indexRequestClock.elapsed(), 1)));
+    }
+}
+
+void ParameterManager::_indexRequestTimeout()
+{
+    if (_logReplay) {
+        return;
     }
 
-    return (!_indexBatchQueue.isEmpty());
+    // Selective retry of the requests which timed out, the others are still in flight
+    (void) _fillIndexBatchQueue(false /* waitingParamTimeout */);
+    _updateProgressBar();
+    _checkInitialLoadComplete();
 }
 
 void ParameterManager::_waitingParamTimeout()
@@ -639,8 +895,10 @@ void ParameterManager::_waitingParamTimeout()
 
     qCDebug(ParameterManagerLog) << _logVehiclePrefix(-1) << "_waitingParamTimeout";
 
-    // Now that we have timed out for possibly the first time we can activate the index batch queue
+    // Now that we have timed out for possibly the first time we can activate the index batch queue. This ends the
+    // initial stream, the shortened stream end timeout no longer applies.
     _indexBatchQueueActive = true;
+    _waitingParamTimeoutTimer.setInterval(kWaitingParamTimeoutMSecs);
 
     // First check for any missing parameters from the initial index based load
     bool paramsRequested = _fillIndexBatchQueue(true /* waitingParamTimeout */);
@@ -648,7 +906,7 @@ void ParameterManager::_waitingParamTimeout()
         // Initial load is complete but we still don't have any default component params. Wait one more cycle to see if the
         // any show up.
         qCDebug(ParameterManagerLog) << _logVehiclePrefix(-1) << "Restarting _waitingParamTimeoutTimer - still don't have default component params" << _vehicle->defaultComponentId();
-        _waitingParamTimeoutTimer.start();
+        _restartWaitingParamTimeoutTimer();
         _waitingForDefaultComponent = true;
         return;
     }
@@ -658,29 +916,6 @@ void ParameterManager::_waitingParamTimeout()
 
     constexpr int maxBatchSize = 10;
     int batchCount = 0;
-    if (!paramsRequested) {
-        for (const int componentId: _waitingWriteParamNameMap.keys()) {
-            for (const QString &paramName: _waitingWriteParamNameMap[componentId].keys()) {
-                paramsRequested = true;
-                _waitingWriteParamNameMap[componentId][paramName]++;   // Bump retry count
-                if (_waitingWriteParamNameMap[componentId][paramName] <= _maxReadWriteRetry) {
-                    const Fact *const fact = getParameter(componentId, paramName);
-                    _sendParamSetToVehicle(componentId, paramName, fact->type(), fact->rawValue());
-                    qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Write resend for (paramName:" << paramName << "retryCount:" << _waitingWriteParamNameMap[componentId][paramName] << ")";
-                    if (++batchCount > maxBatchSize) {
-                        goto Out;
-                    }
-                } else {
-                    // Exceeded max retry count, notify user
-                    _waitingWriteParamNameMap[componentId].remove(paramName);
-                    const QString errorMsg = tr("Parameter write failed: veh:%1 comp:%2 param:%3").arg(_vehicle->id()).arg(componentId).arg(paramName);
-                    qCDebug(ParameterManagerLog) << errorMsg;
-                    qgcApp()->showAppMessage(errorMsg);
-                }
-            }
-        }
-    }
-
     if (!paramsRequested) {
         for (const int componentId: _waitingReadParamNameMap.keys()) {
             for (const QString &paramName: _waitingReadParamNameMap[componentId].keys()) {
@@ -706,10 +941,16 @@ void ParameterManager::_waitingParamTimeout()
 Out:
     if (paramsRequested) {
         qCDebug(ParameterManagerLog) << _logVehiclePrefix(-1) << "Restarting _waitingParamTimeoutTimer - re-request";
-        _waitingParamTimeoutTimer.start();
+        _restartWaitingParamTimeoutTimer();
     }
 }
 
+void ParameterManager::_restartWaitingParamTimeoutTimer()
+{
+    _waitingParamTimeoutTimer.setInterval(kWaitingParamTimeoutMSecs);
+    _waitingParamTimeoutTimer.start();
+}
+
 void ParameterManager::_readParameterRaw(int componentId, const QString &paramName, int paramIndex) const
 {
     const SharedLinkInterfacePtr sharedLink = _vehicle->vehicleLinkManager()->primaryLink().lock();
@@ -791,21 +1032,81 @@ void ParameterManager::_sendParamSetToVehicle(int componentId, const QString &pa
     (void) _vehicle->sendMessageOnLinkThreadSafe(sharedLink.get(), msg);
 }
 
-void ParameterManager::_writeLocalParamCache(int vehicleId, int componentId)
+bool ParameterManager::_localParamCacheEnabled() const
 {
-    CacheMapName2ParamTypeVal cacheMap;
+    return (!_logReplay && _vehicle->px4Firmware());
+}
 
-    for (const QString &paramName: _mapCompId2FactMap[componentId].keys()) {
-        const Fact *const fact = _mapCompId2FactMap[componentId][paramName];
-        cacheMap[paramName] = ParamTypeVal(fact->type(), fact->rawValue());
+void ParameterManager::_writeLocalParamCache(int vehicleId, int componentId)
+{
+    QList<ParamCacheFile::Param> params;
+    params.reserve(_mapCompId2FactMap[componentId].count());
+
+    // QMap iterates sorted by name, which is the order the cache file requires
+    for (const Fact *const fact: _mapCompId2FactMap[componentId]) {
+        ParamCacheFile::Param param;
+        param.name = fact->name();
+        param.type = fact->type();
+        param.value = fact->rawValue();
+        param.volatileValue = fact->metaData() && fact->metaData()->volatileValue();
+        params.append(param);
+    }
+
+    // Queued single value updates are covered by the complete cache
+    (void) _pendingParamCacheUpdates.remove(componentId);
+
+    // Nothing to do if the file already holds these values, for example right after loading from it
+    const quint32 hash = ParamCacheFile::hash(params);
+    if (_paramCacheHashes.contains(componentId) && (_paramCacheHashes[componentId] == hash)) {
+        qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Cache file is up to date";
+        return;
     }
 
-    QFile cacheFile(parameterCacheFile(vehicleId, componentId));
-    if (cacheFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-        QDataStream ds(&cacheFile);
-        ds << cacheMap;
+    const quint32 firmwareVersion = ParamCacheFile::packFirmwareVersion(_vehicle->firmwareMajorVersion(), _vehicle->firmwareMinorVersion(), _vehicle->firmwarePatchVersion());
+    if (ParamCacheFile::write(parameterCacheFile(vehicleId, componentId), params, firmwareVersion)) {
+        _paramCacheHashes[componentId] = hash;
+
+        // Text cache of older versions, replaced by the file above
+        (void) QFile::remove(parameterCacheDir().filePath(QStringLiteral("%1_%2.v2").arg(vehicleId).arg(componentId)));
     } else {
-        qCWarning(ParameterManagerLog) << "Failed to open cache file for writing" << cacheFile.fileName();
+        qCWarning(ParameterManagerLog) << "Failed to write cache file" << parameterCacheFile(vehicleId, componentId);
+        (void) _paramCacheHashes.remove(componentId);
+    }
+}
+
+void ParameterManager::_updateLocalParamCache(int componentId, const Fact *fact)
+{
+    _pendingParamCacheUpdates[componentId].insert(fact->name());
+    if (!_paramCacheUpdateTimer.isActive()) {
+        _paramCacheUpdateTimer.start();
+    }
+}
+
+void ParameterManager::_flushLocalParamCacheUpdates()
+{
+    const QMap<int, QSet<QString>> pendingUpdates = std::exchange(_pendingParamCacheUpdates, {});
+    for (auto it = pendingUpdates.constBegin(); it != pendingUpdates.constEnd(); ++it) {
+        const int componentId = it.key();
+        const QMap<QString, Fact*> &factMap = _mapCompId2FactMap[componentId];
+
+        ParamCacheFile cacheFile(parameterCacheFile(_vehicle->id(), componentId));
+        bool updated = cacheFile.open(true);
+        for (const QString &name : it.value()) {
+            const Fact *const fact = factMap.value(name, nullptr);
+            updated = updated && fact && cacheFile.updateValue(name, fact->type(), fact->rawValue());
+            if (!updated) {
+                break;
+            }
+        }
+
+        if (updated) {
+            _paramCacheHashes[componentId] = cacheFile.paramHash();
+            continue;
+        }
+        cacheFile.close();
+
+        // New param or changed type, the sorted record table has to be rebuilt
+        _writeLocalParamCache(_vehicle->id(), componentId);
     }
 }
 
@@ -817,54 +1118,49 @@ QDir ParameterManager::parameterCacheDir()
 
 QString ParameterManager::parameterCacheFile(int vehicleId, int componentId)
 {
-    return parameterCacheDir().filePath(QStringLiteral("%1_%2.v2").arg(vehicleId).arg(componentId));
+    return parameterCacheDir().filePath(QStringLiteral("%1_%2.v3").arg(vehicleId).arg(componentId));
 }
 
 void ParameterManager::_tryCacheHashLoad(int vehicleId, int componentId, const QVariant &hashValue)
 {
     qCInfo(ParameterManagerLog) << "Attemping load from cache";
 
-    /* The datastructure of the cache table */
-    CacheMapName2ParamTypeVal cacheMap;
-    QFile cacheFile(parameterCacheFile(vehicleId, componentId));
-    if (!cacheFile.exists()) {
-        /* no local cache, just wait for them to come in*/
+    ParamCacheFile cacheFile(parameterCacheFile(vehicleId, componentId));
+    if (!cacheFile.open()) {
+        /* no usable local cache, just wait for them to come in*/
         return;
     }
-    (void) cacheFile.open(QIODevice::ReadOnly);
 
-    /* Deserialize the parameter cache table */
-    QDataStream ds(&cacheFile);
-    ds >> cacheMap;
+    /* the hash of the local cache is kept in the file header, so a miss only reads a few bytes */
+    const uint32_t crc32_value = cacheFile.paramHash();
+    bool hashMatch = (crc32_value == hashValue.toUInt());
 
-    /* compute the crc of the local cache to check against the remote */
-    uint32_t crc32_value = 0;
-    for (const QString &name: cacheMap.keys()) {
-        const ParamTypeVal &paramTypeVal = cacheMap[name];
-        const FactMetaData::ValueType_t factType = static_cast<FactMetaData::ValueType_t>(paramTypeVal.first);
+    /* the same param set hash from another firmware version may carry different meanings, 0 means unknown */
+    const quint32 cacheFirmwareVersion = cacheFile.firmwareVersion();
+    const quint32 vehicleFirmwareVersion = ParamCacheFile::packFirmwareVersion(_vehicle->firmwareMajorVersion(), _vehicle->firmwareMinorVersion(), _vehicle->firmwarePatchVersion());
+    if (hashMatch && (cacheFirmwareVersion != 0) && (vehicleFirmwareVersion != 0) && (cacheFirmwareVersion != vehicleFirmwareVersion)) {
+        qCInfo(ParameterManagerLog) << "Parameters cache is from another firmware version" << Qt::hex << cacheFirmwareVersion << vehicleFirmwareVersion;
+        hashMatch = false;
+    }
 
-        if (_vehicle->compInfoManager()->compInfoParam(MAV_COMP_ID_AUTOPILOT1)->factMetaDataForName(name, factType)->volatileValue()) {
-            // Does not take part in CRC
-            qCDebug(ParameterManagerLog) << "Volatile parameter" << name;
-        } else {
-            const void *const vdat = paramTypeVal.second.constData();
-            const FactMetaData::ValueType_t factType = static_cast<FactMetaData::ValueType_t>(paramTypeVal.first);
-            crc32_value = QGC::crc32(reinterpret_cast<const uint8_t *>(qPrintable(name)), name.length(),  crc32_value);
-            crc32_value = QGC::crc32(static_cast<const uint8_t *>(vdat), FactMetaData::typeToSize(factType), crc32_value);
-        }
+    /* the records are copied out and the file closed before they are handled, the cache may be rewritten meanwhile */
+    QList<ParamCacheFile::Param> cachedParams;
+    if (hashMatch || ParameterManagerDebugCacheFailureLog().isDebugEnabled()) {
+        cachedParams = cacheFile.params();
     }
+    cacheFile.close();
 
     /* if the two param set hashes match, just load from the disk */
-    if (crc32_value == hashValue.toUInt()) {
-        qCInfo(ParameterManagerLog) << "Parameters loaded from cache" << qPrintable(QFileInfo(cacheFile).absoluteFilePath());
-
-        const int count = cacheMap.count();
-        int index = 0;
-        for (const QString &name: cacheMap.keys()) {
-            const ParamTypeVal &paramTypeVal = cacheMap[name];
-            const FactMetaData::ValueType_t factType = static_cast<FactMetaData::ValueType_t>(paramTypeVal.first);
-            const MAV_PARAM_TYPE mavParamType = factTypeToMavType(factType);
-            _handleParamValue(componentId, name, count, index++, mavParamType, paramTypeVal.second);
+    if (hashMatch) {
+        qCInfo(ParameterManagerLog) << "Parameters loaded from cache" << qPrintable(QFileInfo(parameterCacheFile(vehicleId, componentId)).absoluteFilePath());
+
+        // The file already holds these values, handling them must not rewrite it
+        _paramCacheHashes[componentId] = crc32_value;
+
+        const int count = static_cast<int>(cachedParams.count());
+        for (int index = 0; index < count; index++) {
+            const ParamCacheFile::Param &param = cachedParams[index];
+            _handleParamValue(componentId, param.name, count, index, factTypeToMavType(param.type), param.value);
         }
 
         const SharedLinkInterfacePtr sharedLink = _vehicle->vehicleLinkManager()->primaryLink().lock();
@@ -909,8 +1205,13 @@ void ParameterManager::_tryCacheHashLoad(int vehicleId, int componentId, const Q
 
         ani->start(QAbstractAnimation::DeleteWhenStopped);
     } else {
-        qCInfo(ParameterManagerLog) << "Parameters cache match failed" << qPrintable(QFileInfo(cacheFile).absoluteFilePath());
+        qCInfo(ParameterManagerLog) << "Parameters cache match failed" << qPrintable(QFileInfo(parameterCacheFile(vehicleId, componentId)).absoluteFilePath());
         if (ParameterManagerDebugCacheFailureLog().isDebugEnabled()) {
+            CacheMapName2ParamTypeVal cacheMap;
+            for (const ParamCacheFile::Param &param : std::as_const(cachedParams)) {
+                cacheMap[param.name] = ParamTypeVal(param.type, param.value);
+            }
+
             _debugCacheCRC[componentId] = true;
             _debugCacheMap[componentId] = cacheMap;
             for (const QString &name: cacheMap.keys()) {
@@ -1098,6 +1399,12 @@ void ParameterManager::_checkInitialLoadComplete()
     _debugCacheCRC.clear();
 
     qCDebug(ParameterManagerLog) << _logVehiclePrefix(-1) << "Initial load complete";
+    for (const int componentId: _indexRequestWindows.keys()) {
+        const MAVLinkRequestWindow &window = _indexRequestWindows[componentId];
+        if (window.sentCount() > 0) {
+            qCDebug(ParameterManagerLog) << _logVehiclePrefix(componentId) << "Index re-requests sent:" << window.sentCount() << "lost:" << window.lostCount() << "window:" << window.window() << "srtt:" << window.srttMSecs();
+        }
+    }
 
     // Check for index based load failures
     QString indexList;
@@ -1316,19 +1623,8 @@ Vehicle *ParameterManager::vehicle()
 
 bool ParameterManager::_parseParamFile(const QString& filename)
 {
-    constexpr quint16 magic_standard = 0x671B;
-    constexpr quint16 magic_withdefaults = 0x671C;
     quint32 no_of_parameters_found = 0;
     constexpr int componentId = MAV_COMP_ID_AUTOPILOT1;
-    enum ap_var_type {
-        AP_PARAM_NONE = 0,
-        AP_PARAM_INT8,
-        AP_PARAM_INT16,
-        AP_PARAM_INT32,
-        AP_PARAM_FLOAT,
-        AP_PARAM_VECTOR3F,
-        AP_PARAM_GROUP
-    };
 
     qCDebug(ParameterManagerLog) << "_parseParamFile:" << filename;
     QFile file(filename);
@@ -1511,3 +1807,75 @@ bool ParameterManager::_parseParamFile(const QString& filename)
     file.close();
     return false;
 }
+
+bool ParameterManager::_writeParamFile(const QString &filename, const QList<ParamWriteQueue::Write> &writes)
+{
+    QFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(ParameterManagerLog) << "_writeParamFile: Could not open" << filename << file.errorString();
+        return false;
+    }
+
+    QDataStream out(&file);
+    out.setByteOrder(QDataStream::LittleEndian);
+    out.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    const quint16 num_params = static_cast<quint16>(writes.count());
+    out << magic_standard << num_params << num_params;
+
+    for (const ParamWriteQueue::Write &write : writes) {
+        const QByteArray name = write.name.toLatin1();
+        if (name.isEmpty() || (name.length() > 16)) {
+            qCWarning(ParameterManagerLog) << "_writeParamFile: Invalid param name" << write.name;
+            return false;
+        }
+
+        ap_var_type ptype = AP_PARAM_NONE;
+        switch (write.valueType) {
+        case FactMetaData::valueTypeInt8:
+        case FactMetaData::valueTypeUint8:
+            ptype = AP_PARAM_INT8;
+            break;
+        case FactMetaData::valueTypeInt16:
+        case FactMetaData::valueTypeUint16:
+            ptype = AP_PARAM_INT16;
+            break;
+        case FactMetaData::valueTypeInt32:
+        case FactMetaData::valueTypeUint32:
+            ptype = AP_PARAM_INT32;
+            break;
+        case FactMetaData::valueTypeFloat:
+            ptype = AP_PARAM_FLOAT;
+            break;
+        default:
+            qCWarning(ParameterManagerLog) << "_writeParamFile: Unsupported type" << write.name << write.valueType;
+            return false;
+        }
+
+        // No flags, no common prefix with the previous name
+        out << static_cast<quint8>(ptype) << static_cast<quint8>((name.length() - 1) << 4);
+        (void) out.writeRawData(name.constData(), static_cast<int>(name.length()));
+
+        switch (ptype) {
+        case AP_PARAM_INT8:
+            out << static_cast<qint8>(write.value.toInt());
+            break;
+        case AP_PARAM_INT16:
+            out << static_cast<qint16>(write.value.toInt());
+            break;
+        case AP_PARAM_INT32:
+            out << static_cast<qint32>(write.value.toLongLong());
+            break;
+        default:
+            out << write.value.toFloat();
+            break;
+        }
+    }
+
+    if (out.status() != QDataStream::Ok) {
+        qCWarning(ParameterManagerLog) << "_writeParamFile: Write failed" << filename << file.errorString();
+        return false;
+    }
+
+    return true;
+}
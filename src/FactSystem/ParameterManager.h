@@ -10,9 +10,11 @@
 #pragma once
 
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QMap>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
 #include <QtCore/QString>
 #include <QtCore/QTimer>
 #include <QtQmlIntegration/QtQmlIntegration>
@@ -20,6 +22,8 @@
 #include "Fact.h"
 #include "FactMetaData.h"
 #include "MAVLinkLib.h"
+#include "MAVLinkRequestWindow.h"
+#include "ParamWriteQueue.h"
 
 Q_DECLARE_LOGGING_CATEGORY(ParameterManagerLog)
 Q_DECLARE_LOGGING_CATEGORY(ParameterManagerVerbose1Log)
@@ -114,13 +118,29 @@ private slots:
      /// Writes the parameter update to mavlink, sets up for write wait
     void _factRawValueUpdateWorker(int componentId, const QString &name, FactMetaData::ValueType_t valueType, const QVariant &rawValue);
     void _waitingParamTimeout();
+    /// Restarts the waiting param timer with the regular timeout, only the initial stream uses a shorter one
+    void _restartWaitingParamTimeoutTimer();
+    void _indexRequestTimeout();
+    void _scheduleIndexRequestTimer();
+    void _paramWriteTimeout();
+    /// Sends the queued param writes the write windows allow
+    void _sendQueuedParamWrites();
+    void _scheduleParamWriteTimer();
+    /// Reports the outcome of a batch of param writes once all of them are acked or failed
+    void _paramWritesComplete();
     void _tryCacheLookup();
     void _initialRequestTimeout();
     /// Translates ParameterManager::defaultComponentId to real component id if needed
     int _actualComponentId(int componentId) const;
     void _readParameterRaw(int componentId, const QString &paramName, int paramIndex) const;
     void _sendParamSetToVehicle(int componentId, const QString &paramName, FactMetaData::ValueType_t valueType, const QVariant &value) const;
+    /// The param cache is only used on PX4 Firmware, see _handleParamValue
+    bool _localParamCacheEnabled() const;
     void _writeLocalParamCache(int vehicleId, int componentId);
+    /// Queues a changed value for the next in place update of the cache file
+    void _updateLocalParamCache(int componentId, const Fact *fact);
+    /// Updates the queued values in place, one mapping per component. Falls back to writing the whole cache.
+    void _flushLocalParamCacheUpdates();
     void _tryCacheHashLoad(int vehicleId, int componentId, const QVariant &hashValue);
     void _loadMetaData();
     void _clearMetaData();
@@ -141,6 +161,14 @@ private slots:
     /// Parse the binary parameter file and inject the parameters in the qgc fact system.
     /// See: https://github.com/ArduPilot/ardupilot/tree/master/libraries/AP_Filesystem
     bool _parseParamFile(const QString &filename);
+    /// Write the params in the binary parameter file format, uploading it sets them all on the vehicle
+    static bool _writeParamFile(const QString &filename, const QList<ParamWriteQueue::Write> &writes);
+    /// @return true: writes to this component are uploaded as a binary parameter file when enough of them are queued
+    bool _ftpParamWriteAvailable(int componentId) const;
+    /// Uploads the queued writes as a binary parameter file
+    ///     @return false: the upload was not started, the writes are still queued
+    bool _uploadParamWrites(ParamWriteQueue &queue);
+    void _ftpUploadComplete(const QString &fileName, const QString &errorMsg);
 
     static QVariant _stringToTypedVariant(const QString &string, FactMetaData::ValueType_t type, bool failOk = false);
 
@@ -180,12 +208,19 @@ private slots:
     bool _disableAllRetries = false;                            ///< true: Don't retry any requests (used for testing)
 
     bool _indexBatchQueueActive = false;    ///< true: we are actively batching re-requests for missing index base params, false: index based re-request has not yet started
-    QList<int> _indexBatchQueue;            ///< The current queue of index re-requests
+    QMap<int, MAVLinkRequestWindow> _indexRequestWindows; ///< Key: Component id, Value: flow control for index re-requests
+    QElapsedTimer _indexRequestClock;
+    QTimer _indexRequestTimer;                          ///< Fires when the next outstanding index re-request times out
+    qint64 _lastParamValueMSecs = -1;                   ///< Arrival of the last param value, used to measure the parameter stream gap
+    double _paramStreamGapMSecs = 0;                    ///< Smoothed gap between param values of the initial stream
 
     QMap<int, int> _paramCountMap;                              ///< Key: Component id, Value: count of parameters in this component
     QMap<int, QMap<int, int>> _waitingReadParamIndexMap;        ///< Key: Component id, Value: Map { Key: parameter index still waiting for, Value: retry count }
     QMap<int, QMap<QString, int>> _waitingReadParamNameMap;     ///< Key: Component id, Value: Map { Key: parameter name still waiting for, Value: retry count }
-    QMap<int, QMap<QString, int>> _waitingWriteParamNameMap;    ///< Key: Component id, Value: Map { Key: parameter name still waiting for, Value: retry count }
+    QMap<int, QMap<QString, int>> _waitingWriteParamNameMap;    ///< Key: Component id, Value: Map { Key: parameter name still waiting for, Value: unused, retries are tracked by _paramWriteQueues }
+    QMap<int, ParamWriteQueue> _paramWriteQueues;               ///< Key: Component id, Value: pipelined writes
+    QTimer _paramWriteTimer;                                    ///< Fires when the next outstanding write times out
+    QStringList _failedWriteParams;                             ///< "compId:name" of the writes of the current batch which failed
     QMap<int, QList<int>> _failedReadParamIndexMap;             ///< Key: Component id, Value: failed parameter index
 
     int _totalParamCount = 0;                   ///< Number of parameters across all components
@@ -195,7 +230,20 @@ private slots:
     QTimer _initialRequestTimeoutTimer;
     QTimer _waitingParamTimeoutTimer;
 
+    QMap<int, quint32> _paramCacheHashes;                       ///< Key: Component id, Value: hash of the cache file as last loaded or written
+    QMap<int, QSet<QString>> _pendingParamCacheUpdates;         ///< Key: Component id, Value: names of the params changed since the last cache update
+    QTimer _paramCacheUpdateTimer;                              ///< Collects changed values into a single cache update
+
+    static constexpr int kWaitingParamTimeoutMSecs = 3000;
+    static constexpr int kMinStreamEndTimeoutMSecs = 500;  ///< Lower limit for detecting the end of the initial param stream
+    static constexpr int kParamCacheUpdateDelayMSecs = 1000;
+
     Fact _defaultFact;   ///< Used to return default fact, when parameter not found
 
     bool _tryftp = false;
+    bool _ftpParamWrite = false;                    ///< true: writes may be uploaded as a binary parameter file, cleared once an upload fails
+    QList<ParamWriteQueue::Write> _ftpParamWrites;  ///< Writes of the binary parameter file being uploaded
+    QTimer _paramWriteCollectTimer;                 ///< Collects the writes made in one go, for example by loading a param file
+
+    static constexpr int kFtpParamWriteMinCount = 10;   ///< Fewer writes are cheaper as PARAM_SETs than as an FTP session
 };
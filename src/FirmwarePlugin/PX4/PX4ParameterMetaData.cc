@@ -88,6 +88,15 @@ void PX4ParameterMetaData::loadParameterFactMetaDataFile(const QString& metaData
 
     qCDebug(PX4ParameterMetaDataLog) << "Loading parameter meta data:" << metaDataFile;
 
+    const QByteArray sourceKey = ParamMetaDataBlob::sourceKey(metaDataFile);
+    if (!sourceKey.isEmpty()) {
+        _metaDataBlob.setFileName(ParamMetaDataBlob::cacheFileName(sourceKey));
+        if (_metaDataBlob.open(sourceKey)) {
+            qCDebug(PX4ParameterMetaDataLog) << "Using precompiled parameter meta data:" << _metaDataBlob.fileName();
+            return;
+        }
+    }
+
     QFile xmlFile(metaDataFile);
 
     if (!xmlFile.exists()) {
@@ -399,6 +408,10 @@ void PX4ParameterMetaData::loadParameterFactMetaDataFile(const QString& metaData
         xml.readNext();
     }
 
+    if (!sourceKey.isEmpty()) {
+        (void) ParamMetaDataBlob::write(ParamMetaDataBlob::cacheFileName(sourceKey), sourceKey, _mapParameterName2FactMetaData);
+    }
+
 #ifdef GENERATE_PARAMETER_JSON
     _generateParameterJson();
 #endif
@@ -493,8 +506,17 @@ FactMetaData* PX4ParameterMetaData::getMetaDataForFact(const QString& name, MAV_
     Q_UNUSED(vehicleType)
 
     if (!_mapParameterName2FactMetaData.contains(name)) {
-        qCDebug(PX4ParameterMetaDataLog) << "No metaData for " << name << "using generic metadata";
-        FactMetaData* metaData = new FactMetaData(type, this);
+        FactMetaData* metaData = nullptr;
+        if (_metaDataBlob.isOpen()) {
+            const qint64 index = _metaDataBlob.indexOf(name);
+            if (index >= 0) {
+                metaData = _metaDataBlob.createMetaData(static_cast<quint32>(index), this);
+            }
+        }
+        if (!metaData) {
+            qCDebug(PX4ParameterMetaDataLog) << "No metaData for " << name << "using generic metadata";
+            metaData = new FactMetaData(type, this);
+        }
         _mapParameterName2FactMetaData[name] = metaData;
     }
 
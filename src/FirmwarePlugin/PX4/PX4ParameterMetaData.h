@@ -12,6 +12,7 @@
 
 #include "MAVLinkLib.h"
 #include "FactMetaData.h"
+#include "ParamMetaDataBlob.h"
 
 #include <QtCore/QObject>
 #include <QtCore/QLoggingCategory>
@@ -55,6 +56,7 @@ class PX4ParameterMetaData : public QObject
 
     bool                                _parameterMetaDataLoaded        = false;    ///< true: parameter meta data already loaded
     FactMetaData::NameToMetaDataMap_t   _mapParameterName2FactMetaData;             ///< Maps from a parameter name to FactMetaData
+    ParamMetaDataBlob                   _metaDataBlob;                              ///< Precompiled meta data, FactMetaData is created on first lookup
 
     static constexpr const char* kInvalidConverstion = "Internal Error: No support for string parameters";
 
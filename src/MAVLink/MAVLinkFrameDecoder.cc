@@ -0,0 +1,230 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkFrameDecoder.h"
+#include "QGCLoggingCategory.h"
+
+QGC_LOGGING_CATEGORY(MAVLinkFrameDecoderLog, "qgc.mavlink.mavlinkframedecoder")
+
+namespace
+{
+
+constexpr qsizetype kHeaderLenV1 = MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1;
+constexpr qsizetype kHeaderLenV2 = MAVLINK_CORE_HEADER_LEN + 1;
+
+const uint8_t *_findStx(const uint8_t *begin, const uint8_t *end)
+{
+    while ((begin < end) && (*begin != MAVLINK_STX) && (*begin != MAVLINK_STX_MAVLINK1)) {
+        ++begin;
+    }
+
+    return begin;
+}
+
+} // namespace
+
+MAVLinkFrameDecoder::MAVLinkFrameDecoder(uint8_t channel, QByteArrayView data)
+    : MAVLinkFrameDecoder(mavlink_get_channel_status(channel), mavlink_get_channel_buffer(channel), data)
+{
+}
+
+MAVLinkFrameDecoder::MAVLinkFrameDecoder(mavlink_status_t *status, mavlink_message_t *rxBuffer, QByteArrayView data)
+    : _status(status)
+    , _rxBuffer(rxBuffer)
+    , _data(reinterpret_cast<const uint8_t*>(data.data()))
+    , _size(data.size())
+{
+    _byteMode = _status && !_parserIdle();
+}
+
+bool MAVLinkFrameDecoder::next(mavlink_message_t &message)
+{
+    if (!_status) {
+        return false;
+    }
+
+    while (_pos < _size) {
+        if (_byteMode) {
+            if (_parseByte(message)) {
+                return true;
+            }
+            continue;
+        }
+
+        _pos = _findStx(_data + _pos, _data + _size) - _data;
+        if (_pos >= _size) {
+            break;
+        }
+
+        switch (_decodeFrame(message)) {
+        case FrameResult::Ok:
+            return true;
+        case FrameResult::Invalid:
+            break;
+        case FrameResult::Incomplete:
+            // Frame continues in the next chunk, hand the tail to the byte-wise parser
+            _byteMode = true;
+            break;
+        }
+    }
+
+    return false;
+}
+
+/// Validates the frame starting at _pos in place.
+/// Rejected frames advance _pos to the same byte the byte-wise parser would resume scanning from.
+MAVLinkFrameDecoder::FrameResult MAVLinkFrameDecoder::_decodeFrame(mavlink_message_t &message)
+{
+    const uint8_t *const frame = _data + _pos;
+    const qsizetype available = _size - _pos;
+    const bool mavlink1 = (frame[0] == MAVLINK_STX_MAVLINK1);
+    const qsizetype headerLen = mavlink1 ? kHeaderLenV1 : kHeaderLenV2;
+
+    if (mavlink1) {
+        _status->flags |= MAVLINK_STATUS_FLAG_IN_MAVLINK1;
+    } else {
+        _status->flags &= ~MAVLINK_STATUS_FLAG_IN_MAVLINK1;
+    }
+
+    if (available < headerLen) {
+        return FrameResult::Incomplete;
+    }
+
+    if (!mavlink1 && ((frame[2] & ~MAVLINK_IFLAG_MASK) != 0)) {
+        // Incompatible feature flag: the parser drops STX, length and flags
+        _parseErrors++;
+        _status->parse_error++;
+        _pos += 3;
+        return FrameResult::Invalid;
+    }
+
+    const uint8_t payloadLen = frame[1];
+    const bool isSigned = !mavlink1 && (frame[2] & MAVLINK_IFLAG_SIGNED);
+    const qsizetype crcOffset = headerLen + payloadLen;
+    const qsizetype frameLen = crcOffset + MAVLINK_NUM_CHECKSUM_BYTES + (isSigned ? MAVLINK_SIGNATURE_BLOCK_LEN : 0);
+    if (available < frameLen) {
+        return FrameResult::Incomplete;
+    }
+
+    const uint32_t msgid = mavlink1 ? frame[5] : (frame[7] | (frame[8] << 8) | (static_cast<uint32_t>(frame[9]) << 16));
+    const mavlink_msg_entry_t *const entry = mavlink_get_msg_entry(msgid);
+    const uint16_t wireCrc = frame[crcOffset] | (frame[crcOffset + 1] << 8);
+
+    uint16_t crc = 0;
+    if (entry) {
+        crc = crc_calculate(frame + 1, static_cast<uint16_t>(crcOffset - 1));
+        crc_accumulate(entry->crc_extra, &crc);
+    }
+
+    if (!entry || (crc != wireCrc)) {
+        _crcErrors++;
+        _frameRejected(crcOffset + 1);
+        return FrameResult::Invalid;
+    }
+
+    if (mavlink1) {
+        message.magic = MAVLINK_STX_MAVLINK1;
+        message.len = payloadLen;
+        message.incompat_flags = 0;
+        message.compat_flags = 0;
+        message.seq = frame[2];
+        message.sysid = frame[3];
+        message.compid = frame[4];
+        message.msgid = msgid;
+    } else {
+        // mavlink_message_t mirrors the v2 wire header starting at magic, signature checks rely on this as well
+        (void) memcpy(&message.magic, frame, kHeaderLenV2);
+    }
+
+    uint8_t *const payload = reinterpret_cast<uint8_t*>(_MAV_PAYLOAD_NON_CONST(&message));
+    (void) memcpy(payload, frame + headerLen, payloadLen);
+    if (payloadLen < entry->max_msg_len) {
+        // Zero-fill MAVLink 2 truncated payloads
+        (void) memset(payload + payloadLen, 0, entry->max_msg_len - payloadLen);
+    }
+    message.checksum = crc;
+    message.ck[0] = frame[crcOffset];
+    message.ck[1] = frame[crcOffset + 1];
+
+    bool signatureOk = true;
+    mavlink_signing_t *const signing = _status->signing;
+    if (isSigned) {
+        (void) memcpy(message.signature, frame + crcOffset + MAVLINK_NUM_CHECKSUM_BYTES, MAVLINK_SIGNATURE_BLOCK_LEN);
+        signatureOk = mavlink_signature_check(signing, _status->signing_streams, &message);
+        if (!signatureOk && signing->accept_unsigned_callback && signing->accept_unsigned_callback(_status, msgid)) {
+            signatureOk = true;
+        }
+    } else if (signing) {
+        signatureOk = signing->accept_unsigned_callback && signing->accept_unsigned_callback(_status, msgid);
+    }
+
+    if (!signatureOk) {
+        _signatureErrors++;
+        _frameRejected(frameLen - 1);
+        return FrameResult::Invalid;
+    }
+
+    _status->msg_received = MAVLINK_FRAMING_OK;
+    _status->parse_state = MAVLINK_PARSE_STATE_IDLE;
+    _status->parse_error = 0;
+    _status->current_rx_seq = message.seq;
+    if (_status->packet_rx_success_count == 0) {
+        _status->packet_rx_drop_count = 0;
+    }
+    _status->packet_rx_success_count++;
+
+    _frame = QByteArrayView(frame, frameLen);
+    _pos += frameLen;
+    return FrameResult::Ok;
+}
+
+/// Matches mavlink_parse_char error handling: scanning resumes after the byte which failed the frame,
+/// unless that byte is itself a v2 STX.
+void MAVLinkFrameDecoder::_frameRejected(qsizetype lastByteOffset)
+{
+    _status->parse_error++;
+    _status->msg_received = MAVLINK_FRAMING_INCOMPLETE;
+    _status->parse_state = MAVLINK_PARSE_STATE_IDLE;
+
+    const uint8_t lastByte = _data[_pos + lastByteOffset];
+    _pos += lastByteOffset;
+    if (lastByte != MAVLINK_STX) {
+        _pos++;
+    }
+}
+
+/// Feeds a single byte through the mavlink parser using the channel buffers.
+///     @return true: a complete and valid message was placed in message
+bool MAVLinkFrameDecoder::_parseByte(mavlink_message_t &message)
+{
+    const uint8_t byte = _data[_pos++];
+    _frame = QByteArrayView();
+    const uint8_t result = mavlink_frame_char_buffer(_rxBuffer, _status, byte, &message, nullptr);
+
+    if ((result == MAVLINK_FRAMING_BAD_CRC) || (result == MAVLINK_FRAMING_BAD_SIGNATURE)) {
+        if (result == MAVLINK_FRAMING_BAD_CRC) {
+            _crcErrors++;
+        } else {
+            _signatureErrors++;
+        }
+
+        _status->parse_error++;
+        _status->msg_received = MAVLINK_FRAMING_INCOMPLETE;
+        _status->parse_state = MAVLINK_PARSE_STATE_IDLE;
+        if (byte == MAVLINK_STX) {
+            _status->parse_state = MAVLINK_PARSE_STATE_GOT_STX;
+            _rxBuffer->len = 0;
+            mavlink_start_checksum(_rxBuffer);
+        }
+    }
+
+    _byteMode = !_parserIdle();
+
+    return (result == MAVLINK_FRAMING_OK);
+}
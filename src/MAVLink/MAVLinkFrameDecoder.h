@@ -0,0 +1,78 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QByteArrayView>
+#include <QtCore/QLoggingCategory>
+
+#include "MAVLinkLib.h"
+
+Q_DECLARE_LOGGING_CATEGORY(MAVLinkFrameDecoderLog)
+
+/// Bulk MAVLink frame decoder for a received chunk of bytes.
+/// Complete frames are located by scanning for STX and validated in place (length, CRC_EXTRA and signing).
+/// Only frames which are split across chunk boundaries go through the byte-wise mavlink parser, which keeps the
+/// partial frame state in the channel buffers exactly like mavlink_parse_char does.
+/// The receive mavlink_status_t (sequence, success counters, MAVLink 1 flag) is updated the same way as the
+/// byte-wise parser so version detection and signing continue to work unchanged. A decoder running on another thread
+/// than the channel owner must bring its own status and parse buffer, the channel status is also used for sending.
+class MAVLinkFrameDecoder
+{
+public:
+    /// @param channel Mavlink channel the data was received on
+    /// @param data Chunk to decode, must stay valid while next() is called
+    MAVLinkFrameDecoder(uint8_t channel, QByteArrayView data);
+
+    /// @param status Receive status, including the signing state used to verify signatures
+    /// @param rxBuffer Partial frame buffer of the byte-wise parser, kept together with status across chunks
+    /// @param data Chunk to decode, must stay valid while next() is called
+    MAVLinkFrameDecoder(mavlink_status_t *status, mavlink_message_t *rxBuffer, QByteArrayView data);
+
+    /// Decodes the next valid frame from the chunk.
+    ///     @param message Filled with the decoded message
+    ///     @return true: message is valid, false: no more complete frames in the chunk
+    bool next(mavlink_message_t &message);
+
+    /// Wire bytes of the message last returned by next(), as received.
+    /// Empty if the frame was split across chunks and reassembled by the byte-wise parser.
+    QByteArrayView frame() const { return _frame; }
+
+    /// Number of frames dropped due to CRC errors (including unknown message ids)
+    uint32_t crcErrors() const { return _crcErrors; }
+
+    /// Number of frames dropped due to signing failures
+    uint32_t signatureErrors() const { return _signatureErrors; }
+
+    /// Number of frames dropped due to unsupported header flags
+    uint32_t parseErrors() const { return _parseErrors; }
+
+private:
+    enum class FrameResult {
+        Ok,
+        Invalid,
+        Incomplete
+    };
+
+    FrameResult _decodeFrame(mavlink_message_t &message);
+    bool _parseByte(mavlink_message_t &message);
+    bool _parserIdle() const { return _status->parse_state <= MAVLINK_PARSE_STATE_IDLE; }
+    void _frameRejected(qsizetype lastByteOffset);
+
+    mavlink_status_t *const _status = nullptr;
+    mavlink_message_t *const _rxBuffer = nullptr;
+    const uint8_t *const _data = nullptr;
+    const qsizetype _size = 0;
+    qsizetype _pos = 0;
+    QByteArrayView _frame;
+    bool _byteMode = false;     ///< true: a partial frame is being completed by the byte-wise parser
+    uint32_t _crcErrors = 0;
+    uint32_t _signatureErrors = 0;
+    uint32_t _parseErrors = 0;
+};
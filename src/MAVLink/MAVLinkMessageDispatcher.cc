@@ -0,0 +1,96 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkMessageDispatcher.h"
+#include "QGCLoggingCategory.h"
+
+QGC_LOGGING_CATEGORY(MAVLinkMessageDispatcherLog, "qgc.mavlink.mavlinkmessagedispatcher")
+
+void MAVLinkMessageDispatcher::registerHandler(const void *owner, const QList<uint32_t> &messageIds, const Handler &handler)
+{
+    const Entry entry{owner, handler};
+
+    for (const uint32_t messageId : messageIds) {
+        if (messageId == allMessageIds) {
+            _allMessageEntries.append(entry);
+        } else if (messageId < kFlatTableSize) {
+            _flatTable[messageId].append(entry);
+        } else {
+            _sparseTable[messageId].append(entry);
+        }
+    }
+
+    (void) _owners.insert(owner);
+
+    qCDebug(MAVLinkMessageDispatcherLog) << "registerHandler" << owner << messageIds;
+}
+
+void MAVLinkMessageDispatcher::unregisterHandlers(const void *owner)
+{
+    if (!_owners.remove(owner)) {
+        return;
+    }
+
+    for (EntryList &entryList : _flatTable) {
+        _removeOwner(entryList, owner);
+    }
+
+    for (auto it = _sparseTable.begin(); it != _sparseTable.end();) {
+        _removeOwner(it.value(), owner);
+        if (it.value().isEmpty()) {
+            it = _sparseTable.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    _removeOwner(_allMessageEntries, owner);
+}
+
+void MAVLinkMessageDispatcher::_removeOwner(EntryList &entryList, const void *owner)
+{
+    if (!entryList.isEmpty()) {
+        (void) entryList.removeIf([owner](const Entry &entry) { return entry.owner == owner; });
+    }
+}
+
+const MAVLinkMessageDispatcher::EntryList *MAVLinkMessageDispatcher::_entryList(uint32_t messageId) const
+{
+    if (messageId < kFlatTableSize) {
+        return &_flatTable[messageId];
+    }
+
+    const auto it = _sparseTable.constFind(messageId);
+    return ((it == _sparseTable.constEnd()) ? nullptr : &it.value());
+}
+
+qsizetype MAVLinkMessageDispatcher::handlerCount(uint32_t messageId) const
+{
+    const EntryList *const entryList = _entryList(messageId);
+    return (entryList ? entryList->count() : 0) + _allMessageEntries.count();
+}
+
+void MAVLinkMessageDispatcher::dispatch(const mavlink_message_t &message) const
+{
+    // Iterate by index over the live lists: handlers registered while dispatching (e.g. FactGroups created
+    // from this message) still see the message. The handler is copied since the call may modify the list.
+    for (qsizetype i = 0; ; i++) {
+        const EntryList *const entryList = _entryList(message.msgid);
+        if (!entryList || (i >= entryList->count())) {
+            break;
+        }
+        const Handler handler = entryList->at(i).handler;
+        handler(message);
+    }
+
+    for (qsizetype i = 0; i < _allMessageEntries.count(); i++) {
+        const Handler handler = _allMessageEntries.at(i).handler;
+        handler(message);
+    }
+}
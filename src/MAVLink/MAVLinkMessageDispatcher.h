@@ -0,0 +1,68 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QSet>
+
+#include <array>
+#include <functional>
+#include <limits>
+
+#include "MAVLinkLib.h"
+
+Q_DECLARE_LOGGING_CATEGORY(MAVLinkMessageDispatcherLog)
+
+/// Routes incoming messages only to the handlers which registered for the message id.
+/// Handlers for the low (high rate telemetry) message ids live in a flat table indexed by message id,
+/// everything else is looked up through a hash.
+class MAVLinkMessageDispatcher
+{
+public:
+    using Handler = std::function<void(const mavlink_message_t &message)>;
+
+    /// Message id used to register for every incoming message
+    static constexpr uint32_t allMessageIds = std::numeric_limits<uint32_t>::max();
+
+    /// Registers a handler for the specified message ids
+    ///     @param owner Key used to unregister the handler
+    ///     @param messageIds Message ids to route to the handler, allMessageIds routes everything
+    void registerHandler(const void *owner, const QList<uint32_t> &messageIds, const Handler &handler);
+
+    /// Removes all handlers registered by owner
+    void unregisterHandlers(const void *owner);
+
+    bool isRegistered(const void *owner) const { return _owners.contains(owner); }
+
+    /// @return Number of handlers which will be called for the message id
+    qsizetype handlerCount(uint32_t messageId) const;
+
+    /// Calls the handlers registered for the message id followed by those registered for all messages
+    void dispatch(const mavlink_message_t &message) const;
+
+private:
+    struct Entry {
+        const void *owner = nullptr;
+        Handler handler;
+    };
+    using EntryList = QList<Entry>;
+
+    const EntryList *_entryList(uint32_t messageId) const;
+    static void _removeOwner(EntryList &entryList, const void *owner);
+
+    static constexpr uint32_t kFlatTableSize = 512;
+
+    std::array<EntryList, kFlatTableSize> _flatTable;
+    QHash<uint32_t, EntryList> _sparseTable;
+    EntryList _allMessageEntries;
+    QSet<const void*> _owners;
+};
@@ -0,0 +1,119 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkRequestWindow.h"
+
+qint64 MAVLinkRequestWindow::rtoMSecs() const
+{
+    qint64 rtoMSecs = kInitialRtoMSecs;
+    if (_srttMSecs >= 0) {
+        rtoMSecs = static_cast<qint64>(_srttMSecs + qMax(10.0, 4 * _rttvarMSecs));
+    }
+
+    return qBound(kMinRtoMSecs, rtoMSecs * _rtoBackoff, kMaxRtoMSecs);
+}
+
+void MAVLinkRequestWindow::requestSent(int index, qint64 nowMSecs, bool retransmission)
+{
+    _outstanding[index] = { nowMSecs, retransmission };
+    _sentCount++;
+}
+
+bool MAVLinkRequestWindow::responseReceived(int index, qint64 nowMSecs)
+{
+    const auto it = _outstanding.constFind(index);
+    if (it == _outstanding.constEnd()) {
+        return false;
+    }
+
+    // Karn's algorithm: a response to a request which was sent more than once can't be matched to one of the sends
+    if (!it->retransmission) {
+        const double rttMSecs = static_cast<double>(qMax<qint64>(nowMSecs - it->sentMSecs, 0));
+        if (_srttMSecs < 0) {
+            _srttMSecs = rttMSecs;
+            _rttvarMSecs = rttMSecs / 2;
+        } else {
+            _rttvarMSecs = (0.75 * _rttvarMSecs) + (0.25 * qAbs(_srttMSecs - rttMSecs));
+            _srttMSecs = (0.875 * _srttMSecs) + (0.125 * rttMSecs);
+        }
+        _rtoBackoff = 1;
+    }
+    (void) _outstanding.erase(it);
+
+    if (_window < _ssthresh) {
+        _window += 1;
+    } else {
+        _window += 1 / _window;
+    }
+    _window = qMin(_window, kMaxWindow);
+
+    return true;
+}
+
+QList<int> MAVLinkRequestWindow::takeExpired(qint64 nowMSecs)
+{
+    QList<int> expired;
+
+    const qint64 rtoMSecs = this->rtoMSecs();
+    for (auto it = _outstanding.begin(); it != _outstanding.end();) {
+        if ((nowMSecs - it->sentMSecs) >= rtoMSecs) {
+            expired.append(it.key());
+            it = _outstanding.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    _lost(expired.count(), nowMSecs);
+
+    return expired;
+}
+
+QList<int> MAVLinkRequestWindow::takeAll(qint64 nowMSecs)
+{
+    const QList<int> all = _outstanding.keys();
+    _outstanding.clear();
+
+    _lost(all.count(), nowMSecs);
+
+    return all;
+}
+
+void MAVLinkRequestWindow::_lost(qsizetype count, qint64 nowMSecs)
+{
+    if (count == 0) {
+        return;
+    }
+
+    _lostCount += static_cast<quint64>(count);
+
+    // All requests of a window are usually lost together, that is a single congestion event
+    if (nowMSecs < _recoveryEndMSecs) {
+        return;
+    }
+
+    _ssthresh = qMax(_window / 2, kMinWindow);
+    _window = _ssthresh;
+    _rtoBackoff = qMin(_rtoBackoff * 2, static_cast<int>(kMaxRtoMSecs / kMinRtoMSecs));
+    _recoveryEndMSecs = nowMSecs + rtoMSecs();
+}
+
+qint64 MAVLinkRequestWindow::nextExpiryMSecs() const
+{
+    if (_outstanding.isEmpty()) {
+        return -1;
+    }
+
+    qint64 oldestMSecs = _outstanding.cbegin()->sentMSecs;
+    for (const Request &request : _outstanding) {
+        oldestMSecs = qMin(oldestMSecs, request.sentMSecs);
+    }
+
+    return (oldestMSecs + rtoMSecs());
+}
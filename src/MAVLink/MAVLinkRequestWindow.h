@@ -0,0 +1,79 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QList>
+#include <QtCore/QMap>
+
+/// Flow control for the requests sent to a single component, each request being identified by an index.
+/// Works like TCP congestion control: the number of requests in flight is limited by a window which grows by one per
+/// response during slow start and by one per window of responses after that. A request which is not answered within the
+/// retransmission timeout counts as lost, which halves the window and backs off the timeout. The timeout follows the
+/// measured round trip time (RFC 6298), so fast links retry quickly while lossy radio links are not flooded with
+/// requests they can't carry. Used by ParameterManager for index based param re-requests and param writes, and by
+/// PlanManager for MISSION_REQUEST_INT during a mission item read.
+class MAVLinkRequestWindow
+{
+public:
+    MAVLinkRequestWindow() = default;
+
+    /// Number of requests which may be in flight
+    int window() const { return static_cast<int>(_window); }
+    qsizetype outstandingCount() const { return _outstanding.count(); }
+    bool isOutstanding(int index) const { return _outstanding.contains(index); }
+    bool canSend() const { return (_outstanding.count() < window()); }
+
+    /// @return -1: No round trip time measured yet
+    double srttMSecs() const { return _srttMSecs; }
+    qint64 rtoMSecs() const;
+
+    /// @param retransmission true: index was requested before, the response won't be used to measure the round trip time
+    void requestSent(int index, qint64 nowMSecs, bool retransmission);
+
+    /// @return false: index was not requested
+    bool responseReceived(int index, qint64 nowMSecs);
+
+    /// Removes the requests which were not answered within the retransmission timeout and counts them as lost
+    QList<int> takeExpired(qint64 nowMSecs);
+
+    /// Removes all outstanding requests and counts them as lost
+    QList<int> takeAll(qint64 nowMSecs);
+
+    /// @return Time at which the next outstanding request expires, -1 if nothing is outstanding
+    qint64 nextExpiryMSecs() const;
+
+    quint64 sentCount() const { return _sentCount; }
+    quint64 lostCount() const { return _lostCount; }
+
+    static constexpr double kInitialWindow = 4;
+    static constexpr double kMinWindow = 1;
+    static constexpr double kMaxWindow = 64;
+    static constexpr qint64 kInitialRtoMSecs = 1000;
+    static constexpr qint64 kMinRtoMSecs = 200;
+    static constexpr qint64 kMaxRtoMSecs = 5000;
+
+private:
+    struct Request {
+        qint64 sentMSecs = 0;
+        bool retransmission = false;
+    };
+
+    void _lost(qsizetype count, qint64 nowMSecs);
+
+    QMap<int /* request index */, Request> _outstanding;
+    double _window = kInitialWindow;
+    double _ssthresh = kMaxWindow;
+    double _srttMSecs = -1;
+    double _rttvarMSecs = 0;
+    int _rtoBackoff = 1;                ///< Doubled for every timeout, reset by the next round trip time sample
+    qint64 _recoveryEndMSecs = 0;       ///< Losses before this point belong to a window which was already reduced
+    quint64 _sentCount = 0;
+    quint64 _lostCount = 0;
+};
@@ -117,6 +117,18 @@ bool checkSigningLinkId(mavlink_channel_t channel, const mavlink_message_t &mess
     return (signing->link_id == _getMessageChannel(message));
 }
 
+/// Copy of the signing state of a channel, for receivers which verify signatures on another thread.
+/// Returns no value if signing is disabled on the channel.
+std::optional<mavlink_signing_t> channelSigning(mavlink_channel_t channel)
+{
+    const mavlink_signing_t* const signing = _getChannelSigning(channel);
+    if (!signing) {
+        return std::nullopt;
+    }
+
+    return *signing;
+}
+
 /// Create a setup signing message for a target system.
 /// Assumes that signing has already been initialized for the channel.
 void createSetupSigning(mavlink_channel_t channel, mavlink_system_t target_system, mavlink_setup_signing_t &setup_signing)
@@ -227,6 +227,7 @@ void MissionController::sendToVehicle(void)
         qCWarning(MissionControllerLog) << "MissionControllerLog::sendToVehicle called while syncInProgress";
     } else {
         qCDebug(MissionControllerLog) << "MissionControllerLog::sendToVehicle";
+        _waitForTransectsJobs();
         if (_visualItems->count() == 1) {
             // This prevents us from sending a possibly bogus home position to the vehicle
             QmlObjectListModel emptyModel;
@@ -276,6 +277,7 @@ void MissionController::addMissionToKML(KMLPlanDomDocument& planKML)
     QObject*            deleteParent = new QObject();
     QList<MissionItem*> rgMissionItems;
 
+    _waitForTransectsJobs();
     _convertToMissionItems(_visualItems, rgMissionItems, deleteParent);
     planKML.addMission(_controllerVehicle, _visualItems, rgMissionItems);
     deleteParent->deleteLater();
@@ -836,6 +838,7 @@ bool MissionController::_loadJsonMissionFileV2(const QJsonObject& json, QmlObjec
                 if (!surveyItem->load(itemObject, nextSequenceNumber++, errorString)) {
                     return false;
                 }
+                surveyItem->waitForTransectsJob();
                 nextSequenceNumber = surveyItem->lastSequenceNumber() + 1;
                 qCDebug(MissionControllerLog) << "Survey load complete: nextSequenceNumber" << nextSequenceNumber;
                 visualItems->append(surveyItem);
@@ -872,6 +875,7 @@ bool MissionController::_loadJsonMissionFileV2(const QJsonObject& json, QmlObjec
                 if (!corridorItem->load(itemObject, nextSequenceNumber++, errorString)) {
                     return false;
                 }
+                corridorItem->waitForTransectsJob();
                 nextSequenceNumber = corridorItem->lastSequenceNumber() + 1;
                 qCDebug(MissionControllerLog) << "Corridor Scan load complete: nextSequenceNumber" << nextSequenceNumber;
                 visualItems->append(corridorItem);
@@ -1100,6 +1104,8 @@ void MissionController::save(QJsonObject& json)
 {
     json[JsonHelper::jsonVersionKey] = _missionFileVersion;
 
+    _waitForTransectsJobs();
+
     // Mission settings
 
     MissionSettingsItem* settingsItem = _visualItems->value<MissionSettingsItem*>(0);
@@ -1166,6 +1172,17 @@ double MissionController::_calcDistanceToHome(VisualMissionItem* currentItem, Vi
     return distanceOk ? homeCoord.distanceTo(currentCoord) : 0.0;
 }
 
+static FlightPathSegment::SegmentType flightPathSegmentType(const VisualItemPair& pair, bool mavlinkTerrainFrame)
+{
+    if (pair.second->isTakeoffItem()) {
+        return FlightPathSegment::SegmentTypeTakeoff;
+    } else if (pair.second->isLandCommand()) {
+        return FlightPathSegment::SegmentTypeLand;
+    }
+
+    return mavlinkTerrainFrame ? FlightPathSegment::SegmentTypeTerrainFrame : FlightPathSegment::SegmentTypeGeneric;
+}
+
 FlightPathSegment* MissionController::_createFlightPathSegmentWorker(VisualItemPair& pair, bool mavlinkTerrainFrame)
 {
     // The takeoff goes straight up from ground to alt and then over to specified position at same alt. Which means
@@ -1177,14 +1194,7 @@ FlightPathSegment* MissionController::_createFlightPathSegmentWorker(VisualItemP
     double              coord2AMSLAlt       = pair.second->amslEntryAlt();
     double              coord1AMSLAlt       = takeoffStraightUp ? coord2AMSLAlt : pair.first->amslExitAlt();
 
-    FlightPathSegment::SegmentType segmentType = mavlinkTerrainFrame ? FlightPathSegment::SegmentTypeTerrainFrame : FlightPathSegment::SegmentTypeGeneric;
-    if (pair.second->isTakeoffItem()) {
-        segmentType = FlightPathSegment::SegmentTypeTakeoff;
-    } else if (pair.second->isLandCommand()) {
-        segmentType = FlightPathSegment::SegmentTypeLand;
-    }
-
-    FlightPathSegment* segment = new FlightPathSegment(segmentType, coord1, coord1AMSLAlt, coord2, coord2AMSLAlt, !_flyView /* queryTerrainData */,  this);
+    FlightPathSegment* segment = new FlightPathSegment(flightPathSegmentType(pair, mavlinkTerrainFrame), coord1, coord1AMSLAlt, coord2, coord2AMSLAlt, !_flyView /* queryTerrainData */,  this);
 
     if (takeoffStraightUp) {
         connect(pair.second, &VisualMissionItem::amslEntryAltChanged, segment, &FlightPathSegment::setCoord1AMSLAlt);
@@ -1195,11 +1205,7 @@ FlightPathSegment* MissionController::_createFlightPathSegmentWorker(VisualItemP
     connect(pair.second, &VisualMissionItem::coordinateChanged,     segment,    &FlightPathSegment::setCoordinate2);
     connect(pair.second, &VisualMissionItem::amslEntryAltChanged,   segment,    &FlightPathSegment::setCoord2AMSLAlt);
 
-    connect(pair.second, &VisualMissionItem::coordinateChanged,         this,       &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-
     connect(segment,    &FlightPathSegment::totalDistanceChanged,       this,       &MissionController::recalcTerrainProfile,             Qt::QueuedConnection);
-    connect(segment,    &FlightPathSegment::coord1AMSLAltChanged,       this,       &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(segment,    &FlightPathSegment::coord2AMSLAltChanged,       this,       &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
     connect(segment,    &FlightPathSegment::amslTerrainHeightsChanged,  this,       &MissionController::recalcTerrainProfile,             Qt::QueuedConnection);
     connect(segment,    &FlightPathSegment::terrainCollisionChanged,    this,       &MissionController::recalcTerrainProfile,             Qt::QueuedConnection);
 
@@ -1208,17 +1214,15 @@ FlightPathSegment* MissionController::_createFlightPathSegmentWorker(VisualItemP
 
 FlightPathSegment* MissionController::_addFlightPathSegment(FlightPathSegmentHashTable& prevItemPairHashTable, VisualItemPair& pair, bool mavlinkTerrainFrame)
 {
-    FlightPathSegment* segment = nullptr;
+    FlightPathSegment* segment = prevItemPairHashTable.value(pair);
 
-    if (prevItemPairHashTable.contains(pair) && (prevItemPairHashTable[pair]->segmentType() == FlightPathSegment::SegmentTypeTerrainFrame) != mavlinkTerrainFrame) {
+    if (segment && segment->segmentType() == flightPathSegmentType(pair, mavlinkTerrainFrame)) {
         // Pair already exists and connected, just re-use
-        _flightPathSegmentHashTable[pair] = segment = prevItemPairHashTable.take(pair);
+        (void) prevItemPairHashTable.remove(pair);
     } else {
         segment = _createFlightPathSegmentWorker(pair, mavlinkTerrainFrame);
-        _flightPathSegmentHashTable[pair] = segment;
     }
-
-    _simpleFlightPathSegments.append(segment);
+    _flightPathSegmentHashTable[pair] = segment;
 
     return segment;
 }
@@ -1258,62 +1262,94 @@ void MissionController::_recalcROISpecialVisuals(void)
 
 void MissionController::_recalcFlightPathSegments(void)
 {
-    VisualItemPair      lastSegmentVisualItemPair;
-    int                 segmentCount =              0;
-    bool                firstCoordinateNotFound =   true;
-    VisualMissionItem*  lastFlyThroughVI =          qobject_cast<VisualMissionItem*>(_visualItems->get(0));
-    bool                linkEndToHome =             false;
-    bool                linkStartToHome =           _controllerVehicle->rover() ? true : false;
-    bool                foundRTL =                  false;
-    bool                homePositionValid =         _settingsItem->coordinate().isValid();
-    bool                roiActive =                 false;
-    bool                previousItemIsIncomplete =  false;
-    bool                signalSplitSegmentChanged = false;
+    if (_flightPathDirtyIndex == -1) {
+        // Nothing changed since the last recalc
+        return;
+    }
 
-    qCDebug(MissionControllerLog) << "_recalcFlightPathSegments homePositionValid" << homePositionValid;
+    bool                homePositionValid =                     _settingsItem->coordinate().isValid();
+    bool                signalSplitSegmentChanged =             false;
+    bool                previousMissionContainsVTOLTakeoff =    _missionContainsVTOLTakeoff;
+    int                 startIndex =                            _flightPathDirtyIndex;
+
+    _flightPathDirtyIndex = -1;
+
+    // Items ahead of the first changed item produce the same segments as last time, so the walk continues from the state
+    // before that item. A delayed split segment update needs a full walk since the current item can be anywhere.
+    FlightPathWalkState_t state;
+    if (startIndex <= 1 || _delayedSplitSegmentUpdate || _flightPathWalkStates.count() < 2) {
+        startIndex = 1;
+
+        state.lastFlyThroughVI =            qobject_cast<VisualMissionItem*>(_visualItems->get(0));
+        state.lastSegmentVisualItemPair =   VisualItemPair();
+        state.segmentCount =                0;
+        state.flightPathSegmentCount =      0;
+        state.directionArrowCount =         0;
+        state.firstCoordinateNotFound =     true;
+        state.linkEndToHome =               false;
+        state.linkStartToHome =             _controllerVehicle->rover() ? true : false;
+        state.foundRTL =                    false;
+        state.roiActive =                   false;
+        state.previousItemIsIncomplete =    false;
+        state.missionContainsVTOLTakeoff =  false;
+
+        _flightPathWalkStates.clear();
+        _flightPathWalkStates.append(state);
+    } else {
+        startIndex = qMin(startIndex, static_cast<int>(_flightPathWalkStates.count()) - 1);
+        state = _flightPathWalkStates[startIndex];
+        _flightPathWalkStates.resize(startIndex);
+    }
+    _missionContainsVTOLTakeoff = state.missionContainsVTOLTakeoff;
 
-    FlightPathSegmentHashTable oldSegmentTable = _flightPathSegmentHashTable;
+    qCDebug(MissionControllerLog) << "_recalcFlightPathSegments homePositionValid:startIndex" << homePositionValid << startIndex;
+
+    // Segments from the restart point on can be reused by the walk, whatever is left over afterwards is obsolete
+    const int           firstFlightPathSegment =    state.flightPathSegmentCount;
+    const int           firstDirectionArrow =       state.directionArrowCount;
+    FlightPathSegmentHashTable oldSegmentTable;
+    for (int i=firstFlightPathSegment; i<_flightPathSegmentPairs.count(); i++) {
+        const VisualItemPair& pair = _flightPathSegmentPairs[i];
+        oldSegmentTable[pair] = _flightPathSegmentHashTable.take(pair);
+    }
 
-    _missionContainsVTOLTakeoff = false;
-    _flightPathSegmentHashTable.clear();
+    QObjectList             newFlightPathSegments;
+    QObjectList             newDirectionArrows;
+    QList<VisualItemPair>   newFlightPathSegmentPairs;
 
     // Note: Although visual support for _incompleteComplexItemLines is still in the codebase. The support for populating the list is not.
     // This is due to the initial implementation being buggy and incomplete with respect to correctly generating the line set.
     // So for now we leave the code for displaying them in, but none are ever added until we have time to implement the correct support.
+    if (!_incompleteComplexItemLines.isEmpty()) {
+        _incompleteComplexItemLines.clearAndDeleteContents();
+    }
 
-    _simpleFlightPathSegments.beginResetModel();
-    _directionArrows.beginResetModel();
-    _incompleteComplexItemLines.beginResetModel();
-
-    _simpleFlightPathSegments.clear();
-    _directionArrows.clear();
-    _incompleteComplexItemLines.clearAndDeleteContents();
-
-    // Mission Settings item needs to start with no segment
-    lastFlyThroughVI->clearSimpleFlighPathSegment();
+    // The item the walk restarts from needs to start with no segment
+    state.lastFlyThroughVI->clearSimpleFlighPathSegment();
 
-    // We need to clear the simple flight path segments on all items since they are going to be rebuilt. We can't just do this in the main loop
+    // We need to clear the simple flight path segments on all remaining items since they are going to be rebuilt. We can't just do this in the main loop
     // below since that loop won't always process all items.
-    for (int i=1; i<_visualItems->count(); i++) {
+    for (int i=startIndex; i<_visualItems->count(); i++) {
         qobject_cast<VisualMissionItem*>(_visualItems->get(i))->clearSimpleFlighPathSegment();
     }
 
     // Grovel through the list of items keeping track of things needed to correctly draw waypoints lines
-    for (int i=1; i<_visualItems->count(); i++) {
+    for (int i=startIndex; i<_visualItems->count(); i++) {
         VisualMissionItem*  visualItem =    qobject_cast<VisualMissionItem*>(_visualItems->get(i));
         SimpleMissionItem*  simpleItem =    qobject_cast<SimpleMissionItem*>(visualItem);
         ComplexMissionItem* complexItem =   qobject_cast<ComplexMissionItem*>(visualItem);
 
-        visualItem->clearSimpleFlighPathSegment();
+        state.missionContainsVTOLTakeoff = _missionContainsVTOLTakeoff;
+        _flightPathWalkStates.append(state);
 
         if (simpleItem) {
-            if (roiActive) {
+            if (state.roiActive) {
                 if (_isROICancelItem(simpleItem)) {
-                    roiActive = false;
+                    state.roiActive = false;
                 }
             } else {
                 if (_isROIBeginItem(simpleItem)) {
-                    roiActive = true;
+                    state.roiActive = true;
                 }
             }
 
@@ -1322,17 +1358,17 @@ void MissionController::_recalcFlightPathSegments(void)
             case MAV_CMD_NAV_TAKEOFF:
             case MAV_CMD_NAV_VTOL_TAKEOFF:
                 _missionContainsVTOLTakeoff = command == MAV_CMD_NAV_VTOL_TAKEOFF;
-                if (!linkEndToHome) {
+                if (!state.linkEndToHome) {
                     // If we still haven't found the first coordinate item and we hit a takeoff command this means the mission starts from the ground.
                     // Link the first item back to home to show that.
-                    if (firstCoordinateNotFound) {
-                        linkStartToHome = true;
+                    if (state.firstCoordinateNotFound) {
+                        state.linkStartToHome = true;
                     }
                 }
                 break;
             case MAV_CMD_NAV_RETURN_TO_LAUNCH:
-                linkEndToHome = true;
-                foundRTL = true;
+                state.linkEndToHome = true;
+                state.foundRTL = true;
                 break;
             default:
                 break;
@@ -1340,13 +1376,13 @@ void MissionController::_recalcFlightPathSegments(void)
         }
 
         // No need to add waypoint segments after an RTL.
-        if (foundRTL) {
+        if (state.foundRTL) {
             break;
         }
 
         // Don't draw segments immediately after a landing item
-        if (lastFlyThroughVI->isLandCommand()) {
-            lastFlyThroughVI = visualItem;
+        if (state.lastFlyThroughVI->isLandCommand()) {
+            state.lastFlyThroughVI = visualItem;
             continue;
         }
 
@@ -1356,93 +1392,81 @@ void MissionController::_recalcFlightPathSegments(void)
             // For examples a Survey item which has no polygon set yet.
             if (complexItem && complexItem->isIncomplete()) {
                 // We don't link lines from a valid item to an incomplete item
-                previousItemIsIncomplete = true;
-            } else if (previousItemIsIncomplete) {
+                state.previousItemIsIncomplete = true;
+            } else if (state.previousItemIsIncomplete) {
                 // We also don't link lines from an incomplete item to a valid item.
-                previousItemIsIncomplete = false;
-                firstCoordinateNotFound = false;
-                lastFlyThroughVI = visualItem;
+                state.previousItemIsIncomplete = false;
+                state.firstCoordinateNotFound = false;
+                state.lastFlyThroughVI = visualItem;
             } else {
-                if (lastFlyThroughVI != _settingsItem || (homePositionValid && linkStartToHome)) {
+                if (state.lastFlyThroughVI != _settingsItem || (homePositionValid && state.linkStartToHome)) {
                     bool addDirectionArrow = false;
                     if (i != 1) {
                         // Direction arrows are added to the second segment and every 5 segments thereafter.
                         // The reason for start with second segment is to prevent an arrow being added in between the home position
                         // and a takeoff item which may be right over each other. In that case the arrow points in a random direction.
-                        if (firstCoordinateNotFound || !lastFlyThroughVI->isSimpleItem() || !visualItem->isSimpleItem()) {
+                        if (state.firstCoordinateNotFound || !state.lastFlyThroughVI->isSimpleItem() || !visualItem->isSimpleItem()) {
                             addDirectionArrow = true;
-                        } else if (segmentCount > 5) {
-                            segmentCount = 0;
+                        } else if (state.segmentCount > 5) {
+                            state.segmentCount = 0;
                             addDirectionArrow = true;
                         }
-                        segmentCount++;
+                        state.segmentCount++;
                     }
 
-                    lastSegmentVisualItemPair =  VisualItemPair(lastFlyThroughVI, visualItem);
-                    SimpleMissionItem* simpleItem = qobject_cast<SimpleMissionItem*>(lastFlyThroughVI);
+                    state.lastSegmentVisualItemPair =  VisualItemPair(state.lastFlyThroughVI, visualItem);
+                    SimpleMissionItem* simpleItem = qobject_cast<SimpleMissionItem*>(state.lastFlyThroughVI);
                     bool mavlinkTerrainFrame = simpleItem ? simpleItem->missionItem().frame() == MAV_FRAME_GLOBAL_TERRAIN_ALT : false;
-                    FlightPathSegment* segment = _addFlightPathSegment(oldSegmentTable, lastSegmentVisualItemPair, mavlinkTerrainFrame);
-                    segment->setSpecialVisual(roiActive);
+                    FlightPathSegment* segment = _addFlightPathSegment(oldSegmentTable, state.lastSegmentVisualItemPair, mavlinkTerrainFrame);
+                    segment->setSpecialVisual(state.roiActive);
+                    newFlightPathSegments.append(segment);
+                    newFlightPathSegmentPairs.append(state.lastSegmentVisualItemPair);
+                    state.flightPathSegmentCount++;
                     if (addDirectionArrow) {
-                        _directionArrows.append(segment);
+                        newDirectionArrows.append(segment);
+                        state.directionArrowCount++;
                     }
                     if (visualItem->isCurrentItem() && _delayedSplitSegmentUpdate) {
                         _splitSegment = segment;
                         _delayedSplitSegmentUpdate = false;
                         signalSplitSegmentChanged = true;
                     }
-                    lastFlyThroughVI->setSimpleFlighPathSegment(segment);
+                    state.lastFlyThroughVI->setSimpleFlighPathSegment(segment);
                 }
-                firstCoordinateNotFound = false;
-                lastFlyThroughVI = visualItem;
+                state.firstCoordinateNotFound = false;
+                state.lastFlyThroughVI = visualItem;
             }
         }
     }
 
-    if (linkEndToHome && lastFlyThroughVI != _settingsItem && homePositionValid) {
-        lastSegmentVisualItemPair = VisualItemPair(lastFlyThroughVI, _settingsItem);
-        FlightPathSegment* segment = _addFlightPathSegment(oldSegmentTable, lastSegmentVisualItemPair, false /* mavlinkTerrainFrame */);
-        segment->setSpecialVisual(roiActive);
-        lastFlyThroughVI->setSimpleFlighPathSegment(segment);
+    if (state.linkEndToHome && state.lastFlyThroughVI != _settingsItem && homePositionValid) {
+        state.lastSegmentVisualItemPair = VisualItemPair(state.lastFlyThroughVI, _settingsItem);
+        FlightPathSegment* segment = _addFlightPathSegment(oldSegmentTable, state.lastSegmentVisualItemPair, false /* mavlinkTerrainFrame */);
+        segment->setSpecialVisual(state.roiActive);
+        newFlightPathSegments.append(segment);
+        newFlightPathSegmentPairs.append(state.lastSegmentVisualItemPair);
+        state.lastFlyThroughVI->setSimpleFlighPathSegment(segment);
     }
 
-    // Add direction arrow to last segment
-    if (lastSegmentVisualItemPair.first) {
-        FlightPathSegment* coordVector = nullptr;
-
-        // The pair may not be in the hash, this can happen in the fly view where only segments with arrows on them are added to hash.
-        // check for that first and add if needed
-
-        if (_flightPathSegmentHashTable.contains(lastSegmentVisualItemPair)) {
-            // Pair exists in the new table already just reuse it
-            coordVector = _flightPathSegmentHashTable[lastSegmentVisualItemPair];
-        } else if (oldSegmentTable.contains(lastSegmentVisualItemPair)) {
-            // Pair already exists in old table, pull from old to new and reuse
-            _flightPathSegmentHashTable[lastSegmentVisualItemPair] = coordVector = oldSegmentTable.take(lastSegmentVisualItemPair);
-        } else {
-            // Create a new segment. Since this is the fly view there is no need to wire change signals or worry about correct SegmentType
-            coordVector = new FlightPathSegment(
-                        FlightPathSegment::SegmentTypeGeneric,
-                        lastSegmentVisualItemPair.first->isSimpleItem() ? lastSegmentVisualItemPair.first->coordinate() : lastSegmentVisualItemPair.first->exitCoordinate(),
-                        lastSegmentVisualItemPair.first->isSimpleItem() ? lastSegmentVisualItemPair.first->amslEntryAlt() : lastSegmentVisualItemPair.first->amslExitAlt(),
-                        lastSegmentVisualItemPair.second->coordinate(),
-                        lastSegmentVisualItemPair.second->amslEntryAlt(),
-                        !_flyView /* queryTerrainData */,
-                        this);
-            _flightPathSegmentHashTable[lastSegmentVisualItemPair] = coordVector;
+    // Add direction arrow to last segment. The pair is always in the hash since all segments are added through _addFlightPathSegment.
+    if (state.lastSegmentVisualItemPair.first) {
+        FlightPathSegment* coordVector = _flightPathSegmentHashTable.value(state.lastSegmentVisualItemPair);
+        if (coordVector) {
+            newDirectionArrows.append(coordVector);
         }
-
-        _directionArrows.append(coordVector);
     }
 
-    _simpleFlightPathSegments.endResetModel();
-    _directionArrows.endResetModel();
-    _incompleteComplexItemLines.endResetModel();
+    // Only the rows which actually changed are removed/inserted so views don't rebuild the whole path
+    _simpleFlightPathSegments.replaceFrom(firstFlightPathSegment, newFlightPathSegments);
+    _directionArrows.replaceFrom(firstDirectionArrow, newDirectionArrows);
+    _flightPathSegmentPairs.resize(firstFlightPathSegment);
+    _flightPathSegmentPairs.append(newFlightPathSegmentPairs);
 
     // Anything left in the old table is an obsolete line object that can go
     qDeleteAll(oldSegmentTable);
 
-    emit _recalcMissionFlightStatusSignal();
+    // The VTOL takeoff changes the initial VTOL state of the whole mission
+    _setFlightStatusDirty(_missionContainsVTOLTakeoff == previousMissionContainsVTOLTakeoff ? startIndex : 0);
 
     emit recalcTerrainProfile();
     if (signalSplitSegmentChanged) {
@@ -1512,7 +1536,7 @@ void MissionController::_addTimeDistance(bool vtolInHover, double hoverTime, dou
 
 void MissionController::_recalcMissionFlightStatus()
 {
-    if (!_visualItems->count()) {
+    if (!_visualItems->count() || _flightStatusDirtyIndex == -1) {
         return;
     }
 
@@ -1521,32 +1545,63 @@ void MissionController::_recalcMissionFlightStatus()
 
     bool homePositionValid = _settingsItem->coordinate().isValid();
 
-    qCDebug(MissionControllerLog) << "_recalcMissionFlightStatus";
+    int    startIndex =                 _flightStatusDirtyIndex;
+    double previousMinAMSLAltitude =    _minAMSLAltitude;
+    double previousMaxAMSLAltitude =    _maxAMSLAltitude;
+
+    _flightStatusDirtyIndex = -1;
+
+    qCDebug(MissionControllerLog) << "_recalcMissionFlightStatus startIndex" << startIndex;
 
     // If home position is valid we can calculate distances between all waypoints.
     // If home position is not valid we can only calculate distances between waypoints which are
     // both relative altitude.
 
-    // No values for first item
-    lastFlyThroughVI->setAltDifference(0);
-    lastFlyThroughVI->setAzimuth(0);
-    lastFlyThroughVI->setDistance(0);
-    lastFlyThroughVI->setDistanceFromStart(0);
-
-    _minAMSLAltitude = _maxAMSLAltitude = qQNaN();
-
-    _resetMissionFlightStatus();
-
     bool   linkStartToHome =            false;
     bool   foundRTL =                   false;
     bool   pastLandCommand =            false;
     double totalHorizontalDistance =    0;
 
-    for (int i=0; i<_visualItems->count(); i++) {
+    if (startIndex > 0 && _flightStatusWalkStates.count() > 1) {
+        // Items ahead of the first changed item produce the same values as last time, continue from the state before it
+        startIndex = qMin(startIndex, static_cast<int>(_flightStatusWalkStates.count()) - 1);
+
+        const FlightStatusWalkState_t& state = _flightStatusWalkStates[startIndex];
+        _missionFlightStatus =      state.missionFlightStatus;
+        lastFlyThroughVI =          state.lastFlyThroughVI;
+        totalHorizontalDistance =   state.totalHorizontalDistance;
+        _minAMSLAltitude =          state.minAMSLAltitude;
+        _maxAMSLAltitude =          state.maxAMSLAltitude;
+        firstCoordinateItem =       state.firstCoordinateItem;
+        linkStartToHome =           state.linkStartToHome;
+        foundRTL =                  state.foundRTL;
+        pastLandCommand =           state.pastLandCommand;
+
+        _flightStatusWalkStates.resize(startIndex);
+    } else {
+        startIndex = 0;
+        _flightStatusWalkStates.clear();
+
+        // No values for first item
+        lastFlyThroughVI->setAltDifference(0);
+        lastFlyThroughVI->setAzimuth(0);
+        lastFlyThroughVI->setDistance(0);
+        lastFlyThroughVI->setDistanceFromStart(0);
+
+        _minAMSLAltitude = _maxAMSLAltitude = qQNaN();
+
+        _resetMissionFlightStatus();
+    }
+
+    for (int i=startIndex; i<_visualItems->count(); i++) {
         VisualMissionItem*  item =          qobject_cast<VisualMissionItem*>(_visualItems->get(i));
         SimpleMissionItem*  simpleItem =    qobject_cast<SimpleMissionItem*>(item);
         ComplexMissionItem* complexItem =   qobject_cast<ComplexMissionItem*>(item);
 
+        FlightStatusWalkState_t walkState = { _missionFlightStatus, lastFlyThroughVI, totalHorizontalDistance, _minAMSLAltitude, _maxAMSLAltitude,
+                                              firstCoordinateItem, linkStartToHome, foundRTL, pastLandCommand };
+        _flightStatusWalkStates.append(walkState);
+
         if (simpleItem && simpleItem->mavCommand() == MAV_CMD_NAV_RETURN_TO_LAUNCH) {
             foundRTL = true;
         }
@@ -1775,9 +1830,11 @@ void MissionController::_recalcMissionFlightStatus()
     emit minAMSLAltitudeChanged         (_minAMSLAltitude);
     emit maxAMSLAltitudeChanged         (_maxAMSLAltitude);
 
-    // Walk the list again calculating altitude percentages
+    // Walk the list again calculating altitude percentages. Items ahead of the restart point only need an update if the altitude range changed.
+    auto sameAltitude = [](double alt1, double alt2) { return (alt1 == alt2) || (qIsNaN(alt1) && qIsNaN(alt2)); };
+    bool altRangeChanged = !sameAltitude(previousMinAMSLAltitude, _minAMSLAltitude) || !sameAltitude(previousMaxAMSLAltitude, _maxAMSLAltitude);
     double altRange = _maxAMSLAltitude - _minAMSLAltitude;
-    for (int i=0; i<_visualItems->count(); i++) {
+    for (int i=altRangeChanged ? 0 : startIndex; i<_visualItems->count(); i++) {
         VisualMissionItem* item = qobject_cast<VisualMissionItem*>(_visualItems->get(i));
 
         if (item->specifiesCoordinate()) {
@@ -1805,6 +1862,19 @@ void MissionController::_recalcMissionFlightStatus()
     emit recalcTerrainProfile();
 }
 
+/// Publishes any pending transects jobs and resequences the items, so the mission items built
+/// from the visual items match the current complex item settings
+void MissionController::_waitForTransectsJobs(void)
+{
+    for (int i=0; i<_visualItems->count(); i++) {
+        TransectStyleComplexItem* transectItem = qobject_cast<TransectStyleComplexItem*>(_visualItems->get(i));
+        if (transectItem) {
+            transectItem->waitForTransectsJob();
+        }
+    }
+    _recalcSequence();
+}
+
 // This will update the sequence numbers to be sequential starting from 0
 void MissionController::_recalcSequence(void)
 {
@@ -1914,7 +1984,7 @@ void MissionController::_initAllVisualItems(void)
         }
     }
 
-    connect(_settingsItem, &MissionSettingsItem::coordinateChanged,     this, &MissionController::_recalcAll);
+    connect(_settingsItem, &MissionSettingsItem::coordinateChanged,     this, &MissionController::_settingsItemCoordinateChanged);
     connect(_settingsItem, &MissionSettingsItem::coordinateChanged,     this, &MissionController::plannedHomePositionChanged);
 
     for (int i=0; i<_visualItems->count(); i++) {
@@ -1927,10 +1997,15 @@ void MissionController::_initAllVisualItems(void)
         }
     }
 
+    // New set of items, nothing from the previous recalcs can be reused
+    _setFlightPathDirty(0);
+    _setFlightStatusDirty(0);
     _recalcAll();
 
     connect(_visualItems, &QmlObjectListModel::dirtyChanged, this, &MissionController::_visualItemsDirtyChanged);
     connect(_visualItems, &QmlObjectListModel::countChanged, this, &MissionController::_updateContainsItems);
+    connect(_visualItems, &QmlObjectListModel::rowsInserted, this, &MissionController::_visualItemsRowsChanged);
+    connect(_visualItems, &QmlObjectListModel::rowsRemoved,  this, &MissionController::_visualItemsRowsChanged);
 
     emit visualItemsChanged();
     emit containsItemsChanged(containsItems());
@@ -1945,7 +2020,7 @@ void MissionController::_initAllVisualItems(void)
 
 void MissionController::_deinitAllVisualItems(void)
 {
-    disconnect(_settingsItem, &MissionSettingsItem::coordinateChanged, this, &MissionController::_recalcAll);
+    disconnect(_settingsItem, &MissionSettingsItem::coordinateChanged, this, &MissionController::_settingsItemCoordinateChanged);
     disconnect(_settingsItem, &MissionSettingsItem::coordinateChanged, this, &MissionController::plannedHomePositionChanged);
 
     for (int i=0; i<_visualItems->count(); i++) {
@@ -1954,38 +2029,45 @@ void MissionController::_deinitAllVisualItems(void)
 
     disconnect(_visualItems, &QmlObjectListModel::dirtyChanged, this, &MissionController::dirtyChanged);
     disconnect(_visualItems, &QmlObjectListModel::countChanged, this, &MissionController::_updateContainsItems);
+    disconnect(_visualItems, &QmlObjectListModel::rowsInserted, this, &MissionController::_visualItemsRowsChanged);
+    disconnect(_visualItems, &QmlObjectListModel::rowsRemoved,  this, &MissionController::_visualItemsRowsChanged);
 }
 
 void MissionController::_initVisualItem(VisualMissionItem* visualItem)
 {
     setDirty(false);
 
-    connect(visualItem, &VisualMissionItem::specifiesCoordinateChanged,                 this, &MissionController::_recalcFlightPathSegmentsSignal,  Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::specifiedFlightSpeedChanged,                this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::specifiedGimbalYawChanged,                  this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::specifiedGimbalPitchChanged,                this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::specifiedVehicleYawChanged,                 this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::terrainAltitudeChanged,                     this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::additionalTimeDelayChanged,                 this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(visualItem, &VisualMissionItem::currentVTOLModeChanged,                     this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
+    // Changes only invalidate the recalcs from the changed item on. The recalcs themselves are queued and compressed.
+    connect(visualItem, &VisualMissionItem::specifiesCoordinateChanged,                 this, &MissionController::_visualItemFlightPathChanged);
+    connect(visualItem, &VisualMissionItem::coordinateChanged,                          this, &MissionController::_visualItemFlightStatusChanged);
+    connect(visualItem, &VisualMissionItem::amslEntryAltChanged,                        this, &MissionController::_visualItemFlightStatusChanged);
+    connect(visualItem, &VisualMissionItem::amslExitAltChanged,                         this, &MissionController::_visualItemFlightStatusChanged);
+    connect(visualItem, &VisualMissionItem::specifiedFlightSpeedChanged,                this, &MissionController::_visualItemFlightStatusChanged);
+    connect(visualItem, &VisualMissionItem::specifiedGimbalYawChanged,                  this, &MissionController::_visualItemFlightStatusChanged);
+    connect(visualItem, &VisualMissionItem::specifiedGimbalPitchChanged,                this, &MissionController::_visualItemFlightStatusChanged);
+    connect(visualItem, &VisualMissionItem::specifiedVehicleYawChanged,                 this, &MissionController::_visualItemFlightStatusChanged);
+    connect(visualItem, &VisualMissionItem::terrainAltitudeChanged,                     this, &MissionController::_visualItemFlightStatusChanged);
+    connect(visualItem, &VisualMissionItem::additionalTimeDelayChanged,                 this, &MissionController::_visualItemFlightStatusChanged);
+    connect(visualItem, &VisualMissionItem::currentVTOLModeChanged,                     this, &MissionController::_visualItemFlightStatusChanged);
     connect(visualItem, &VisualMissionItem::lastSequenceNumberChanged,                  this, &MissionController::_recalcSequence);
+    connect(visualItem, &VisualMissionItem::lastSequenceNumberChanged,                  this, &MissionController::_visualItemFlightStatusChanged);
 
     if (visualItem->isSimpleItem()) {
         // We need to track commandChanged on simple item since recalc has special handling for takeoff command
         SimpleMissionItem* simpleItem = qobject_cast<SimpleMissionItem*>(visualItem);
         if (simpleItem) {
-            connect(&simpleItem->missionItem()._commandFact, &Fact::valueChanged, this, &MissionController::_itemCommandChanged);
+            connect(&simpleItem->missionItem()._commandFact, &Fact::valueChanged, this, [this, simpleItem]() { _itemCommandChanged(simpleItem); });
         } else {
             qWarning() << "isSimpleItem == true, yet not SimpleMissionItem";
         }
     } else {
         ComplexMissionItem* complexItem = qobject_cast<ComplexMissionItem*>(visualItem);
         if (complexItem) {
-            connect(complexItem, &ComplexMissionItem::complexDistanceChanged,       this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-            connect(complexItem, &ComplexMissionItem::greatestDistanceToChanged,    this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-            connect(complexItem, &ComplexMissionItem::minAMSLAltitudeChanged,       this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-            connect(complexItem, &ComplexMissionItem::maxAMSLAltitudeChanged,       this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-            connect(complexItem, &ComplexMissionItem::isIncompleteChanged,          this, &MissionController::_recalcFlightPathSegmentsSignal,  Qt::QueuedConnection);
+            connect(complexItem, &ComplexMissionItem::complexDistanceChanged,       this, &MissionController::_visualItemFlightStatusChanged);
+            connect(complexItem, &ComplexMissionItem::greatestDistanceToChanged,    this, &MissionController::_visualItemFlightStatusChanged);
+            connect(complexItem, &ComplexMissionItem::minAMSLAltitudeChanged,       this, &MissionController::_visualItemFlightStatusChanged);
+            connect(complexItem, &ComplexMissionItem::maxAMSLAltitudeChanged,       this, &MissionController::_visualItemFlightStatusChanged);
+            connect(complexItem, &ComplexMissionItem::isIncompleteChanged,          this, &MissionController::_visualItemFlightPathChanged);
         } else {
             qWarning() << "ComplexMissionItem not found";
         }
@@ -1998,12 +2080,59 @@ void MissionController::_deinitVisualItem(VisualMissionItem* visualItem)
     disconnect(visualItem, nullptr, nullptr, nullptr);
 }
 
-void MissionController::_itemCommandChanged(void)
+void MissionController::_itemCommandChanged(VisualMissionItem* visualItem)
 {
     _recalcChildItems();
+    _setFlightPathDirty(_visualItems->indexOf(visualItem));
+}
+
+/// Marks the flight path segments from the specified visual item on as needing a recalc
+///     @param visualItemIndex -1 if unknown, which recalcs everything
+void MissionController::_setFlightPathDirty(int visualItemIndex)
+{
+    visualItemIndex = qMax(visualItemIndex, 0);
+    _flightPathDirtyIndex = _flightPathDirtyIndex == -1 ? visualItemIndex : qMin(_flightPathDirtyIndex, visualItemIndex);
     emit _recalcFlightPathSegmentsSignal();
 }
 
+/// Marks the mission flight status from the specified visual item on as needing a recalc
+///     @param visualItemIndex -1 if unknown, which recalcs everything
+void MissionController::_setFlightStatusDirty(int visualItemIndex)
+{
+    visualItemIndex = qMax(visualItemIndex, 0);
+    _flightStatusDirtyIndex = _flightStatusDirtyIndex == -1 ? visualItemIndex : qMin(_flightStatusDirtyIndex, visualItemIndex);
+    emit _recalcMissionFlightStatusSignal();
+}
+
+void MissionController::_visualItemFlightPathChanged(void)
+{
+    _setFlightPathDirty(_visualItems->indexOf(sender()));
+}
+
+void MissionController::_visualItemFlightStatusChanged(void)
+{
+    _setFlightStatusDirty(_visualItems->indexOf(sender()));
+}
+
+void MissionController::_visualItemsRowsChanged(const QModelIndex& /*parent*/, int first, int /*last*/)
+{
+    _setFlightPathDirty(first);
+    _setFlightStatusDirty(first);
+}
+
+void MissionController::_settingsItemCoordinateChanged(void)
+{
+    // Distances to the planned home position are part of the status of every item
+    _setFlightPathDirty(0);
+    _setFlightStatusDirty(0);
+    _recalcAll();
+}
+
+void MissionController::_invalidateMissionFlightStatus(void)
+{
+    _setFlightStatusDirty(0);
+}
+
 void MissionController::_managerVehicleChanged(Vehicle* managerVehicle)
 {
     if (_managerVehicle) {
@@ -2029,8 +2158,8 @@ void MissionController::_managerVehicleChanged(Vehicle* managerVehicle)
     connect(_missionManager, &MissionManager::lastCurrentIndexChanged,  this, &MissionController::resumeMissionIndexChanged);
     connect(_missionManager, &MissionManager::resumeMissionReady,       this, &MissionController::resumeMissionReady);
     connect(_missionManager, &MissionManager::resumeMissionUploadFail,  this, &MissionController::resumeMissionUploadFail);
-    connect(_managerVehicle, &Vehicle::defaultCruiseSpeedChanged,       this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
-    connect(_managerVehicle, &Vehicle::defaultHoverSpeedChanged,        this, &MissionController::_recalcMissionFlightStatusSignal, Qt::QueuedConnection);
+    connect(_managerVehicle, &Vehicle::defaultCruiseSpeedChanged,       this, &MissionController::_invalidateMissionFlightStatus);
+    connect(_managerVehicle, &Vehicle::defaultHoverSpeedChanged,        this, &MissionController::_invalidateMissionFlightStatus);
     connect(_managerVehicle, &Vehicle::vehicleTypeChanged,              this, &MissionController::complexMissionItemNamesChanged);
 
     emit complexMissionItemNamesChanged();
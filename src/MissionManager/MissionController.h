@@ -316,7 +316,6 @@ class MissionController : public PlanElementController
 
 private slots:
     void _newMissionItemsAvailableFromVehicle   (bool removeAllRequested);
-    void _itemCommandChanged                    (void);
     void _inProgressChanged                     (bool inProgress);
     void _currentMissionIndexChanged            (int sequenceNumber);
     void _recalcFlightPathSegments              (void);
@@ -331,10 +330,45 @@ private slots:
     void _recalcAll                             (void);
     void _managerVehicleChanged                 (Vehicle* managerVehicle);
     void _forceRecalcOfAllowedBits              (void);
+    void _visualItemFlightPathChanged           (void);
+    void _visualItemFlightStatusChanged         (void);
+    void _visualItemsRowsChanged                (const QModelIndex& parent, int first, int last);
+    void _settingsItemCoordinateChanged         (void);
+    void _invalidateMissionFlightStatus         (void);
 
 private:
+    /// State of the _recalcFlightPathSegments walk before a visual item is processed
+    typedef struct {
+        VisualMissionItem*  lastFlyThroughVI;
+        VisualItemPair      lastSegmentVisualItemPair;
+        int                 segmentCount;
+        int                 flightPathSegmentCount;         ///< Number of entries in _simpleFlightPathSegments added by the previous items
+        int                 directionArrowCount;            ///< Number of entries in _directionArrows added by the previous items
+        bool                firstCoordinateNotFound;
+        bool                linkEndToHome;
+        bool                linkStartToHome;
+        bool                foundRTL;
+        bool                roiActive;
+        bool                previousItemIsIncomplete;
+        bool                missionContainsVTOLTakeoff;
+    } FlightPathWalkState_t;
+
+    /// State of the _recalcMissionFlightStatus walk before a visual item is processed
+    typedef struct {
+        MissionFlightStatus_t   missionFlightStatus;
+        VisualMissionItem*      lastFlyThroughVI;
+        double                  totalHorizontalDistance;
+        double                  minAMSLAltitude;
+        double                  maxAMSLAltitude;
+        bool                    firstCoordinateItem;
+        bool                    linkStartToHome;
+        bool                    foundRTL;
+        bool                    pastLandCommand;
+    } FlightStatusWalkState_t;
+
     void                    _init                               (void);
     void                    _recalcSequence                     (void);
+    void                    _waitForTransectsJobs               (void);
     void                    _recalcChildItems                   (void);
     void                    _recalcAllWithCoordinate            (const QGeoCoordinate& coordinate);
     void                    _recalcROISpecialVisuals            (void);
@@ -369,6 +403,9 @@ private slots:
     FlightPathSegment*      _createFlightPathSegmentWorker      (VisualItemPair& pair, bool mavlinkTerrainFrame);
     void                    _allItemsRemoved                    (void);
     void                    _firstItemAdded                     (void);
+    void                    _itemCommandChanged                 (VisualMissionItem* visualItem);
+    void                    _setFlightPathDirty                 (int visualItemIndex);
+    void                    _setFlightStatusDirty               (int visualItemIndex);
 
     static double           _calcDistanceToHome                 (VisualMissionItem* currentItem, VisualMissionItem* homeItem);
     static double           _normalizeLat                       (double lat);
@@ -387,6 +424,11 @@ private slots:
     QmlObjectListModel          _directionArrows;
     QmlObjectListModel          _incompleteComplexItemLines;
     FlightPathSegmentHashTable  _flightPathSegmentHashTable;
+    QList<VisualItemPair>       _flightPathSegmentPairs;                                ///< Item pairs of _simpleFlightPathSegments in the same order
+    QList<FlightPathWalkState_t>    _flightPathWalkStates;                              ///< Indexed by visual item index
+    QList<FlightStatusWalkState_t>  _flightStatusWalkStates;                            ///< Indexed by visual item index
+    int                         _flightPathDirtyIndex =         -1;                     ///< First visual item which needs a flight path recalc, -1 for none
+    int                         _flightStatusDirtyIndex =       -1;                     ///< First visual item which needs a flight status recalc, -1 for none
     bool                        _firstItemsFromVehicle =        false;
     bool                        _itemsRequested =               false;
     bool                        _inRecalcSequence =             false;
@@ -432,4 +474,6 @@ private slots:
     static constexpr const char* _jsonMavAutopilotKey =           "MAV_AUTOPILOT";
 
     static constexpr int   _missionFileVersion =            2;
+
+    friend class MissionPlanningBenchmark;
 };
@@ -0,0 +1,113 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "PlanFTPFile.h"
+#include "QGCLoggingCategory.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QtEndian>
+
+#include <cstring>
+
+QGC_LOGGING_CATEGORY(PlanFTPFileLog, "PlanFTPFileLog")
+
+QString PlanFTPFile::vehiclePath(MAV_MISSION_TYPE planType)
+{
+    switch (planType) {
+    case MAV_MISSION_TYPE_MISSION:
+        return QStringLiteral("@MISSION/mission.dat");
+    case MAV_MISSION_TYPE_FENCE:
+        return QStringLiteral("@MISSION/fence.dat");
+    case MAV_MISSION_TYPE_RALLY:
+        return QStringLiteral("@MISSION/rally.dat");
+    default:
+        return QString();
+    }
+}
+
+bool PlanFTPFile::planTypeFromVehiclePath(const QString &path, MAV_MISSION_TYPE &planType)
+{
+    for (const MAV_MISSION_TYPE type : { MAV_MISSION_TYPE_MISSION, MAV_MISSION_TYPE_FENCE, MAV_MISSION_TYPE_RALLY }) {
+        if (path == vehiclePath(type)) {
+            planType = type;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+QByteArray PlanFTPFile::encode(MAV_MISSION_TYPE planType, const QList<mavlink_mission_item_int_t> &items)
+{
+    QByteArray bytes(static_cast<qsizetype>(sizeof(Header) + (items.count() * sizeof(mavlink_mission_item_int_t))), Qt::Uninitialized);
+
+    Header header{};
+    qToLittleEndian(kMagic, &header.magic);
+    qToLittleEndian(static_cast<quint16>(planType), &header.dataType);
+    qToLittleEndian(static_cast<quint16>(items.count()), &header.itemCount);
+    (void) memcpy(bytes.data(), &header, sizeof(header));
+
+    char *record = bytes.data() + sizeof(Header);
+    for (qsizetype i = 0; i < items.count(); i++) {
+        mavlink_mission_item_int_t item = items[i];
+        item.seq = static_cast<uint16_t>(i);
+        item.mission_type = planType;
+        (void) memcpy(record, &item, sizeof(item));
+        record += sizeof(item);
+    }
+
+    qCDebug(PlanFTPFileLog) << "Encoded" << items.count() << "items type" << planType;
+
+    return bytes;
+}
+
+bool PlanFTPFile::decode(const QByteArray &bytes, MAV_MISSION_TYPE planType, QList<mavlink_mission_item_int_t> &items, QString &errorString)
+{
+    items.clear();
+
+    if (bytes.size() < static_cast<qsizetype>(sizeof(Header))) {
+        errorString = QObject::tr("Plan file too small: %1 bytes").arg(bytes.size());
+        return false;
+    }
+
+    Header header{};
+    (void) memcpy(&header, bytes.constData(), sizeof(header));
+
+    if (qFromLittleEndian(header.magic) != kMagic) {
+        errorString = QObject::tr("Plan file has invalid magic: %1").arg(qFromLittleEndian(header.magic), 0, 16);
+        return false;
+    }
+    if (qFromLittleEndian(header.dataType) != planType) {
+        errorString = QObject::tr("Plan file type mismatch expected:actual %1:%2").arg(planType).arg(qFromLittleEndian(header.dataType));
+        return false;
+    }
+
+    const quint16 start = qFromLittleEndian(header.start);
+    const quint16 itemCount = qFromLittleEndian(header.itemCount);
+    if (bytes.size() < static_cast<qsizetype>(sizeof(Header) + (itemCount * sizeof(mavlink_mission_item_int_t)))) {
+        errorString = QObject::tr("Plan file truncated: %1 bytes for %2 items").arg(bytes.size()).arg(itemCount);
+        return false;
+    }
+
+    items.reserve(itemCount);
+    const char *record = bytes.constData() + sizeof(Header);
+    for (quint16 i = 0; i < itemCount; i++) {
+        mavlink_mission_item_int_t item{};
+        (void) memcpy(&item, record, sizeof(item));
+        record += sizeof(item);
+
+        item.seq = static_cast<uint16_t>(start + i);
+        item.mission_type = planType;
+        items.append(item);
+    }
+
+    qCDebug(PlanFTPFileLog) << "Decoded" << itemCount << "items type" << planType << "start" << start;
+
+    return true;
+}
@@ -0,0 +1,54 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QLoggingCategory>
+#include <QtCore/QString>
+
+#include "MAVLinkLib.h"
+
+Q_DECLARE_LOGGING_CATEGORY(PlanFTPFileLog)
+
+/// Mission, fence and rally point file format used by ArduPilot to transfer a complete plan over MAVLink FTP.
+/// The vehicle exposes them as @MISSION/mission.dat, @MISSION/fence.dat and @MISSION/rally.dat. A file is a
+/// little endian header followed by the items as packed MISSION_ITEM_INT payloads. Item sequence numbers are
+/// implied by the position in the file, offset by the start index from the header.
+class PlanFTPFile
+{
+public:
+    /// @return Path of the file on the vehicle which holds the items of planType
+    static QString vehiclePath(MAV_MISSION_TYPE planType);
+
+    /// @return false: path is not one of the plan files
+    static bool planTypeFromVehiclePath(const QString &path, MAV_MISSION_TYPE &planType);
+
+    /// Builds a file which replaces all items of planType on the vehicle
+    static QByteArray encode(MAV_MISSION_TYPE planType, const QList<mavlink_mission_item_int_t> &items);
+
+    /// Sequence numbers and mission_type of the returned items are set from the file header
+    ///     @param planType Type the file is expected to contain
+    ///     @return false: bytes are not a valid file for planType, errorString is set
+    static bool decode(const QByteArray &bytes, MAV_MISSION_TYPE planType, QList<mavlink_mission_item_int_t> &items, QString &errorString);
+
+    static constexpr quint16 kMagic = 0x763d;
+
+private:
+    struct Header {
+        quint16 magic;
+        quint16 dataType;   ///< MAV_MISSION_TYPE
+        quint16 options;
+        quint16 start;      ///< Sequence number of the first item in the file
+        quint16 itemCount;
+    };
+    static_assert(sizeof(Header) == 10);
+    static_assert(sizeof(mavlink_mission_item_int_t) == MAVLINK_MSG_ID_MISSION_ITEM_INT_LEN);
+};
@@ -10,11 +10,20 @@
 #include "PlanManager.h"
 #include "Vehicle.h"
 #include "FirmwarePlugin.h"
+#include "FTPManager.h"
 #include "MAVLinkProtocol.h"
 #include "QGCApplication.h"
 #include "MissionCommandTree.h"
+#include "PlanFTPFile.h"
 #include "QGCLoggingCategory.h"
 
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QStandardPaths>
+
+#include <algorithm>
+
 QGC_LOGGING_CATEGORY(PlanManagerLog, "PlanManagerLog")
 
 PlanManager::PlanManager(Vehicle* vehicle, MAV_MISSION_TYPE planType)
@@ -25,6 +34,7 @@ PlanManager::PlanManager(Vehicle* vehicle, MAV_MISSION_TYPE planType)
     , _expectedAck              (AckNone)
     , _transactionInProgress    (TransactionNone)
     , _resumeMission            (false)
+    , _pipelineReadRequests     (false)
     , _lastMissionRequest       (-1)
     , _missionItemCountToRead   (-1)
     , _currentMissionIndex      (-1)
@@ -54,11 +64,14 @@ void PlanManager::_writeMissionItemsWorker(void)
     for (int i=0; i<_writeMissionItems.count(); i++) {
         _itemIndicesToWrite << i;
     }
+    _encodeWriteMissionItems();
 
     _retryCount = 0;
     _setTransactionInProgress(TransactionWrite);
     _connectToMavlink();
-    _writeMissionCount();
+    if (!_ftpWriteBegin()) {
+        _writeMissionCount();
+    }
 }
 
 
@@ -102,6 +115,36 @@ void PlanManager::writeMissionItems(const QList<MissionItem*>& missionItems)
     _writeMissionItemsWorker();
 }
 
+/// Converts all items to be written up front so answering a MISSION_REQUEST only needs to pack the message
+void PlanManager::_encodeWriteMissionItems(void)
+{
+    _writeMissionItemsEncoded.clear();
+    _writeMissionItemsEncoded.reserve(_writeMissionItems.count());
+
+    for (int i=0; i<_writeMissionItems.count(); i++) {
+        const MissionItem* item = _writeMissionItems[i];
+        const bool missionFrame = item->frame() == MAV_FRAME_MISSION;
+
+        mavlink_mission_item_int_t missionItem{};
+        missionItem.target_system =     _vehicle->id();
+        missionItem.target_component =  MAV_COMP_ID_AUTOPILOT1;
+        missionItem.seq =               i;
+        missionItem.frame =             item->frame();
+        missionItem.command =           item->command();
+        missionItem.current =           i == 0;
+        missionItem.autocontinue =      item->autoContinue();
+        missionItem.param1 =            static_cast<float>(item->param1());
+        missionItem.param2 =            static_cast<float>(item->param2());
+        missionItem.param3 =            static_cast<float>(item->param3());
+        missionItem.param4 =            static_cast<float>(item->param4());
+        missionItem.x =                 static_cast<int32_t>(missionFrame ? item->param5() : item->param5() * 1e7);
+        missionItem.y =                 static_cast<int32_t>(missionFrame ? item->param6() : item->param6() * 1e7);
+        missionItem.z =                 static_cast<float>(item->param7());
+        missionItem.mission_type =      _planType;
+        _writeMissionItemsEncoded.append(missionItem);
+    }
+}
+
 /// This begins the write sequence with the vehicle. This may be called during a retry.
 void PlanManager::_writeMissionCount(void)
 {
@@ -144,7 +187,9 @@ void PlanManager::loadFromVehicle(void)
     _retryCount = 0;
     _setTransactionInProgress(TransactionRead);
     _connectToMavlink();
-    _requestList();
+    if (!_ftpReadBegin()) {
+        _requestList();
+    }
 }
 
 /// Internal call to request list of mission items. May be called during a retry sequence.
@@ -194,16 +239,22 @@ void PlanManager::_ackTimeout(void)
         }
         break;
     case AckMissionItem:
+    {
         // MISSION_ITEM expected
-        if (_retryCount > _maxRetryCount) {
+        const QList<int> lostIndices = _readRequestWindow.takeExpired(_readRequestClock.elapsed());
+        if (lostIndices.isEmpty()) {
+            // Nothing expired yet, wait for the oldest request again
+            _requestMissionItems();
+        } else if (_retryCount > _maxRetryCount) {
             _sendError(MaxRetryExceeded, tr("Mission read failed, maximum retries exceeded."));
             _finishTransaction(false);
         } else {
             _retryCount++;
-            qCDebug(PlanManagerLog) << tr("Retrying %1 MISSION_REQUEST retry Count").arg(_planTypeString()) << _retryCount;
-            _requestNextMissionItem();
+            qCDebug(PlanManagerLog) << QStringLiteral("Retrying %1 MISSION_REQUEST lost:retryCount:window:rto").arg(_planTypeString()) << lostIndices << _retryCount << _readRequestWindow.window() << _readRequestWindow.rtoMSecs();
+            _requestMissionItems();
         }
         break;
+    }
     case AckMissionRequest:
         // MISSION_REQUEST is expected, or MISSION_ACK to end sequence
         if (_itemIndicesToWrite.count() == 0) {
@@ -251,8 +302,12 @@ void PlanManager::_startAckTimeout(AckType_t ack)
 {
     switch (ack) {
     case AckMissionItem:
-        // We are actively trying to get the mission item, so we don't want to wait as long.
-        _ackTimeoutTimer->setInterval(_retryTimeoutMilliseconds);
+        // Fires when the oldest item request in flight runs out of time
+        if (_readRequestWindow.outstandingCount() > 0) {
+            _ackTimeoutTimer->setInterval(static_cast<int>(qMax<qint64>(_readRequestWindow.nextExpiryMSecs() - _readRequestClock.elapsed(), 1)));
+        } else {
+            _ackTimeoutTimer->setInterval(_ackTimeoutMilliseconds);
+        }
         break;
     case AckNone:
         // FALLTHROUGH
@@ -294,7 +349,12 @@ bool PlanManager::_checkForExpectedAck(AckType_t receivedAck)
 
 void PlanManager::_readTransactionComplete(void)
 {
-    qCDebug(PlanManagerLog) << "_readTransactionComplete read sequence complete";
+    qCDebug(PlanManagerLog) << "_readTransactionComplete read sequence complete requests:lost" << _readRequestWindow.sentCount() << _readRequestWindow.lostCount();
+
+    // Items arrive out of order when requests are lost and sent again
+    std::sort(_missionItems.begin(), _missionItems.end(), [](const MissionItem* item1, const MissionItem* item2) {
+        return item1->sequenceNumber() < item2->sequenceNumber();
+    });
 
     SharedLinkInterfacePtr sharedLink = _vehicle->vehicleLinkManager()->primaryLink().lock();
     if (sharedLink) {
@@ -347,32 +407,56 @@ void PlanManager::_handleMissionCount(const mavlink_message_t& message)
             _itemIndicesToRead << i;
         }
         _missionItemCountToRead = missionCount.count;
-        _requestNextMissionItem();
+        _itemIndicesRequested.clear();
+        _readRequestWindow = MAVLinkRequestWindow();
+        _readRequestClock.start();
+        // PX4 only answers a request for the next item or a repeat of the previous one, any other sequence number
+        // aborts the transfer with MAV_MISSION_ERROR. ArduPilot serves any item it holds.
+        _pipelineReadRequests = _vehicle->apmFirmware();
+        _requestMissionItems();
     }
 }
 
-void PlanManager::_requestNextMissionItem(void)
+/// Requests the items which are still missing, as many as the request window allows to be in flight. Items which were
+/// requested before and timed out are requested again first. Without pipelining only a single request is in flight.
+void PlanManager::_requestMissionItems(void)
 {
     if (_itemIndicesToRead.count() == 0) {
-        _sendError(InternalError, tr("Internal Error: Call to Vehicle _requestNextMissionItem with no more indices to read"));
+        _sendError(InternalError, tr("Internal Error: Call to Vehicle _requestMissionItems with no more indices to read"));
         return;
     }
 
-    qCDebug(PlanManagerLog) << QStringLiteral("_requestNextMissionItem %1 sequenceNumber:retry").arg(_planTypeString()) << _itemIndicesToRead[0] << _retryCount;
-
     SharedLinkInterfacePtr sharedLink = _vehicle->vehicleLinkManager()->primaryLink().lock();
-    if (sharedLink) {
-        mavlink_message_t       message;
+    const qint64 nowMSecs = _readRequestClock.elapsed();
 
-        mavlink_msg_mission_request_int_pack_chan(MAVLinkProtocol::instance()->getSystemId(),
-                                                  MAVLinkProtocol::getComponentId(),
-                                                  sharedLink->mavlinkChannel(),
-                                                  &message,
-                                                  _vehicle->id(),
-                                                  MAV_COMP_ID_AUTOPILOT1,
-                                                  _itemIndicesToRead[0],
-                                                  _planType);
-        _vehicle->sendMessageOnLinkThreadSafe(sharedLink.get(), message);
+    for (int i=0; i<_itemIndicesToRead.count() && _readRequestWindow.canSend(); i++) {
+        if (!_pipelineReadRequests && (_readRequestWindow.outstandingCount() > 0)) {
+            break;
+        }
+        const int sequenceNumber = _itemIndicesToRead[i];
+        if (_readRequestWindow.isOutstanding(sequenceNumber)) {
+            continue;
+        }
+
+        const bool retransmission = _itemIndicesRequested.contains(sequenceNumber);
+        qCDebug(PlanManagerLog) << QStringLiteral("_requestMissionItems %1 sequenceNumber:retransmission:retry").arg(_planTypeString()) << sequenceNumber << retransmission << _retryCount;
+
+        _itemIndicesRequested.insert(sequenceNumber);
+        _readRequestWindow.requestSent(sequenceNumber, nowMSecs, retransmission);
+
+        if (sharedLink) {
+            mavlink_message_t       message;
+
+            mavlink_msg_mission_request_int_pack_chan(MAVLinkProtocol::instance()->getSystemId(),
+                                                      MAVLinkProtocol::getComponentId(),
+                                                      sharedLink->mavlinkChannel(),
+                                                      &message,
+                                                      _vehicle->id(),
+                                                      MAV_COMP_ID_AUTOPILOT1,
+                                                      sequenceNumber,
+                                                      _planType);
+            _vehicle->sendMessageOnLinkThreadSafe(sharedLink.get(), message);
+        }
     }
     _startAckTimeout(AckMissionItem);
 }
@@ -380,16 +464,10 @@ void PlanManager::_requestNextMissionItem(void)
 void PlanManager::_handleMissionItem(const mavlink_message_t& message)
 {
     MAV_CMD          command;
-    MAV_FRAME        frame;
     MAV_MISSION_TYPE missionType;
-    double           param1;
-    double           param2;
-    double           param3;
-    double           param4;
     double           param5;
     double           param6;
     double           param7;
-    bool             autoContinue;
     bool             isCurrentItem;
     int              seq;
 
@@ -397,16 +475,10 @@ void PlanManager::_handleMissionItem(const mavlink_message_t& message)
     mavlink_msg_mission_item_int_decode(&message, &missionItem);
 
     command =       (MAV_CMD)missionItem.command;
-    frame =         (MAV_FRAME)missionItem.frame;
     missionType =   (MAV_MISSION_TYPE)missionItem.mission_type;
-    param1 =        missionItem.param1;
-    param2 =        missionItem.param2;
-    param3 =        missionItem.param3;
-    param4 =        missionItem.param4;
     param5 =        missionItem.frame == MAV_FRAME_MISSION ? (double)missionItem.x : (double)missionItem.x * 1e-7;
     param6 =        missionItem.frame == MAV_FRAME_MISSION ? (double)missionItem.y : (double)missionItem.y * 1e-7;
     param7 =        (double)missionItem.z;
-    autoContinue =  missionItem.autocontinue;
     isCurrentItem = missionItem.current;
     seq =           missionItem.seq;
 
@@ -417,13 +489,6 @@ void PlanManager::_handleMissionItem(const mavlink_message_t& message)
        return;
     }
 
-    // We don't support editing ALT_INT frames so change on the way in.
-    if (frame == MAV_FRAME_GLOBAL_INT) {
-        frame = MAV_FRAME_GLOBAL;
-    } else if (frame == MAV_FRAME_GLOBAL_RELATIVE_ALT_INT) {
-        frame = MAV_FRAME_GLOBAL_RELATIVE_ALT;
-    }
-
     bool ardupilotHomePositionUpdate = false;
     if (!_checkForExpectedAck(AckMissionItem)) {
         if (_vehicle->apmFirmware() && seq ==  0 && _planType == MAV_MISSION_TYPE_MISSION) {
@@ -444,27 +509,9 @@ void PlanManager::_handleMissionItem(const mavlink_message_t& message)
 
     if (_itemIndicesToRead.contains(seq)) {
         _itemIndicesToRead.removeOne(seq);
+        (void) _readRequestWindow.responseReceived(seq, _readRequestClock.elapsed());
 
-        MissionItem* item = new MissionItem(seq,
-                                            command,
-                                            frame,
-                                            param1,
-                                            param2,
-                                            param3,
-                                            param4,
-                                            param5,
-                                            param6,
-                                            param7,
-                                            autoContinue,
-                                            isCurrentItem,
-                                            this);
-
-        if (item->command() == MAV_CMD_DO_JUMP && !_vehicle->firmwarePlugin()->sendHomePositionToVehicle()) {
-            // Home is in position 0
-            item->setParam1((int)item->param1() + 1);
-        }
-
-        _missionItems.append(item);
+        _missionItems.append(_createMissionItem(missionItem));
     } else {
         qCDebug(PlanManagerLog) << QStringLiteral("_handleMissionItem %1 mission item received item index which was not requested, disregrarding:").arg(_planTypeString()) << seq;
         // We have to put the ack timeout back since it was removed above
@@ -472,16 +519,50 @@ void PlanManager::_handleMissionItem(const mavlink_message_t& message)
         return;
     }
 
-    emit progressPctChanged((double)seq / (double)_missionItemCountToRead);
+    emit progressPctChanged((double)(_missionItemCountToRead - _itemIndicesToRead.count()) / (double)_missionItemCountToRead);
 
     _retryCount = 0;
     if (_itemIndicesToRead.count() == 0) {
         _readTransactionComplete();
     } else {
-        _requestNextMissionItem();
+        _requestMissionItems();
     }
 }
 
+/// Converts an item as sent by the vehicle to the MissionItem used by the rest of QGC
+MissionItem* PlanManager::_createMissionItem(const mavlink_mission_item_int_t& missionItem)
+{
+    MAV_FRAME frame = (MAV_FRAME)missionItem.frame;
+
+    // We don't support editing ALT_INT frames so change on the way in.
+    if (frame == MAV_FRAME_GLOBAL_INT) {
+        frame = MAV_FRAME_GLOBAL;
+    } else if (frame == MAV_FRAME_GLOBAL_RELATIVE_ALT_INT) {
+        frame = MAV_FRAME_GLOBAL_RELATIVE_ALT;
+    }
+
+    MissionItem* item = new MissionItem(missionItem.seq,
+                                        (MAV_CMD)missionItem.command,
+                                        frame,
+                                        missionItem.param1,
+                                        missionItem.param2,
+                                        missionItem.param3,
+                                        missionItem.param4,
+                                        missionItem.frame == MAV_FRAME_MISSION ? (double)missionItem.x : (double)missionItem.x * 1e-7,
+                                        missionItem.frame == MAV_FRAME_MISSION ? (double)missionItem.y : (double)missionItem.y * 1e-7,
+                                        (double)missionItem.z,
+                                        missionItem.autocontinue,
+                                        missionItem.current,
+                                        this);
+
+    if (item->command() == MAV_CMD_DO_JUMP && !_vehicle->firmwarePlugin()->sendHomePositionToVehicle()) {
+        // Home is in position 0
+        item->setParam1((int)item->param1() + 1);
+    }
+
+    return item;
+}
+
 void PlanManager::_clearMissionItems(void)
 {
     _itemIndicesToRead.clear();
@@ -526,32 +607,17 @@ void PlanManager::_handleMissionRequest(const mavlink_message_t& message)
         _itemIndicesToWrite.removeOne(missionRequestSeq);
     }
 
-    MissionItem* item = _writeMissionItems[missionRequestSeq];
-    qCDebug(PlanManagerLog) << QStringLiteral("_handleMissionRequest %1 sequenceNumber:command").arg(_planTypeString()) << missionRequestSeq << item->command();
+    qCDebug(PlanManagerLog) << QStringLiteral("_handleMissionRequest %1 sequenceNumber:command").arg(_planTypeString()) << missionRequestSeq << _writeMissionItems[missionRequestSeq]->command();
 
     SharedLinkInterfacePtr sharedLink = _vehicle->vehicleLinkManager()->primaryLink().lock();
     if (sharedLink) {
         mavlink_message_t       messageOut;
 
-        mavlink_msg_mission_item_int_pack_chan(MAVLinkProtocol::instance()->getSystemId(),
-                                               MAVLinkProtocol::getComponentId(),
-                                               sharedLink->mavlinkChannel(),
-                                               &messageOut,
-                                               _vehicle->id(),
-                                               MAV_COMP_ID_AUTOPILOT1,
-                                               missionRequestSeq,
-                                               item->frame(),
-                                               item->command(),
-                                               missionRequestSeq == 0,
-                                               item->autoContinue(),
-                                               item->param1(),
-                                               item->param2(),
-                                               item->param3(),
-                                               item->param4(),
-                                               item->frame() == MAV_FRAME_MISSION ? item->param5() : item->param5() * 1e7,
-                                               item->frame() == MAV_FRAME_MISSION ? item->param6() : item->param6() * 1e7,
-                                               item->param7(),
-                                               _planType);
+        mavlink_msg_mission_item_int_encode_chan(MAVLinkProtocol::instance()->getSystemId(),
+                                                 MAVLinkProtocol::getComponentId(),
+                                                 sharedLink->mavlinkChannel(),
+                                                 &messageOut,
+                                                 &_writeMissionItemsEncoded[missionRequestSeq]);
         _vehicle->sendMessageOnLinkThreadSafe(sharedLink.get(), messageOut);
     }
     _startAckTimeout(AckMissionRequest);
@@ -813,6 +879,8 @@ void PlanManager::_finishTransaction(bool success, bool apmGuidedItemWrite)
 
     _itemIndicesToRead.clear();
     _itemIndicesToWrite.clear();
+    _itemIndicesRequested.clear();
+    _readRequestWindow = MAVLinkRequestWindow();
 
     // First thing we do is clear the transaction. This way inProgesss is off when we signal transaction complete.
     TransactionType_t currentTransactionType = _transactionInProgress;
@@ -842,6 +910,7 @@ void PlanManager::_finishTransaction(bool success, bool apmGuidedItemWrite)
                     _missionItems.append(_writeMissionItems[i]);
                 }
                 _writeMissionItems.clear();
+                _writeMissionItemsEncoded.clear();
             } else {
                 // Write failed, throw out the write list
                 _clearAndDeleteWriteMissionItems();
@@ -935,6 +1004,7 @@ void PlanManager::_clearAndDeleteWriteMissionItems(void)
         delete _writeMissionItems[i];
     }
     _writeMissionItems.clear();
+    _writeMissionItemsEncoded.clear();
 }
 
 void PlanManager::_connectToMavlink(void)
@@ -962,6 +1032,138 @@ QString PlanManager::_planTypeString(void)
     }
 }
 
+/// ArduPilot exposes the plan as a file over MAVLink FTP. Burst reads stream the whole file without a round trip per
+/// item and a write needs one round trip per FTP block instead of one per item.
+bool PlanManager::_ftpSupported(void) const
+{
+    return _vehicle->apmFirmware() && (_vehicle->capabilityBits() & MAV_PROTOCOL_CAPABILITY_FTP);
+}
+
+QString PlanManager::_ftpLocalFileName(void) const
+{
+    return QStringLiteral("Vehicle%1-%2").arg(_vehicle->id()).arg(QFileInfo(PlanFTPFile::vehiclePath(_planType)).fileName());
+}
+
+/// Starts reading the plan file from the vehicle
+///     @return false: FTP can't be used, use the mission protocol instead
+bool PlanManager::_ftpReadBegin(void)
+{
+    if (!_ftpSupported()) {
+        return false;
+    }
+
+    FTPManager* ftpManager = _vehicle->ftpManager();
+    connect(ftpManager, &FTPManager::downloadComplete, this, &PlanManager::_ftpDownloadComplete);
+    if (!ftpManager->download(MAV_COMP_ID_AUTOPILOT1,
+                              PlanFTPFile::vehiclePath(_planType),
+                              QStandardPaths::writableLocation(QStandardPaths::TempLocation),
+                              _ftpLocalFileName(),
+                              false /* No filesize check */)) {
+        // FTPManager is busy with another transfer
+        qCDebug(PlanManagerLog) << QStringLiteral("_ftpReadBegin %1 FTPManager::download failed").arg(_planTypeString());
+        disconnect(ftpManager, &FTPManager::downloadComplete, this, &PlanManager::_ftpDownloadComplete);
+        return false;
+    }
+    connect(ftpManager, &FTPManager::commandProgress, this, &PlanManager::_ftpProgress);
+
+    qCDebug(PlanManagerLog) << QStringLiteral("_ftpReadBegin %1").arg(_planTypeString()) << PlanFTPFile::vehiclePath(_planType);
+
+    return true;
+}
+
+void PlanManager::_ftpDownloadComplete(const QString& file, const QString& errorMsg)
+{
+    FTPManager* ftpManager = _vehicle->ftpManager();
+    disconnect(ftpManager, &FTPManager::downloadComplete, this, &PlanManager::_ftpDownloadComplete);
+    disconnect(ftpManager, &FTPManager::commandProgress, this, &PlanManager::_ftpProgress);
+
+    QList<mavlink_mission_item_int_t> items;
+    QString error = errorMsg;
+    if (error.isEmpty()) {
+        QFile ftpFile(file);
+        if (ftpFile.open(QFile::ReadOnly)) {
+            (void) PlanFTPFile::decode(ftpFile.readAll(), _planType, items, error);
+        } else {
+            error = ftpFile.errorString();
+        }
+        (void) ftpFile.remove();
+    }
+
+    if (!error.isEmpty()) {
+        qCDebug(PlanManagerLog) << QStringLiteral("_ftpDownloadComplete %1 FTP read failed, using mission protocol:").arg(_planTypeString()) << error;
+        _requestList();
+        return;
+    }
+
+    qCDebug(PlanManagerLog) << QStringLiteral("_ftpDownloadComplete %1 count:").arg(_planTypeString()) << items.count();
+
+    _clearMissionItems();
+    for (const mavlink_mission_item_int_t& missionItem : items) {
+        _missionItems.append(_createMissionItem(missionItem));
+    }
+
+    _finishTransaction(true);
+}
+
+/// Starts writing _writeMissionItemsEncoded to the vehicle as a single plan file
+///     @return false: FTP can't be used, use the mission protocol instead
+bool PlanManager::_ftpWriteBegin(void)
+{
+    if (!_ftpSupported()) {
+        return false;
+    }
+
+    const QString localFile = QDir(QStandardPaths::writableLocation(QStandardPaths::TempLocation)).absoluteFilePath(_ftpLocalFileName());
+    const QByteArray bytes = PlanFTPFile::encode(_planType, _writeMissionItemsEncoded);
+
+    QFile file(localFile);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate) || (file.write(bytes) != bytes.size())) {
+        qCWarning(PlanManagerLog) << QStringLiteral("_ftpWriteBegin %1 unable to write").arg(_planTypeString()) << localFile << file.errorString();
+        return false;
+    }
+    file.close();
+
+    FTPManager* ftpManager = _vehicle->ftpManager();
+    connect(ftpManager, &FTPManager::uploadComplete, this, &PlanManager::_ftpUploadComplete);
+    if (!ftpManager->upload(MAV_COMP_ID_AUTOPILOT1, PlanFTPFile::vehiclePath(_planType), localFile)) {
+        // FTPManager is busy with another transfer
+        qCDebug(PlanManagerLog) << QStringLiteral("_ftpWriteBegin %1 FTPManager::upload failed").arg(_planTypeString());
+        disconnect(ftpManager, &FTPManager::uploadComplete, this, &PlanManager::_ftpUploadComplete);
+        (void) file.remove();
+        return false;
+    }
+    connect(ftpManager, &FTPManager::commandProgress, this, &PlanManager::_ftpProgress);
+
+    qCDebug(PlanManagerLog) << QStringLiteral("_ftpWriteBegin %1 count:bytes").arg(_planTypeString()) << _writeMissionItemsEncoded.count() << bytes.size();
+
+    return true;
+}
+
+void PlanManager::_ftpUploadComplete(const QString& file, const QString& errorMsg)
+{
+    FTPManager* ftpManager = _vehicle->ftpManager();
+    disconnect(ftpManager, &FTPManager::uploadComplete, this, &PlanManager::_ftpUploadComplete);
+    disconnect(ftpManager, &FTPManager::commandProgress, this, &PlanManager::_ftpProgress);
+
+    (void) QFile::remove(file);
+
+    if (!errorMsg.isEmpty()) {
+        qCDebug(PlanManagerLog) << QStringLiteral("_ftpUploadComplete %1 FTP write failed, using mission protocol:").arg(_planTypeString()) << errorMsg;
+        _writeMissionCount();
+        return;
+    }
+
+    qCDebug(PlanManagerLog) << QStringLiteral("_ftpUploadComplete %1 write sequence complete").arg(_planTypeString());
+
+    _itemIndicesToWrite.clear();
+    _finishTransaction(true);
+}
+
+void PlanManager::_ftpProgress(float value)
+{
+    emit progressPctChanged(value);
+}
+
 void PlanManager::_setTransactionInProgress(TransactionType_t type)
 {
     if (_transactionInProgress  != type) {
@@ -9,10 +9,13 @@
 
 #pragma once
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
 #include <QtCore/QTimer>
 #include <QtCore/QLoggingCategory>
 
+#include "MAVLinkRequestWindow.h"
 #include "MissionItem.h"
 #include "QGCMAVLink.h"
 
@@ -21,7 +24,8 @@ class Vehicle;
 Q_DECLARE_LOGGING_CATEGORY(PlanManagerLog)
 
 /// The PlanManager class is the base class for the Mission, GeoFence and Rally Point managers. All of which use the
-/// new mavlink v2 mission protocol.
+/// new mavlink v2 mission protocol. If the vehicle exposes its plan as files over MAVLink FTP the whole plan is
+/// transferred as a single file instead, falling back to the mission protocol if that fails.
 class PlanManager : public QObject
 {
     Q_OBJECT
@@ -67,10 +71,9 @@ class PlanManager : public QObject
     } ErrorCode_t;
 
     // These values are public so the unit test can set appropriate signal wait times
-    // When passively waiting for a mission process, use a longer timeout.
+    // When passively waiting for a mission process, use a longer timeout. Item requests during a read time out
+    // based on the measured round trip time instead.
     static const int _ackTimeoutMilliseconds = 1500;
-    // When actively retrying to request mission items, use a shorter timeout instead.
-    static const int _retryTimeoutMilliseconds = 250;
     static const int _maxRetryCount = 5;
 
 signals:
@@ -88,6 +91,9 @@ class PlanManager : public QObject
 private slots:
     void _mavlinkMessageReceived(const mavlink_message_t& message);
     void _ackTimeout(void);
+    void _ftpDownloadComplete(const QString& file, const QString& errorMsg);
+    void _ftpUploadComplete(const QString& file, const QString& errorMsg);
+    void _ftpProgress(float value);
 
 protected:
     typedef enum {
@@ -113,7 +119,8 @@ private slots:
     void _handleMissionItem(const mavlink_message_t& message);
     void _handleMissionRequest(const mavlink_message_t& message);
     void _handleMissionAck(const mavlink_message_t& message);
-    void _requestNextMissionItem(void);
+    MissionItem* _createMissionItem(const mavlink_mission_item_int_t& missionItem);
+    void _requestMissionItems(void);
     void _clearMissionItems(void);
     void _sendError(ErrorCode_t errorCode, const QString& errorMsg);
     QString _ackTypeToString(AckType_t ackType);
@@ -122,6 +129,7 @@ private slots:
     void _requestList(void);
     void _writeMissionCount(void);
     void _writeMissionItemsWorker(void);
+    void _encodeWriteMissionItems(void);
     void _clearAndDeleteMissionItems(void);
     void _clearAndDeleteWriteMissionItems(void);
     QString _lastMissionReqestString(MAV_MISSION_RESULT result);
@@ -129,6 +137,10 @@ private slots:
     void _connectToMavlink(void);
     void _disconnectFromMavlink(void);
     QString _planTypeString(void);
+    bool _ftpSupported(void) const;
+    bool _ftpReadBegin(void);
+    bool _ftpWriteBegin(void);
+    QString _ftpLocalFileName(void) const;
 
 protected:
     Vehicle*            _vehicle =              nullptr;
@@ -142,11 +154,16 @@ private slots:
     bool                _resumeMission;
     QList<int>          _itemIndicesToWrite;    ///< List of mission items which still need to be written to vehicle
     QList<int>          _itemIndicesToRead;     ///< List of mission items which still need to be requested from vehicle
+    QSet<int>           _itemIndicesRequested;  ///< Mission items requested at least once during the current read
+    MAVLinkRequestWindow _readRequestWindow;    ///< Limits the MISSION_REQUEST_INT messages in flight during a read
+    QElapsedTimer       _readRequestClock;
+    bool                _pipelineReadRequests;  ///< true: vehicle answers requests for any item, more than one may be in flight
     int                 _lastMissionRequest;    ///< Index of item last requested by MISSION_REQUEST
     int                 _missionItemCountToRead;///< Count of all mission items to read
 
     QList<MissionItem*> _missionItems;          ///< Set of mission items on vehicle
     QList<MissionItem*> _writeMissionItems;     ///< Set of mission items currently being written to vehicle
+    QList<mavlink_mission_item_int_t> _writeMissionItemsEncoded;    ///< _writeMissionItems in wire format, same indices
     int                 _currentMissionIndex;
     int                 _lastCurrentIndex;
 
@@ -21,6 +21,7 @@
 #include "Vehicle.h"
 #include "QGCLoggingCategory.h"
 
+#include <QtConcurrent/QtConcurrentRun>
 #include <QtCore/QJsonArray>
 
 QGC_LOGGING_CATEGORY(TransectStyleComplexItemLog, "TransectStyleComplexItemLog")
@@ -41,6 +42,10 @@ TransectStyleComplexItem::TransectStyleComplexItem(PlanMasterController* masterC
     _terrainPolyPathQueryTimer.setSingleShot(true);
     connect(&_terrainPolyPathQueryTimer, &QTimer::timeout, this, &TransectStyleComplexItem::_reallyQueryTransectsPathHeightInfo);
 
+    // Unit tests expect the transects to be available as soon as a setting changes
+    _asyncTransects = !qgcApp()->runningUnitTests();
+    connect(&_transectsWatcher, &QFutureWatcher<Transects_t>::finished, this, &TransectStyleComplexItem::_transectsJobFinished);
+
     // The follow is used to compress multiple recalc calls in a row to into a single call.
     connect(this, &TransectStyleComplexItem::_updateFlightPathSegmentsSignal, this, &TransectStyleComplexItem::_updateFlightPathSegmentsDontCallDirectly,   Qt::QueuedConnection);
     qgcApp()->addCompressedSignal(QMetaMethod::fromSignal(&TransectStyleComplexItem::_updateFlightPathSegmentsSignal));
@@ -106,6 +111,12 @@ TransectStyleComplexItem::TransectStyleComplexItem(PlanMasterController* masterC
     setDirty(false);
 }
 
+TransectStyleComplexItem::~TransectStyleComplexItem()
+{
+    // The job only works on its own copies so there is no need to wait for it
+    _cancelTransectsJob();
+}
+
 void TransectStyleComplexItem::_setCameraShots(int cameraShots)
 {
     if (_cameraShots != cameraShots) {
@@ -128,6 +139,8 @@ void TransectStyleComplexItem::setDirty(bool dirty)
 
 void TransectStyleComplexItem::_save(QJsonObject& complexObject)
 {
+    waitForTransectsJob();
+
     QJsonObject innerObject;
 
     innerObject[JsonHelper::jsonVersionKey] =       2;
@@ -188,6 +201,9 @@ bool TransectStyleComplexItem::_load(const QJsonObject& complexObject, bool forP
         return false;
     }
 
+    // Results from a job started before the load would replace the loaded transects
+    _cancelTransectsJob();
+
     // The TransectStyleComplexItem is a sub-object of the main complex item object
     QJsonObject innerObject = complexObject[_jsonTransectStyleComplexItemKey].toObject();
 
@@ -388,12 +404,59 @@ void TransectStyleComplexItem::_rebuildTransects(void)
         return;
     }
 
+    // Any job which is still running was started for settings which are now out of date
+    _cancelTransectsJob();
+
+    TransectsJob_t transectsJob = _asyncTransects ? _transectsJob() : TransectsJob_t();
+    if (transectsJob) {
+        // The current transects and visuals stay in place until the job publishes its results
+        _transectsPending = true;
+        _transectsWatcher.setFuture(QtConcurrent::run(transectsJob));
+        return;
+    }
+
     _transects.clear();
+    _rebuildTransectsPhase1();
+    _rebuildTransectsPhase2();
+}
+
+void TransectStyleComplexItem::_transectsJobFinished(void)
+{
+    const QFuture<Transects_t> future = _transectsWatcher.future();
+
+    if (!_transectsPending || future.isCanceled() || (future.resultCount() == 0)) {
+        return;
+    }
+    _transectsPending = false;
+
+    _transects = future.result();
+    qCDebug(TransectStyleComplexItemLog) << "_transectsJobFinished transect count" << _transects.count();
+
+    _rebuildTransectsPhase2();
+}
+
+void TransectStyleComplexItem::_cancelTransectsJob(void)
+{
+    if (_transectsPending) {
+        _transectsPending = false;
+        _transectsWatcher.cancel();
+    }
+}
+
+void TransectStyleComplexItem::waitForTransectsJob(void)
+{
+    if (_transectsPending) {
+        _transectsWatcher.waitForFinished();
+        _transectsJobFinished();
+    }
+}
+
+/// Builds the flight path, visuals and statistics from the new _transects
+void TransectStyleComplexItem::_rebuildTransectsPhase2(void)
+{
     _rgPathHeightInfo.clear();
     _rgFlightPathCoordInfo.clear();
 
-    _rebuildTransectsPhase1();
-
     _minAMSLAltitude = _maxAMSLAltitude = qQNaN();
 
     switch (_cameraCalc.distanceMode()) {
@@ -1108,6 +1171,8 @@ void TransectStyleComplexItem::_handleHoverAndCaptureEnabled(QVariant enabled)
 
 void TransectStyleComplexItem::appendMissionItems(QList<MissionItem*>& items, QObject* missionItemParent)
 {
+    waitForTransectsJob();
+
     if (_loadedMissionItems.count()) {
         // We have mission items from the loaded plan, use those
         _appendLoadedMissionItems(items, missionItemParent);
@@ -16,7 +16,11 @@
 #include "CameraCalc.h"
 #include "TerrainQuery.h"
 
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QPromise>
+
+#include <functional>
 
 Q_DECLARE_LOGGING_CATEGORY(TransectStyleComplexItemLog)
 
@@ -28,6 +32,7 @@ class TransectStyleComplexItem : public ComplexMissionItem
 
 public:
     TransectStyleComplexItem(PlanMasterController* masterController, bool flyView, QString settignsGroup);
+    ~TransectStyleComplexItem();
 
     Q_PROPERTY(QGCMapPolygon*   surveyAreaPolygon           READ surveyAreaPolygon                                  CONSTANT)
     Q_PROPERTY(CameraCalc*      cameraCalc                  READ cameraCalc                                         CONSTANT)
@@ -70,8 +75,13 @@ class TransectStyleComplexItem : public ComplexMissionItem
     bool    hoverAndCaptureEnabled  (void) const { return hoverAndCapture()->rawValue().toBool(); }
     bool    triggerCamera           (void) const { return triggerDistance() != 0; }
 
+    /// Publishes the results of a pending transects job right away, for callers which need the mission items for the current settings
+    void    waitForTransectsJob     (void);
+
     // Used internally only by unit tests
-    int _transectCount(void) const { return _transects.count(); }
+    int     _transectCount          (void) const { return _transects.count(); }
+    bool    _transectsJobPending    (void) const { return _transectsPending; }
+    void    _setAsyncTransects      (bool asyncTransects) { _asyncTransects = asyncTransects; }
 
     // Overrides from ComplexMissionItem
     int     lastSequenceNumber  (void) const final;
@@ -135,9 +145,31 @@ protected slots:
     void _rebuildTransects                  (void);
 
 protected:
+    enum CoordType {
+        CoordTypeInterior,              ///< Interior waypoint for flight path only (example: interior corridor point)
+        CoordTypeInteriorHoverTrigger,  ///< Interior waypoint for hover and capture trigger
+        CoordTypeInteriorTerrainAdded,  ///< Interior waypoint added for terrain
+        CoordTypeSurveyEntry,           ///< Waypoint at entry edge of survey polygon
+        CoordTypeSurveyExit,            ///< Waypoint at exit edge of survey polygon
+        CoordTypeTurnaround,            ///< Turnaround extension waypoint
+    };
+
+    typedef struct {
+        QGeoCoordinate  coord;
+        CoordType       coordType;
+    } CoordInfo_t;
+
+    typedef QList<QList<CoordInfo_t>>                               Transects_t;
+    typedef std::function<void(QPromise<Transects_t>& promise)>     TransectsJob_t;
+
     virtual void _rebuildTransectsPhase1    (void) = 0; ///< Rebuilds the _transects array
     virtual void _recalcCameraShots         (void) = 0;
 
+    /// Returns a job which generates the transects on the global thread pool instead of running _rebuildTransectsPhase1 on the
+    /// GUI thread. The job must only use values it captured, since the item may change or be deleted while it runs, and should
+    /// return without a result once promise.isCanceled(). An empty job means phase 1 runs synchronously.
+    virtual TransectsJob_t _transectsJob    (void) { return TransectsJob_t(); }
+
     void    _save                           (QJsonObject& saveObject);
     bool    _load                           (const QJsonObject& complexObject, bool forPresets, QString& errorString);
     void    _setExitCoordinate              (const QGeoCoordinate& coordinate);
@@ -159,22 +191,8 @@ protected slots:
     QGeoCoordinate      _exitCoordinate;
     QGCMapPolygon       _surveyAreaPolygon;
 
-    enum CoordType {
-        CoordTypeInterior,              ///< Interior waypoint for flight path only (example: interior corridor point)
-        CoordTypeInteriorHoverTrigger,  ///< Interior waypoint for hover and capture trigger
-        CoordTypeInteriorTerrainAdded,  ///< Interior waypoint added for terrain
-        CoordTypeSurveyEntry,           ///< Waypoint at entry edge of survey polygon
-        CoordTypeSurveyExit,            ///< Waypoint at exit edge of survey polygon
-        CoordTypeTurnaround,            ///< Turnaround extension waypoint
-    };
-
-    typedef struct {
-        QGeoCoordinate  coord;
-        CoordType       coordType;
-    } CoordInfo_t;
-
     QVariantList                                _visualTransectPoints;                          ///< Used to draw the flight path visuals on the screen
-    QList<QList<CoordInfo_t>>                   _transects;
+    Transects_t                                 _transects;
     QList<TerrainPathQuery::PathHeightInfo_t>   _rgPathHeightInfo;                              ///< Path height for each segment includes turn segments
     QList<QGeoCoordinate>                       _rgFlyThroughMissionItemCoords;
     QList<double>                               _rgFlyThroughMissionItemCoordsTerrainHeights;
@@ -218,6 +236,7 @@ private slots:
     void _updateFlightPathSegmentsDontCallDirectly  (void);
     void _segmentTerrainCollisionChanged            (bool terrainCollision) final;
     void _distanceModeChanged                       (int distanceMode);
+    void _transectsJobFinished                      (void);
 
 private:
     typedef struct {
@@ -239,10 +258,15 @@ private slots:
     double  _altitudeBetweenCoords                                          (const QGeoCoordinate& fromCoord, const QGeoCoordinate& toCoord, double percentTowardsTo);
     int     _maxPathHeight                                                  (const TerrainPathQuery::PathHeightInfo_t& pathHeightInfo, int fromIndex, int toIndex, double& maxHeight);
     BuildMissionItemsState_t _buildMissionItemsState                        (void) const;
+    void    _rebuildTransectsPhase2                                         (void);
+    void    _cancelTransectsJob                                             (void);
 
     TerrainPolyPathQuery*       _currentTerrainPolyPathQuery        = nullptr;
     TerrainAtCoordinateQuery*   _currentTerrainAtCoordinateQuery    = nullptr;
     QTimer                      _terrainPolyPathQueryTimer;
+    QFutureWatcher<Transects_t> _transectsWatcher;
+    bool                        _transectsPending                   = false;    ///< Job result has not been published to _transects yet
+    bool                        _asyncTransects                     = true;     ///< false: Always rebuild synchronously (unit tests)
 
     // Deprecated json keys
     static constexpr const char* _jsonTerrainFollowKeyDeprecated       = "FollowTerrain";
@@ -33,6 +33,7 @@
 #include "LinkManager.h"
 #include "MAVLinkProtocol.h"
 #include "MultiVehicleManager.h"
+#include "ParamMetaDataBlob.h"
 #include "ParameterManager.h"
 #include "PositionManager.h"
 #include "QGCCommandLineParser.h"
@@ -58,6 +59,7 @@ QGCApplication::QGCApplication(int &argc, char *argv[], const QGCCommandLinePars
     : QApplication(argc, argv)
     , _runningUnitTests(cli.runningUnitTests)
     , _simpleBootTest(cli.simpleBootTest)
+    , _analyzingLogs(!cli.analyzeLogs.isEmpty())
     , _fakeMobile(cli.fakeMobile)
     , _logOutput(cli.logOutput)
     , _systemId(cli.systemId.value_or(0))
@@ -136,6 +138,8 @@ QGCApplication::QGCApplication(int &argc, char *argv[], const QGCCommandLinePars
     if (fClearCache) {
         QDir dir(ParameterManager::parameterCacheDir());
         dir.removeRecursively();
+        QDir metaDataDir(ParamMetaDataBlob::cacheDir());
+        metaDataDir.removeRecursively();
         QFile airframe(cachedAirframeMetaDataFile());
         airframe.remove();
         QFile parameter(cachedParameterMetaDataFile());
@@ -228,11 +232,20 @@ void QGCApplication::init()
         // Since GStream builds are so problematic we initialize video during the simple boot test
         // to make sure it works and verfies plugin availability.
         _initVideo();
+    } else if (_analyzingLogs) {
+        _initForLogAnalysis();
     } else if (!_runningUnitTests) {
         _initForNormalAppBoot();
     }
 }
 
+void QGCApplication::_initForLogAnalysis()
+{
+    QGCCorePlugin::instance()->init();
+    MAVLinkProtocol::instance()->init();
+    MultiVehicleManager::instance()->init();
+}
+
 void QGCApplication::_initVideo()
 {
 #ifdef QGC_GST_STREAMING
@@ -406,6 +419,9 @@ void QGCApplication::showAppMessage(const QString &message, const QString &title
     } else if (runningUnitTests()) {
         // Unit tests can run without UI
         qCDebug(QGCApplicationLog) << "QGCApplication::showAppMessage unittest title:message" << dialogTitle << message;
+    } else if (_analyzingLogs) {
+        // There is no UI to show it in
+        qCWarning(QGCApplicationLog) << dialogTitle << message;
     } else {
         // UI isn't ready yet
         _delayedAppMessages.append(QPair<QString, QString>(dialogTitle, message));
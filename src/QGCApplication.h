@@ -66,6 +66,9 @@ class QGCApplication : public QApplication
     bool runningUnitTests() const { return _runningUnitTests; }
     bool simpleBootTest() const { return _simpleBootTest; }
 
+    /// Returns true if the application runs headless tlog analysis instead of the UI
+    bool analyzingLogs() const { return _analyzingLogs; }
+
     /// Returns true if Qt debug output should be logged to a file
     bool logOutput() const { return _logOutput; }
 
@@ -139,11 +142,15 @@ private slots:
     /// Initialize the application for normal application boot. Or in other words we are not going to run unit tests.
     void _initForNormalAppBoot();
 
+    /// Initialize only what is needed to replay logs into vehicles, without UI or auto connect links.
+    void _initForLogAnalysis();
+
     QObject *_rootQmlObject();
     void _checkForNewVersion();
 
     bool _runningUnitTests = false;
     bool _simpleBootTest = false;
+    bool _analyzingLogs = false;
     bool _fakeMobile = false;    ///< true: Fake ui into displaying mobile interface
     bool _logOutput = false;    ///< true: Log Qt debug output to file
     quint8 _systemId = 0; ///< MAVLink system ID, 0 means not set
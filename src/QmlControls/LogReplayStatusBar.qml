@@ -71,6 +71,9 @@ Rectangle {
                 ListElement { text: "2x";   value: 2 }
                 ListElement { text: "5x";   value: 5 }
                 ListElement { text: "10x";  value: 10 }
+                ListElement { text: "25x";  value: 25 }
+                ListElement { text: "50x";  value: 50 }
+                ListElement { text: "100x"; value: 100 }
             }
 
             onActivated: (index) => { controller.playbackSpeed = model.get(currentIndex).value }
@@ -232,6 +232,48 @@ void QmlObjectListModel::append(QList<QObject*> objects)
     insert(_objectList.count(), objects);
 }
 
+void QmlObjectListModel::replaceFrom(int first, const QObjectList& objects)
+{
+    if (first < 0 || first > _objectList.count()) {
+        qCWarning(QmlObjectListModelLog) << "Invalid index - index:count" << first << _objectList.count() << this;
+        return;
+    }
+
+    const int oldCount = _objectList.count() - first;
+    const int newCount = objects.count();
+
+    // Skip the unchanged items at the start and end of the range
+    int prefixCount = 0;
+    while (prefixCount < oldCount && prefixCount < newCount && _objectList[first + prefixCount] == objects[prefixCount]) {
+        prefixCount++;
+    }
+    int suffixCount = 0;
+    while (suffixCount < oldCount - prefixCount && suffixCount < newCount - prefixCount &&
+           _objectList[first + oldCount - 1 - suffixCount] == objects[newCount - 1 - suffixCount]) {
+        suffixCount++;
+    }
+
+    const int removeIndex = first + prefixCount;
+    const int removeCount = oldCount - prefixCount - suffixCount;
+    if (removeCount > 0) {
+        for (int i=removeIndex; i<removeIndex + removeCount; i++) {
+            QObject* removedObject = _objectList[i];
+            if (removedObject && removedObject->metaObject()->indexOfSignal(QMetaObject::normalizedSignature("dirtyChanged(bool)").constData()) != -1) {
+                if (!_skipDirtyFirstItem || i != 0) {
+                    QObject::disconnect(removedObject, SIGNAL(dirtyChanged(bool)), this, SLOT(_childDirtyChanged(bool)));
+                }
+            }
+        }
+        removeRows(removeIndex, removeCount);
+        setDirty(true);
+    }
+
+    const int insertCount = newCount - prefixCount - suffixCount;
+    if (insertCount > 0) {
+        insert(removeIndex, objects.mid(prefixCount, insertCount));
+    }
+}
+
 QObjectList QmlObjectListModel::swapObjectList(const QObjectList& newlist)
 {
     QObjectList oldlist(_objectList);
@@ -55,6 +55,10 @@ class QmlObjectListModel : public QAbstractListModel
     /// Moves an item to a new position
     void move(int from, int to);
 
+    /// Replaces the items from index first to the end of the list with objects. Only the rows which differ from the
+    /// current list are removed and inserted, views keep their delegates for everything else. Removed items are not deleted.
+    void replaceFrom(int first, const QObjectList& objects);
+
     QObject*    operator[]          (int i);
     const QObject* operator[]       (int i) const;
     template<class T> T value       (int index) const { return qobject_cast<T>(_objectList[index]); }
@@ -26,9 +26,12 @@ class MavlinkSettings : public SettingsGroup
 
     DEFINE_SETTINGFACT(telemetrySave)
     DEFINE_SETTINGFACT(telemetrySaveNotArmed)
+    DEFINE_SETTINGFACT(telemetryLogFlushInterval)
+    DEFINE_SETTINGFACT(telemetryLogFlushSize)
     DEFINE_SETTINGFACT(saveCsvTelemetry)
     DEFINE_SETTINGFACT(forwardMavlink)
     DEFINE_SETTINGFACT(forwardMavlinkHostName)
+    DEFINE_SETTINGFACT(forwardMavlinkFilter)
     DEFINE_SETTINGFACT(forwardMavlinkAPMSupportHostName)
     DEFINE_SETTINGFACT(mavlink2SigningKey)
     DEFINE_SETTINGFACT(sendGCSHeartbeat)
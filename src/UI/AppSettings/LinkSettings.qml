@@ -253,6 +253,24 @@ SettingsPage {
                     onCheckedChanged:   editingConfig.highLatency = checked
                 }
 
+                RowLayout {
+                    Layout.fillWidth:   true
+                    spacing:            ScreenTools.defaultFontPixelWidth
+
+                    QGCLabel { text: qsTr("Send Rate Limit (bytes/s)") }
+                    QGCTextField {
+                        Layout.fillWidth:   true
+                        text:               editingConfig.sendByteRate > 0 ? editingConfig.sendByteRate.toString() : ""
+                        placeholderText:    qsTr("Automatic")
+                        inputMethodHints:   Qt.ImhFormattedNumbersOnly
+                        onEditingFinished:  editingConfig.sendByteRate = text.length > 0 ? parseInt(text) : 0
+
+                        validator: IntValidator {
+                            bottom: 0
+                        }
+                    }
+                }
+
                 LabelledComboBox {
                     label:                  qsTr("Type")
                     enabled:                originalConfig == null
@@ -111,6 +111,15 @@ SettingsPage {
             visible:                    fact.visible
             enabled:                    _mavlinkSettings.forwardMavlink.rawValue
         }
+
+        LabelledFactTextField {
+            Layout.fillWidth:           true
+            textFieldPreferredWidth:    ScreenTools.defaultFontPixelWidth * 20
+            label:                      qsTr("Filter")
+            fact:                       _mavlinkSettings.forwardMavlinkFilter
+            visible:                    fact.visible
+            enabled:                    _mavlinkSettings.forwardMavlink.rawValue
+        }
     }
 
     SettingsGroupLayout {
@@ -20,6 +20,9 @@ static const QString kOptClearCache      = QStringLiteral("clear-cache");
 static const QString kOptLogging         = QStringLiteral("logging");
 static const QString kOptLogOutput       = QStringLiteral("log-output");
 static const QString kOptSimpleBoot      = QStringLiteral("simple-boot-test");
+static const QString kOptAnalyzeLog      = QStringLiteral("analyze-log");
+static const QString kOptAnalyzeOutput   = QStringLiteral("analyze-output");
+static const QString kOptAnalyzeInterval = QStringLiteral("analyze-interval");
 static const QString kOptFakeMobile      = QStringLiteral("fake-mobile");
 static const QString kOptAllowMultiple   = QStringLiteral("allow-multiple");
 static const QString kOptUnittest        = QStringLiteral("unittest");
@@ -56,6 +59,11 @@ static QStringList normalizeArgs(const QStringList &args)
 }
 
 CommandLineParseResult parseCommandLine()
+{
+    return parseCommandLine(QCoreApplication::arguments());
+}
+
+CommandLineParseResult parseCommandLine(const QStringList &args)
 {
     CommandLineParseResult out{};
     out.parser = std::make_unique<QCommandLineParser>();
@@ -100,6 +108,24 @@ CommandLineParseResult parseCommandLine()
         QCoreApplication::translate("main", "Initialize subsystems and exit."));
     (void) parser.addOption(simpleBootOpt);
 
+    const QCommandLineOption analyzeLogOpt(
+        kOptAnalyzeLog,
+        QCoreApplication::translate("main", "Replay a telemetry log as fast as possible without UI, write FactGroup time series and exit. May be repeated."),
+        QCoreApplication::translate("main", "file"));
+    (void) parser.addOption(analyzeLogOpt);
+
+    const QCommandLineOption analyzeOutputOpt(
+        kOptAnalyzeOutput,
+        QCoreApplication::translate("main", "Output directory for --analyze-log results (defaults to the log directory)."),
+        QCoreApplication::translate("main", "dir"));
+    (void) parser.addOption(analyzeOutputOpt);
+
+    const QCommandLineOption analyzeIntervalOpt(
+        kOptAnalyzeInterval,
+        QCoreApplication::translate("main", "Log time between --analyze-log samples (default 1000)."),
+        QCoreApplication::translate("main", "msecs"));
+    (void) parser.addOption(analyzeIntervalOpt);
+
 #if defined(QGC_UNITTEST_BUILD)
     const QCommandLineOption unittestOpt(
         kOptUnittest,
@@ -145,7 +171,7 @@ CommandLineParseResult parseCommandLine()
     (void) parser.addOption(quietWinAssertOpt);
 #endif
 
-    const QStringList normalizedArgs = normalizeArgs(QCoreApplication::arguments());
+    const QStringList normalizedArgs = normalizeArgs(args);
     parser.process(normalizedArgs);
 
     out.unknownOptions = parser.unknownOptionNames();
@@ -215,6 +241,22 @@ CommandLineParseResult parseCommandLine()
     out.logOutput = parser.isSet(logOutputOpt);
     out.simpleBootTest = parser.isSet(simpleBootOpt);
 
+    out.analyzeLogs = parser.values(analyzeLogOpt);
+    if (parser.isSet(analyzeOutputOpt)) {
+        out.analyzeOutputDir = parser.value(analyzeOutputOpt);
+    }
+    if (parser.isSet(analyzeIntervalOpt)) {
+        const QString intervalStr = parser.value(analyzeIntervalOpt);
+        bool ok = false;
+        const uint interval = intervalStr.toUInt(&ok);
+        if (!ok || (interval == 0)) {
+            out.statusCode = CommandLineParseResult::Status::Error;
+            out.errorString = QCoreApplication::translate("main", "Invalid analyze interval: %1").arg(intervalStr);
+            return out;
+        }
+        out.analyzeIntervalMSecs = interval;
+    }
+
 #if defined(QGC_UNITTEST_BUILD)
     if (parser.isSet(unittestOpt)) {
         out.runningUnitTests = true;
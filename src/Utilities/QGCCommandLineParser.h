@@ -46,6 +46,10 @@ struct CommandLineParseResult
     bool stressUnitTests = false;
     uint stressUnitTestsCount = 0;
 
+    QStringList analyzeLogs;
+    std::optional<QString> analyzeOutputDir;
+    uint analyzeIntervalMSecs = 1000;
+
     bool fakeMobile = false;
     bool allowMultiple = false;
 
@@ -57,4 +61,7 @@ struct CommandLineParseResult
 /// Parse the application's command-line arguments into result.
 CommandLineParseResult parseCommandLine();
 
+/// Parse the given arguments into result. The first argument is the program name.
+CommandLineParseResult parseCommandLine(const QStringList &args);
+
 } // namespace QGCCommandLineParser
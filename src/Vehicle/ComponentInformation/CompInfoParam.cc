@@ -45,6 +45,26 @@ void CompInfoParam::setJson(const QString& metadataJsonFileName)
 
     _noJsonMetadata = false;
 
+    const QByteArray sourceKey = ParamMetaDataBlob::sourceKey(metadataJsonFileName);
+    if (!sourceKey.isEmpty()) {
+        _metaDataBlob.setFileName(ParamMetaDataBlob::cacheFileName(sourceKey));
+        if (_metaDataBlob.open(sourceKey)) {
+            qCDebug(CompInfoParamLog) << "Using precompiled metadata: compid:" << compId << _metaDataBlob.fileName();
+
+            // Indexed names are matched by pattern, so they can't be looked up by name later on
+            for (quint32 i=0; i<_metaDataBlob.count(); i++) {
+                const QString name = _metaDataBlob.name(i);
+                if (name.contains(_indexedNameTag)) {
+                    FactMetaData* newMetaData = _metaDataBlob.createMetaData(i, this);
+                    if (newMetaData) {
+                        _indexedNameMetaDataList.append(RegexFactMetaDataPair_t(name, newMetaData));
+                    }
+                }
+            }
+            return;
+        }
+    }
+
     if (!JsonHelper::isJsonFile(metadataJsonFileName, jsonDoc, errorString)) {
         qCWarning(CompInfoParamLog) << "Metadata json file open failed: compid:" << compId << errorString;
         return;
@@ -83,6 +103,14 @@ void CompInfoParam::setJson(const QString& metadataJsonFileName)
             _nameToMetaDataMap[newMetaData->name()] = newMetaData;
         }
     }
+
+    if (!sourceKey.isEmpty()) {
+        FactMetaData::NameToMetaDataMap_t compileMap = _nameToMetaDataMap;
+        for (const RegexFactMetaDataPair_t& pair: _indexedNameMetaDataList) {
+            compileMap[pair.first] = pair.second;
+        }
+        (void) ParamMetaDataBlob::write(ParamMetaDataBlob::cacheFileName(sourceKey), sourceKey, compileMap);
+    }
 }
 
 FactMetaData* CompInfoParam::factMetaDataForName(const QString& name, FactMetaData::ValueType_t type)
@@ -100,8 +128,15 @@ FactMetaData* CompInfoParam::factMetaDataForName(const QString& name, FactMetaDa
         if (_nameToMetaDataMap.contains(name)) {
             factMetaData = _nameToMetaDataMap[name];
         } else {
+            if (_metaDataBlob.isOpen()) {
+                const qint64 index = _metaDataBlob.indexOf(name);
+                if (index >= 0) {
+                    factMetaData = _metaDataBlob.createMetaData(static_cast<quint32>(index), this);
+                }
+            }
+
             // We didn't get any direct matches. Try an indexed name.
-            for (int i=0; i<_indexedNameMetaDataList.count(); i++) {
+            for (int i=0; !factMetaData && i<_indexedNameMetaDataList.count(); i++) {
                 const RegexFactMetaDataPair_t& pair = _indexedNameMetaDataList[i];
 
                 QString indexedName = pair.first;
@@ -12,6 +12,7 @@
 #include "CompInfo.h"
 #include "MAVLinkLib.h"
 #include "FactMetaData.h"
+#include "ParamMetaDataBlob.h"
 
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QObject>
@@ -47,6 +48,7 @@ class CompInfoParam : public CompInfo
     FactMetaData::NameToMetaDataMap_t   _nameToMetaDataMap;
     QList<RegexFactMetaDataPair_t>      _indexedNameMetaDataList;
     QObject*                            _opaqueParameterMetaData    = nullptr;
+    ParamMetaDataBlob                   _metaDataBlob;                          ///< Precompiled json meta data, FactMetaData is created on first lookup
 
     static constexpr const char* _jsonParametersKey           = "parameters";
     static constexpr const char* _cachedMetaDataFilePrefix    = "ParameterFactMetaData";
@@ -114,6 +114,48 @@ bool FTPManager::listDirectory(uint8_t fromCompId, const QString& fromURI)
     return true;
 }
 
+bool FTPManager::upload(uint8_t toCompId, const QString& toURI, const QString& fromFile)
+{
+    qCDebug(FTPManagerLog) << "upload fromFile:" << fromFile << "to:" << toURI << "toCompId:" << toCompId;
+
+    if (!_rgStateMachine.isEmpty()) {
+        qCDebug(FTPManagerLog) << "Cannot upload. Already in another operation";
+        return false;
+    }
+
+    _uploadState.reset();
+    _uploadState.fromFile = fromFile;
+
+    QFile file(fromFile);
+    if (!file.open(QFile::ReadOnly)) {
+        qCWarning(FTPManagerLog) << "upload: open failed" << fromFile << file.errorString();
+        return false;
+    }
+    _uploadState.fileData = file.readAll();
+
+    if (!_parseURI(toCompId, toURI, _uploadState.fullPathOnVehicle, _ftpCompId)) {
+        qCWarning(FTPManagerLog) << "_parseURI failed";
+        _uploadState.reset();
+        return false;
+    }
+
+    static const StateFunctions_t rgUploadStateMachine[] = {
+        { &FTPManager::_createFileBegin,            &FTPManager::_createFileAckOrNak,           &FTPManager::_createFileTimeout },
+        { &FTPManager::_writeFileBegin,             &FTPManager::_writeFileAckOrNak,            &FTPManager::_writeFileTimeout },
+        { &FTPManager::_closeUploadBegin,           &FTPManager::_closeUploadAckOrNak,          &FTPManager::_closeUploadTimeout },
+        { &FTPManager::_uploadCompleteNoError,      nullptr,                                    nullptr },
+    };
+    for (size_t i=0; i<sizeof(rgUploadStateMachine)/sizeof(rgUploadStateMachine[0]); i++) {
+        _rgStateMachine.append(rgUploadStateMachine[i]);
+    }
+
+    qCDebug(FTPManagerLog) << "_uploadState.fullPathOnVehicle:size" << _uploadState.fullPathOnVehicle << _uploadState.fileData.size();
+
+    _startStateMachine();
+
+    return true;
+}
+
 void FTPManager::cancelDownload()
 {
     if (!_downloadState.inProgress()) {
@@ -197,6 +239,22 @@ void FTPManager::_downloadComplete(const QString& errorMsg)
     emit downloadComplete(downloadFilePath, errorMsg);
 }
 
+/// Closes out an upload sequence
+///     @param errorMsg Error message, empty if no error
+void FTPManager::_uploadComplete(const QString& errorMsg)
+{
+    qCDebug(FTPManagerLog) << QString("_uploadComplete: errorMsg(%1)").arg(errorMsg);
+
+    _ackOrNakTimeoutTimer.stop();
+    _rgStateMachine.clear();
+    _currentStateMachineIndex = -1;
+
+    const QString fromFile = _uploadState.fromFile;
+    _uploadState.reset();
+
+    emit uploadComplete(fromFile, errorMsg);
+}
+
 /// Closes out a list directory sequence
 ///     @param errorMsg Error message, empty if no error
 void FTPManager::_listDirectoryComplete(const QString& errorMsg)
@@ -726,6 +784,221 @@ void FTPManager::_resetSessionsTimeout(void)
     _downloadComplete(QString());
 }
 
+void FTPManager::_createFileBegin(void)
+{
+    MavlinkFTP::Request request{};
+    request.hdr.session = 0;
+    request.hdr.opcode  = MavlinkFTP::kCmdCreateFile;
+    request.hdr.offset  = 0;
+    request.hdr.size    = 0;
+    _fillRequestDataWithString(&request, _uploadState.fullPathOnVehicle);
+    _sendRequestExpectAck(&request);
+}
+
+void FTPManager::_createFileAckOrNak(const MavlinkFTP::Request* ackOrNak)
+{
+    MavlinkFTP::OpCode_t requestOpCode = static_cast<MavlinkFTP::OpCode_t>(ackOrNak->hdr.req_opcode);
+    if (requestOpCode != MavlinkFTP::kCmdCreateFile) {
+        qCDebug(FTPManagerLog) << "_createFileAckOrNak: Ack disregarding ack for incorrect requestOpCode" << MavlinkFTP::opCodeToString(requestOpCode);
+        return;
+    }
+    if (ackOrNak->hdr.seqNumber != _expectedIncomingSeqNumber) {
+        qCDebug(FTPManagerLog) << "_createFileAckOrNak: Ack disregarding ack for incorrect sequence actual:expected" << ackOrNak->hdr.seqNumber << _expectedIncomingSeqNumber;
+        return;
+    }
+
+    _ackOrNakTimeoutTimer.stop();
+
+    if (ackOrNak->hdr.opcode == MavlinkFTP::kRspAck) {
+        qCDebug(FTPManagerLog) << "_createFileAckOrNak: Ack - sessionId" << ackOrNak->hdr.session;
+        _uploadState.sessionId = ackOrNak->hdr.session;
+        _advanceStateMachine();
+    } else if (ackOrNak->hdr.opcode == MavlinkFTP::kRspNak) {
+        qCDebug(FTPManagerLog) << "_createFileAckOrNak: Nak -" << _errorMsgFromNak(ackOrNak);
+        _uploadComplete(tr("Upload failed") + ": " + _errorMsgFromNak(ackOrNak));
+    }
+}
+
+void FTPManager::_createFileTimeout(void)
+{
+    // Creating the file again would leak the session of the first request in case only the ack was lost. That
+    // session is unknown, so all sessions are reset.
+    qCDebug(FTPManagerLog) << "_createFileTimeout";
+    _abortUpload(tr("Upload failed"), true /* resetSessions */);
+}
+
+void FTPManager::_writeFileWorker(bool firstRequest)
+{
+    MavlinkFTP::Request request{};
+
+    const uint32_t cBytesToWrite = qMin(static_cast<uint32_t>(sizeof(request.data)), static_cast<uint32_t>(_uploadState.fileData.size()) - _uploadState.offset);
+
+    qCDebug(FTPManagerLog) << "_writeFileWorker: offset:cBytesToWrite:firstRequest:retryCount" << _uploadState.offset << cBytesToWrite << firstRequest << _uploadState.retryCount;
+
+    request.hdr.session = _uploadState.sessionId;
+    request.hdr.opcode  = MavlinkFTP::kCmdWriteFile;
+    request.hdr.offset  = _uploadState.offset;
+    request.hdr.size    = static_cast<uint8_t>(cBytesToWrite);
+    memcpy(request.data, _uploadState.fileData.constData() + _uploadState.offset, cBytesToWrite);
+
+    if (firstRequest) {
+        _uploadState.retryCount = 0;
+    } else {
+        // Must used same sequence number as previous request
+        _expectedIncomingSeqNumber -= 2;
+    }
+
+    _sendRequestExpectAck(&request);
+}
+
+void FTPManager::_writeFileBegin(void)
+{
+    if (_uploadState.fileData.isEmpty()) {
+        // Nothing to write, the create already truncated the file
+        _advanceStateMachine();
+    } else {
+        _writeFileWorker(true /* firstRequest */);
+    }
+}
+
+void FTPManager::_writeFileAckOrNak(const MavlinkFTP::Request* ackOrNak)
+{
+    MavlinkFTP::OpCode_t requestOpCode = static_cast<MavlinkFTP::OpCode_t>(ackOrNak->hdr.req_opcode);
+
+    if (requestOpCode != MavlinkFTP::kCmdWriteFile) {
+        qCDebug(FTPManagerLog) << "_writeFileAckOrNak: Disregarding due to incorrect requestOpCode" << MavlinkFTP::opCodeToString(requestOpCode);
+        return;
+    }
+    if (ackOrNak->hdr.seqNumber != _expectedIncomingSeqNumber) {
+        qCDebug(FTPManagerLog) << "_writeFileAckOrNak: Disregarding due to incorrect sequence actual:expected" << ackOrNak->hdr.seqNumber << _expectedIncomingSeqNumber;
+        return;
+    }
+    if (ackOrNak->hdr.session != _uploadState.sessionId) {
+        qCDebug(FTPManagerLog) << "_writeFileAckOrNak: Disregarding due to incorrect session id actual:expected" << ackOrNak->hdr.session << _uploadState.sessionId;
+        return;
+    }
+
+    _ackOrNakTimeoutTimer.stop();
+
+    if (ackOrNak->hdr.opcode == MavlinkFTP::kRspAck) {
+        _uploadState.offset += qMin(static_cast<uint32_t>(sizeof(ackOrNak->data)), static_cast<uint32_t>(_uploadState.fileData.size()) - _uploadState.offset);
+
+        qCDebug(FTPManagerLog) << "_writeFileAckOrNak: Ack offset" << _uploadState.offset;
+
+        const float progress = static_cast<float>(_uploadState.offset) / static_cast<float>(_uploadState.fileData.size());
+        if (_uploadState.offset >= static_cast<uint32_t>(_uploadState.fileData.size())) {
+            _uploadState.retryCount = 0;
+            _advanceStateMachine();
+        } else {
+            _writeFileWorker(true /* firstRequest */);
+        }
+
+        // Emit progress last, as cancel could be called in there
+        emit commandProgress(progress);
+    } else if (ackOrNak->hdr.opcode == MavlinkFTP::kRspNak) {
+        qCDebug(FTPManagerLog) << "_writeFileAckOrNak: Nak -" << _errorMsgFromNak(ackOrNak);
+        _abortUpload(tr("Upload failed") + ": " + _errorMsgFromNak(ackOrNak), false /* resetSessions */);
+    }
+}
+
+void FTPManager::_writeFileTimeout(void)
+{
+    if (++_uploadState.retryCount > _maxRetry) {
+        qCDebug(FTPManagerLog) << QString("_writeFileTimeout retries exceeded");
+        _abortUpload(tr("Upload failed"), false /* resetSessions */);
+    } else {
+        // Writing the same block again is harmless
+        qCDebug(FTPManagerLog) << QString("_writeFileTimeout: retrying - retryCount(%1) offset(%2)").arg(_uploadState.retryCount).arg(_uploadState.offset);
+        _writeFileWorker(false /* firstReqeust */);
+    }
+}
+
+void FTPManager::_closeUploadBegin(void)
+{
+    MavlinkFTP::Request request{};
+    request.hdr.session = _uploadState.sessionId;
+    request.hdr.opcode  = MavlinkFTP::kCmdTerminateSession;
+    _sendRequestExpectAck(&request);
+}
+
+void FTPManager::_closeUploadAckOrNak(const MavlinkFTP::Request* ackOrNak)
+{
+    MavlinkFTP::OpCode_t requestOpCode = static_cast<MavlinkFTP::OpCode_t>(ackOrNak->hdr.req_opcode);
+    if (requestOpCode != MavlinkFTP::kCmdTerminateSession) {
+        qCDebug(FTPManagerLog) << "_closeUploadAckOrNak: Ack disregarding ack for incorrect requestOpCode" << MavlinkFTP::opCodeToString(requestOpCode);
+        return;
+    }
+    if (ackOrNak->hdr.seqNumber != _expectedIncomingSeqNumber) {
+        qCDebug(FTPManagerLog) << "_closeUploadAckOrNak: Ack disregarding ack for incorrect sequence actual:expected" << ackOrNak->hdr.seqNumber << _expectedIncomingSeqNumber;
+        return;
+    }
+
+    _ackOrNakTimeoutTimer.stop();
+
+    if (ackOrNak->hdr.opcode == MavlinkFTP::kRspAck) {
+        _advanceStateMachine();
+    } else if (ackOrNak->hdr.opcode == MavlinkFTP::kRspNak) {
+        // Some components only validate the file contents once it is closed
+        qCDebug(FTPManagerLog) << "_closeUploadAckOrNak: Nak -" << _errorMsgFromNak(ackOrNak);
+        _uploadComplete(tr("Upload failed") + ": " + _errorMsgFromNak(ackOrNak));
+    }
+}
+
+void FTPManager::_closeUploadTimeout(void)
+{
+    if (++_uploadState.retryCount > _maxRetry) {
+        qCDebug(FTPManagerLog) << QString("_closeUploadTimeout retries exceeded");
+        _uploadComplete(tr("Upload failed"));
+    } else {
+        // Try again
+        qCDebug(FTPManagerLog) << QString("_closeUploadTimeout: retrying - retryCount(%1)").arg(_uploadState.retryCount);
+        _expectedIncomingSeqNumber -= 2;
+        _closeUploadBegin();
+    }
+}
+
+void FTPManager::_abortUpload(const QString& errorMsg, bool resetSessions)
+{
+    qCDebug(FTPManagerLog) << "_abortUpload: resetSessions" << resetSessions << errorMsg;
+
+    _ackOrNakTimeoutTimer.stop();
+    _rgStateMachine.clear();
+    _uploadState.errorMsg = errorMsg;
+
+    if (resetSessions) {
+        _rgStateMachine.append({ &FTPManager::_resetSessionsBegin,    &FTPManager::_abortUploadAckOrNak,  &FTPManager::_abortUploadTimeout });
+    } else {
+        _rgStateMachine.append({ &FTPManager::_closeUploadBegin,      &FTPManager::_abortUploadAckOrNak,  &FTPManager::_abortUploadTimeout });
+    }
+    _rgStateMachine.append({ &FTPManager::_abortUploadComplete, nullptr, nullptr });
+
+    _startStateMachine();
+}
+
+void FTPManager::_abortUploadAckOrNak(const MavlinkFTP::Request* ackOrNak)
+{
+    MavlinkFTP::OpCode_t requestOpCode = static_cast<MavlinkFTP::OpCode_t>(ackOrNak->hdr.req_opcode);
+    if ((requestOpCode != MavlinkFTP::kCmdTerminateSession) && (requestOpCode != MavlinkFTP::kCmdResetSessions)) {
+        qCDebug(FTPManagerLog) << "_abortUploadAckOrNak: Disregarding due to incorrect requestOpCode" << MavlinkFTP::opCodeToString(requestOpCode);
+        return;
+    }
+    if (ackOrNak->hdr.seqNumber != _expectedIncomingSeqNumber) {
+        qCDebug(FTPManagerLog) << "_abortUploadAckOrNak: Disregarding due to incorrect sequence actual:expected" << ackOrNak->hdr.seqNumber << _expectedIncomingSeqNumber;
+        return;
+    }
+
+    // The upload failed either way, a Nak only means the vehicle had already dropped the session
+    _ackOrNakTimeoutTimer.stop();
+    _advanceStateMachine();
+}
+
+void FTPManager::_abortUploadTimeout(void)
+{
+    // Not retried, the upload already failed and the vehicle times out stale sessions on its own
+    qCDebug(FTPManagerLog) << "_abortUploadTimeout";
+    _advanceStateMachine();
+}
+
 void FTPManager::_sendRequestExpectAck(MavlinkFTP::Request* request)
 {
     _ackOrNakTimeoutTimer.start();
@@ -52,6 +52,15 @@ class FTPManager : public QObject
     /// Signals listDirectoryComplete
     bool listDirectory(uint8_t fromCompId, const QString& fromURI);
 
+    /// Uploads the specified file, replacing the file on the vehicle if it already exists.
+    ///     @param toCompId   Component id of the component to upload to. If toCompId is MAV_COMP_ID_ALL, then MAV_COMP_ID_AUTOPILOT1 is used.
+    ///     @param toURI      File to create on the component, fully qualified path. May be in the format "mftp://[;comp=<id>]..." where the component id
+    ///                       is specified. If component id is not specified, then the id set via toCompId is used.
+    ///     @param fromFile   Local file to upload
+    /// @return true: upload has started, false: error, no upload
+    /// Signals uploadComplete, commandProgress
+    bool upload(uint8_t toCompId, const QString& toURI, const QString& fromFile);
+
     /// Cancel the download operation
     /// This will emit downloadComplete() when done, and if there's currently a download in progress
     void cancelDownload();
@@ -61,6 +70,7 @@ class FTPManager : public QObject
 signals:
     void downloadComplete       (const QString& file, const QString& errorMsg);
     void listDirectoryComplete  (const QStringList& dirList, const QString& errorMsg);
+    void uploadComplete         (const QString& file, const QString& errorMsg);
 
     /// Signalled during a lengthy command to show progress
     ///     @param value Amount of progress: 0.0 = none, 1.0 = complete
@@ -131,6 +141,26 @@ private slots:
         }
     };
 
+    struct UploadState_t {
+        uint8_t     sessionId;
+        uint32_t    offset;                 ///< offset of the next block to write
+        QString     fullPathOnVehicle;      ///< Fully qualified path to file on vehicle
+        QString     fromFile;               ///< Local file being uploaded
+        QByteArray  fileData;               ///< Contents of the local file
+        int         retryCount;
+        QString     errorMsg;               ///< Error reported once a failed upload closed its session
+
+        void reset() {
+            sessionId       = 0;
+            offset          = 0;
+            retryCount      = 0;
+            fullPathOnVehicle.clear();
+            fromFile.clear();
+            fileData.clear();
+            errorMsg.clear();
+        }
+    };
+
     void    _mavlinkMessageReceived     (const mavlink_message_t& message);
     void    _startStateMachine          (void);
     void    _advanceStateMachine        (void);
@@ -167,11 +197,31 @@ private slots:
     void    _terminateSessionTimeout    (void);
     void    _terminateComplete          (void);
 
+    void    _createFileBegin            (void);
+    void    _createFileAckOrNak         (const MavlinkFTP::Request* ackOrNak);
+    void    _createFileTimeout          (void);
+    void    _writeFileBegin             (void);
+    void    _writeFileAckOrNak          (const MavlinkFTP::Request* ackOrNak);
+    void    _writeFileTimeout           (void);
+    void    _writeFileWorker            (bool firstRequest);
+    void    _closeUploadBegin           (void);
+    void    _closeUploadAckOrNak        (const MavlinkFTP::Request* ackOrNak);
+    void    _closeUploadTimeout         (void);
+    void    _uploadCompleteNoError      (void) { _uploadComplete(QString()); }
+    /// Closes the session of a failed upload before reporting the error
+    ///     @param resetSessions true: session id is unknown, all sessions are reset instead of terminating it
+    void    _abortUpload                (const QString& errorMsg, bool resetSessions);
+    void    _abortUploadAckOrNak        (const MavlinkFTP::Request* ackOrNak);
+    void    _abortUploadTimeout         (void);
+    void    _abortUploadComplete        (void) { _uploadComplete(_uploadState.errorMsg); }
+    void    _uploadComplete             (const QString& errorMsg);
+
     Vehicle*                _vehicle;
     uint8_t                 _ftpCompId = MAV_COMP_ID_AUTOPILOT1;
     QList<StateFunctions_t> _rgStateMachine;
     DownloadState_t         _downloadState;
     ListDirectoryState_t    _listDirectoryState;
+    UploadState_t           _uploadState;
     QTimer                  _ackOrNakTimeoutTimer;
     int                     _currentStateMachineIndex   = -1;
     uint16_t                _expectedIncomingSeqNumber  = 0;
@@ -15,6 +15,15 @@ BatteryFactGroupListModel::BatteryFactGroupListModel(QObject* parent)
 
 }
 
+QList<uint32_t> BatteryFactGroupListModel::creationMessageIds() const
+{
+    return {
+        MAVLINK_MSG_ID_HIGH_LATENCY,
+        MAVLINK_MSG_ID_HIGH_LATENCY2,
+        MAVLINK_MSG_ID_BATTERY_STATUS
+    };
+}
+
 bool BatteryFactGroupListModel::_shouldHandleMessage(const mavlink_message_t &message, QList<uint32_t> &ids) const
 {
     ids.clear();
@@ -71,6 +80,15 @@ BatteryFactGroup::BatteryFactGroup(uint32_t batteryId, QObject *parent)
     (void) connect(&_timeRemainingFact, &Fact::rawValueChanged, this, &BatteryFactGroup::_timeRemainingChanged);
 }
 
+QList<uint32_t> BatteryFactGroup::handledMessageIds() const
+{
+    return {
+        MAVLINK_MSG_ID_HIGH_LATENCY,
+        MAVLINK_MSG_ID_HIGH_LATENCY2,
+        MAVLINK_MSG_ID_BATTERY_STATUS
+    };
+}
+
 void BatteryFactGroup::handleMessage(Vehicle *vehicle, const mavlink_message_t &message)
 {
     switch (message.msgid) {
@@ -20,6 +20,9 @@ class BatteryFactGroupListModel : public FactGroupListModel
 public:
     explicit BatteryFactGroupListModel(QObject* parent = nullptr);
 
+    // Overrides from FactGroupListModel
+    QList<uint32_t> creationMessageIds() const final;
+
 protected:
     // Overrides from FactGroupListModel
     bool _shouldHandleMessage(const mavlink_message_t &message, QList<uint32_t> &ids) const final;
@@ -58,6 +61,7 @@ class BatteryFactGroup : public FactGroupWithId
 
     // Overrides from FactGroup
     void handleMessage(Vehicle *vehicle, const mavlink_message_t &message) final;
+    QList<uint32_t> handledMessageIds() const final;
 
 private slots:
     void _timeRemainingChanged(const QVariant &value);
@@ -20,6 +20,9 @@ class EscStatusFactGroupListModel : public FactGroupListModel
 public:
     explicit EscStatusFactGroupListModel(QObject* parent = nullptr);
 
+    // Overrides from FactGroupListModel
+    QList<uint32_t> creationMessageIds() const final;
+
 protected:
     // Overrides from FactGroupListModel
     bool _shouldHandleMessage(const mavlink_message_t &message, QList<uint32_t> &ids) const final;
@@ -55,6 +58,7 @@ class EscStatusFactGroup : public FactGroupWithId
 
     // Overrides from FactGroup
     void handleMessage(Vehicle *vehicle, const mavlink_message_t &message) final;
+    QList<uint32_t> handledMessageIds() const final;
 
 private:
     void _handleEscInfo(Vehicle *vehicle, const mavlink_message_t &message);
@@ -23,6 +23,9 @@ class TerrainFactGroup : public FactGroup
     Fact *blocksPending() { return &_blocksPendingFact; }
     Fact *blocksLoaded() { return &_blocksLoadedFact; }
 
+    // Overrides from FactGroup
+    QList<uint32_t> handledMessageIds() const final { return {}; }
+
 private:
     Fact _blocksPendingFact = Fact(0, QStringLiteral("blocksPending"), FactMetaData::valueTypeDouble);
     Fact _blocksLoadedFact = Fact(0, QStringLiteral("blocksLoaded"), FactMetaData::valueTypeDouble);
@@ -20,6 +20,8 @@ VehicleClockFactGroup::VehicleClockFactGroup(QObject *parent)
     _currentTimeFact.setRawValue(QTime().toString());
     _currentUTCTimeFact.setRawValue(std::numeric_limits<float>::quiet_NaN());
     _currentDateFact.setRawValue(std::numeric_limits<float>::quiet_NaN());
+
+    _setPeriodicUpdates(true);
 }
 
 void VehicleClockFactGroup::_updateAllValues()
@@ -29,6 +31,4 @@ void VehicleClockFactGroup::_updateAllValues()
     currentDate()->setRawValue(QDateTime::currentDateTime().toString(qgcApp()->getCurrentLanguage().dateFormat(QLocale::ShortFormat)));
 
     _setTelemetryAvailable(true);
-
-    FactGroup::_updateAllValues();
 }
@@ -50,6 +50,13 @@ VehicleEFIFactGroup::VehicleEFIFactGroup(QObject *parent)
     _ptCompFact.setRawValue(qQNaN());
 }
 
+QList<uint32_t> VehicleEFIFactGroup::handledMessageIds() const
+{
+    return {
+        MAVLINK_MSG_ID_EFI_STATUS
+    };
+}
+
 void VehicleEFIFactGroup::handleMessage(Vehicle *vehicle, const mavlink_message_t &message)
 {
     Q_UNUSED(vehicle);
@@ -57,6 +57,7 @@ class VehicleEFIFactGroup : public FactGroup
 
     // Overrides from FactGroup
     void handleMessage(Vehicle *vehicle, const mavlink_message_t &message) final;
+    QList<uint32_t> handledMessageIds() const final;
 
 private:
     void _handleEFIStatus(const mavlink_message_t &message);
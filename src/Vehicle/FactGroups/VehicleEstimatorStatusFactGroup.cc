@@ -35,6 +35,13 @@ VehicleEstimatorStatusFactGroup::VehicleEstimatorStatusFactGroup(QObject *parent
     _addFact(&_vertPosAccuracyFact);
 }
 
+QList<uint32_t> VehicleEstimatorStatusFactGroup::handledMessageIds() const
+{
+    return {
+        MAVLINK_MSG_ID_ESTIMATOR_STATUS
+    };
+}
+
 void VehicleEstimatorStatusFactGroup::handleMessage(Vehicle *vehicle, const mavlink_message_t &message)
 {
     Q_UNUSED(vehicle);
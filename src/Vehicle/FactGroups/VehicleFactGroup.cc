@@ -52,6 +52,23 @@ VehicleFactGroup::VehicleFactGroup(QObject *parent)
     _hobbsFact.setRawValue(QStringLiteral("0000:00:00"));
 }
 
+QList<uint32_t> VehicleFactGroup::handledMessageIds() const
+{
+    QList<uint32_t> messageIds = {
+        MAVLINK_MSG_ID_ATTITUDE,
+        MAVLINK_MSG_ID_ATTITUDE_QUATERNION,
+        MAVLINK_MSG_ID_ALTITUDE,
+        MAVLINK_MSG_ID_VFR_HUD,
+        MAVLINK_MSG_ID_NAV_CONTROLLER_OUTPUT,
+        MAVLINK_MSG_ID_RAW_IMU
+    };
+#ifndef QGC_NO_ARDUPILOT_DIALECT
+    messageIds.append(MAVLINK_MSG_ID_RANGEFINDER);
+#endif
+
+    return messageIds;
+}
+
 void VehicleFactGroup::handleMessage(Vehicle *vehicle, const mavlink_message_t &message)
 {
     switch (message.msgid) {
@@ -99,9 +116,9 @@ void VehicleFactGroup::_handleAttitudeWorker(double rollRadians, double pitchRad
     // truncate to integer so widget never displays 360
     yawDegrees = trunc(yawDegrees);
 
-    roll()->setRawValue(rollDegrees);
-    pitch()->setRawValue(pitchDegrees);
-    heading()->setRawValue(yawDegrees);
+    roll()->setRawValueDouble(rollDegrees);
+    pitch()->setRawValueDouble(pitchDegrees);
+    heading()->setRawValueDouble(yawDegrees);
 }
 
 void VehicleFactGroup::_handleAttitude(Vehicle *vehicle, const mavlink_message_t &message)
@@ -129,8 +146,8 @@ void VehicleFactGroup::_handleAltitude(const mavlink_message_t &message)
 
     // Data from ALTITUDE message takes precedence over gps messages
     _altitudeMessageAvailable = true;
-    altitudeRelative()->setRawValue(altitude.altitude_relative);
-    altitudeAMSL()->setRawValue(altitude.altitude_amsl);
+    altitudeRelative()->setRawValueDouble(altitude.altitude_relative);
+    altitudeAMSL()->setRawValueDouble(altitude.altitude_amsl);
 
     _setTelemetryAvailable(true);
 }
@@ -163,9 +180,9 @@ void VehicleFactGroup::_handleAttitudeQuaternion(Vehicle *vehicle, const mavlink
 
     _handleAttitudeWorker(attRoll, attPitch, attYaw);
 
-    rollRate()->setRawValue(qRadiansToDegrees(rates[0]));
-    pitchRate()->setRawValue(qRadiansToDegrees(rates[1]));
-    yawRate()->setRawValue(qRadiansToDegrees(rates[2]));
+    rollRate()->setRawValueDouble(qRadiansToDegrees(rates[0]));
+    pitchRate()->setRawValueDouble(qRadiansToDegrees(rates[1]));
+    yawRate()->setRawValueDouble(qRadiansToDegrees(rates[2]));
 
     _setTelemetryAvailable(true);
 }
@@ -175,10 +192,10 @@ void VehicleFactGroup::_handleNavControllerOutput(const mavlink_message_t &messa
     mavlink_nav_controller_output_t navControllerOutput{};
     mavlink_msg_nav_controller_output_decode(&message, &navControllerOutput);
 
-    altitudeTuningSetpoint()->setRawValue(_altitudeTuningFact.rawValue().toDouble() - navControllerOutput.alt_error);
-    xTrackError()->setRawValue(navControllerOutput.xtrack_error);
-    airSpeedSetpoint()->setRawValue(_airSpeedFact.rawValue().toDouble() - navControllerOutput.aspd_error);
-    distanceToNextWP()->setRawValue(navControllerOutput.wp_dist);
+    altitudeTuningSetpoint()->setRawValueDouble(_altitudeTuningFact.rawValue().toDouble() - navControllerOutput.alt_error);
+    xTrackError()->setRawValueDouble(navControllerOutput.xtrack_error);
+    airSpeedSetpoint()->setRawValueDouble(_airSpeedFact.rawValue().toDouble() - navControllerOutput.aspd_error);
+    distanceToNextWP()->setRawValueDouble(navControllerOutput.wp_dist);
 
     _setTelemetryAvailable(true);
 }
@@ -188,16 +205,16 @@ void VehicleFactGroup::_handleVfrHud(const mavlink_message_t &message)
     mavlink_vfr_hud_t vfrHud{};
     mavlink_msg_vfr_hud_decode(&message, &vfrHud);
 
-    airSpeed()->setRawValue(qIsNaN(vfrHud.airspeed) ? 0 : vfrHud.airspeed);
-    groundSpeed()->setRawValue(qIsNaN(vfrHud.groundspeed) ? 0 : vfrHud.groundspeed);
-    climbRate()->setRawValue(qIsNaN(vfrHud.climb) ? 0 : vfrHud.climb);
-    throttlePct()->setRawValue(static_cast<int16_t>(vfrHud.throttle));
+    airSpeed()->setRawValueDouble(qIsNaN(vfrHud.airspeed) ? 0 : vfrHud.airspeed);
+    groundSpeed()->setRawValueDouble(qIsNaN(vfrHud.groundspeed) ? 0 : vfrHud.groundspeed);
+    climbRate()->setRawValueDouble(qIsNaN(vfrHud.climb) ? 0 : vfrHud.climb);
+    throttlePct()->setRawValueInt(static_cast<int16_t>(vfrHud.throttle));
     if (qIsNaN(_altitudeTuningOffset)) {
         _altitudeTuningOffset = vfrHud.alt;
     }
-    altitudeTuning()->setRawValue(vfrHud.alt - _altitudeTuningOffset);
+    altitudeTuning()->setRawValueDouble(vfrHud.alt - _altitudeTuningOffset);
     if (!qIsNaN(vfrHud.groundspeed) && !qIsNaN(_distanceToHomeFact.cookedValue().toDouble())) {
-      timeToHome()->setRawValue(_distanceToHomeFact.cookedValue().toDouble() / vfrHud.groundspeed);
+      timeToHome()->setRawValueDouble(_distanceToHomeFact.cookedValue().toDouble() / vfrHud.groundspeed);
     }
 
     _setTelemetryAvailable(true);
@@ -208,7 +225,7 @@ void VehicleFactGroup::_handleRawImuTemp(const mavlink_message_t &message)
     mavlink_raw_imu_t imuRaw{};
     mavlink_msg_raw_imu_decode(&message, &imuRaw);
 
-    imuTemp()->setRawValue((imuRaw.temperature == 0) ? 0 : (imuRaw.temperature * 0.01));
+    imuTemp()->setRawValueDouble((imuRaw.temperature == 0) ? 0 : (imuRaw.temperature * 0.01));
 
     _setTelemetryAvailable(true);
 }
@@ -219,7 +236,7 @@ void VehicleFactGroup::_handleRangefinder(const mavlink_message_t &message)
     mavlink_rangefinder_t rangefinder{};
     mavlink_msg_rangefinder_decode(&message, &rangefinder);
 
-    rangeFinderDist()->setRawValue(qIsNaN(rangefinder.distance) ? 0 : rangefinder.distance);
+    rangeFinderDist()->setRawValueDouble(qIsNaN(rangefinder.distance) ? 0 : rangefinder.distance);
 
     _setTelemetryAvailable(true);
 }
@@ -35,6 +35,15 @@ VehicleGPSFactGroup::VehicleGPSFactGroup(QObject *parent)
     _yawFact.setRawValue(std::numeric_limits<int16_t>::quiet_NaN());
 }
 
+QList<uint32_t> VehicleGPSFactGroup::handledMessageIds() const
+{
+    return {
+        MAVLINK_MSG_ID_GPS_RAW_INT,
+        MAVLINK_MSG_ID_HIGH_LATENCY,
+        MAVLINK_MSG_ID_HIGH_LATENCY2
+    };
+}
+
 void VehicleGPSFactGroup::handleMessage(Vehicle *vehicle, const mavlink_message_t &message)
 {
     Q_UNUSED(vehicle);
@@ -59,15 +68,15 @@ void VehicleGPSFactGroup::_handleGpsRawInt(const mavlink_message_t &message)
     mavlink_gps_raw_int_t gpsRawInt{};
     mavlink_msg_gps_raw_int_decode(&message, &gpsRawInt);
 
-    lat()->setRawValue(gpsRawInt.lat * 1e-7);
-    lon()->setRawValue(gpsRawInt.lon * 1e-7);
+    lat()->setRawValueDouble(gpsRawInt.lat * 1e-7);
+    lon()->setRawValueDouble(gpsRawInt.lon * 1e-7);
     mgrs()->setRawValue(QGCGeo::convertGeoToMGRS(QGeoCoordinate(gpsRawInt.lat * 1e-7, gpsRawInt.lon * 1e-7)));
-    count()->setRawValue((gpsRawInt.satellites_visible == 255) ? 0 : gpsRawInt.satellites_visible);
-    hdop()->setRawValue((gpsRawInt.eph == UINT16_MAX) ? qQNaN() : (gpsRawInt.eph / 100.0));
-    vdop()->setRawValue((gpsRawInt.epv == UINT16_MAX) ? qQNaN() : (gpsRawInt.epv / 100.0));
-    courseOverGround()->setRawValue((gpsRawInt.cog == UINT16_MAX) ? qQNaN() : (gpsRawInt.cog / 100.0));
-    yaw()->setRawValue((gpsRawInt.yaw == UINT16_MAX) ? qQNaN() : (gpsRawInt.yaw / 100.0));
-    lock()->setRawValue(gpsRawInt.fix_type);
+    count()->setRawValueInt((gpsRawInt.satellites_visible == 255) ? 0 : gpsRawInt.satellites_visible);
+    hdop()->setRawValueDouble((gpsRawInt.eph == UINT16_MAX) ? qQNaN() : (gpsRawInt.eph / 100.0));
+    vdop()->setRawValueDouble((gpsRawInt.epv == UINT16_MAX) ? qQNaN() : (gpsRawInt.epv / 100.0));
+    courseOverGround()->setRawValueDouble((gpsRawInt.cog == UINT16_MAX) ? qQNaN() : (gpsRawInt.cog / 100.0));
+    yaw()->setRawValueDouble((gpsRawInt.yaw == UINT16_MAX) ? qQNaN() : (gpsRawInt.yaw / 100.0));
+    lock()->setRawValueInt(gpsRawInt.fix_type);
 
     _setTelemetryAvailable(true);
 }
@@ -77,10 +86,10 @@ void VehicleGPSFactGroup::_handleHighLatency(const mavlink_message_t &message)
     mavlink_high_latency_t highLatency{};
     mavlink_msg_high_latency_decode(&message, &highLatency);
 
-    lat()->setRawValue(highLatency.latitude * 1e-7);
-    lon()->setRawValue(highLatency.longitude * 1e-7);
+    lat()->setRawValueDouble(highLatency.latitude * 1e-7);
+    lon()->setRawValueDouble(highLatency.longitude * 1e-7);
     mgrs()->setRawValue(QGCGeo::convertGeoToMGRS(QGeoCoordinate(highLatency.latitude * 1e-7, highLatency.longitude * 1e-7, highLatency.altitude_amsl)));
-    count()->setRawValue(0);
+    count()->setRawValueInt(0);
 
     _setTelemetryAvailable(true);
 }
@@ -90,12 +99,12 @@ void VehicleGPSFactGroup::_handleHighLatency2(const mavlink_message_t &message)
     mavlink_high_latency2_t highLatency2{};
     mavlink_msg_high_latency2_decode(&message, &highLatency2);
 
-    lat()->setRawValue(highLatency2.latitude * 1e-7);
-    lon()->setRawValue(highLatency2.longitude * 1e-7);
+    lat()->setRawValueDouble(highLatency2.latitude * 1e-7);
+    lon()->setRawValueDouble(highLatency2.longitude * 1e-7);
     mgrs()->setRawValue(QGCGeo::convertGeoToMGRS(QGeoCoordinate(highLatency2.latitude * 1e-7, highLatency2.longitude * 1e-7, highLatency2.altitude)));
-    count()->setRawValue(0);
-    hdop()->setRawValue((highLatency2.eph == UINT8_MAX) ? qQNaN() : (highLatency2.eph / 10.0));
-    vdop()->setRawValue((highLatency2.epv == UINT8_MAX) ? qQNaN() : (highLatency2.epv / 10.0));
+    count()->setRawValueInt(0);
+    hdop()->setRawValueDouble((highLatency2.eph == UINT8_MAX) ? qQNaN() : (highLatency2.eph / 10.0));
+    vdop()->setRawValueDouble((highLatency2.epv == UINT8_MAX) ? qQNaN() : (highLatency2.epv / 10.0));
 
     _setTelemetryAvailable(true);
 }
@@ -40,6 +40,13 @@ VehicleGeneratorFactGroup::VehicleGeneratorFactGroup(QObject *parent)
     (void) connect(status(), &Fact::rawValueChanged, this,& VehicleGeneratorFactGroup::_updateGeneratorFlags);
 }
 
+QList<uint32_t> VehicleGeneratorFactGroup::handledMessageIds() const
+{
+    return {
+        MAVLINK_MSG_ID_GENERATOR_STATUS
+    };
+}
+
 void VehicleGeneratorFactGroup::handleMessage(Vehicle *vehicle, const mavlink_message_t &message)
 {
     Q_UNUSED(vehicle);
@@ -28,6 +28,13 @@ VehicleLocalPositionSetpointFactGroup::VehicleLocalPositionSetpointFactGroup(QOb
     _vzFact.setRawValue(qQNaN());
 }
 
+QList<uint32_t> VehicleLocalPositionSetpointFactGroup::handledMessageIds() const
+{
+    return {
+        MAVLINK_MSG_ID_POSITION_TARGET_LOCAL_NED
+    };
+}
+
 void VehicleLocalPositionSetpointFactGroup::handleMessage(Vehicle *vehicle, const mavlink_message_t &message)
 {
     Q_UNUSED(vehicle);
@@ -39,13 +46,13 @@ void VehicleLocalPositionSetpointFactGroup::handleMessage(Vehicle *vehicle, cons
     mavlink_position_target_local_ned_t localPosition{};
     mavlink_msg_position_target_local_ned_decode(&message, &localPosition);
 
-    x()->setRawValue(localPosition.x);
-    y()->setRawValue(localPosition.y);
-    z()->setRawValue(localPosition.z);
+    x()->setRawValueDouble(localPosition.x);
+    y()->setRawValueDouble(localPosition.y);
+    z()->setRawValueDouble(localPosition.z);
 
-    vx()->setRawValue(localPosition.vx);
-    vy()->setRawValue(localPosition.vy);
-    vz()->setRawValue(localPosition.vz);
+    vx()->setRawValueDouble(localPosition.vx);
+    vy()->setRawValueDouble(localPosition.vy);
+    vz()->setRawValueDouble(localPosition.vz);
 
     _setTelemetryAvailable(true);
 }
@@ -25,6 +25,13 @@ VehicleVibrationFactGroup::VehicleVibrationFactGroup(QObject *parent)
     _zAxisFact.setRawValue(qQNaN());
 }
 
+QList<uint32_t> VehicleVibrationFactGroup::handledMessageIds() const
+{
+    return {
+        MAVLINK_MSG_ID_VIBRATION
+    };
+}
+
 void VehicleVibrationFactGroup::handleMessage(Vehicle *vehicle, const mavlink_message_t &message)
 {
     Q_UNUSED(vehicle);
@@ -36,12 +43,12 @@ void VehicleVibrationFactGroup::handleMessage(Vehicle *vehicle, const mavlink_me
     mavlink_vibration_t vibration{};
     mavlink_msg_vibration_decode(&message, &vibration);
 
-    xAxis()->setRawValue(vibration.vibration_x);
-    yAxis()->setRawValue(vibration.vibration_y);
-    zAxis()->setRawValue(vibration.vibration_z);
-    clipCount1()->setRawValue(vibration.clipping_0);
-    clipCount2()->setRawValue(vibration.clipping_1);
-    clipCount3()->setRawValue(vibration.clipping_2);
+    xAxis()->setRawValueDouble(vibration.vibration_x);
+    yAxis()->setRawValueDouble(vibration.vibration_y);
+    zAxis()->setRawValueDouble(vibration.vibration_z);
+    clipCount1()->setRawValueInt(vibration.clipping_0);
+    clipCount2()->setRawValueInt(vibration.clipping_1);
+    clipCount3()->setRawValueInt(vibration.clipping_2);
 
     _setTelemetryAvailable(true);
 }
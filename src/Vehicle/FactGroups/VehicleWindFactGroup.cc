@@ -24,6 +24,20 @@ VehicleWindFactGroup::VehicleWindFactGroup(QObject *parent)
     _verticalSpeedFact.setRawValue(qQNaN());
 }
 
+QList<uint32_t> VehicleWindFactGroup::handledMessageIds() const
+{
+    QList<uint32_t> messageIds = {
+        MAVLINK_MSG_ID_WIND_COV,
+        MAVLINK_MSG_ID_HIGH_LATENCY,
+        MAVLINK_MSG_ID_HIGH_LATENCY2
+    };
+#ifndef QGC_NO_ARDUPILOT_DIALECT
+    messageIds.append(MAVLINK_MSG_ID_WIND);
+#endif
+
+    return messageIds;
+}
+
 void VehicleWindFactGroup::handleMessage(Vehicle *vehicle, const mavlink_message_t &message)
 {
     Q_UNUSED(vehicle);
@@ -53,7 +67,7 @@ void VehicleWindFactGroup::_handleHighLatency(const mavlink_message_t &message)
     mavlink_high_latency_t highLatency{};
     mavlink_msg_high_latency_decode(&message, &highLatency);
 
-    speed()->setRawValue(static_cast<double>(highLatency.airspeed) / 5.0);
+    speed()->setRawValueDouble(static_cast<double>(highLatency.airspeed) / 5.0);
 
     _setTelemetryAvailable(true);
 }
@@ -63,8 +77,8 @@ void VehicleWindFactGroup::_handleHighLatency2(const mavlink_message_t &message)
     mavlink_high_latency2_t highLatency2{};
     mavlink_msg_high_latency2_decode(&message, &highLatency2);
 
-    direction()->setRawValue(static_cast<double>(highLatency2.wind_heading) * 2.0);
-    speed()->setRawValue(static_cast<double>(highLatency2.windspeed) / 5.0);
+    direction()->setRawValueDouble(static_cast<double>(highLatency2.wind_heading) * 2.0);
+    speed()->setRawValueDouble(static_cast<double>(highLatency2.windspeed) / 5.0);
 
     _setTelemetryAvailable(true);
 }
@@ -78,12 +92,12 @@ void VehicleWindFactGroup::_handleWindCov(const mavlink_message_t &message)
     if (windDirection < 0) {
         windDirection += 360;
     }
-    direction()->setRawValue(windDirection);
+    direction()->setRawValueDouble(windDirection);
 
     const float windSpeed = qSqrt(qPow(wind.wind_x, 2) + qPow(wind.wind_y, 2));
-    speed()->setRawValue(windSpeed);
+    speed()->setRawValueDouble(windSpeed);
 
-    verticalSpeed()->setRawValue(wind.wind_z);
+    verticalSpeed()->setRawValueDouble(wind.wind_z);
 
     _setTelemetryAvailable(true);
 }
@@ -99,9 +113,9 @@ void VehicleWindFactGroup::_handleWind(const mavlink_message_t &message)
     if (windDirection < 0) {
         windDirection += 360;
     }
-    direction()->setRawValue(windDirection);
-    speed()->setRawValue(wind.speed);
-    verticalSpeed()->setRawValue(wind.speed_z);
+    direction()->setRawValueDouble(windDirection);
+    speed()->setRawValueDouble(wind.speed);
+    verticalSpeed()->setRawValueDouble(wind.speed_z);
 
     _setTelemetryAvailable(true);
 }
@@ -327,7 +327,7 @@ void MultiVehicleManager::_sendGCSHeartbeat()
 
         uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
         const uint16_t len = mavlink_msg_to_send_buffer(buffer, &message);
-        (void) link->writeBytesThreadSafe(reinterpret_cast<const char*>(buffer), len);
+        (void) link->writeBytesThreadSafe(reinterpret_cast<const char*>(buffer), len, LinkSendQueue::PriorityControl);
     }
 }
 
@@ -362,6 +362,60 @@ void Vehicle::_commonInit()
     _gimbalController = new GimbalController(this);
 
     _createCameraManager();
+
+    _registerMessageHandlers();
+}
+
+/// Sets up the message id based routing for the managers and FactGroups which consume incoming messages
+void Vehicle::_registerMessageHandlers()
+{
+    const QList<uint32_t> corePluginMessageIds = QGCCorePlugin::instance()->mavlinkMessageIds();
+    _corePluginAllMessages = corePluginMessageIds.contains(MAVLinkMessageDispatcher::allMessageIds);
+    _corePluginMessageIds = QSet<uint32_t>(corePluginMessageIds.constBegin(), corePluginMessageIds.constEnd());
+
+    _messageDispatcher.registerHandler(_ftpManager, { MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL }, [this](const mavlink_message_t &message) {
+        _ftpManager->_mavlinkMessageReceived(message);
+    });
+    _messageDispatcher.registerHandler(_parameterManager, { MAVLINK_MSG_ID_PARAM_VALUE }, [this](const mavlink_message_t &message) {
+        _parameterManager->mavlinkMessageReceived(message);
+    });
+    _messageDispatcher.registerHandler(_imageProtocolManager, { MAVLINK_MSG_ID_DATA_TRANSMISSION_HANDSHAKE, MAVLINK_MSG_ID_ENCAPSULATED_DATA }, [this](const mavlink_message_t &message) {
+        (void) QMetaObject::invokeMethod(_imageProtocolManager, "mavlinkMessageReceived", Qt::AutoConnection, message);
+    });
+    _messageDispatcher.registerHandler(_remoteIDManager, { MAVLINK_MSG_ID_OPEN_DRONE_ID_ARM_STATUS }, [this](const mavlink_message_t &message) {
+        _remoteIDManager->mavlinkMessageReceived(message);
+    });
+
+    // Dynamic fact group creation must happen before the FactGroups see the message
+    _messageDispatcher.registerHandler(&_batteryFactGroupListModel, _batteryFactGroupListModel.creationMessageIds(), [this](const mavlink_message_t &message) {
+        _batteryFactGroupListModel.handleMessageForFactGroupCreation(this, message);
+    });
+    _messageDispatcher.registerHandler(&_escStatusFactGroupListModel, _escStatusFactGroupListModel.creationMessageIds(), [this](const mavlink_message_t &message) {
+        _escStatusFactGroupListModel.handleMessageForFactGroupCreation(this, message);
+    });
+
+    _registerFactGroupMessageHandlers();
+    (void) connect(this, &FactGroup::factGroupNamesChanged, this, &Vehicle::_registerFactGroupMessageHandlers);
+}
+
+/// Adds routing for FactGroups which have been added since the last call, including the Vehicle itself
+void Vehicle::_registerFactGroupMessageHandlers()
+{
+    QList<FactGroup*> factGroupList = factGroups().values();
+    factGroupList.append(this);
+
+    for (FactGroup *factGroup : factGroupList) {
+        if (_messageDispatcher.isRegistered(factGroup)) {
+            continue;
+        }
+
+        _messageDispatcher.registerHandler(factGroup, factGroup->handledMessageIds(), [this, factGroup](const mavlink_message_t &message) {
+            // Facts only need the newest copy of a high rate state message from each batch
+            if (!MAVLinkProtocol::instance()->receivedSuperseded()) {
+                factGroup->handleMessage(this, message);
+            }
+        });
+    }
 }
 
 Vehicle::~Vehicle()
@@ -432,7 +486,6 @@ void Vehicle::resetCounters()
     _messagesReceived   = 0;
     _messagesSent       = 0;
     _messagesLost       = 0;
-    _messageSeq         = 0;
     _heardFrom          = false;
 }
 
@@ -455,26 +508,17 @@ void Vehicle::_mavlinkMessageReceived(LinkInterface* link, mavlink_message_t mes
     // We give the link manager first whack since it it reponsible for adding new links
     _vehicleLinkManager->mavlinkMessageReceived(link, message);
 
-    //-- Check link status
+    //-- Check link status. Sequence loss is tracked by the decode stage.
     _messagesReceived++;
     emit messagesReceivedChanged();
     if(!_heardFrom) {
         if(message.msgid == MAVLINK_MSG_ID_HEARTBEAT) {
             _heardFrom  = true;
             _compID     = message.compid;
-            _messageSeq = message.seq + 1;
         }
     } else {
         if(_compID == message.compid) {
-            uint16_t seq_received = static_cast<uint16_t>(message.seq);
-            uint16_t packet_lost_count = 0;
-            //-- Account for overflow during packet loss
-            if(seq_received < _messageSeq) {
-                packet_lost_count = (seq_received + 255) - _messageSeq;
-            } else {
-                packet_lost_count = seq_received - _messageSeq;
-            }
-            _messageSeq = message.seq + 1;
+            const quint32 packet_lost_count = MAVLinkProtocol::instance()->receivedLost();
             _messagesLost += packet_lost_count;
             if(packet_lost_count)
                 emit messagesLostChanged();
@@ -486,31 +530,21 @@ void Vehicle::_mavlinkMessageReceived(LinkInterface* link, mavlink_message_t mes
         return;
     }
 
-    // Give the Core Plugin access to all mavlink traffic
-    if (!QGCCorePlugin::instance()->mavlinkMessage(this, link, message)) {
-        return;
+    // Give the Core Plugin access to the mavlink traffic it asked for
+    if (_corePluginAllMessages || _corePluginMessageIds.contains(message.msgid)) {
+        if (!QGCCorePlugin::instance()->mavlinkMessage(this, link, message)) {
+            return;
+        }
     }
 
     if (!_terrainProtocolHandler->mavlinkMessageReceived(message)) {
         return;
     }
-    _ftpManager->_mavlinkMessageReceived(message);
-    _parameterManager->mavlinkMessageReceived(message);
-    (void) QMetaObject::invokeMethod(_imageProtocolManager, "mavlinkMessageReceived", Qt::AutoConnection, message);
-    _remoteIDManager->mavlinkMessageReceived(message);
-
-    _waitForMavlinkMessageMessageReceivedHandler(message);
-
-    // Handle creation of dynamic fact group lists
-    _batteryFactGroupListModel.handleMessageForFactGroupCreation(this, message);
-    _escStatusFactGroupListModel.handleMessageForFactGroupCreation(this, message);
 
-    // Let the fact groups take a whack at the mavlink traffic
-    for (FactGroup* factGroup : factGroups()) {
-        factGroup->handleMessage(this, message);
-    }
+    // Managers, dynamic fact group lists and fact groups only see the message ids they consume
+    _messageDispatcher.dispatch(message);
 
-    this->handleMessage(this, message);
+    _waitForMavlinkMessageMessageReceivedHandler(message);
 
     switch (message.msgid) {
     case MAVLINK_MSG_ID_HOME_POSITION:
@@ -1478,7 +1512,7 @@ bool Vehicle::sendMessageOnLinkThreadSafe(LinkInterface* link, mavlink_message_t
     uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
     int len = mavlink_msg_to_send_buffer(buffer, &message);
 
-    link->writeBytesThreadSafe((const char*)buffer, len);
+    link->writeBytesThreadSafe((const char*)buffer, len, LinkSendQueue::priorityForMessage(message.msgid));
     _messagesSent++;
     emit messagesSentChanged();
 
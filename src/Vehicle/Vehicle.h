@@ -20,6 +20,7 @@
 #include <QtQmlIntegration/QtQmlIntegration>
 
 #include "HealthAndArmingCheckReport.h"
+#include "MAVLinkMessageDispatcher.h"
 #include "MAVLinkStreamConfig.h"
 #include "QGCMapCircle.h"
 #include "QGCMAVLink.h"
@@ -919,6 +920,7 @@ public slots:
 
 private slots:
     void _mavlinkMessageReceived            (LinkInterface* link, mavlink_message_t message);
+    void _registerFactGroupMessageHandlers  ();
     void _sendMessageMultipleNext           ();
     void _parametersReady                   (bool parametersReady);
     void _remoteControlRSSIChanged          (uint8_t rssi);
@@ -986,6 +988,7 @@ private slots:
     void _handleMavlinkLoggingDataAcked (mavlink_message_t& message);
     void _ackMavlinkLogData             (uint16_t sequence);
     void _commonInit                    ();
+    void _registerMessageHandlers       ();
     void _setupAutoDisarmSignalling     ();
     void _setCapabilities               (uint64_t capabilityBits);
     void _updateArmed                   (bool armed);
@@ -1110,7 +1113,6 @@ private slots:
     uint                _messagesReceived = 0;
     uint                _messagesSent = 0;
     uint                _messagesLost = 0;
-    uint8_t             _messageSeq = 0;
     uint8_t             _compID = 0;
     bool                _heardFrom = false;
 
@@ -1275,6 +1277,11 @@ private slots:
     BatteryFactGroupListModel       _batteryFactGroupListModel;
     EscStatusFactGroupListModel     _escStatusFactGroupListModel;
 
+    /// Routes incoming messages to the managers and FactGroups which consume them
+    MAVLinkMessageDispatcher        _messageDispatcher;
+    QSet<uint32_t>                  _corePluginMessageIds;
+    bool                            _corePluginAllMessages = true;
+
     TerrainProtocolHandler* _terrainProtocolHandler = nullptr;
 
     MissionManager*                 _missionManager             = nullptr;
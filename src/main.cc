@@ -14,6 +14,7 @@
 #include "QGCCommandLineParser.h"
 #include "QGCLogging.h"
 #include "Platform.h"
+#include "TLogAnalyzer.h"
 
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
     #include <QtWidgets/QMessageBox>
@@ -90,6 +91,11 @@ int main(int argc, char *argv[])
 #ifdef QGC_UNITTEST_BUILD
         exitCode = QGCUnitTest::runTests(args.stressUnitTests, args.unitTests);
 #endif
+    } else if (!args.analyzeLogs.isEmpty()) {
+        TLogAnalyzer analyzer(args.analyzeLogs, args.analyzeOutputDir.value_or(QString()), args.analyzeIntervalMSecs);
+        (void) QObject::connect(&analyzer, &TLogAnalyzer::finished, &app, &QCoreApplication::exit);
+        analyzer.start();
+        exitCode = app.exec();
     } else if (!args.simpleBootTest) {
         exitCode = app.exec();
     }
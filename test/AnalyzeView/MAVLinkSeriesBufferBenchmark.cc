@@ -0,0 +1,40 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkSeriesBufferBenchmark.h"
+#include "MAVLinkSeriesBuffer.h"
+
+#include <QtCore/QtMath>
+#include <QtTest/QTest>
+
+void MAVLinkSeriesBufferBenchmark::_benchmarkAppend()
+{
+    constexpr int kSamples = 100000;
+
+    MAVLinkSeriesBuffer buffer;
+    QBENCHMARK {
+        for (int i = 0; i < kSamples; i++) {
+            buffer.append(QPointF(i, qSin(i * 0.01)));
+            (void) buffer.minimum();
+            (void) buffer.maximum();
+        }
+    }
+}
+
+void MAVLinkSeriesBufferBenchmark::_benchmarkDownsample()
+{
+    MAVLinkSeriesBuffer buffer;
+    for (qsizetype i = 0; i < buffer.capacity(); i++) {
+        buffer.append(QPointF(i, qSin(i * 0.01)));
+    }
+
+    QBENCHMARK {
+        (void) buffer.downsample(0, 2000);
+    }
+}
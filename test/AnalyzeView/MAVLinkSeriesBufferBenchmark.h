@@ -0,0 +1,24 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+/// MAVLink Inspector chart history throughput with the running min/max queried after every sample, as the chart does,
+/// and the LTTB downsampling of a full history.
+/// Standalone, run with the benchmark build target or --unittest:MAVLinkSeriesBufferBenchmark.
+class MAVLinkSeriesBufferBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _benchmarkAppend();
+    void _benchmarkDownsample();
+};
@@ -0,0 +1,210 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkSeriesBufferTest.h"
+#include "MAVLinkSeriesBuffer.h"
+
+#include <QtCore/QRandomGenerator>
+#include <QtCore/QtMath>
+#include <QtTest/QTest>
+
+void MAVLinkSeriesBufferTest::_testWrap()
+{
+    MAVLinkSeriesBuffer buffer(4);
+    QVERIFY(buffer.isEmpty());
+    QVERIFY(!buffer.hasRange());
+
+    for (int i = 0; i < 6; i++) {
+        buffer.append(QPointF(i, i * 10));
+    }
+
+    QCOMPARE(buffer.count(), qsizetype(4));
+    QCOMPARE(buffer.totalAppended(), 6ULL);
+    for (qsizetype i = 0; i < buffer.count(); i++) {
+        QCOMPARE(buffer.at(i).x(), static_cast<qreal>(i + 2));
+    }
+
+    const QList<QPointF> newest = buffer.newest(2);
+    QCOMPARE(newest.count(), qsizetype(2));
+    QCOMPARE(newest[0].x(), 4.);
+    QCOMPARE(newest[1].x(), 5.);
+
+    QCOMPARE(buffer.toList().count(), qsizetype(4));
+    QCOMPARE(buffer.toList().first().x(), 2.);
+
+    buffer.clear();
+    QVERIFY(buffer.isEmpty());
+    QCOMPARE(buffer.totalAppended(), 0ULL);
+}
+
+void MAVLinkSeriesBufferTest::_testMinMax()
+{
+    constexpr qsizetype capacity = 37;
+
+    MAVLinkSeriesBuffer buffer(capacity);
+    QRandomGenerator random(1234);
+    for (int i = 0; i < 1000; i++) {
+        // Small value range so equal values are common
+        buffer.append(QPointF(i, random.bounded(20) - 10));
+
+        qreal vmin = buffer.at(0).y();
+        qreal vmax = vmin;
+        for (qsizetype j = 1; j < buffer.count(); j++) {
+            vmin = qMin(vmin, buffer.at(j).y());
+            vmax = qMax(vmax, buffer.at(j).y());
+        }
+
+        QVERIFY(buffer.hasRange());
+        QCOMPARE(buffer.minimum(), vmin);
+        QCOMPARE(buffer.maximum(), vmax);
+    }
+}
+
+void MAVLinkSeriesBufferTest::_testRange()
+{
+    constexpr qsizetype capacity = 37;
+
+    MAVLinkSeriesBuffer buffer(capacity);
+    QRandomGenerator random(4321);
+    for (int i = 0; i < 200; i++) {
+        buffer.append(QPointF(i, random.bounded(20) - 10));
+
+        for (qsizetype first = 0; first < buffer.count(); first++) {
+            qreal vmin = buffer.at(first).y();
+            qreal vmax = vmin;
+            for (qsizetype j = first + 1; j < buffer.count(); j++) {
+                vmin = qMin(vmin, buffer.at(j).y());
+                vmax = qMax(vmax, buffer.at(j).y());
+            }
+
+            qreal rangeMin = 0;
+            qreal rangeMax = 0;
+            QVERIFY(buffer.range(first, rangeMin, rangeMax));
+            QCOMPARE(rangeMin, vmin);
+            QCOMPARE(rangeMax, vmax);
+        }
+    }
+
+    // Old extremes outside the window don't count
+    MAVLinkSeriesBuffer window(10);
+    window.append(QPointF(0, 100));
+    window.append(QPointF(1, -100));
+    window.append(QPointF(2, 1));
+    window.append(QPointF(3, qQNaN()));
+    qreal rangeMin = 0;
+    qreal rangeMax = 0;
+    QVERIFY(window.range(2, rangeMin, rangeMax));
+    QCOMPARE(rangeMin, 1.);
+    QCOMPARE(rangeMax, 1.);
+    QVERIFY(!window.range(3, rangeMin, rangeMax));
+    QVERIFY(!window.range(window.count(), rangeMin, rangeMax));
+}
+
+void MAVLinkSeriesBufferTest::_testNonFinite()
+{
+    MAVLinkSeriesBuffer buffer(3);
+
+    buffer.append(QPointF(0, qQNaN()));
+    QCOMPARE(buffer.count(), qsizetype(1));
+    QVERIFY(!buffer.hasRange());
+    QCOMPARE(buffer.minimum(), 0.);
+
+    buffer.append(QPointF(1, 5));
+    buffer.append(QPointF(2, qInf()));
+    buffer.append(QPointF(3, -2));
+    QCOMPARE(buffer.minimum(), -2.);
+    QCOMPARE(buffer.maximum(), 5.);
+
+    // 5 drops out, the non-finite values leave -2 as the only range value
+    buffer.append(QPointF(4, qQNaN()));
+    buffer.append(QPointF(5, qQNaN()));
+    QCOMPARE(buffer.minimum(), -2.);
+    QCOMPARE(buffer.maximum(), -2.);
+    buffer.append(QPointF(6, qQNaN()));
+    QVERIFY(!buffer.hasRange());
+}
+
+void MAVLinkSeriesBufferTest::_testSetCapacity()
+{
+    MAVLinkSeriesBuffer buffer(10);
+    for (int i = 0; i < 15; i++) {
+        buffer.append(QPointF(i, (i == 6) ? 100 : i));
+    }
+    QCOMPARE(buffer.maximum(), 100.);
+
+    buffer.setCapacity(3);
+    QCOMPARE(buffer.capacity(), qsizetype(3));
+    QCOMPARE(buffer.count(), qsizetype(3));
+    QCOMPARE(buffer.totalAppended(), 3ULL);
+    QCOMPARE(buffer.at(0).x(), 12.);
+    QCOMPARE(buffer.minimum(), 12.);
+    QCOMPARE(buffer.maximum(), 14.);
+
+    buffer.setCapacity(100);
+    QCOMPARE(buffer.count(), qsizetype(3));
+    buffer.append(QPointF(15, 1));
+    QCOMPARE(buffer.count(), qsizetype(4));
+    QCOMPARE(buffer.at(0).x(), 12.);
+    QCOMPARE(buffer.minimum(), 1.);
+}
+
+void MAVLinkSeriesBufferTest::_testLowerBound()
+{
+    MAVLinkSeriesBuffer buffer(5);
+    QCOMPARE(buffer.lowerBound(0), qsizetype(0));
+
+    // Wrapped, holds x 30 to 70
+    for (int i = 0; i < 8; i++) {
+        buffer.append(QPointF(i * 10, 0));
+    }
+
+    QCOMPARE(buffer.lowerBound(0), qsizetype(0));
+    QCOMPARE(buffer.lowerBound(30), qsizetype(0));
+    QCOMPARE(buffer.lowerBound(31), qsizetype(1));
+    QCOMPARE(buffer.lowerBound(60), qsizetype(3));
+    QCOMPARE(buffer.lowerBound(70), qsizetype(4));
+    QCOMPARE(buffer.lowerBound(71), qsizetype(5));
+}
+
+void MAVLinkSeriesBufferTest::_testDownsample()
+{
+    constexpr qsizetype kMaxPoints = 100;
+
+    MAVLinkSeriesBuffer buffer(10000);
+    for (int i = 0; i < 12000; i++) {
+        buffer.append(QPointF(i, ((i == 6000) ? 1000. : (i == 9000) ? -1000. : qSin(i * 0.01))));
+    }
+
+    // Nothing to do if it already fits
+    QCOMPARE(buffer.downsample(buffer.count() - 50, kMaxPoints).count(), qsizetype(50));
+
+    const QList<QPointF> points = buffer.downsample(0, kMaxPoints);
+    QCOMPARE(points.count(), kMaxPoints);
+    QCOMPARE(points.first(), buffer.at(0));
+    QCOMPARE(points.last(), buffer.at(buffer.count() - 1));
+
+    // In x order and the spikes survive
+    bool foundMax = false;
+    bool foundMin = false;
+    for (qsizetype i = 0; i < points.count(); i++) {
+        if (i > 0) {
+            QVERIFY(points[i].x() > points[i - 1].x());
+        }
+        foundMax |= (points[i].y() == 1000.);
+        foundMin |= (points[i].y() == -1000.);
+    }
+    QVERIFY(foundMax);
+    QVERIFY(foundMin);
+
+    // Starting part way in
+    const qsizetype first = buffer.lowerBound(8000);
+    const QList<QPointF> tail = buffer.downsample(first, kMaxPoints);
+    QCOMPARE(tail.count(), kMaxPoints);
+    QCOMPARE(tail.first().x(), 8000.);
+}
@@ -0,0 +1,26 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class MAVLinkSeriesBufferTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _testWrap();
+    void _testMinMax();
+    void _testRange();
+    void _testNonFinite();
+    void _testSetCapacity();
+    void _testLowerBound();
+    void _testDownsample();
+};
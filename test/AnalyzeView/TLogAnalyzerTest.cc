@@ -0,0 +1,200 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "TLogAnalyzerTest.h"
+#include "TLogAnalyzer.h"
+#include "MAVLinkLib.h"
+#include "QGCCommandLineParser.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QtEndian>
+#include <QtCore/QtMath>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+/// Generates a 50 Hz tlog with a heartbeat at the start of every second and attitude in all other records.
+/// The roll is 10 degrees in the first second, 20 in the second and so on.
+QByteArray TLogAnalyzerTest::_buildLog(int seconds)
+{
+    QByteArray log;
+    uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
+    quint64 timestamp = kStartTimeUSecs;
+
+    for (int tick = 0; tick < (seconds * kRecordsPerSecond); tick++) {
+        mavlink_message_t message;
+        const int second = tick / kRecordsPerSecond;
+        if ((tick % kRecordsPerSecond) == 0) {
+            (void) mavlink_msg_heartbeat_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, MAVLINK_COMM_12, &message, MAV_TYPE_QUADROTOR, MAV_AUTOPILOT_PX4, 0, 0, MAV_STATE_ACTIVE);
+        } else {
+            const float roll = static_cast<float>(qDegreesToRadians(10.0 * (second + 1)));
+            (void) mavlink_msg_attitude_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, MAVLINK_COMM_12, &message, tick, roll, 0.f, 0.f, 0.f, 0.f, 0.f);
+        }
+
+        char timestampBytes[sizeof(timestamp)];
+        qToBigEndian(timestamp, timestampBytes);
+        (void) log.append(timestampBytes, sizeof(timestampBytes));
+        const uint16_t len = mavlink_msg_to_send_buffer(buffer, &message);
+        (void) log.append(reinterpret_cast<const char*>(buffer), len);
+
+        timestamp += kRecordIntervalUSecs;
+    }
+
+    return log;
+}
+
+/// Reads a CSV file written by the analyzer, including the header row
+QList<QStringList> TLogAnalyzerTest::_readCsv(const QString &filename)
+{
+    QList<QStringList> rows;
+
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return rows;
+    }
+
+    while (!file.atEnd()) {
+        QString line = QString::fromUtf8(file.readLine());
+        if (line.endsWith(QLatin1Char('\n'))) {
+            line.chop(1);
+        }
+        QStringList fields;
+        QString field;
+        bool quoted = false;
+        for (qsizetype i = 0; i < line.size(); i++) {
+            const QChar c = line[i];
+            if (quoted) {
+                if ((c == QLatin1Char('"')) && ((i + 1) < line.size()) && (line[i + 1] == QLatin1Char('"'))) {
+                    field += c;
+                    i++;
+                } else if (c == QLatin1Char('"')) {
+                    quoted = false;
+                } else {
+                    field += c;
+                }
+            } else if (c == QLatin1Char('"')) {
+                quoted = true;
+            } else if (c == QLatin1Char(',')) {
+                fields.append(field);
+                field.clear();
+            } else {
+                field += c;
+            }
+        }
+        fields.append(field);
+        rows.append(fields);
+    }
+
+    return rows;
+}
+
+void TLogAnalyzerTest::_testAnalyze()
+{
+    const QTemporaryDir tmpDir;
+    const QString logFilename = tmpDir.filePath(QStringLiteral("analyze.tlog"));
+    {
+        QFile logFile(logFilename);
+        QVERIFY(logFile.open(QFile::WriteOnly | QFile::Truncate));
+        const QByteArray log = _buildLog(kLogSeconds);
+        QCOMPARE(logFile.write(log), log.size());
+    }
+
+    const QString outputDir = tmpDir.filePath(QStringLiteral("results"));
+    TLogAnalyzer analyzer(QStringList({ logFilename }), outputDir, 1000);
+    QSignalSpy spyFinished(&analyzer, &TLogAnalyzer::finished);
+    analyzer.start();
+    QVERIFY(spyFinished.wait(30000));
+    QCOMPARE(spyFinished.at(0).at(0).toInt(), 0);
+
+    const QDir logOutputDir(QDir(outputDir).filePath(QStringLiteral("analyze")));
+
+    // One sample per interval plus one at the end of the log
+    const QList<QStringList> vehicleRows = _readCsv(logOutputDir.filePath(QStringLiteral("vehicle1/vehicle.csv")));
+    QCOMPARE(vehicleRows.count(), 1 + kLogSeconds + 1);
+    QCOMPARE(vehicleRows[0].first(), QStringLiteral("log_time_s"));
+    const qsizetype rollColumn = vehicleRows[0].indexOf(QStringLiteral("roll"));
+    QVERIFY(rollColumn > 0);
+
+    const double endTimeSecs = static_cast<double>(((kLogSeconds * kRecordsPerSecond) - 1) * kRecordIntervalUSecs) / 1e6;
+    for (int interval = 0; interval <= kLogSeconds; interval++) {
+        const QStringList &row = vehicleRows[interval + 1];
+        QCOMPARE(row.count(), vehicleRows[0].count());
+
+        const double logTimeSecs = row[0].toDouble();
+        const double expectedRoll = 10.0 * (qMin(interval, kLogSeconds - 1) + 1);
+        if (interval < kLogSeconds) {
+            // Samples are taken on the first batch at or past each interval
+            QVERIFY(logTimeSecs >= interval);
+            QVERIFY(logTimeSecs < (interval + 0.2));
+        } else {
+            QVERIFY(qAbs(logTimeSecs - endTimeSecs) < 0.001);
+        }
+        QVERIFY(qAbs(row[rollColumn].toDouble() - expectedRoll) < 0.1);
+    }
+
+    // Totals
+    const QList<QStringList> summaryRows = _readCsv(logOutputDir.filePath(QStringLiteral("summary.csv")));
+    QVERIFY(!summaryRows.isEmpty());
+    QCOMPARE(summaryRows[0], QStringLiteral("vehicle,group,fact,units,samples,min,max,mean").split(QLatin1Char(',')));
+    bool foundRoll = false;
+    for (const QStringList &row : summaryRows) {
+        if ((row.count() == 8) && (row[0] == QStringLiteral("vehicle1")) && (row[1] == QStringLiteral("vehicle")) && (row[2] == QStringLiteral("roll"))) {
+            foundRoll = true;
+            QCOMPARE(row[4].toInt(), kLogSeconds + 1);
+            QVERIFY(qAbs(row[5].toDouble() - 10.0) < 0.01);
+            QVERIFY(qAbs(row[6].toDouble() - 30.0) < 0.01);
+            QVERIFY(qAbs(row[7].toDouble() - ((10.0 + 20.0 + 30.0 + 30.0) / 4)) < 0.01);
+        }
+    }
+    QVERIFY(foundRoll);
+
+    const QList<QStringList> messageRows = _readCsv(logOutputDir.filePath(QStringLiteral("messages.csv")));
+    const QList<QStringList> expectedMessageRows = {
+        QStringLiteral("msgid,name,count").split(QLatin1Char(',')),
+        { QString::number(MAVLINK_MSG_ID_HEARTBEAT), QStringLiteral("HEARTBEAT"), QString::number(kLogSeconds) },
+        { QString::number(MAVLINK_MSG_ID_ATTITUDE), QStringLiteral("ATTITUDE"), QString::number(kLogSeconds * (kRecordsPerSecond - 1)) },
+    };
+    QCOMPARE(messageRows, expectedMessageRows);
+}
+
+void TLogAnalyzerTest::_testMissingLog()
+{
+    const QTemporaryDir tmpDir;
+
+    TLogAnalyzer analyzer(QStringList({ tmpDir.filePath(QStringLiteral("missing.tlog")) }), tmpDir.path(), 1000);
+    QSignalSpy spyFinished(&analyzer, &TLogAnalyzer::finished);
+    analyzer.start();
+    QVERIFY(spyFinished.wait(5000));
+    QCOMPARE(spyFinished.at(0).at(0).toInt(), 1);
+}
+
+void TLogAnalyzerTest::_testCommandLine()
+{
+    const QString app = QCoreApplication::applicationFilePath();
+
+    QGCCommandLineParser::CommandLineParseResult result = QGCCommandLineParser::parseCommandLine({
+        app,
+        QStringLiteral("--analyze-log"), QStringLiteral("a.tlog"),
+        QStringLiteral("--analyze-log"), QStringLiteral("b.tlog"),
+        QStringLiteral("--analyze-output"), QStringLiteral("results"),
+        QStringLiteral("--analyze-interval"), QStringLiteral("250"),
+    });
+    QCOMPARE(result.statusCode, QGCCommandLineParser::CommandLineParseResult::Status::Ok);
+    QCOMPARE(result.analyzeLogs, QStringList({ QStringLiteral("a.tlog"), QStringLiteral("b.tlog") }));
+    QCOMPARE(result.analyzeOutputDir.value_or(QString()), QStringLiteral("results"));
+    QCOMPARE(result.analyzeIntervalMSecs, 250U);
+
+    result = QGCCommandLineParser::parseCommandLine({ app, QStringLiteral("--analyze-log"), QStringLiteral("a.tlog") });
+    QCOMPARE(result.statusCode, QGCCommandLineParser::CommandLineParseResult::Status::Ok);
+    QVERIFY(!result.analyzeOutputDir.has_value());
+    QCOMPARE(result.analyzeIntervalMSecs, 1000U);
+
+    result = QGCCommandLineParser::parseCommandLine({ app, QStringLiteral("--analyze-log"), QStringLiteral("a.tlog"), QStringLiteral("--analyze-interval"), QStringLiteral("0") });
+    QCOMPARE(result.statusCode, QGCCommandLineParser::CommandLineParseResult::Status::Error);
+}
@@ -0,0 +1,132 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "LinkMetricsTest.h"
+#include "LinkMetrics.h"
+#include "MockLink.h"
+
+#include <QtCore/QJsonArray>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+#include <iterator>
+
+namespace
+{
+
+mavlink_message_t _attitude(uint8_t seq)
+{
+    mavlink_message_t message;
+    (void) mavlink_msg_attitude_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, MAVLINK_COMM_12, &message, 0, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f);
+    message.seq = seq;
+    return message;
+}
+
+} // namespace
+
+void LinkMetricsTest::_testMessageStats()
+{
+    LinkMetrics metrics;
+
+    constexpr qint64 kIntervalNSecs = 20 * 1000 * 1000;
+    qint64 readTimeNSecs = 1000000000;
+    constexpr uint8_t kSeqs[] = { 0, 1, 2, 5, 6 };
+    constexpr quint32 kLost[] = { 0, 0, 0, 2, 0 };
+    for (size_t i = 0; i < std::size(kSeqs); i++) {
+        metrics.recordMessage(_attitude(kSeqs[i]), kLost[i], false /* superseded */, readTimeNSecs, readTimeNSecs + 1000, readTimeNSecs + 3000);
+        readTimeNSecs += kIntervalNSecs;
+    }
+    metrics.recordBytes(100);
+    metrics.recordDecodeErrors(2, 1, 3);
+
+    QCOMPARE(metrics.messagesReceived(), 5ULL);
+    QCOMPARE(metrics.bytesReceived(), 100ULL);
+    QCOMPARE(metrics.sequenceGaps(), 2ULL);
+    QCOMPARE(metrics.crcErrors(), 2ULL);
+    QCOMPARE(metrics.signatureErrors(), 1ULL);
+    QCOMPARE(metrics.parseErrors(), 3ULL);
+
+    const quint64 key = LinkMetrics::messageKey(1, MAV_COMP_ID_AUTOPILOT1, MAVLINK_MSG_ID_ATTITUDE);
+    QVERIFY(metrics.messageStats().contains(key));
+    const LinkMetrics::MessageStats &stats = metrics.messageStats()[key];
+    QCOMPARE(stats.count, 5ULL);
+    QCOMPARE(stats.bytes, static_cast<quint64>(5 * (MAVLINK_NUM_NON_PAYLOAD_BYTES + MAVLINK_MSG_ID_ATTITUDE_LEN)));
+    QCOMPARE(stats.arrivalHistogram[LinkMetrics::arrivalBucket(kIntervalNSecs)], 4U);
+    QCOMPARE(stats.latencyMaxNSecs, 3000LL);
+    QCOMPARE(stats.dispatchMaxNSecs, 2000LL);
+
+    // Superseded copies are dispatched, so they are counted and timed like any other message
+    metrics.recordMessage(_attitude(7), 0, true /* superseded */, readTimeNSecs, readTimeNSecs + 1000, readTimeNSecs + 3000);
+    readTimeNSecs += kIntervalNSecs;
+    metrics.recordMessage(_attitude(8), 0, false /* superseded */, readTimeNSecs, readTimeNSecs + 1000, readTimeNSecs + 3000);
+    QCOMPARE(metrics.messagesReceived(), 7ULL);
+    QCOMPARE(metrics.messagesSuperseded(), 1ULL);
+    const LinkMetrics::MessageStats &supersededStats = metrics.messageStats()[key];
+    QCOMPARE(supersededStats.count, 7ULL);
+    QCOMPARE(supersededStats.superseded, 1ULL);
+    QCOMPARE(supersededStats.arrivalHistogram[LinkMetrics::arrivalBucket(kIntervalNSecs)], 6U);
+
+    const QJsonArray messages = metrics.toJson().value(QStringLiteral("messages")).toArray();
+    QCOMPARE(messages.count(), static_cast<qsizetype>(1));
+    const QJsonObject message = messages[0].toObject();
+    QCOMPARE(message.value(QStringLiteral("superseded")).toInteger(), static_cast<qint64>(1));
+    QCOMPARE(message.value(QStringLiteral("latencyAvgMSecs")).toDouble(), 0.003);
+    QCOMPARE(message.value(QStringLiteral("dispatchAvgMSecs")).toDouble(), 0.002);
+
+    metrics.reset();
+    QCOMPARE(metrics.messagesReceived(), 0ULL);
+    QCOMPARE(metrics.messagesSuperseded(), 0ULL);
+    QVERIFY(metrics.messageStats().isEmpty());
+}
+
+void LinkMetricsTest::_testArrivalBuckets()
+{
+    constexpr qint64 kMSecs = 1000 * 1000;
+
+    QCOMPARE(LinkMetrics::arrivalBucket(0), 0);
+    QCOMPARE(LinkMetrics::arrivalBucket(kMSecs / 2), 0);
+    QCOMPARE(LinkMetrics::arrivalBucket(kMSecs), 1);
+    QCOMPARE(LinkMetrics::arrivalBucket(3 * kMSecs), 2);
+    QCOMPARE(LinkMetrics::arrivalBucket(20 * kMSecs), 5);
+    QCOMPARE(LinkMetrics::arrivalBucket(60000 * kMSecs), LinkMetrics::kIntervalBuckets - 1);
+}
+
+void LinkMetricsTest::_testJson()
+{
+    LinkMetrics metrics;
+    metrics.recordMessage(_attitude(0), 0, false /* superseded */, 1000, 2000, 3000);
+
+    const QJsonObject json = metrics.toJson();
+    QCOMPARE(json.value(QStringLiteral("messagesReceived")).toInteger(), static_cast<qint64>(1));
+
+    const QJsonArray messages = json.value(QStringLiteral("messages")).toArray();
+    QCOMPARE(messages.count(), static_cast<qsizetype>(1));
+    const QJsonObject message = messages[0].toObject();
+    QCOMPARE(message.value(QStringLiteral("msgid")).toInteger(), static_cast<qint64>(MAVLINK_MSG_ID_ATTITUDE));
+    QCOMPARE(message.value(QStringLiteral("name")).toString(), QStringLiteral("ATTITUDE"));
+    QCOMPARE(message.value(QStringLiteral("arrivalHistogram")).toArray().count(), static_cast<qsizetype>(LinkMetrics::kIntervalBuckets));
+
+    QCOMPARE(metrics.messages().count(), static_cast<qsizetype>(1));
+}
+
+void LinkMetricsTest::_testMockLink()
+{
+    _connectMockLink();
+
+    const LinkMetrics *const metrics = _mockLink->metrics();
+    QVERIFY(metrics->messagesReceived() > 0);
+    QVERIFY(metrics->bytesReceived() > 0);
+    QVERIFY(metrics->messageStats().contains(LinkMetrics::messageKey(_mockLink->vehicleId(), MAV_COMP_ID_AUTOPILOT1, MAVLINK_MSG_ID_HEARTBEAT)));
+
+    QSignalSpy spyUpdated(metrics, &LinkMetrics::updated);
+    QVERIFY(spyUpdated.wait(LinkMetrics::kUpdateIntervalMSecs * 2));
+    QVERIFY(metrics->messageRate() > 0);
+
+    _disconnectMockLink();
+}
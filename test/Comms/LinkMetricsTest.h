@@ -0,0 +1,23 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class LinkMetricsTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _testMessageStats();
+    void _testArrivalBuckets();
+    void _testJson();
+    void _testMockLink();
+};
@@ -0,0 +1,145 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "LinkSendQueueTest.h"
+#include "LinkSendQueue.h"
+#include "MAVLinkLib.h"
+
+#include <QtCore/QJsonArray>
+#include <QtTest/QTest>
+
+void LinkSendQueueTest::_testPriorityOrder()
+{
+    LinkSendQueue queue;
+    QVERIFY(queue.isEmpty());
+
+    QVERIFY(queue.enqueue(QByteArrayLiteral("bulk1"), LinkSendQueue::PriorityBulk, 0));
+    QVERIFY(queue.enqueue(QByteArrayLiteral("request"), LinkSendQueue::PriorityRequest, 0));
+    QVERIFY(queue.enqueue(QByteArrayLiteral("bulk2"), LinkSendQueue::PriorityBulk, 0));
+    QVERIFY(queue.enqueue(QByteArrayLiteral("control"), LinkSendQueue::PriorityControl, 0));
+    QVERIFY(queue.enqueue(QByteArrayLiteral("command"), LinkSendQueue::PriorityCommand, 0));
+    QVERIFY(!queue.isEmpty());
+
+    // Unlimited rate, everything goes out in priority order and fifo within a priority
+    QByteArray data;
+    qint64 retryNSecs = 0;
+    const QList<QByteArray> expected = { "control", "command", "request", "bulk1", "bulk2" };
+    for (const QByteArray &expectedData : expected) {
+        QVERIFY(queue.dequeue(0, data, retryNSecs));
+        QCOMPARE(data, expectedData);
+    }
+
+    QVERIFY(!queue.dequeue(0, data, retryNSecs));
+    QCOMPARE(retryNSecs, 0LL);
+    QVERIFY(queue.isEmpty());
+
+    QCOMPARE(LinkSendQueue::priorityForMessage(MAVLINK_MSG_ID_HEARTBEAT), LinkSendQueue::PriorityControl);
+    QCOMPARE(LinkSendQueue::priorityForMessage(MAVLINK_MSG_ID_COMMAND_LONG), LinkSendQueue::PriorityCommand);
+    QCOMPARE(LinkSendQueue::priorityForMessage(MAVLINK_MSG_ID_REQUEST_DATA_STREAM), LinkSendQueue::PriorityRequest);
+    QCOMPARE(LinkSendQueue::priorityForMessage(MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL), LinkSendQueue::PriorityBulk);
+}
+
+void LinkSendQueueTest::_testByteRate()
+{
+    static constexpr qint64 kByteRate = 1000;
+    static constexpr qint64 kNSecsPerSec = 1000000000;
+
+    LinkSendQueue queue;
+    queue.setByteRate(kByteRate);
+    QCOMPARE(queue.byteRate(), kByteRate);
+
+    // 280 bytes of bulk data uses up the initial budget (one max size packet) and puts it into debt
+    const QByteArray bulk(280, 'b');
+    QVERIFY(queue.enqueue(bulk, LinkSendQueue::PriorityBulk, 0));
+    QVERIFY(queue.enqueue(bulk, LinkSendQueue::PriorityBulk, 0));
+
+    qint64 nowNSecs = kNSecsPerSec;
+    QByteArray data;
+    qint64 retryNSecs = 0;
+    QVERIFY(queue.dequeue(nowNSecs, data, retryNSecs));
+    QCOMPARE(data.size(), bulk.size());
+    QVERIFY(!queue.dequeue(nowNSecs, data, retryNSecs));
+    QVERIFY(retryNSecs > 0);
+
+    // Control data queued behind the bulk data is next once the budget allows it
+    QVERIFY(queue.enqueue(QByteArrayLiteral("control"), LinkSendQueue::PriorityControl, nowNSecs));
+    QVERIFY(!queue.dequeue(nowNSecs + (retryNSecs / 2), data, retryNSecs));
+    nowNSecs += (2 * kNSecsPerSec) / 1000 + retryNSecs;
+    QVERIFY(queue.dequeue(nowNSecs, data, retryNSecs));
+    QCOMPARE(data, QByteArrayLiteral("control"));
+
+    // Budget doesn't build up beyond the burst limit while idle
+    nowNSecs += 100 * kNSecsPerSec;
+    QVERIFY(queue.dequeue(nowNSecs, data, retryNSecs));
+    QCOMPARE(data.size(), bulk.size());
+    QVERIFY(queue.enqueue(bulk, LinkSendQueue::PriorityBulk, nowNSecs));
+    QVERIFY(!queue.dequeue(nowNSecs, data, retryNSecs));
+    QVERIFY(retryNSecs > 0);
+
+    // Back to unlimited
+    queue.setByteRate(0);
+    QVERIFY(queue.dequeue(nowNSecs, data, retryNSecs));
+    QVERIFY(queue.isEmpty());
+}
+
+void LinkSendQueueTest::_testStats()
+{
+    static constexpr qint64 kNSecsPerMSec = 1000000;
+
+    LinkSendQueue queue;
+    QVERIFY(queue.enqueue(QByteArray(10, 'a'), LinkSendQueue::PriorityCommand, 0));
+    QVERIFY(queue.enqueue(QByteArray(20, 'b'), LinkSendQueue::PriorityCommand, 0));
+
+    LinkSendQueue::Stats stats = queue.stats(LinkSendQueue::PriorityCommand);
+    QCOMPARE(stats.queued, 2ULL);
+    QCOMPARE(stats.queuedBytes, 30ULL);
+    QCOMPARE(stats.maxQueued, 2ULL);
+
+    QByteArray data;
+    qint64 retryNSecs = 0;
+    QVERIFY(queue.dequeue(5 * kNSecsPerMSec, data, retryNSecs));
+    QVERIFY(queue.dequeue(15 * kNSecsPerMSec, data, retryNSecs));
+
+    stats = queue.stats(LinkSendQueue::PriorityCommand);
+    QCOMPARE(stats.queued, 0ULL);
+    QCOMPARE(stats.queuedBytes, 0ULL);
+    QCOMPARE(stats.maxQueued, 2ULL);
+    QCOMPARE(stats.sent, 2ULL);
+    QCOMPARE(stats.sentBytes, 30ULL);
+    QCOMPARE(stats.waitTotalNSecs, 20 * kNSecsPerMSec);
+    QCOMPARE(stats.waitMaxNSecs, 15 * kNSecsPerMSec);
+
+    QCOMPARE(queue.stats(LinkSendQueue::PriorityBulk).sent, 0ULL);
+
+    const QJsonObject json = queue.toJson();
+    QCOMPARE(json[QStringLiteral("priorities")].toArray().count(), static_cast<qsizetype>(LinkSendQueue::PriorityCount));
+    const QJsonObject commandJson = json[QStringLiteral("priorities")].toArray()[LinkSendQueue::PriorityCommand].toObject();
+    QCOMPARE(commandJson[QStringLiteral("priority")].toString(), QStringLiteral("command"));
+    QCOMPARE(commandJson[QStringLiteral("waitAvgMSecs")].toDouble(), 10.0);
+    QCOMPARE(commandJson[QStringLiteral("waitMaxMSecs")].toDouble(), 15.0);
+}
+
+void LinkSendQueueTest::_testQueueFull()
+{
+    LinkSendQueue queue;
+
+    const QByteArray bulk(LinkSendQueue::kMaxQueuedBytes / 2, 'b');
+    QVERIFY(queue.enqueue(bulk, LinkSendQueue::PriorityBulk, 0));
+    QVERIFY(queue.enqueue(bulk, LinkSendQueue::PriorityBulk, 0));
+    QVERIFY(!queue.enqueue(bulk, LinkSendQueue::PriorityBulk, 0));
+    QCOMPARE(queue.stats(LinkSendQueue::PriorityBulk).dropped, 1ULL);
+
+    // A full bulk queue doesn't hold back other priorities
+    QVERIFY(queue.enqueue(QByteArrayLiteral("control"), LinkSendQueue::PriorityControl, 0));
+
+    queue.clear();
+    QVERIFY(queue.isEmpty());
+    QCOMPARE(queue.stats(LinkSendQueue::PriorityBulk).queuedBytes, 0ULL);
+    QCOMPARE(queue.stats(LinkSendQueue::PriorityBulk).dropped, 1ULL);
+}
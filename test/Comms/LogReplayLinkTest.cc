@@ -0,0 +1,92 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "LogReplayLinkTest.h"
+#include "LinkManager.h"
+#include "LogReplayLink.h"
+#include "MAVLinkLib.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QtEndian>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+namespace
+{
+    constexpr uint8_t kEncodeChannel = MAVLINK_COMM_12;
+    constexpr uint8_t kDecodeChannel = MAVLINK_COMM_14;
+}
+
+/// Fast replay of a log spanning many batches must hand on every message once, in log order
+void LogReplayLinkTest::_testFastReplay()
+{
+    *mavlink_get_channel_status(kEncodeChannel) = mavlink_status_t{};
+    *mavlink_get_channel_status(kDecodeChannel) = mavlink_status_t{};
+
+    // Attitude only, so no vehicle is created. time_boot_ms carries the record index.
+    QByteArray log;
+    uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
+    for (int i = 0; i < kRecordCount; i++) {
+        mavlink_message_t message;
+        (void) mavlink_msg_attitude_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, kEncodeChannel, &message, i, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f);
+
+        char timestampBytes[sizeof(quint64)];
+        qToBigEndian(kStartTimeUSecs + (i * kRecordIntervalUSecs), timestampBytes);
+        (void) log.append(timestampBytes, sizeof(timestampBytes));
+        const uint16_t len = mavlink_msg_to_send_buffer(buffer, &message);
+        (void) log.append(reinterpret_cast<const char*>(buffer), len);
+    }
+
+    const QTemporaryDir tmpDir;
+    const QString logFilename = tmpDir.filePath(QStringLiteral("replay.tlog"));
+    {
+        QFile logFile(logFilename);
+        QVERIFY(logFile.open(QFile::WriteOnly | QFile::Truncate));
+        QCOMPARE(logFile.write(log), log.size());
+    }
+
+    LogReplayLink *const link = LinkManager::instance()->startLogReplay(logFilename, true /* fastReplay */);
+    QVERIFY(link);
+
+    QList<uint32_t> timeBootMSecs;
+    (void) connect(link, &LinkInterface::bytesReceived, this, [&timeBootMSecs](LinkInterface *, const QByteArray &data) {
+        for (const char byte : data) {
+            mavlink_message_t message;
+            mavlink_status_t status;
+            if (mavlink_parse_char(kDecodeChannel, static_cast<uint8_t>(byte), &message, &status) == MAVLINK_FRAMING_OK) {
+                timeBootMSecs.append(mavlink_msg_attitude_get_time_boot_ms(&message));
+            }
+        }
+    });
+
+    QList<quint64> replayedUSecs;
+    (void) connect(link, &LogReplayLink::dataReplayed, this, [&replayedUSecs](quint64 logTimeUSecs) {
+        replayedUSecs.append(logTimeUSecs);
+    });
+
+    QSignalSpy spyAtEnd(link, &LogReplayLink::playbackAtEnd);
+    QVERIFY(spyAtEnd.wait(10000));
+    QCoreApplication::processEvents();
+
+    QCOMPARE(timeBootMSecs.count(), kRecordCount);
+    for (int i = 0; i < kRecordCount; i++) {
+        QCOMPARE(timeBootMSecs[i], static_cast<uint32_t>(i));
+    }
+
+    // The log is sent in several batches, each reporting a later log time than the last
+    QVERIFY(replayedUSecs.count() > 1);
+    for (qsizetype i = 1; i < replayedUSecs.count(); i++) {
+        QVERIFY(replayedUSecs[i] > replayedUSecs[i - 1]);
+    }
+    QCOMPARE(replayedUSecs.constLast(), kStartTimeUSecs + ((kRecordCount - 1) * kRecordIntervalUSecs));
+
+    (void) disconnect(link, nullptr, this, nullptr);
+    LinkManager::instance()->removeConfiguration(link->linkConfiguration().get());
+}
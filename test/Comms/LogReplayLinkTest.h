@@ -0,0 +1,25 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class LogReplayLinkTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _testFastReplay();
+
+private:
+    static constexpr quint64 kStartTimeUSecs = 1700000000000000ULL;
+    static constexpr quint64 kRecordIntervalUSecs = 20000;
+    static constexpr int kRecordCount = 500;
+};
@@ -0,0 +1,223 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkDecodeWorkerTest.h"
+#include "MAVLinkDecodeWorker.h"
+#include "MAVLinkSigning.h"
+#include "MockLink.h"
+#include "Vehicle.h"
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+namespace
+{
+    constexpr uint8_t kEncodeChannel = MAVLINK_COMM_12;
+    constexpr uint8_t kDecodeChannel = MAVLINK_COMM_14;
+
+    QByteArray _frame(const mavlink_message_t &message)
+    {
+        uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
+        const uint16_t len = mavlink_msg_to_send_buffer(buffer, &message);
+        return QByteArray(reinterpret_cast<const char*>(buffer), len);
+    }
+
+    QByteArray _attitude(uint8_t seq, float roll = 0.f)
+    {
+        mavlink_get_channel_status(kEncodeChannel)->current_tx_seq = seq;
+        mavlink_message_t message;
+        (void) mavlink_msg_attitude_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, kEncodeChannel, &message, 0, roll, 0.f, 0.f, 0.f, 0.f, 0.f);
+        return _frame(message);
+    }
+
+    QByteArray _commandAck(uint8_t seq)
+    {
+        mavlink_get_channel_status(kEncodeChannel)->current_tx_seq = seq;
+        mavlink_message_t message;
+        (void) mavlink_msg_command_ack_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, kEncodeChannel, &message, MAV_CMD_REQUEST_MESSAGE, MAV_RESULT_ACCEPTED, 0, 0, 0, 0);
+        return _frame(message);
+    }
+
+    MAVLinkDecodedBatch _batch(const QSignalSpy &spy, qsizetype index)
+    {
+        return spy.at(index).at(1).value<MAVLinkDecodedBatch>();
+    }
+}
+
+void MAVLinkDecodeWorkerTest::init()
+{
+    UnitTest::init();
+
+    *mavlink_get_channel_status(kEncodeChannel) = mavlink_status_t{};
+    *mavlink_get_channel_status(kDecodeChannel) = mavlink_status_t{};
+}
+
+void MAVLinkDecodeWorkerTest::_testSequenceLoss()
+{
+    MAVLinkDecodeWorker worker(nullptr, kDecodeChannel, false /* forwardingLink */, false /* coalesce */);
+
+    MAVLinkDecodedBatch batch;
+    worker.decode(_attitude(0) + _attitude(1) + _attitude(4) + _commandAck(5), 1000, batch);
+
+    QCOMPARE(batch.messages.count(), static_cast<qsizetype>(4));
+    QCOMPARE(batch.messages[2].lost, 2U);
+    QCOMPARE(batch.messages[3].lost, 0U);
+    QCOMPARE(batch.totalReceived, 4ULL);
+    QCOMPARE(batch.totalLost, 2ULL);
+    QCOMPARE(batch.messages[0].readTimeNSecs, 1000LL);
+
+    // Sequence numbers wrap around
+    MAVLinkDecodedBatch wrapped;
+    worker.decode(_attitude(254) + _attitude(1), 2000, wrapped);
+    QCOMPARE(wrapped.messages[0].lost, 248U);
+    QCOMPARE(wrapped.messages[1].lost, 2U);
+}
+
+void MAVLinkDecodeWorkerTest::_testCoalesce()
+{
+    MAVLinkDecodeWorker worker(nullptr, kDecodeChannel, false /* forwardingLink */, true /* coalesce */);
+    QSignalSpy spyBatch(&worker, &MAVLinkDecodeWorker::batchDecoded);
+
+    worker.receiveBytes(nullptr, _commandAck(0), 0);
+    QCOMPARE(spyBatch.count(), 1);
+
+    // While the receiver is busy every message is kept, older copies of high rate state messages are marked as superseded
+    worker.receiveBytes(nullptr, _attitude(1, 0.1f) + _attitude(2, 0.2f), 0);
+    worker.receiveBytes(nullptr, _attitude(4, 0.3f), 0);
+    worker.receiveBytes(nullptr, _commandAck(5) + _attitude(6, 0.4f), 0);
+    QCOMPARE(spyBatch.count(), 1);
+
+    worker.batchConsumed();
+    QVERIFY(spyBatch.wait(MAVLinkDecodeWorker::kDeliveryIntervalMSecs * 10));
+    QCOMPARE(spyBatch.count(), 2);
+
+    const MAVLinkDecodedBatch batch = _batch(spyBatch, 1);
+    QCOMPARE(batch.messages.count(), static_cast<qsizetype>(5));
+    constexpr uint8_t kSeqs[] = { 1, 2, 4, 5, 6 };
+    for (qsizetype i = 0; i < batch.messages.count(); i++) {
+        QCOMPARE(batch.messages[i].message.seq, kSeqs[i]);
+        QCOMPARE(batch.messages[i].superseded, i < 3);
+    }
+    QCOMPARE(batch.messages[2].lost, 1U);
+    QCOMPARE(batch.messages[3].message.msgid, static_cast<uint32_t>(MAVLINK_MSG_ID_COMMAND_ACK));
+    QCOMPARE(mavlink_msg_attitude_get_roll(&batch.messages[4].message), 0.4f);
+    QCOMPARE(batch.totalReceived, 6ULL);
+    worker.batchConsumed();
+
+    // State messages alone are delivered at most once per delivery interval
+    worker.receiveBytes(nullptr, _attitude(7), 0);
+    QTRY_COMPARE_WITH_TIMEOUT(spyBatch.count(), 3, MAVLinkDecodeWorker::kDeliveryIntervalMSecs * 10);
+}
+
+void MAVLinkDecodeWorkerTest::_testCoalesceInstances()
+{
+    MAVLinkDecodeWorker worker(nullptr, kDecodeChannel, false /* forwardingLink */, true /* coalesce */);
+
+    // Servo outputs and IMUs with several instances per component only supersede copies of the same instance
+    QByteArray data;
+    for (const uint8_t port : { 0, 1, 0, 1 }) {
+        mavlink_servo_output_raw_t servoOutputRaw{};
+        servoOutputRaw.port = port;
+        mavlink_message_t message;
+        (void) mavlink_msg_servo_output_raw_encode_chan(1, MAV_COMP_ID_AUTOPILOT1, kEncodeChannel, &message, &servoOutputRaw);
+        data += _frame(message);
+    }
+    for (const uint8_t id : { 0, 1, 1 }) {
+        mavlink_highres_imu_t highresImu{};
+        highresImu.id = id;
+        mavlink_message_t message;
+        (void) mavlink_msg_highres_imu_encode_chan(1, MAV_COMP_ID_AUTOPILOT1, kEncodeChannel, &message, &highresImu);
+        data += _frame(message);
+    }
+
+    MAVLinkDecodedBatch batch;
+    worker.decode(data, 1000, batch);
+    QCOMPARE(batch.messages.count(), static_cast<qsizetype>(7));
+    constexpr bool kSuperseded[] = { true, true, false, false, false, true, false };
+    for (qsizetype i = 0; i < batch.messages.count(); i++) {
+        QCOMPARE(batch.messages[i].superseded, kSuperseded[i]);
+    }
+}
+
+void MAVLinkDecodeWorkerTest::_testBackPressure()
+{
+    constexpr quint64 kGeneration = 7;
+    MAVLinkDecodeWorker worker(nullptr, kDecodeChannel, false /* forwardingLink */, true /* coalesce */, kGeneration);
+    QSignalSpy spyBatch(&worker, &MAVLinkDecodeWorker::batchDecoded);
+
+    worker.receiveBytes(nullptr, _commandAck(0), 0);
+    QCOMPARE(spyBatch.count(), 1);
+    QCOMPARE(_batch(spyBatch, 0).generation, kGeneration);
+
+    // Nothing more is delivered until the receiver has consumed the previous batch
+    worker.receiveBytes(nullptr, _commandAck(1), 0);
+    worker.receiveBytes(nullptr, _commandAck(2), 0);
+    QCOMPARE(spyBatch.count(), 1);
+
+    worker.batchConsumed();
+    QVERIFY(spyBatch.wait(MAVLinkDecodeWorker::kDeliveryIntervalMSecs * 10));
+    QCOMPARE(spyBatch.count(), 2);
+    QCOMPARE(_batch(spyBatch, 1).messages.count(), static_cast<qsizetype>(2));
+}
+
+void MAVLinkDecodeWorkerTest::_testChannelStatusUntouched()
+{
+    MAVLinkDecodeWorker worker(nullptr, kDecodeChannel, false /* forwardingLink */, false /* coalesce */);
+
+    // Split across chunks so the byte-wise parser has to keep its state in between
+    const QByteArray frame = _attitude(0);
+    MAVLinkDecodedBatch batch;
+    worker.decode(frame.left(5), 1000, batch);
+    worker.decode(frame.mid(5) + _attitude(1), 2000, batch);
+    QCOMPARE(batch.messages.count(), static_cast<qsizetype>(2));
+
+    // The channel status belongs to the GUI thread which sends with it
+    const mavlink_status_t *const status = mavlink_get_channel_status(kDecodeChannel);
+    QCOMPARE(status->packet_rx_success_count, static_cast<uint16_t>(0));
+    QCOMPARE(static_cast<int>(status->parse_state), static_cast<int>(MAVLINK_PARSE_STATE_UNINIT));
+}
+
+void MAVLinkDecodeWorkerTest::_testSigning()
+{
+    const QByteArray key("MAVLinkDecodeWorkerTest");
+    QVERIFY(MAVLinkSigning::initSigning(static_cast<mavlink_channel_t>(kEncodeChannel), key, MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    QVERIFY(MAVLinkSigning::initSigning(static_cast<mavlink_channel_t>(kDecodeChannel), key, MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+
+    MAVLinkDecodeWorker worker(nullptr, kDecodeChannel, false /* forwardingLink */, false /* coalesce */);
+
+    MAVLinkDecodedBatch batch;
+    worker.decode(_attitude(0), 1000, batch);
+    QCOMPARE(batch.messages.count(), static_cast<qsizetype>(1));
+    QCOMPARE(batch.signatureErrors, 0U);
+
+    // Changes to the channel signing only apply once they are handed over
+    QVERIFY(MAVLinkSigning::initSigning(static_cast<mavlink_channel_t>(kDecodeChannel), QByteArray("Other"), MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    worker.decode(_attitude(1), 2000, batch);
+    QCOMPARE(batch.messages.count(), static_cast<qsizetype>(2));
+
+    worker.setSigning(MAVLinkSigning::channelSigning(static_cast<mavlink_channel_t>(kDecodeChannel)));
+    worker.decode(_attitude(2), 3000, batch);
+    QCOMPARE(batch.messages.count(), static_cast<qsizetype>(2));
+    QCOMPARE(batch.signatureErrors, 1U);
+
+    (void) MAVLinkSigning::initSigning(static_cast<mavlink_channel_t>(kEncodeChannel), QByteArrayView(), nullptr);
+    (void) MAVLinkSigning::initSigning(static_cast<mavlink_channel_t>(kDecodeChannel), QByteArrayView(), nullptr);
+}
+
+void MAVLinkDecodeWorkerTest::_testMockLink()
+{
+    _connectMockLink();
+
+    // Decoded on the link decode thread and dispatched to the vehicle on the GUI thread
+    QVERIFY(_vehicle);
+    QVERIFY(_vehicle->messagesReceived() > 0);
+    QCOMPARE(_vehicle->messagesLost(), 0U);
+
+    _disconnectMockLink();
+}
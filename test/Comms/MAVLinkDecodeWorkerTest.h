@@ -0,0 +1,27 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class MAVLinkDecodeWorkerTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void init() override;
+    void _testSequenceLoss();
+    void _testCoalesce();
+    void _testCoalesceInstances();
+    void _testBackPressure();
+    void _testChannelStatusUntouched();
+    void _testSigning();
+    void _testMockLink();
+};
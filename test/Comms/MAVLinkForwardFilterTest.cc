@@ -0,0 +1,69 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkForwardFilterTest.h"
+#include "MAVLinkForwardFilter.h"
+#include "MAVLinkLib.h"
+
+#include <QtTest/QTest>
+
+void MAVLinkForwardFilterTest::_testEmpty()
+{
+    MAVLinkForwardFilter filter;
+    QVERIFY(filter.isEmpty());
+    QVERIFY(filter.matches(1, 1, MAVLINK_MSG_ID_HEARTBEAT));
+
+    QVERIFY(filter.parse(QStringLiteral(" , ")));
+    QVERIFY(filter.isEmpty());
+    QVERIFY(filter.matches(255, 190, MAVLINK_MSG_ID_ATTITUDE));
+}
+
+void MAVLinkForwardFilterTest::_testRules()
+{
+    MAVLinkForwardFilter filter;
+    QVERIFY(filter.parse(QStringLiteral("1/1, 2 */*/30")));
+    QVERIFY(!filter.isEmpty());
+
+    // 1/1: autopilot of system 1 only
+    QVERIFY(filter.matches(1, 1, MAVLINK_MSG_ID_HEARTBEAT));
+    QVERIFY(!filter.matches(1, 100, MAVLINK_MSG_ID_HEARTBEAT));
+
+    // 2: everything from system 2
+    QVERIFY(filter.matches(2, 100, MAVLINK_MSG_ID_GPS_RAW_INT));
+
+    // */*/30: ATTITUDE from anyone
+    QVERIFY(filter.matches(3, 1, MAVLINK_MSG_ID_ATTITUDE));
+    QVERIFY(!filter.matches(3, 1, MAVLINK_MSG_ID_HEARTBEAT));
+}
+
+void MAVLinkForwardFilterTest::_testMessageNames()
+{
+    MAVLinkForwardFilter filter;
+    QVERIFY(filter.parse(QStringLiteral("*/*/HEARTBEAT,1/*/global_position_int")));
+    QVERIFY(filter.matches(5, 1, MAVLINK_MSG_ID_HEARTBEAT));
+    QVERIFY(filter.matches(1, 1, MAVLINK_MSG_ID_GLOBAL_POSITION_INT));
+    QVERIFY(!filter.matches(2, 1, MAVLINK_MSG_ID_GLOBAL_POSITION_INT));
+}
+
+void MAVLinkForwardFilterTest::_testInvalid()
+{
+    MAVLinkForwardFilter filter;
+    for (const QString &rule : { QStringLiteral("256"), QStringLiteral("1/2/3/4"), QStringLiteral("1//3"), QStringLiteral("*/*/NOT_A_MESSAGE") }) {
+        QVERIFY(!filter.parse(QStringLiteral("1/1,") + rule));
+        QVERIFY(!filter.errorString().isEmpty());
+        QVERIFY(!filter.isEmpty());
+
+        // Nothing is forwarded until the filter is fixed
+        QVERIFY(!filter.matches(1, 1, MAVLINK_MSG_ID_HEARTBEAT));
+    }
+
+    QVERIFY(filter.parse(QString()));
+    QVERIFY(filter.errorString().isEmpty());
+    QVERIFY(filter.matches(1, 1, MAVLINK_MSG_ID_HEARTBEAT));
+}
@@ -0,0 +1,88 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkLogWriterTest.h"
+#include "MAVLinkLogWriter.h"
+
+#include <QtCore/QFileInfo>
+#include <QtCore/QTemporaryFile>
+#include <QtCore/QtEndian>
+#include <QtTest/QTest>
+
+void MAVLinkLogWriterTest::_testWrite()
+{
+    QTemporaryFile file;
+    QVERIFY(file.open());
+
+    // Small ring so the records wrap around many times
+    MAVLinkLogWriter writer(8 * 1024);
+    writer.setFlushSize(1024);
+    writer.startWriting(&file);
+    QVERIFY(writer.writing());
+
+    QByteArray expected;
+    for (int i = 0; i < 5000; i++) {
+        const QByteArray data(10 + (i % 270), static_cast<char>(i));
+        const quint64 timestamp = 1000000ULL + i;
+
+        // Give the writer thread a chance to catch up instead of overrunning the small ring
+        while (!writer.write(timestamp, data.constData(), data.size())) {
+            QThread::yieldCurrentThread();
+        }
+
+        char timestampBytes[sizeof(timestamp)];
+        qToBigEndian(timestamp, timestampBytes);
+        (void) expected.append(timestampBytes, sizeof(timestampBytes));
+        (void) expected.append(data);
+    }
+
+    writer.stopWriting();
+    QVERIFY(!writer.writing());
+    QCOMPARE(writer.bytesWritten(), static_cast<quint64>(expected.size()));
+    QCOMPARE(writer.writeErrors(), 0ULL);
+
+    QVERIFY(file.seek(0));
+    QCOMPARE(file.readAll(), expected);
+}
+
+void MAVLinkLogWriterTest::_testFlushInterval()
+{
+    QTemporaryFile file;
+    QVERIFY(file.open());
+
+    MAVLinkLogWriter writer;
+    writer.setFlushInterval(50);
+    writer.startWriting(&file);
+
+    // Well below the flush size, so only the flush interval gets this to disk
+    const QByteArray data(32, 'x');
+    QVERIFY(writer.write(0, data.constData(), data.size()));
+    QTRY_COMPARE(QFileInfo(file.fileName()).size(), static_cast<qint64>(sizeof(quint64) + data.size()));
+
+    writer.stopWriting();
+}
+
+void MAVLinkLogWriterTest::_testOverrun()
+{
+    // Writer thread is not running so nothing drains the ring
+    MAVLinkLogWriter writer(MAVLinkLogWriter::kMinCapacity);
+
+    const QByteArray data(100, 'x');
+    const qsizetype recordLength = sizeof(quint64) + data.size();
+    const int fittingRecords = MAVLinkLogWriter::kMinCapacity / recordLength;
+
+    for (int i = 0; i < fittingRecords; i++) {
+        QVERIFY(writer.write(i, data.constData(), data.size()));
+    }
+    QVERIFY(!writer.write(0, data.constData(), data.size()));
+    QVERIFY(!writer.write(0, data.constData(), data.size()));
+
+    QCOMPARE(writer.overruns(), 2ULL);
+    QCOMPARE(writer.droppedBytes(), static_cast<quint64>(2 * recordLength));
+}
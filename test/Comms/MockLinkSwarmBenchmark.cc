@@ -0,0 +1,149 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MockLinkSwarmBenchmark.h"
+#include "LinkMetrics.h"
+#include "MockLink.h"
+#include "MockLinkSwarm.h"
+#include "MultiVehicleManager.h"
+#include "QmlObjectListModel.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QTimer>
+#include <QtTest/QTest>
+
+#include <algorithm>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+constexpr int kSettleMSecs = 2000;
+constexpr int kMeasureMSecs = 10000;
+constexpr int kProbeIntervalMSecs = 10;
+
+/// @return Resident set size of the process, 0 if unknown on this platform
+qint64 _residentBytes()
+{
+#ifdef Q_OS_LINUX
+    QFile statm(QStringLiteral("/proc/self/statm"));
+    if (statm.open(QIODevice::ReadOnly)) {
+        const QList<QByteArray> fields = statm.readAll().split(' ');
+        if (fields.count() > 1) {
+            return (fields[1].toLongLong() * sysconf(_SC_PAGESIZE));
+        }
+    }
+#endif
+    return 0;
+}
+
+quint64 _messagesReceived(const MockLinkSwarm &swarm)
+{
+    quint64 messages = 0;
+    for (const MockLink *link : swarm.links()) {
+        messages += link->metrics()->messagesReceived();
+    }
+    return messages;
+}
+
+double _percentileMSecs(const QList<qint64> &sortedNSecs, double percentile)
+{
+    if (sortedNSecs.isEmpty()) {
+        return 0;
+    }
+
+    const qsizetype index = qMin(static_cast<qsizetype>(percentile * sortedNSecs.count()), sortedNSecs.count() - 1);
+    return (static_cast<double>(sortedNSecs[index]) / 1e6);
+}
+
+} // namespace
+
+void MockLinkSwarmBenchmark::_benchmarkSwarm_data()
+{
+    QTest::addColumn<int>("vehicleCount");
+    QTest::addColumn<int>("linkCount");
+    QTest::addColumn<int>("burstIntervalMSecs");
+
+    QTest::newRow("50 vehicles, 1 link") << 50 << 1 << 0;
+    QTest::newRow("100 vehicles, 1 link") << 100 << 1 << 0;
+    QTest::newRow("250 vehicles, 1 link") << 250 << 1 << 0;
+    QTest::newRow("250 vehicles, 5 links") << 250 << 5 << 0;
+    QTest::newRow("250 vehicles, 5 links, 200ms bursts") << 250 << 5 << 200;
+}
+
+void MockLinkSwarmBenchmark::_benchmarkSwarm()
+{
+    QFETCH(int, vehicleCount);
+    QFETCH(int, linkCount);
+    QFETCH(int, burstIntervalMSecs);
+
+    QmlObjectListModel *const vehicles = MultiVehicleManager::instance()->vehicles();
+    QCOMPARE(vehicles->count(), 0);
+    const qint64 residentBefore = _residentBytes();
+
+    MockLinkSwarmConfig config;
+    config.vehicleCount = vehicleCount;
+    config.linkCount = linkCount;
+    config.burstIntervalMSecs = burstIntervalMSecs;
+
+    MockLinkSwarm swarm(config);
+    QVERIFY(swarm.start());
+    QTRY_COMPARE_WITH_TIMEOUT(vehicles->count(), vehicleCount, 60000);
+    QTest::qWait(kSettleMSecs);
+
+    const qint64 residentPerVehicle = (residentBefore > 0) ? ((_residentBytes() - residentBefore) / vehicleCount) : 0;
+
+    // Time from posting an event on the GUI thread until it is processed. Probes still queued when probeContext goes
+    // away are dropped.
+    QList<qint64> latencyNSecs;
+    QObject probeContext;
+    QTimer probe;
+    probe.setTimerType(Qt::PreciseTimer);
+    (void) connect(&probe, &QTimer::timeout, &probeContext, [&probeContext, &latencyNSecs]() {
+        const qint64 postedNSecs = LinkMetrics::timestampNSecs();
+        QTimer::singleShot(0, &probeContext, [&latencyNSecs, postedNSecs]() {
+            latencyNSecs.append(LinkMetrics::timestampNSecs() - postedNSecs);
+        });
+    });
+
+    const quint64 receivedStart = _messagesReceived(swarm);
+    const quint64 sentStart = swarm.messagesSent();
+    QElapsedTimer measureTimer;
+    measureTimer.start();
+    probe.start(kProbeIntervalMSecs);
+    QTest::qWait(kMeasureMSecs);
+    probe.stop();
+    const double elapsedSecs = static_cast<double>(measureTimer.elapsed()) / 1000.0;
+
+    const double receivedRate = static_cast<double>(_messagesReceived(swarm) - receivedStart) / elapsedSecs;
+    const double sentRate = static_cast<double>(swarm.messagesSent() - sentStart) / elapsedSecs;
+
+    std::sort(latencyNSecs.begin(), latencyNSecs.end());
+
+    qInfo().noquote() << QStringLiteral("swarm vehicles:%1 links:%2 burst_ms:%3 sent_msgs_per_s:%4 received_msgs_per_s:%5 latency_ms p50:%6 p95:%7 p99:%8 max:%9 rss_per_vehicle_kb:%10")
+        .arg(vehicleCount)
+        .arg(linkCount)
+        .arg(burstIntervalMSecs)
+        .arg(sentRate, 0, 'f', 0)
+        .arg(receivedRate, 0, 'f', 0)
+        .arg(_percentileMSecs(latencyNSecs, 0.50), 0, 'f', 2)
+        .arg(_percentileMSecs(latencyNSecs, 0.95), 0, 'f', 2)
+        .arg(_percentileMSecs(latencyNSecs, 0.99), 0, 'f', 2)
+        .arg(_percentileMSecs(latencyNSecs, 1.0), 0, 'f', 2)
+        .arg(residentPerVehicle / 1024);
+
+    QTest::setBenchmarkResult(receivedRate, QTest::Events);
+
+    swarm.stop();
+    QTRY_COMPARE_WITH_TIMEOUT(vehicles->count(), 0, 60000);
+}
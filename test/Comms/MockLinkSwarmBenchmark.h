@@ -0,0 +1,24 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+/// End to end receive throughput with a MockLinkSwarm driving LinkManager, MAVLinkProtocol, MultiVehicleManager and
+/// Vehicle. Reports messages per second, GUI event loop latency percentiles and memory per vehicle.
+/// Standalone, run with the benchmark build target or --unittest:MockLinkSwarmBenchmark.
+class MockLinkSwarmBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _benchmarkSwarm_data();
+    void _benchmarkSwarm();
+};
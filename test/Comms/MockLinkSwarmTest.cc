@@ -0,0 +1,58 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MockLinkSwarmTest.h"
+#include "LinkMetrics.h"
+#include "MockLink.h"
+#include "MockLinkSwarm.h"
+#include "MultiVehicleManager.h"
+#include "QmlObjectListModel.h"
+
+#include <QtTest/QTest>
+
+void MockLinkSwarmTest::_testSwarm()
+{
+    MockLinkSwarmConfig config;
+    config.vehicleCount = 6;
+    config.linkCount = 2;
+    config.lossPercent = 10;
+    config.reorderPercent = 5;
+
+    MockLinkSwarm swarm(config);
+    QVERIFY(swarm.start());
+    QCOMPARE(swarm.links().count(), 2);
+
+    QmlObjectListModel *const vehicles = MultiVehicleManager::instance()->vehicles();
+    QTRY_COMPARE_WITH_TIMEOUT(vehicles->count(), 6, 10000);
+
+    // Injected loss and reordering show up as sequence gaps on both links
+    for (const MockLink *link : swarm.links()) {
+        QTRY_VERIFY_WITH_TIMEOUT(link->metrics()->messagesReceived() > 0, 5000);
+        QTRY_VERIFY_WITH_TIMEOUT(link->metrics()->sequenceGaps() > 0, 5000);
+    }
+
+    swarm.stop();
+    QVERIFY(swarm.messagesSent() > 0);
+    QVERIFY(swarm.messagesDropped() > 0);
+    QVERIFY(swarm.links().isEmpty());
+
+    QTRY_COMPARE_WITH_TIMEOUT(vehicles->count(), 0, 10000);
+}
+
+void MockLinkSwarmTest::_testLimits()
+{
+    MockLinkSwarmConfig config;
+    config.vehicleCount = 1000;
+    config.firstSystemId = 200;
+    config.linkCount = 100;
+
+    // System ids stop short of the one used by QGC
+    const MockLinkSwarm swarm(config);
+    QCOMPARE(swarm.vehicleCount(), 55);
+}
@@ -0,0 +1,137 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "TLogIndexTest.h"
+#include "TLogIndex.h"
+#include "MAVLinkLib.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QtEndian>
+#include <QtTest/QTest>
+
+/// Generates a 50 Hz tlog with an attitude message every record and a heartbeat once a second.
+/// Optional garbage is inserted after every heartbeat.
+QByteArray TLogIndexTest::_buildLog(int seconds, const QByteArray &garbage)
+{
+    QByteArray log;
+    uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
+    quint64 timestamp = kStartTimeUSecs;
+
+    for (int tick = 0; tick < (seconds * 50); tick++) {
+        mavlink_message_t message;
+        const bool heartbeat = ((tick % 50) == 0);
+        if (heartbeat) {
+            (void) mavlink_msg_heartbeat_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, MAVLINK_COMM_12, &message, MAV_TYPE_QUADROTOR, MAV_AUTOPILOT_PX4, 0, 0, MAV_STATE_ACTIVE);
+        } else {
+            (void) mavlink_msg_attitude_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, MAVLINK_COMM_12, &message, tick, 0.1f, 0.2f, 0.3f, 0.f, 0.f, 0.f);
+        }
+
+        char timestampBytes[sizeof(timestamp)];
+        qToBigEndian(timestamp, timestampBytes);
+        (void) log.append(timestampBytes, sizeof(timestampBytes));
+        const uint16_t len = mavlink_msg_to_send_buffer(buffer, &message);
+        (void) log.append(reinterpret_cast<const char*>(buffer), len);
+        if (heartbeat) {
+            (void) log.append(garbage);
+        }
+
+        timestamp += kRecordIntervalUSecs;
+    }
+
+    return log;
+}
+
+bool TLogIndexTest::_writeFile(const QString &filename, const QByteArray &data)
+{
+    QFile file(filename);
+    return (file.open(QFile::WriteOnly | QFile::Truncate) && (file.write(data) == data.size()));
+}
+
+void TLogIndexTest::_testBuild()
+{
+    const QTemporaryDir tmpDir;
+    const QString logFilename = tmpDir.filePath(QStringLiteral("build.tlog"));
+    QVERIFY(_writeFile(logFilename, _buildLog(10)));
+
+    TLogIndex index;
+    QVERIFY(index.build(logFilename));
+    QCOMPARE(index.startTimeUSecs(), kStartTimeUSecs);
+    QCOMPARE(index.endTimeUSecs(), kStartTimeUSecs + (499 * kRecordIntervalUSecs));
+    QCOMPARE(index.messageCount(), 500ULL);
+    QCOMPARE(index.messageCounts().value(MAVLINK_MSG_ID_HEARTBEAT), 10ULL);
+    QCOMPARE(index.messageCounts().value(MAVLINK_MSG_ID_ATTITUDE), 490ULL);
+
+    const QList<TLogIndex::Entry> &entries = index.entries();
+    QCOMPARE(entries.count(), 39);
+    for (qsizetype i = 1; i < entries.count(); i++) {
+        QVERIFY(entries[i].timestampUSecs >= (entries[i - 1].timestampUSecs + TLogIndex::kIntervalUSecs));
+        QVERIFY(entries[i].offset > entries[i - 1].offset);
+    }
+}
+
+void TLogIndexTest::_testSeek()
+{
+    const QTemporaryDir tmpDir;
+    const QString logFilename = tmpDir.filePath(QStringLiteral("seek.tlog"));
+    const QByteArray log = _buildLog(10);
+    QVERIFY(_writeFile(logFilename, log));
+
+    TLogIndex index;
+    QVERIFY(index.build(logFilename));
+
+    const quint64 targetUSecs = kStartTimeUSecs + 6100000;
+    const TLogIndex::Entry entry = index.entryForTimestamp(targetUSecs);
+    QVERIFY(entry.timestampUSecs <= targetUSecs);
+    QVERIFY((targetUSecs - entry.timestampUSecs) < (TLogIndex::kIntervalUSecs + kRecordIntervalUSecs));
+
+    // The entry offset points at a record
+    QCOMPARE(TLogIndex::parseTimestamp(log.constData() + entry.offset), entry.timestampUSecs);
+    QCOMPARE(static_cast<uint8_t>(log[entry.offset + TLogIndex::kTimestampSize]), static_cast<uint8_t>(MAVLINK_STX));
+
+    // Out of range timestamps clamp to the first and last entries
+    QCOMPARE(index.entryForTimestamp(0).offset, static_cast<qint64>(0));
+    QCOMPARE(index.entryForTimestamp(UINT64_MAX).timestampUSecs, index.entries().constLast().timestampUSecs);
+}
+
+void TLogIndexTest::_testCache()
+{
+    const QTemporaryDir tmpDir;
+    const QString logFilename = tmpDir.filePath(QStringLiteral("cache.tlog"));
+    QVERIFY(_writeFile(logFilename, _buildLog(5)));
+
+    TLogIndex index;
+    QVERIFY(index.load(logFilename));
+    QVERIFY(QFile::exists(TLogIndex::sidecarFilename(logFilename)));
+
+    TLogIndex cachedIndex;
+    QVERIFY(cachedIndex.load(logFilename));
+    QCOMPARE(cachedIndex.messageCount(), index.messageCount());
+    QCOMPARE(cachedIndex.messageCounts(), index.messageCounts());
+    QCOMPARE(cachedIndex.entries().count(), index.entries().count());
+    QCOMPARE(cachedIndex.entries().constLast().offset, index.entries().constLast().offset);
+
+    // A changed log invalidates the cached index
+    QVERIFY(_writeFile(logFilename, _buildLog(8)));
+    TLogIndex rebuiltIndex;
+    QVERIFY(rebuiltIndex.load(logFilename));
+    QCOMPARE(rebuiltIndex.messageCount(), 400ULL);
+}
+
+void TLogIndexTest::_testResync()
+{
+    const QTemporaryDir tmpDir;
+    const QString logFilename = tmpDir.filePath(QStringLiteral("resync.tlog"));
+    QVERIFY(_writeFile(logFilename, _buildLog(10, QByteArray("\x01\x02\x03\x04\x05", 5))));
+
+    TLogIndex index;
+    QVERIFY(index.build(logFilename));
+    QCOMPARE(index.messageCount(), 500ULL);
+    QCOMPARE(index.endTimeUSecs(), kStartTimeUSecs + (499 * kRecordIntervalUSecs));
+}
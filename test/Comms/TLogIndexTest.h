@@ -0,0 +1,30 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class TLogIndexTest : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _testBuild();
+    void _testSeek();
+    void _testCache();
+    void _testResync();
+
+private:
+    static QByteArray _buildLog(int seconds, const QByteArray &garbage = QByteArray());
+    static bool _writeFile(const QString &filename, const QByteArray &data);
+
+    static constexpr quint64 kStartTimeUSecs = 1700000000000000ULL;
+    static constexpr quint64 kRecordIntervalUSecs = 20000;
+};
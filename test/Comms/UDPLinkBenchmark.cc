@@ -0,0 +1,110 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "UDPLinkBenchmark.h"
+#include "UDPLink.h"
+
+#include <QtCore/QDeadlineTimer>
+#include <QtNetwork/QUdpSocket>
+#include <QtTest/QTest>
+
+namespace
+{
+
+constexpr int kDatagramSize = 280;
+constexpr int kDatagramsPerRound = 100;
+
+quint16 _freePort()
+{
+    QUdpSocket socket;
+    (void) socket.bind(QHostAddress::LocalHost, 0);
+    return socket.localPort();
+}
+
+/// Sends datagrams to a worker running on the test thread and counts the bytes it receives
+class UDPReceiver
+{
+public:
+    UDPReceiver(bool batched)
+        : _config(QStringLiteral("UDPLinkBenchmark"))
+        , _datagram(kDatagramSize, 'x')
+    {
+        _config.setLocalPort(_freePort());
+        _worker = new UDPWorker(&_config);
+        _worker->setupSocket();
+        _worker->setBatchedReceive(batched);
+        (void) QObject::connect(_worker, &UDPWorker::dataReceived, _worker, [this](const QByteArray &data, qint64) {
+            _received += data.size();
+        });
+        _worker->connectLink();
+        (void) _sender.bind(QHostAddress::LocalHost, 0);
+    }
+
+    ~UDPReceiver()
+    {
+        delete _worker;
+    }
+
+    bool connected() const { return _worker->isConnected(); }
+
+    /// Sends a round of datagrams and waits until all of them have been received
+    bool sendRound()
+    {
+        const qint64 expected = _received + (static_cast<qint64>(kDatagramsPerRound) * kDatagramSize);
+        for (int i = 0; i < kDatagramsPerRound; i++) {
+            if (_sender.writeDatagram(_datagram, QHostAddress::LocalHost, _config.localPort()) != kDatagramSize) {
+                return false;
+            }
+        }
+
+        const QDeadlineTimer deadline(5000);
+        while ((_received < expected) && !deadline.hasExpired()) {
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        }
+
+        return (_received == expected);
+    }
+
+private:
+    UDPConfiguration _config;
+    UDPWorker *_worker = nullptr;
+    QUdpSocket _sender;
+    const QByteArray _datagram;
+    qint64 _received = 0;
+};
+
+} // namespace
+
+void UDPLinkBenchmark::_benchmarkReceive_data()
+{
+    QTest::addColumn<bool>("batched");
+
+    QTest::newRow("qudpsocket") << false;
+    QTest::newRow("recvmmsg") << true;
+}
+
+void UDPLinkBenchmark::_benchmarkReceive()
+{
+    QFETCH(bool, batched);
+
+    if (batched && !UDPWorker::batchedReceiveSupported()) {
+        QSKIP("Batched receive not supported on this platform");
+    }
+
+    UDPReceiver receiver(batched);
+    QVERIFY(receiver.connected());
+
+    // Rounds are drained before the next is sent so the socket receive buffer never overflows
+    constexpr int kRounds = 20;
+    QBENCHMARK {
+        for (int round = 0; round < kRounds; round++) {
+            QVERIFY(receiver.sendRound());
+        }
+    }
+}
@@ -0,0 +1,23 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+/// UDPWorker receive throughput with QUdpSocket and with batched recvmmsg reads.
+/// Standalone, run with the benchmark build target or --unittest:UDPLinkBenchmark.
+class UDPLinkBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _benchmarkReceive_data();
+    void _benchmarkReceive();
+};
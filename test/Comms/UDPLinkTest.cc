@@ -0,0 +1,155 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "UDPLinkTest.h"
+#include "UDPLink.h"
+
+#include <QtCore/QDeadlineTimer>
+#include <QtNetwork/QUdpSocket>
+#include <QtTest/QTest>
+
+namespace
+{
+
+constexpr int kDatagramSize = 280;
+
+quint16 _freePort()
+{
+    QUdpSocket socket;
+    (void) socket.bind(QHostAddress::LocalHost, 0);
+    return socket.localPort();
+}
+
+QByteArray _datagram(int index)
+{
+    QByteArray datagram(kDatagramSize, static_cast<char>(index & 0xFF));
+    (void) datagram.replace(0, sizeof(index), reinterpret_cast<const char*>(&index), sizeof(index));
+    return datagram;
+}
+
+/// Sends datagrams to a worker running on the test thread and collects what it receives
+class UDPReceiver
+{
+public:
+    UDPReceiver(bool batched)
+        : _config(QStringLiteral("UDPLinkTest"))
+    {
+        _config.setLocalPort(_freePort());
+        _worker = new UDPWorker(&_config);
+        _worker->setupSocket();
+        _worker->setBatchedReceive(batched);
+        (void) QObject::connect(_worker, &UDPWorker::dataReceived, _worker, [this](const QByteArray &data, qint64) {
+            (void) _received.append(data);
+        });
+        _worker->connectLink();
+        (void) _sender.bind(QHostAddress::LocalHost, 0);
+    }
+
+    ~UDPReceiver()
+    {
+        delete _worker;
+    }
+
+    bool connected() const { return _worker->isConnected(); }
+    bool batched() const { return _worker->batchedReceive(); }
+
+    /// Sends datagrams and waits until all of them have been received
+    bool sendRound(int firstIndex, int count)
+    {
+        const qsizetype expected = _received.size() + (static_cast<qsizetype>(count) * kDatagramSize);
+        for (int i = firstIndex; i < (firstIndex + count); i++) {
+            if (_sender.writeDatagram(_datagram(i), QHostAddress::LocalHost, _config.localPort()) != kDatagramSize) {
+                return false;
+            }
+        }
+
+        const QDeadlineTimer deadline(5000);
+        while ((_received.size() < expected) && !deadline.hasExpired()) {
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        }
+
+        return (_received.size() == expected);
+    }
+
+    /// Writes through the worker and waits for the datagram to reach the sender socket
+    QByteArray echo(const QByteArray &data)
+    {
+        _worker->writeData(data);
+
+        const QDeadlineTimer deadline(5000);
+        while (!_sender.hasPendingDatagrams() && !deadline.hasExpired()) {
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+        }
+
+        return _sender.hasPendingDatagrams() ? _sender.receiveDatagram().data() : QByteArray();
+    }
+
+    const QByteArray &received() const { return _received; }
+    void clear() { _received.clear(); }
+
+private:
+    UDPConfiguration _config;
+    UDPWorker *_worker = nullptr;
+    QUdpSocket _sender;
+    QByteArray _received;
+};
+
+} // namespace
+
+void UDPLinkTest::_testReceive_data()
+{
+    QTest::addColumn<bool>("batched");
+
+    QTest::newRow("qudpsocket") << false;
+    QTest::newRow("recvmmsg") << true;
+}
+
+void UDPLinkTest::_testReceive()
+{
+    QFETCH(bool, batched);
+
+    if (batched && !UDPWorker::batchedReceiveSupported()) {
+        QSKIP("Batched receive not supported on this platform");
+    }
+
+    UDPReceiver receiver(batched);
+    QVERIFY(receiver.connected());
+    QCOMPARE(receiver.batched(), batched);
+
+    // More datagrams than a single recvmmsg batch
+    constexpr int kDatagramCount = 75;
+    QVERIFY(receiver.sendRound(0, kDatagramCount));
+
+    const QByteArray &received = receiver.received();
+    QCOMPARE(received.size(), static_cast<qsizetype>(kDatagramCount * kDatagramSize));
+    for (int i = 0; i < kDatagramCount; i++) {
+        QCOMPARE(received.mid(i * kDatagramSize, kDatagramSize), _datagram(i));
+    }
+}
+
+void UDPLinkTest::_testSend_data()
+{
+    _testReceive_data();
+}
+
+void UDPLinkTest::_testSend()
+{
+    QFETCH(bool, batched);
+
+    if (batched && !UDPWorker::batchedReceiveSupported()) {
+        QSKIP("Batched receive not supported on this platform");
+    }
+
+    UDPReceiver receiver(batched);
+    QVERIFY(receiver.connected());
+
+    // The first datagram makes the sender a session target
+    QVERIFY(receiver.sendRound(0, 1));
+    QCOMPARE(receiver.echo(_datagram(1)), _datagram(1));
+}
@@ -0,0 +1,41 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "FactBenchmark.h"
+#include "Fact.h"
+
+#include <QtTest/QTest>
+
+namespace {
+    constexpr int kUpdateCount = 100000;
+}
+
+void FactBenchmark::_benchmarkSetRawValue()
+{
+    Fact fact(0, QStringLiteral("value"), FactMetaData::valueTypeFloat);
+    fact.setSendValueChangedSignals(false);
+
+    QBENCHMARK {
+        for (int i = 0; i < kUpdateCount; i++) {
+            fact.setRawValue(i * 0.5);
+        }
+    }
+}
+
+void FactBenchmark::_benchmarkSetRawValueDouble()
+{
+    Fact fact(0, QStringLiteral("value"), FactMetaData::valueTypeFloat);
+    fact.setSendValueChangedSignals(false);
+
+    QBENCHMARK {
+        for (int i = 0; i < kUpdateCount; i++) {
+            fact.setRawValueDouble(i * 0.5);
+        }
+    }
+}
@@ -0,0 +1,23 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+/// Fact update throughput of the QVariant setRawValue path against the typed setters used for telemetry.
+/// Standalone, run with the benchmark build target or --unittest:FactBenchmark.
+class FactBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _benchmarkSetRawValue();
+    void _benchmarkSetRawValueDouble();
+};
@@ -0,0 +1,100 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "FactTest.h"
+#include "Fact.h"
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+void FactTest::_testTypedSetters()
+{
+    Fact fact(0, QStringLiteral("value"), FactMetaData::valueTypeDouble);
+    QSignalSpy spyValue(&fact, &Fact::valueChanged);
+    QSignalSpy spyRawValue(&fact, &Fact::rawValueChanged);
+    QSignalSpy spyContainer(&fact, &Fact::containerRawValueChanged);
+
+    fact.setRawValueDouble(1.5);
+    QCOMPARE(fact.rawValue().metaType(), QMetaType::fromType<double>());
+    QCOMPARE(fact.rawValue().toDouble(), 1.5);
+    QCOMPARE(spyValue.count(), 1);
+    QCOMPARE(spyValue.at(0).at(0).toDouble(), 1.5);
+    QCOMPARE(spyRawValue.count(), 1);
+
+    // Values coming from the vehicle are not sent back to it
+    QCOMPARE(spyContainer.count(), 0);
+
+    // Unchanged values are not signalled, NaN included
+    fact.setRawValueDouble(1.5);
+    QCOMPARE(spyValue.count(), 1);
+    fact.setRawValueDouble(qQNaN());
+    fact.setRawValueDouble(qQNaN());
+    QCOMPARE(spyValue.count(), 2);
+    QVERIFY(qIsNaN(fact.rawValue().toDouble()));
+
+    // Same results as the QVariant setter
+    Fact referenceFact(0, QStringLiteral("reference"), FactMetaData::valueTypeDouble);
+    referenceFact.setRawValue(2.25);
+    fact.setRawValueInt(2);
+    fact.setRawValueDouble(2.25);
+    QCOMPARE(fact.rawValue(), referenceFact.rawValue());
+    QCOMPARE(fact.cookedValue(), referenceFact.cookedValue());
+}
+
+void FactTest::_testTypedSettersConversion()
+{
+    // Stored as the Fact type, the same as setRawValue does
+    Fact floatFact(0, QStringLiteral("float"), FactMetaData::valueTypeFloat);
+    floatFact.setRawValueDouble(0.1);
+    QCOMPARE(floatFact.rawValue().metaType(), QMetaType::fromType<float>());
+    QCOMPARE(floatFact.rawValue().toFloat(), 0.1f);
+
+    Fact uintFact(0, QStringLiteral("uint"), FactMetaData::valueTypeUint32);
+    uintFact.setRawValueDouble(41.6);
+    QCOMPARE(uintFact.rawValue().metaType(), QMetaType::fromType<uint>());
+    QCOMPARE(uintFact.rawValue().toUInt(), 42U);
+    Fact referenceFact(0, QStringLiteral("reference"), FactMetaData::valueTypeUint32);
+    referenceFact.setRawValue(41.6);
+    QCOMPARE(uintFact.rawValue(), referenceFact.rawValue());
+
+    Fact int64Fact(0, QStringLiteral("int64"), FactMetaData::valueTypeInt64);
+    int64Fact.setRawValueInt(-(Q_INT64_C(1) << 40));
+    QCOMPARE(int64Fact.rawValue().metaType(), QMetaType::fromType<qint64>());
+    QCOMPARE(int64Fact.rawValue().toLongLong(), -(Q_INT64_C(1) << 40));
+
+    Fact boolFact(0, QStringLiteral("bool"), FactMetaData::valueTypeBool);
+    QSignalSpy spyBool(&boolFact, &Fact::valueChanged);
+    boolFact.setRawValueBool(true);
+    QCOMPARE(boolFact.rawValue().metaType(), QMetaType::fromType<bool>());
+    QVERIFY(boolFact.rawValue().toBool());
+    boolFact.setRawValueInt(1);
+    QCOMPARE(spyBool.count(), 1);
+
+    // Non numeric types go through setRawValue
+    Fact stringFact(0, QStringLiteral("string"), FactMetaData::valueTypeString);
+    stringFact.setRawValueInt(7);
+    QCOMPARE(stringFact.rawValue().toString(), QStringLiteral("7"));
+}
+
+void FactTest::_testDeferredSignals()
+{
+    Fact fact(0, QStringLiteral("value"), FactMetaData::valueTypeDouble);
+    fact.setSendValueChangedSignals(false);
+    QSignalSpy spyValue(&fact, &Fact::valueChanged);
+
+    fact.setRawValueDouble(1);
+    fact.setRawValueDouble(2);
+    QCOMPARE(spyValue.count(), 0);
+    QVERIFY(fact.deferredValueChangeSignal());
+
+    fact.sendDeferredValueChangedSignal();
+    QCOMPARE(spyValue.count(), 1);
+    QCOMPARE(spyValue.at(0).at(0).toDouble(), 2.);
+    QVERIFY(!fact.deferredValueChangeSignal());
+}
@@ -0,0 +1,146 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "FactUpdateSchedulerTest.h"
+#include "FactGroup.h"
+#include "FactUpdateScheduler.h"
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+namespace {
+
+class TestFactGroup : public FactGroup
+{
+public:
+    explicit TestFactGroup(int updateRateMSecs, QObject *parent = nullptr)
+        : FactGroup(updateRateMSecs, parent)
+    {
+        _addFact(&value1);
+        _addFact(&value2);
+    }
+
+    void setPeriodicUpdates(bool periodicUpdates) { _setPeriodicUpdates(periodicUpdates); }
+
+    Fact value1 = Fact(0, QStringLiteral("value1"), FactMetaData::valueTypeDouble);
+    Fact value2 = Fact(0, QStringLiteral("value2"), FactMetaData::valueTypeDouble);
+    int periodicUpdateCount = 0;
+
+protected:
+    void _updateAllValues() override
+    {
+        periodicUpdateCount++;
+        value2.setRawValue(periodicUpdateCount);
+    }
+};
+
+constexpr int kUpdateRateMSecs = 50;
+
+}
+
+void FactUpdateSchedulerTest::_testCoalescing()
+{
+    FactUpdateScheduler *const scheduler = FactUpdateScheduler::instance();
+    TestFactGroup factGroup(kUpdateRateMSecs);
+
+    QSignalSpy spyValue1(&factGroup.value1, &Fact::valueChanged);
+    QSignalSpy spyValue2(&factGroup.value2, &Fact::valueChanged);
+    const quint64 signalsEmitted = scheduler->signalsEmitted();
+
+    factGroup.value1.setRawValue(1.);
+    factGroup.value1.setRawValue(2.);
+    factGroup.value1.setRawValue(3.);
+    QCOMPARE(spyValue1.count(), 0);
+    QCOMPARE(scheduler->pendingCount(), qsizetype(1));
+
+    QTRY_COMPARE_WITH_TIMEOUT(spyValue1.count(), 1, kUpdateRateMSecs * 10);
+    QCOMPARE(spyValue1.takeFirst().at(0).toDouble(), 3.);
+    QCOMPARE(scheduler->signalsEmitted(), signalsEmitted + 1);
+    QCOMPARE(scheduler->pendingCount(), qsizetype(0));
+
+    // Nothing changed, nothing sent
+    QTest::qWait(kUpdateRateMSecs * 3);
+    QCOMPARE(spyValue1.count(), 0);
+    QCOMPARE(spyValue2.count(), 0);
+}
+
+void FactUpdateSchedulerTest::_testSamePhase()
+{
+    FactUpdateScheduler *const scheduler = FactUpdateScheduler::instance();
+    TestFactGroup factGroup1(kUpdateRateMSecs);
+    TestFactGroup factGroup2(kUpdateRateMSecs);
+
+    quint64 flush1 = 0;
+    quint64 flush2 = 0;
+    (void) connect(&factGroup1.value1, &Fact::valueChanged, this, [&flush1, scheduler]() { flush1 = scheduler->flushes(); });
+    (void) connect(&factGroup2.value1, &Fact::valueChanged, this, [&flush2, scheduler]() { flush2 = scheduler->flushes(); });
+
+    // Changes made at different times within an update interval are sent by the same flush
+    factGroup1.value1.setRawValue(1.);
+    QTest::qWait(kUpdateRateMSecs / 5);
+    factGroup2.value1.setRawValue(1.);
+
+    QTRY_VERIFY_WITH_TIMEOUT((flush1 != 0) && (flush2 != 0), kUpdateRateMSecs * 10);
+    if (flush1 != flush2) {
+        // The first change may have just missed a flush
+        QVERIFY(flush2 > flush1);
+        QTest::qWait(kUpdateRateMSecs * 2);
+        flush1 = 0;
+        flush2 = 0;
+        factGroup1.value1.setRawValue(2.);
+        factGroup2.value1.setRawValue(2.);
+        QTRY_VERIFY_WITH_TIMEOUT((flush1 != 0) && (flush2 != 0), kUpdateRateMSecs * 10);
+    }
+    QCOMPARE(flush1, flush2);
+}
+
+void FactUpdateSchedulerTest::_testDestroyedWhilePending()
+{
+    FactUpdateScheduler *const scheduler = FactUpdateScheduler::instance();
+
+    TestFactGroup *factGroup = new TestFactGroup(kUpdateRateMSecs);
+    factGroup->value1.setRawValue(1.);
+    factGroup->value2.setRawValue(1.);
+    QCOMPARE(scheduler->pendingCount(), qsizetype(2));
+
+    delete factGroup;
+    QCOMPARE(scheduler->pendingCount(), qsizetype(0));
+
+    // The flush must skip the destroyed Facts
+    const quint64 signalsEmitted = scheduler->signalsEmitted();
+    QTest::qWait(kUpdateRateMSecs * 3);
+    QCOMPARE(scheduler->signalsEmitted(), signalsEmitted);
+}
+
+void FactUpdateSchedulerTest::_testPeriodicUpdates()
+{
+    TestFactGroup factGroup(kUpdateRateMSecs);
+    QSignalSpy spyValue2(&factGroup.value2, &Fact::valueChanged);
+
+    factGroup.setPeriodicUpdates(true);
+    QTRY_VERIFY_WITH_TIMEOUT(factGroup.periodicUpdateCount >= 2, kUpdateRateMSecs * 10);
+
+    // Values computed by the periodic update go out with the same flush
+    QCOMPARE(spyValue2.count(), factGroup.periodicUpdateCount);
+    QCOMPARE(spyValue2.last().at(0).toInt(), factGroup.periodicUpdateCount);
+
+    // Live updates send immediately and stop the periodic updates
+    factGroup.setLiveUpdates(true);
+    const int periodicUpdateCount = factGroup.periodicUpdateCount;
+    spyValue2.clear();
+    factGroup.value2.setRawValue(100.);
+    QCOMPARE(spyValue2.count(), 1);
+    QTest::qWait(kUpdateRateMSecs * 3);
+    QCOMPARE(factGroup.periodicUpdateCount, periodicUpdateCount);
+
+    factGroup.setLiveUpdates(false);
+    QTRY_VERIFY_WITH_TIMEOUT(factGroup.periodicUpdateCount > periodicUpdateCount, kUpdateRateMSecs * 10);
+
+    factGroup.setPeriodicUpdates(false);
+}
@@ -0,0 +1,157 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "ParamCacheFileTest.h"
+#include "ParamCacheFile.h"
+#include "QGC.h"
+
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QTest>
+
+static QList<ParamCacheFile::Param> _testParams()
+{
+    return {
+        { QStringLiteral("BAT_CAPACITY"), FactMetaData::valueTypeFloat, QVariant::fromValue(5000.5f), false },
+        { QStringLiteral("COM_FLTMODE1"), FactMetaData::valueTypeInt32, QVariant::fromValue(qint32(-1)), false },
+        { QStringLiteral("LND_FLIGHT_T_HI"), FactMetaData::valueTypeInt32, QVariant::fromValue(qint32(1234)), true },
+        { QStringLiteral("MAV_TYPE"), FactMetaData::valueTypeUint8, QVariant::fromValue(quint8(2)), false },
+        { QStringLiteral("SYS_AUTOSTART_XY"), FactMetaData::valueTypeUint32, QVariant::fromValue(quint32(4001)), false },
+    };
+}
+
+void ParamCacheFileTest::_testRoundTrip()
+{
+    const QTemporaryDir tmpDir;
+    const QString fileName = tmpDir.filePath(QStringLiteral("1_1.v3"));
+    const QList<ParamCacheFile::Param> params = _testParams();
+
+    QVERIFY(ParamCacheFile::write(fileName, params, ParamCacheFile::packFirmwareVersion(1, 15, 2)));
+
+    ParamCacheFile cacheFile(fileName);
+    QVERIFY(cacheFile.open());
+    QCOMPARE(cacheFile.count(), static_cast<quint32>(params.count()));
+    QCOMPARE(cacheFile.firmwareVersion(), static_cast<quint32>((1 << 16) | (15 << 8) | 2));
+
+    for (qsizetype i = 0; i < params.count(); i++) {
+        const quint32 index = static_cast<quint32>(i);
+        QCOMPARE(cacheFile.name(index), params[i].name);
+        QCOMPARE(cacheFile.type(index), params[i].type);
+        QCOMPARE(cacheFile.value(index), params[i].value);
+        QCOMPARE(cacheFile.isVolatile(index), params[i].volatileValue);
+        QCOMPARE(cacheFile.indexOf(params[i].name), static_cast<qint64>(i));
+    }
+
+    const QList<ParamCacheFile::Param> copied = cacheFile.params();
+    cacheFile.close();
+    QCOMPARE(copied.count(), params.count());
+    for (qsizetype i = 0; i < params.count(); i++) {
+        QCOMPARE(copied[i].name, params[i].name);
+        QCOMPARE(copied[i].type, params[i].type);
+        QCOMPARE(copied[i].value, params[i].value);
+        QCOMPARE(copied[i].volatileValue, params[i].volatileValue);
+    }
+
+    QVERIFY(cacheFile.open());
+    QCOMPARE(cacheFile.indexOf(QStringLiteral("BAT")), -1LL);
+    QCOMPARE(cacheFile.indexOf(QStringLiteral("ZZZ")), -1LL);
+    QCOMPARE(cacheFile.indexOf(QStringLiteral("NAME_LONGER_THAN_16")), -1LL);
+
+    // Not opened writable
+    QVERIFY(!cacheFile.updateValue(QStringLiteral("MAV_TYPE"), FactMetaData::valueTypeUint8, 1));
+}
+
+void ParamCacheFileTest::_testHash()
+{
+    const QList<ParamCacheFile::Param> params = _testParams();
+
+    // Same crc the vehicle computes: name followed by the value bytes, volatile params skipped
+    quint32 expected = 0;
+    for (const ParamCacheFile::Param &param : params) {
+        if (param.volatileValue) {
+            continue;
+        }
+        const QByteArray name = param.name.toLatin1();
+        expected = QGC::crc32(reinterpret_cast<const quint8*>(name.constData()), static_cast<unsigned>(name.length()), expected);
+        expected = QGC::crc32(static_cast<const quint8*>(param.value.constData()), static_cast<unsigned>(FactMetaData::typeToSize(param.type)), expected);
+    }
+    QCOMPARE(ParamCacheFile::hash(params), expected);
+
+    const QTemporaryDir tmpDir;
+    const QString fileName = tmpDir.filePath(QStringLiteral("1_1.v3"));
+    QVERIFY(ParamCacheFile::write(fileName, params, 0));
+
+    ParamCacheFile cacheFile(fileName);
+    QVERIFY(cacheFile.open());
+    QCOMPARE(cacheFile.paramHash(), expected);
+
+    // Volatile values don't change the hash
+    QList<ParamCacheFile::Param> changed = params;
+    changed[2].value = QVariant::fromValue(qint32(99));
+    QCOMPARE(ParamCacheFile::hash(changed), expected);
+    changed[1].value = QVariant::fromValue(qint32(3));
+    QVERIFY(ParamCacheFile::hash(changed) != expected);
+}
+
+void ParamCacheFileTest::_testUpdateValue()
+{
+    const QTemporaryDir tmpDir;
+    const QString fileName = tmpDir.filePath(QStringLiteral("1_1.v3"));
+    QList<ParamCacheFile::Param> params = _testParams();
+    QVERIFY(ParamCacheFile::write(fileName, params, 0));
+
+    {
+        ParamCacheFile cacheFile(fileName);
+        QVERIFY(cacheFile.open(true));
+        QVERIFY(cacheFile.updateValue(QStringLiteral("COM_FLTMODE1"), FactMetaData::valueTypeInt32, QVariant::fromValue(qint32(7))));
+        QVERIFY(!cacheFile.updateValue(QStringLiteral("COM_FLTMODE1"), FactMetaData::valueTypeFloat, 7.0f));
+        QVERIFY(!cacheFile.updateValue(QStringLiteral("NOT_CACHED"), FactMetaData::valueTypeInt32, 7));
+    }
+
+    // The in place update must end up identical to a complete rewrite
+    params[1].value = QVariant::fromValue(qint32(7));
+
+    ParamCacheFile cacheFile(fileName);
+    QVERIFY(cacheFile.open());
+    QCOMPARE(cacheFile.value(1), QVariant::fromValue(qint32(7)));
+    QCOMPARE(cacheFile.paramHash(), ParamCacheFile::hash(params));
+}
+
+void ParamCacheFileTest::_testInvalidFile()
+{
+    const QTemporaryDir tmpDir;
+    const QString fileName = tmpDir.filePath(QStringLiteral("1_1.v3"));
+
+    ParamCacheFile missing(fileName);
+    QVERIFY(!missing.open());
+
+    QVERIFY(ParamCacheFile::write(fileName, _testParams(), 0));
+
+    // Truncated record table
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.resize(file.size() - 1));
+    file.close();
+
+    ParamCacheFile truncated(fileName);
+    QVERIFY(!truncated.open());
+    QVERIFY(!truncated.isOpen());
+
+    // Previous QDataStream based cache format
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    QVERIFY(file.write(QByteArray(64, '\x01')) == 64);
+    file.close();
+
+    ParamCacheFile wrongMagic(fileName);
+    QVERIFY(!wrongMagic.open());
+
+    // Names which don't fit a record are rejected
+    QList<ParamCacheFile::Param> params = _testParams();
+    params[0].name = QStringLiteral("NAME_LONGER_THAN_16");
+    QVERIFY(!ParamCacheFile::write(fileName, params, 0));
+}
@@ -0,0 +1,55 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "ParamMetaDataBlobBenchmark.h"
+#include "ParamMetaDataBlob.h"
+#include "PX4ParameterMetaData.h"
+
+#include <QtTest/QTest>
+
+static constexpr const char *kPX4MetaDataFile = ":/FirmwarePlugin/PX4/PX4ParameterFactMetaData.xml";
+
+/// Names of the params which are typically looked at after connecting
+static const QStringList kViewedParams = {
+    QStringLiteral("BAT1_CAPACITY"),
+    QStringLiteral("COM_FLTMODE1"),
+    QStringLiteral("MPC_XY_VEL_MAX"),
+    QStringLiteral("NAV_RCL_ACT"),
+    QStringLiteral("RTL_RETURN_ALT"),
+    QStringLiteral("SYS_AUTOSTART"),
+};
+
+static void _loadViewedParams()
+{
+    PX4ParameterMetaData metaData;
+    metaData.loadParameterFactMetaDataFile(kPX4MetaDataFile);
+    for (const QString &name : kViewedParams) {
+        (void) metaData.getMetaDataForFact(name, MAV_TYPE_QUADROTOR, FactMetaData::valueTypeFloat);
+    }
+}
+
+void ParamMetaDataBlobBenchmark::_benchmarkPX4XmlLoad()
+{
+    // Only the first load after a meta data update parses the xml, which also compiles the blob
+    (void) QFile::remove(ParamMetaDataBlob::cacheFileName(ParamMetaDataBlob::sourceKey(kPX4MetaDataFile)));
+
+    QBENCHMARK_ONCE {
+        _loadViewedParams();
+    }
+}
+
+void ParamMetaDataBlobBenchmark::_benchmarkPX4BlobLoad()
+{
+    // Compiles the blob if it doesn't exist yet
+    _loadViewedParams();
+
+    QBENCHMARK {
+        _loadViewedParams();
+    }
+}
@@ -0,0 +1,23 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+/// PX4 parameter meta data load time from the XML against the precompiled blob, including the lookups after connecting.
+/// Standalone, run with the benchmark build target or --unittest:ParamMetaDataBlobBenchmark.
+class ParamMetaDataBlobBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _benchmarkPX4XmlLoad();
+    void _benchmarkPX4BlobLoad();
+};
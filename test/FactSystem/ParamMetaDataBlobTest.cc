@@ -0,0 +1,186 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "ParamMetaDataBlobTest.h"
+#include "ParamMetaDataBlob.h"
+#include "PX4ParameterMetaData.h"
+
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QTest>
+
+static constexpr const char *kPX4MetaDataFile = ":/FirmwarePlugin/PX4/PX4ParameterFactMetaData.xml";
+
+static void _compareMetaData(const FactMetaData *actual, const FactMetaData *expected)
+{
+    QCOMPARE(actual->type(), expected->type());
+    QCOMPARE(actual->name(), expected->name());
+    QCOMPARE(actual->category(), expected->category());
+    QCOMPARE(actual->group(), expected->group());
+    QCOMPARE(actual->shortDescription(), expected->shortDescription());
+    QCOMPARE(actual->longDescription(), expected->longDescription());
+    QCOMPARE(actual->rawUnits(), expected->rawUnits());
+    QCOMPARE(actual->cookedUnits(), expected->cookedUnits());
+    QCOMPARE(actual->decimalPlaces(), expected->decimalPlaces());
+    QCOMPARE(actual->rawMin(), expected->rawMin());
+    QCOMPARE(actual->rawMax(), expected->rawMax());
+    QCOMPARE(actual->cookedMax(), expected->cookedMax());
+    QCOMPARE(actual->defaultValueAvailable(), expected->defaultValueAvailable());
+    if (expected->defaultValueAvailable()) {
+        QCOMPARE(actual->rawDefaultValue(), expected->rawDefaultValue());
+    }
+    QCOMPARE(qIsNaN(actual->rawIncrement()), qIsNaN(expected->rawIncrement()));
+    if (!qIsNaN(expected->rawIncrement())) {
+        QCOMPARE(actual->rawIncrement(), expected->rawIncrement());
+    }
+    QCOMPARE(actual->enumStrings(), expected->enumStrings());
+    QCOMPARE(actual->enumValues(), expected->enumValues());
+    QCOMPARE(actual->bitmaskStrings(), expected->bitmaskStrings());
+    QCOMPARE(actual->bitmaskValues(), expected->bitmaskValues());
+    QCOMPARE(actual->vehicleRebootRequired(), expected->vehicleRebootRequired());
+    QCOMPARE(actual->qgcRebootRequired(), expected->qgcRebootRequired());
+    QCOMPARE(actual->hasControl(), expected->hasControl());
+    QCOMPARE(actual->readOnly(), expected->readOnly());
+    QCOMPARE(actual->writeOnly(), expected->writeOnly());
+    QCOMPARE(actual->volatileValue(), expected->volatileValue());
+}
+
+void ParamMetaDataBlobTest::_testRoundTrip()
+{
+    FactMetaData::NameToMetaDataMap_t metaDataMap;
+
+    FactMetaData *const altitude = new FactMetaData(FactMetaData::valueTypeFloat, QStringLiteral("RTL_RETURN_ALT"), this);
+    altitude->setShortDescription(QStringLiteral("Return mode return altitude"));
+    altitude->setLongDescription(QStringLiteral("Default minimum altitude above home for return flight."));
+    altitude->setGroup(QStringLiteral("Return Mode"));
+    altitude->setCategory(QStringLiteral("Standard"));
+    altitude->setRawUnits(QStringLiteral("m"));
+    altitude->setRawMin(0.0f);
+    altitude->setRawMax(150.0f);
+    altitude->setRawDefaultValue(60.0f);
+    altitude->setRawIncrement(0.5);
+    altitude->setDecimalPlaces(1);
+    metaDataMap[altitude->name()] = altitude;
+
+    FactMetaData *const action = new FactMetaData(FactMetaData::valueTypeInt32, QStringLiteral("NAV_RCL_ACT"), this);
+    action->setRawUnits(QStringLiteral("m"));
+    action->addEnumInfo(QStringLiteral("Hold"), 1);
+    action->addEnumInfo(QStringLiteral("Return"), 2);
+    action->setVehicleRebootRequired(true);
+    metaDataMap[action->name()] = action;
+
+    FactMetaData *const mask = new FactMetaData(FactMetaData::valueTypeUint16, QStringLiteral("CBRK_IO_SAFETY"), this);
+    mask->addBitmaskInfo(QStringLiteral("Bit 0"), 1);
+    mask->addBitmaskInfo(QStringLiteral("Bit 1"), 2);
+    mask->setVolatileValue(true);
+    mask->setHasControl(false);
+    metaDataMap[mask->name()] = mask;
+
+    // Key differs from the name, like the generic meta data of duplicate PX4 params
+    metaDataMap[QStringLiteral("DUPLICATE")] = new FactMetaData(FactMetaData::valueTypeDouble, this);
+
+    const QTemporaryDir tmpDir;
+    const QString fileName = tmpDir.filePath(QStringLiteral("test.blob"));
+    const QByteArray sourceKey(16, '\x5A');
+    QVERIFY(ParamMetaDataBlob::write(fileName, sourceKey, metaDataMap));
+
+    ParamMetaDataBlob blob(fileName);
+    QVERIFY(!blob.open(QByteArray(16, '\x00')));
+    QVERIFY(blob.open(sourceKey));
+    QCOMPARE(blob.count(), static_cast<quint32>(metaDataMap.count()));
+
+    for (auto it = metaDataMap.constBegin(); it != metaDataMap.constEnd(); ++it) {
+        const qint64 index = blob.indexOf(it.key());
+        QVERIFY(index >= 0);
+        QCOMPARE(blob.name(static_cast<quint32>(index)), it.key());
+
+        const FactMetaData *const metaData = blob.createMetaData(static_cast<quint32>(index), this);
+        QVERIFY(metaData);
+        _compareMetaData(metaData, it.value());
+    }
+
+    QCOMPARE(blob.indexOf(QStringLiteral("AAA")), -1LL);
+    QCOMPARE(blob.indexOf(QStringLiteral("NAV_RCL")), -1LL);
+    QCOMPARE(blob.indexOf(QStringLiteral("ZZZ")), -1LL);
+}
+
+void ParamMetaDataBlobTest::_testInvalidFile()
+{
+    const QTemporaryDir tmpDir;
+    const QString fileName = tmpDir.filePath(QStringLiteral("test.blob"));
+    const QByteArray sourceKey(16, '\x5A');
+
+    ParamMetaDataBlob missing(fileName);
+    QVERIFY(!missing.open(sourceKey));
+
+    QVERIFY(!ParamMetaDataBlob::write(fileName, QByteArray(4, '\x5A'), FactMetaData::NameToMetaDataMap_t()));
+
+    FactMetaData::NameToMetaDataMap_t metaDataMap;
+    metaDataMap[QStringLiteral("PARAM")] = new FactMetaData(FactMetaData::valueTypeInt32, QStringLiteral("PARAM"), this);
+    QVERIFY(ParamMetaDataBlob::write(fileName, sourceKey, metaDataMap));
+
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.resize(file.size() - 1));
+    file.close();
+
+    ParamMetaDataBlob truncated(fileName);
+    QVERIFY(!truncated.open(sourceKey));
+    QVERIFY(!truncated.isOpen());
+
+    // The source key changes with the contents of the source
+    const QString sourceFileName = tmpDir.filePath(QStringLiteral("source.xml"));
+    QFile sourceFile(sourceFileName);
+    QVERIFY(sourceFile.open(QIODevice::WriteOnly));
+    QVERIFY(sourceFile.write("<parameters/>") > 0);
+    sourceFile.close();
+    const QByteArray key1 = ParamMetaDataBlob::sourceKey(sourceFileName);
+    QCOMPARE(key1.size(), qsizetype(16));
+    QCOMPARE(ParamMetaDataBlob::sourceKey(sourceFileName), key1);
+
+    QVERIFY(sourceFile.open(QIODevice::Append));
+    QVERIFY(sourceFile.write(" ") > 0);
+    sourceFile.close();
+    QVERIFY(ParamMetaDataBlob::sourceKey(sourceFileName) != key1);
+
+    QVERIFY(ParamMetaDataBlob::sourceKey(tmpDir.filePath(QStringLiteral("missing.xml"))).isEmpty());
+}
+
+void ParamMetaDataBlobTest::_testPX4MetaData()
+{
+    const QByteArray sourceKey = ParamMetaDataBlob::sourceKey(kPX4MetaDataFile);
+    QVERIFY(!sourceKey.isEmpty());
+    (void) QFile::remove(ParamMetaDataBlob::cacheFileName(sourceKey));
+
+    // First load parses the xml and compiles it, second load uses the compiled blob
+    PX4ParameterMetaData xmlMetaData;
+    xmlMetaData.loadParameterFactMetaDataFile(kPX4MetaDataFile);
+    QVERIFY(QFile::exists(ParamMetaDataBlob::cacheFileName(sourceKey)));
+
+    PX4ParameterMetaData blobMetaData;
+    blobMetaData.loadParameterFactMetaDataFile(kPX4MetaDataFile);
+
+    ParamMetaDataBlob blob(ParamMetaDataBlob::cacheFileName(sourceKey));
+    QVERIFY(blob.open(sourceKey));
+    QVERIFY(blob.count() > 100);
+
+    for (quint32 index = 0; index < blob.count(); index++) {
+        const QString name = blob.name(index);
+        const FactMetaData *const expected = xmlMetaData.getMetaDataForFact(name, MAV_TYPE_QUADROTOR, FactMetaData::valueTypeInt32);
+        const FactMetaData *const actual = blobMetaData.getMetaDataForFact(name, MAV_TYPE_QUADROTOR, FactMetaData::valueTypeInt32);
+        _compareMetaData(actual, expected);
+        if (QTest::currentTestFailed()) {
+            qWarning() << "Mismatch" << name;
+            return;
+        }
+    }
+
+    // Params without meta data still get generic meta data
+    const FactMetaData *const generic = blobMetaData.getMetaDataForFact(QStringLiteral("NOT_A_PX4_PARAM"), MAV_TYPE_QUADROTOR, FactMetaData::valueTypeUint8);
+    QCOMPARE(generic->type(), FactMetaData::valueTypeUint8);
+}
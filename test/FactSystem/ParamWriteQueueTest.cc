@@ -0,0 +1,145 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "ParamWriteQueueTest.h"
+#include "ParamWriteQueue.h"
+
+#include <QtTest/QTest>
+
+static QString _paramName(int index)
+{
+    return QStringLiteral("PARAM_%1").arg(index, 3, 10, QLatin1Char('0'));
+}
+
+void ParamWriteQueueTest::_testWindowedSend()
+{
+    ParamWriteQueue queue;
+    QVERIFY(queue.isEmpty());
+
+    for (int i = 0; i < 100; i++) {
+        queue.enqueue(_paramName(i), FactMetaData::valueTypeFloat, i);
+    }
+    QCOMPARE(queue.queuedCount(), qsizetype(100));
+
+    // Only the initial window goes out, in the order the writes were made
+    QList<ParamWriteQueue::Write> sent = queue.takeSendable(0);
+    QCOMPARE(sent.count(), qsizetype(MAVLinkRequestWindow::kInitialWindow));
+    QCOMPARE(sent[0].name, _paramName(0));
+    QCOMPARE(sent[0].valueType, FactMetaData::valueTypeFloat);
+    QCOMPARE(queue.outstandingCount(), sent.count());
+    QVERIFY(queue.takeSendable(0).isEmpty());
+
+    // Acks open up the window, everything completes without a single write being sent twice
+    int sentCount = static_cast<int>(sent.count());
+    int ackCount = 0;
+    qint64 nowMSecs = 0;
+    while (!sent.isEmpty()) {
+        nowMSecs += 10;
+        for (const ParamWriteQueue::Write &write : sent) {
+            QVERIFY(queue.ackReceived(write.name, nowMSecs));
+            ackCount++;
+        }
+        sent = queue.takeSendable(nowMSecs);
+        sentCount += static_cast<int>(sent.count());
+    }
+    QCOMPARE(sentCount, 100);
+    QCOMPARE(ackCount, 100);
+    QVERIFY(queue.isEmpty());
+    QVERIFY(queue.window().window() > static_cast<int>(MAVLinkRequestWindow::kInitialWindow));
+
+    // Param values which don't belong to a write are not acks
+    QVERIFY(queue.ackReceived(QStringLiteral("OTHER"), nowMSecs));
+    queue.enqueue(QStringLiteral("QUEUED"), FactMetaData::valueTypeInt32, 1);
+    QVERIFY(!queue.ackReceived(QStringLiteral("QUEUED"), nowMSecs));
+    QVERIFY(queue.contains(QStringLiteral("QUEUED")));
+}
+
+void ParamWriteQueueTest::_testRetry()
+{
+    ParamWriteQueue queue;
+    queue.enqueue(_paramName(0), FactMetaData::valueTypeInt32, 0);
+    queue.enqueue(_paramName(1), FactMetaData::valueTypeInt32, 1);
+    QCOMPARE(queue.takeSendable(0).count(), qsizetype(2));
+    QVERIFY(queue.ackReceived(_paramName(1), 100));
+
+    // Nothing expired yet
+    QVERIFY(queue.takeExpired(101, 2).isEmpty());
+    QCOMPARE(queue.outstandingCount(), qsizetype(1));
+
+    // Only the lost write is sent again
+    qint64 nowMSecs = queue.nextExpiryMSecs();
+    QVERIFY(queue.takeExpired(nowMSecs, 2).isEmpty());
+    QList<ParamWriteQueue::Write> sent = queue.takeSendable(nowMSecs);
+    QCOMPARE(sent.count(), qsizetype(1));
+    QCOMPARE(sent[0].name, _paramName(0));
+    QCOMPARE(sent[0].retryCount, 1);
+
+    nowMSecs = queue.nextExpiryMSecs();
+    QVERIFY(queue.takeExpired(nowMSecs, 2).isEmpty());
+    QCOMPARE(queue.takeSendable(nowMSecs).count(), qsizetype(1));
+
+    // Retries exhausted
+    nowMSecs = queue.nextExpiryMSecs();
+    QCOMPARE(queue.takeExpired(nowMSecs, 2), QStringList({ _paramName(0) }));
+    QVERIFY(queue.isEmpty());
+    QCOMPARE(queue.nextExpiryMSecs(), -1LL);
+}
+
+void ParamWriteQueueTest::_testRewriteWhileOutstanding()
+{
+    ParamWriteQueue queue;
+    queue.enqueue(_paramName(0), FactMetaData::valueTypeInt32, 1);
+    QCOMPARE(queue.takeSendable(0).count(), qsizetype(1));
+
+    // The second value has to go out after the first write is acked
+    queue.enqueue(_paramName(0), FactMetaData::valueTypeInt32, 2);
+    QVERIFY(queue.takeSendable(0).isEmpty());
+    QVERIFY(!queue.ackReceived(_paramName(0), 50));
+
+    QList<ParamWriteQueue::Write> sent = queue.takeSendable(50);
+    QCOMPARE(sent.count(), qsizetype(1));
+    QCOMPARE(sent[0].value, QVariant(2));
+    QVERIFY(queue.ackReceived(_paramName(0), 100));
+    QVERIFY(queue.isEmpty());
+
+    // A queued write which was not sent yet just takes the newer value
+    queue.enqueue(_paramName(1), FactMetaData::valueTypeInt32, 1);
+    queue.enqueue(_paramName(1), FactMetaData::valueTypeInt32, 3);
+    QCOMPARE(queue.queuedCount(), qsizetype(1));
+    sent = queue.takeSendable(200);
+    QCOMPARE(sent.count(), qsizetype(1));
+    QCOMPARE(sent[0].value, QVariant(3));
+
+    // A lost write is replaced by the newer value instead of being retried
+    queue.enqueue(_paramName(1), FactMetaData::valueTypeInt32, 4);
+    const qint64 nowMSecs = queue.nextExpiryMSecs();
+    QVERIFY(queue.takeExpired(nowMSecs, 0).isEmpty());
+    sent = queue.takeSendable(nowMSecs);
+    QCOMPARE(sent.count(), qsizetype(1));
+    QCOMPARE(sent[0].value, QVariant(4));
+    QCOMPARE(sent[0].retryCount, 0);
+}
+
+void ParamWriteQueueTest::_testTakeQueued()
+{
+    ParamWriteQueue queue;
+    for (int i = 0; i < 20; i++) {
+        queue.enqueue(_paramName(i), FactMetaData::valueTypeFloat, i);
+    }
+    const QList<ParamWriteQueue::Write> sent = queue.takeSendable(0);
+
+    // Only the writes which were not sent yet are taken, in order
+    const QList<ParamWriteQueue::Write> queued = queue.takeQueued();
+    QCOMPARE(queued.count(), 20 - sent.count());
+    QCOMPARE(queued[0].name, _paramName(static_cast<int>(sent.count())));
+    QCOMPARE(queue.queuedCount(), qsizetype(0));
+    QCOMPARE(queue.outstandingCount(), sent.count());
+    QVERIFY(!queue.contains(queued[0].name));
+    QVERIFY(queue.takeSendable(0).isEmpty());
+}
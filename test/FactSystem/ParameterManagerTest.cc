@@ -68,6 +68,101 @@ void ParameterManagerTest::_requestListMissingParamSuccess(void)
     _noFailureWorker(MockConfiguration::FailMissingParamOnInitialReqest);
 }
 
+// MockLink drops a share of all param values, the windowed index re-requests should still load everything
+void ParameterManagerTest::_lossyLinkSuccess(void)
+{
+    _noFailureWorker(MockConfiguration::FailParamLossy);
+}
+
+// MockLink drops a share of the param value acks, all writes of a bulk change should still make it to the vehicle
+void ParameterManagerTest::_bulkWriteLossyLink(void)
+{
+    _noFailureWorker(MockConfiguration::FailParamLossy);
+
+    Vehicle* vehicle = MultiVehicleManager::instance()->activeVehicle();
+    QVERIFY(vehicle);
+    ParameterManager* paramMgr = vehicle->parameterManager();
+
+    QList<Fact*> facts;
+    for (const QString& paramName : paramMgr->parameterNames(MAV_COMP_ID_AUTOPILOT1)) {
+        Fact* fact = paramMgr->getParameter(MAV_COMP_ID_AUTOPILOT1, paramName);
+        if (fact->type() == FactMetaData::valueTypeFloat) {
+            facts.append(fact);
+            if (facts.count() == 50) {
+                break;
+            }
+        }
+    }
+    QCOMPARE(facts.count(), 50);
+
+    QSignalSpy spyPendingWrites(paramMgr, &ParameterManager::pendingWritesChanged);
+    QList<float> values;
+    for (Fact* fact : facts) {
+        const float value = fact->rawValue().toFloat() + 1.0f;
+        values.append(value);
+        fact->setRawValue(value);
+    }
+    QVERIFY(paramMgr->pendingWrites());
+
+    while (paramMgr->pendingWrites()) {
+        QVERIFY(spyPendingWrites.wait(10000));
+    }
+
+    for (qsizetype i = 0; i < facts.count(); i++) {
+        QCOMPARE(facts[i]->rawValue().toFloat(), values[i]);
+    }
+}
+
+void ParameterManagerTest::_bulkWriteFTP(void)
+{
+    _connectMockLink(MAV_AUTOPILOT_ARDUPILOTMEGA);
+    ParameterManager* paramMgr = _vehicle->parameterManager();
+
+    QList<Fact*> facts;
+    for (const QString& paramName : paramMgr->parameterNames(MAV_COMP_ID_AUTOPILOT1)) {
+        Fact* fact = paramMgr->getParameter(MAV_COMP_ID_AUTOPILOT1, paramName);
+        if ((fact->type() == FactMetaData::valueTypeFloat) || (fact->type() == FactMetaData::valueTypeInt16)) {
+            facts.append(fact);
+            if (facts.count() == 30) {
+                break;
+            }
+        }
+    }
+    QCOMPARE(facts.count(), 30);
+
+    // The writes made in one go are uploaded as a single param file
+    _mockLink->mockLinkFTP()->enableBinParamFile(true);
+    QSignalSpy spyTerminate(_mockLink->mockLinkFTP(), &MockLinkFTP::terminateCommandReceived);
+    QSignalSpy spyPendingWrites(paramMgr, &ParameterManager::pendingWritesChanged);
+    for (Fact* fact : facts) {
+        fact->setRawValue(fact->rawValue().toInt() + 1);
+    }
+    QVERIFY(paramMgr->pendingWrites());
+
+    while (paramMgr->pendingWrites()) {
+        QVERIFY(spyPendingWrites.wait(10000));
+    }
+    QCOMPARE(spyTerminate.count(), 1);
+    for (const Fact* fact : facts) {
+        QCOMPARE(_mockLink->paramValue(MAV_COMP_ID_AUTOPILOT1, fact->name()).toFloat(), fact->rawValue().toFloat());
+    }
+
+    // Firmware without param file upload support falls back to PARAM_SET
+    _mockLink->mockLinkFTP()->enableBinParamFile(false);
+    for (Fact* fact : facts) {
+        fact->setRawValue(fact->rawValue().toInt() + 1);
+    }
+    while (paramMgr->pendingWrites()) {
+        QVERIFY(spyPendingWrites.wait(10000));
+    }
+    QCOMPARE(spyTerminate.count(), 1);
+    for (const Fact* fact : facts) {
+        QCOMPARE(_mockLink->paramValue(MAV_COMP_ID_AUTOPILOT1, fact->name()).toFloat(), fact->rawValue().toFloat());
+    }
+
+    _disconnectMockLink();
+}
+
 // Test no response to param_request_list
 void ParameterManagerTest::_requestListNoResponse(void)
 {
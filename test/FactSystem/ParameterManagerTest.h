@@ -21,6 +21,9 @@ private slots:
     void _requestListNoResponse(void);
     void _requestListMissingParamSuccess(void);
     void _requestListMissingParamFail(void);
+    void _lossyLinkSuccess(void);
+    void _bulkWriteLossyLink(void);
+    void _bulkWriteFTP(void);
     // void _FTPnoFailure(void);
     // void _FTPChangeParam(void);
 
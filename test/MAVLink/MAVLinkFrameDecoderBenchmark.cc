@@ -0,0 +1,53 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkFrameDecoderBenchmark.h"
+#include "MAVLinkFrameDecoder.h"
+#include "MAVLinkFrameDecoderTest.h"
+
+#include <QtTest/QTest>
+
+namespace
+{
+    constexpr uint8_t kEncodeChannel = MAVLINK_COMM_12;
+    constexpr uint8_t kDecodeChannel = MAVLINK_COMM_14;
+    constexpr int kMessageCount = 20000;
+}
+
+void MAVLinkFrameDecoderBenchmark::init()
+{
+    UnitTest::init();
+
+    *mavlink_get_channel_status(kEncodeChannel) = mavlink_status_t{};
+    *mavlink_get_channel_status(kDecodeChannel) = mavlink_status_t{};
+}
+
+void MAVLinkFrameDecoderBenchmark::_benchmarkParseChar()
+{
+    const QByteArray stream = MAVLinkFrameDecoderTest::_buildStream(kMessageCount, kEncodeChannel);
+
+    QBENCHMARK {
+        for (const uint8_t byte: stream) {
+            mavlink_message_t message{};
+            mavlink_status_t status{};
+            (void) mavlink_parse_char(kDecodeChannel, byte, &message, &status);
+        }
+    }
+}
+
+void MAVLinkFrameDecoderBenchmark::_benchmarkFrameDecoder()
+{
+    const QByteArray stream = MAVLinkFrameDecoderTest::_buildStream(kMessageCount, kEncodeChannel);
+
+    QBENCHMARK {
+        MAVLinkFrameDecoder decoder(kDecodeChannel, stream);
+        mavlink_message_t message{};
+        while (decoder.next(message)) {}
+    }
+}
@@ -0,0 +1,25 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+/// Decode throughput of MAVLinkFrameDecoder against byte at a time mavlink_parse_char over the same stream.
+/// Standalone, run with the benchmark build target or --unittest:MAVLinkFrameDecoderBenchmark.
+class MAVLinkFrameDecoderBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void init() override;
+
+    void _benchmarkParseChar();
+    void _benchmarkFrameDecoder();
+};
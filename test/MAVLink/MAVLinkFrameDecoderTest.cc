@@ -0,0 +1,217 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkFrameDecoderTest.h"
+#include "MAVLinkFrameDecoder.h"
+#include "MAVLinkSigning.h"
+
+#include <QtTest/QTest>
+
+namespace
+{
+    constexpr uint8_t kEncodeChannel = MAVLINK_COMM_12;
+    constexpr uint8_t kReferenceChannel = MAVLINK_COMM_13;
+    constexpr uint8_t kDecodeChannel = MAVLINK_COMM_14;
+
+    void _resetChannel(uint8_t channel)
+    {
+        *mavlink_get_channel_status(channel) = mavlink_status_t{};
+    }
+}
+
+void MAVLinkFrameDecoderTest::init()
+{
+    UnitTest::init();
+
+    _resetChannel(kEncodeChannel);
+    _resetChannel(kReferenceChannel);
+    _resetChannel(kDecodeChannel);
+}
+
+QByteArray MAVLinkFrameDecoderTest::_buildStream(int messageCount, uint8_t encodeChannel)
+{
+    QByteArray stream;
+    stream.reserve(messageCount * 40);
+
+    uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
+    for (int i = 0; i < messageCount; i++) {
+        mavlink_message_t message;
+        switch (i % 4) {
+        case 0:
+            (void) mavlink_msg_heartbeat_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, encodeChannel, &message, MAV_TYPE_QUADROTOR, MAV_AUTOPILOT_PX4, 0, i, MAV_STATE_ACTIVE);
+            break;
+        case 1:
+            (void) mavlink_msg_attitude_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, encodeChannel, &message, i, 0.1f * i, 0.2f, 0.3f, 0.f, 0.f, 0.f);
+            break;
+        case 2:
+            (void) mavlink_msg_gps_raw_int_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, encodeChannel, &message, i, GPS_FIX_TYPE_3D_FIX, 473977420, 85455940, 100000, 100, 100, 0, 0, 12, 0, 0, 0, 0, 0, 0);
+            break;
+        default:
+            (void) mavlink_msg_vfr_hud_pack_chan(1, MAV_COMP_ID_AUTOPILOT1, encodeChannel, &message, 10.f, 12.f, i % 360, 50, 100.f, 0.5f);
+            break;
+        }
+        const uint16_t len = mavlink_msg_to_send_buffer(buffer, &message);
+        (void) stream.append(reinterpret_cast<const char*>(buffer), len);
+    }
+
+    return stream;
+}
+
+QList<mavlink_message_t> MAVLinkFrameDecoderTest::_parseCharReference(uint8_t channel, const QByteArray &stream)
+{
+    QList<mavlink_message_t> messages;
+    for (const uint8_t byte: stream) {
+        mavlink_message_t message{};
+        mavlink_status_t status{};
+        if (mavlink_parse_char(channel, byte, &message, &status) == MAVLINK_FRAMING_OK) {
+            messages.append(message);
+        }
+    }
+
+    return messages;
+}
+
+QList<mavlink_message_t> MAVLinkFrameDecoderTest::_decode(uint8_t channel, const QByteArray &stream, qsizetype chunkSize)
+{
+    QList<mavlink_message_t> messages;
+    for (qsizetype offset = 0; offset < stream.size(); offset += chunkSize) {
+        MAVLinkFrameDecoder decoder(channel, QByteArrayView(stream).sliced(offset, qMin(chunkSize, stream.size() - offset)));
+        mavlink_message_t message{};
+        while (decoder.next(message)) {
+            messages.append(message);
+        }
+    }
+
+    return messages;
+}
+
+void MAVLinkFrameDecoderTest::_compareMessages(const QList<mavlink_message_t> &actual, const QList<mavlink_message_t> &expected)
+{
+    QCOMPARE(actual.count(), expected.count());
+    for (qsizetype i = 0; i < actual.count(); i++) {
+        QCOMPARE(static_cast<uint32_t>(actual[i].msgid), static_cast<uint32_t>(expected[i].msgid));
+        QCOMPARE(actual[i].sysid, expected[i].sysid);
+        QCOMPARE(actual[i].compid, expected[i].compid);
+        QCOMPARE(actual[i].seq, expected[i].seq);
+        QCOMPARE(actual[i].len, expected[i].len);
+        QCOMPARE(actual[i].checksum, expected[i].checksum);
+        QCOMPARE(memcmp(_MAV_PAYLOAD(&actual[i]), _MAV_PAYLOAD(&expected[i]), actual[i].len), 0);
+    }
+}
+
+void MAVLinkFrameDecoderTest::_testCleanStream()
+{
+    const QByteArray stream = _buildStream(200, kEncodeChannel);
+    const QList<mavlink_message_t> expected = _parseCharReference(kReferenceChannel, stream);
+    QCOMPARE(expected.count(), 200);
+
+    _compareMessages(_decode(kDecodeChannel, stream, stream.size()), expected);
+    QCOMPARE(mavlink_get_channel_status(kDecodeChannel)->packet_rx_success_count, static_cast<uint16_t>(200));
+}
+
+void MAVLinkFrameDecoderTest::_testSplitChunks()
+{
+    const QByteArray stream = _buildStream(200, kEncodeChannel);
+    const QList<mavlink_message_t> expected = _parseCharReference(kReferenceChannel, stream);
+
+    for (const qsizetype chunkSize: {1, 7, 33, 64, 255}) {
+        _resetChannel(kDecodeChannel);
+        _compareMessages(_decode(kDecodeChannel, stream, chunkSize), expected);
+    }
+}
+
+void MAVLinkFrameDecoderTest::_testCorruptedStream()
+{
+    QByteArray stream = _buildStream(200, kEncodeChannel);
+
+    // Leading garbage, stray STX bytes and corrupted payloads
+    (void) stream.prepend(QByteArray("\x01\x02\xFD\x03\xFE", 5));
+    for (qsizetype i = 50; i < stream.size(); i += 397) {
+        stream[i] = static_cast<char>(stream[i] ^ 0x5A);
+    }
+    (void) stream.insert(stream.size() / 2, QByteArray(16, static_cast<char>(MAVLINK_STX)));
+
+    const QList<mavlink_message_t> expected = _parseCharReference(kReferenceChannel, stream);
+    QVERIFY(expected.count() < 200);
+
+    _compareMessages(_decode(kDecodeChannel, stream, stream.size()), expected);
+
+    _resetChannel(kDecodeChannel);
+    _compareMessages(_decode(kDecodeChannel, stream, 61), expected);
+}
+
+void MAVLinkFrameDecoderTest::_testMavlink1Detection()
+{
+    mavlink_get_channel_status(kEncodeChannel)->flags |= MAVLINK_STATUS_FLAG_OUT_MAVLINK1;
+    const QByteArray stream = _buildStream(10, kEncodeChannel);
+    QCOMPARE(static_cast<uint8_t>(stream[0]), MAVLINK_STX_MAVLINK1);
+
+    const QList<mavlink_message_t> expected = _parseCharReference(kReferenceChannel, stream);
+    _compareMessages(_decode(kDecodeChannel, stream, stream.size()), expected);
+    QVERIFY(mavlink_get_channel_status(kDecodeChannel)->flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1);
+
+    _resetChannel(kEncodeChannel);
+    const QByteArray stream2 = _buildStream(1, kEncodeChannel);
+    (void) _decode(kDecodeChannel, stream2, stream2.size());
+    QVERIFY(!(mavlink_get_channel_status(kDecodeChannel)->flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1));
+}
+
+void MAVLinkFrameDecoderTest::_testSignedStream()
+{
+    QVERIFY(MAVLinkSigning::initSigning(static_cast<mavlink_channel_t>(kEncodeChannel), "frame_decoder_key", MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    const QByteArray stream = _buildStream(20, kEncodeChannel);
+    QVERIFY(MAVLinkSigning::initSigning(static_cast<mavlink_channel_t>(kEncodeChannel), QByteArrayView(), nullptr));
+
+    // Matching key accepts all frames
+    QVERIFY(MAVLinkSigning::initSigning(static_cast<mavlink_channel_t>(kDecodeChannel), "frame_decoder_key", MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    MAVLinkFrameDecoder decoder(kDecodeChannel, stream);
+    mavlink_message_t message{};
+    int count = 0;
+    while (decoder.next(message)) {
+        count++;
+    }
+    QCOMPARE(count, 20);
+    QCOMPARE(decoder.signatureErrors(), static_cast<uint32_t>(0));
+
+    // Wrong key rejects all frames
+    _resetChannel(kDecodeChannel);
+    QVERIFY(MAVLinkSigning::initSigning(static_cast<mavlink_channel_t>(kDecodeChannel), "wrong_key", MAVLinkSigning::insecureConnectionAccceptUnsignedCallback));
+    MAVLinkFrameDecoder badDecoder(kDecodeChannel, stream);
+    QVERIFY(!badDecoder.next(message));
+    QVERIFY(badDecoder.signatureErrors() > 0);
+
+    QVERIFY(MAVLinkSigning::initSigning(static_cast<mavlink_channel_t>(kDecodeChannel), QByteArrayView(), nullptr));
+}
+
+void MAVLinkFrameDecoderTest::_testRawFrames()
+{
+    const QByteArray stream = _buildStream(50, kEncodeChannel);
+
+    // Frames decoded in place are the received bytes
+    QByteArray frames;
+    MAVLinkFrameDecoder decoder(kDecodeChannel, stream);
+    mavlink_message_t message{};
+    while (decoder.next(message)) {
+        QVERIFY(!decoder.frame().isEmpty());
+        (void) frames.append(decoder.frame());
+    }
+    QCOMPARE(frames, stream);
+
+    // Frames reassembled across chunks have none
+    _resetChannel(kDecodeChannel);
+    const qsizetype splitOffset = 5;
+    MAVLinkFrameDecoder head(kDecodeChannel, QByteArrayView(stream).first(splitOffset));
+    QVERIFY(!head.next(message));
+    MAVLinkFrameDecoder tail(kDecodeChannel, QByteArrayView(stream).sliced(splitOffset));
+    QVERIFY(tail.next(message));
+    QVERIFY(tail.frame().isEmpty());
+    QVERIFY(tail.next(message));
+    QVERIFY(!tail.frame().isEmpty());
+    QCOMPARE(static_cast<uint8_t>(tail.frame().at(0)), MAVLINK_STX);
+}
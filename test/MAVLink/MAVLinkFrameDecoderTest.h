@@ -0,0 +1,38 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class MAVLinkFrameDecoderTest : public UnitTest
+{
+    Q_OBJECT
+
+public:
+    MAVLinkFrameDecoderTest() = default;
+
+    /// Stream of messageCount packed messages with a mix of ids, also used by MAVLinkFrameDecoderBenchmark
+    static QByteArray _buildStream(int messageCount, uint8_t encodeChannel);
+
+private slots:
+    void init() override;
+
+    void _testCleanStream();
+    void _testSplitChunks();
+    void _testCorruptedStream();
+    void _testMavlink1Detection();
+    void _testSignedStream();
+    void _testRawFrames();
+
+private:
+    static QList<mavlink_message_t> _parseCharReference(uint8_t channel, const QByteArray &stream);
+    static QList<mavlink_message_t> _decode(uint8_t channel, const QByteArray &stream, qsizetype chunkSize);
+    static void _compareMessages(const QList<mavlink_message_t> &actual, const QList<mavlink_message_t> &expected);
+};
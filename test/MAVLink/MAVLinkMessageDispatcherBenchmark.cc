@@ -0,0 +1,103 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkMessageDispatcherBenchmark.h"
+#include "MAVLinkFrameDecoder.h"
+#include "MAVLinkProtocol.h"
+#include "MultiVehicleManager.h"
+#include "Vehicle.h"
+
+#include <QtCore/QDateTime>
+#include <QtCore/QtEndian>
+#include <QtTest/QTest>
+
+namespace
+{
+    constexpr uint8_t kLogChannel = MAVLINK_COMM_12;
+}
+
+/// Generates a tlog with a typical 50 Hz telemetry mix
+QByteArray MAVLinkMessageDispatcherBenchmark::_buildTelemetryLog(uint8_t sysid, int seconds)
+{
+    QByteArray log;
+    uint8_t buffer[MAVLINK_MAX_PACKET_LEN];
+    quint64 timestamp = static_cast<quint64>(QDateTime::currentMSecsSinceEpoch()) * 1000;
+
+    const auto append = [&log, &buffer, &timestamp](const mavlink_message_t &message) {
+        uint8_t timestampBytes[sizeof(quint64)];
+        qToBigEndian(timestamp, timestampBytes);
+        (void) log.append(reinterpret_cast<const char*>(timestampBytes), sizeof(timestampBytes));
+        const uint16_t len = mavlink_msg_to_send_buffer(buffer, &message);
+        (void) log.append(reinterpret_cast<const char*>(buffer), len);
+    };
+
+    for (int tick = 0; tick < seconds * 50; tick++) {
+        mavlink_message_t message;
+        (void) mavlink_msg_attitude_pack_chan(sysid, MAV_COMP_ID_AUTOPILOT1, kLogChannel, &message, tick * 20, 0.1f, 0.2f, 0.3f, 0.f, 0.f, 0.f);
+        append(message);
+        (void) mavlink_msg_global_position_int_pack_chan(sysid, MAV_COMP_ID_AUTOPILOT1, kLogChannel, &message, tick * 20, 473977420 + tick, 85455940, 500000, 10000, 100, 0, 0, 9000);
+        append(message);
+        (void) mavlink_msg_vfr_hud_pack_chan(sysid, MAV_COMP_ID_AUTOPILOT1, kLogChannel, &message, 10.f, 12.f, 90, 50, 100.f, 0.5f);
+        append(message);
+        (void) mavlink_msg_local_position_ned_pack_chan(sysid, MAV_COMP_ID_AUTOPILOT1, kLogChannel, &message, tick * 20, 1.f, 2.f, -3.f, 0.f, 0.f, 0.f);
+        append(message);
+        (void) mavlink_msg_servo_output_raw_pack_chan(sysid, MAV_COMP_ID_AUTOPILOT1, kLogChannel, &message, tick * 20, 0, 1500, 1500, 1500, 1500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+        append(message);
+        if ((tick % 10) == 0) {
+            (void) mavlink_msg_gps_raw_int_pack_chan(sysid, MAV_COMP_ID_AUTOPILOT1, kLogChannel, &message, tick * 20, GPS_FIX_TYPE_3D_FIX, 473977420, 85455940, 500000, 100, 100, 0, 0, 12, 0, 0, 0, 0, 0, 0);
+            append(message);
+            (void) mavlink_msg_vibration_pack_chan(sysid, MAV_COMP_ID_AUTOPILOT1, kLogChannel, &message, tick * 20, 1.f, 2.f, 3.f, 0, 0, 0);
+            append(message);
+        }
+        timestamp += 20000;
+    }
+
+    return log;
+}
+
+QList<mavlink_message_t> MAVLinkMessageDispatcherBenchmark::_readTelemetryLog(const QByteArray &log)
+{
+    QList<mavlink_message_t> messages;
+
+    *mavlink_get_channel_status(kLogChannel) = mavlink_status_t{};
+    qsizetype offset = 0;
+    while ((offset + static_cast<qsizetype>(sizeof(quint64)) + 3) <= log.size()) {
+        offset += sizeof(quint64);
+        const uint8_t payloadLen = static_cast<uint8_t>(log[offset + 1]);
+        const qsizetype frameLen = MAVLINK_CORE_HEADER_LEN + 1 + payloadLen + MAVLINK_NUM_CHECKSUM_BYTES;
+
+        MAVLinkFrameDecoder decoder(kLogChannel, QByteArrayView(log).sliced(offset, frameLen));
+        mavlink_message_t message{};
+        while (decoder.next(message)) {
+            messages.append(message);
+        }
+        offset += frameLen;
+    }
+
+    return messages;
+}
+
+void MAVLinkMessageDispatcherBenchmark::_benchmarkTelemetryReplay()
+{
+    _connectMockLink();
+
+    Vehicle *const vehicle = MultiVehicleManager::instance()->activeVehicle();
+    QVERIFY(vehicle);
+
+    const QList<mavlink_message_t> messages = _readTelemetryLog(_buildTelemetryLog(vehicle->id(), 60));
+    QVERIFY(!messages.isEmpty());
+
+    QBENCHMARK {
+        for (const mavlink_message_t &message : messages) {
+            emit MAVLinkProtocol::instance()->messageReceived(_mockLink, message);
+        }
+    }
+
+    _disconnectMockLink();
+}
@@ -0,0 +1,26 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+/// Vehicle message dispatch throughput replaying a minute of 50 Hz telemetry through MAVLinkProtocol::messageReceived.
+/// Standalone, run with the benchmark build target or --unittest:MAVLinkMessageDispatcherBenchmark.
+class MAVLinkMessageDispatcherBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void _benchmarkTelemetryReplay();
+
+private:
+    static QByteArray _buildTelemetryLog(uint8_t sysid, int seconds);
+    static QList<mavlink_message_t> _readTelemetryLog(const QByteArray &log);
+};
@@ -0,0 +1,99 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkMessageDispatcherTest.h"
+#include "MAVLinkMessageDispatcher.h"
+#include "MAVLinkProtocol.h"
+#include "MultiVehicleManager.h"
+#include "Vehicle.h"
+
+#include <QtTest/QTest>
+
+namespace
+{
+    constexpr uint8_t kLogChannel = MAVLINK_COMM_12;
+
+    mavlink_message_t _messageWithId(uint32_t msgid)
+    {
+        mavlink_message_t message{};
+        message.msgid = msgid;
+        return message;
+    }
+}
+
+void MAVLinkMessageDispatcherTest::_testDispatch()
+{
+    MAVLinkMessageDispatcher dispatcher;
+
+    int attitudeCount = 0;
+    int hygrometerCount = 0;
+    int allCount = 0;
+    const int owner1 = 0, owner2 = 0, owner3 = 0;
+    dispatcher.registerHandler(&owner1, { MAVLINK_MSG_ID_ATTITUDE }, [&attitudeCount](const mavlink_message_t &) { attitudeCount++; });
+    dispatcher.registerHandler(&owner2, { MAVLINK_MSG_ID_HYGROMETER_SENSOR }, [&hygrometerCount](const mavlink_message_t &) { hygrometerCount++; });
+    dispatcher.registerHandler(&owner3, { MAVLinkMessageDispatcher::allMessageIds }, [&allCount](const mavlink_message_t &) { allCount++; });
+
+    QCOMPARE(dispatcher.handlerCount(MAVLINK_MSG_ID_ATTITUDE), 2);
+    QCOMPARE(dispatcher.handlerCount(MAVLINK_MSG_ID_HYGROMETER_SENSOR), 2);
+    QCOMPARE(dispatcher.handlerCount(MAVLINK_MSG_ID_HEARTBEAT), 1);
+
+    dispatcher.dispatch(_messageWithId(MAVLINK_MSG_ID_ATTITUDE));
+    dispatcher.dispatch(_messageWithId(MAVLINK_MSG_ID_HYGROMETER_SENSOR));
+    dispatcher.dispatch(_messageWithId(MAVLINK_MSG_ID_HEARTBEAT));
+
+    QCOMPARE(attitudeCount, 1);
+    QCOMPARE(hygrometerCount, 1);
+    QCOMPARE(allCount, 3);
+}
+
+void MAVLinkMessageDispatcherTest::_testUnregister()
+{
+    MAVLinkMessageDispatcher dispatcher;
+
+    int count = 0;
+    const int owner = 0;
+    dispatcher.registerHandler(&owner, { MAVLINK_MSG_ID_ATTITUDE, MAVLINK_MSG_ID_HYGROMETER_SENSOR, MAVLinkMessageDispatcher::allMessageIds }, [&count](const mavlink_message_t &) { count++; });
+    QVERIFY(dispatcher.isRegistered(&owner));
+
+    dispatcher.unregisterHandlers(&owner);
+    QVERIFY(!dispatcher.isRegistered(&owner));
+    QCOMPARE(dispatcher.handlerCount(MAVLINK_MSG_ID_ATTITUDE), 0);
+    QCOMPARE(dispatcher.handlerCount(MAVLINK_MSG_ID_HYGROMETER_SENSOR), 0);
+
+    dispatcher.dispatch(_messageWithId(MAVLINK_MSG_ID_ATTITUDE));
+    dispatcher.dispatch(_messageWithId(MAVLINK_MSG_ID_HYGROMETER_SENSOR));
+    QCOMPARE(count, 0);
+}
+
+void MAVLinkMessageDispatcherTest::_testVehicleRegistration()
+{
+    _connectMockLink();
+
+    Vehicle *const vehicle = MultiVehicleManager::instance()->activeVehicle();
+    QVERIFY(vehicle);
+
+    // Telemetry still reaches the FactGroups through the dispatch table
+    mavlink_message_t message;
+    (void) mavlink_msg_vibration_pack_chan(vehicle->id(), MAV_COMP_ID_AUTOPILOT1, kLogChannel, &message, 0, 1.f, 2.f, 3.f, 0, 0, 0);
+    emit MAVLinkProtocol::instance()->messageReceived(_mockLink, message);
+    QCOMPARE(vehicle->vibrationFactGroup()->getFact(QStringLiteral("xAxis"))->rawValue().toDouble(), 1.);
+
+    // Dynamic FactGroups are routed once created
+    mavlink_battery_status_t batteryStatus{};
+    batteryStatus.id = 7;
+    batteryStatus.current_battery = -1;
+    batteryStatus.battery_remaining = 42;
+    (void) mavlink_msg_battery_status_encode_chan(vehicle->id(), MAV_COMP_ID_AUTOPILOT1, kLogChannel, &message, &batteryStatus);
+    emit MAVLinkProtocol::instance()->messageReceived(_mockLink, message);
+    FactGroup *const battery = vehicle->getFactGroup(QStringLiteral("battery7"));
+    QVERIFY(battery);
+    QCOMPARE(battery->getFact(QStringLiteral("percentRemaining"))->rawValue().toDouble(), 42.);
+
+    _disconnectMockLink();
+}
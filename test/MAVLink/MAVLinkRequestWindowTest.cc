@@ -0,0 +1,118 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MAVLinkRequestWindowTest.h"
+#include "MAVLinkRequestWindow.h"
+
+#include <QtTest/QTest>
+
+void MAVLinkRequestWindowTest::_testSlowStart()
+{
+    MAVLinkRequestWindow window;
+    QCOMPARE(window.window(), static_cast<int>(MAVLinkRequestWindow::kInitialWindow));
+
+    int index = 0;
+    while (window.canSend()) {
+        window.requestSent(index++, 0, false);
+    }
+    QCOMPARE(window.outstandingCount(), qsizetype(4));
+    QVERIFY(window.isOutstanding(0));
+    QVERIFY(!window.isOutstanding(4));
+
+    // Every response grows the window by one during slow start
+    for (int i = 0; i < 4; i++) {
+        QVERIFY(window.responseReceived(i, 10));
+    }
+    QCOMPARE(window.window(), 8);
+    QCOMPARE(window.outstandingCount(), qsizetype(0));
+
+    // Unrequested responses are ignored
+    QVERIFY(!window.responseReceived(100, 10));
+    QCOMPARE(window.window(), 8);
+
+    // Never grows past the maximum
+    for (int i = 0; i < 200; i++) {
+        window.requestSent(i, 20, false);
+        (void) window.responseReceived(i, 30);
+    }
+    QCOMPARE(window.window(), static_cast<int>(MAVLinkRequestWindow::kMaxWindow));
+}
+
+void MAVLinkRequestWindowTest::_testRtt()
+{
+    MAVLinkRequestWindow window;
+    QVERIFY(window.srttMSecs() < 0);
+    QCOMPARE(window.rtoMSecs(), MAVLinkRequestWindow::kInitialRtoMSecs);
+
+    // A slow link gets a timeout which follows its round trip time
+    for (int i = 0; i < 50; i++) {
+        window.requestSent(i, i * 1000, false);
+        QVERIFY(window.responseReceived(i, (i * 1000) + 600));
+    }
+    QVERIFY(qAbs(window.srttMSecs() - 600) < 1);
+    QVERIFY(window.rtoMSecs() >= 600);
+    QVERIFY(window.rtoMSecs() < 700);
+
+    // A fast link is limited by the minimum
+    MAVLinkRequestWindow fastWindow;
+    for (int i = 0; i < 50; i++) {
+        fastWindow.requestSent(i, i * 10, false);
+        QVERIFY(fastWindow.responseReceived(i, (i * 10) + 5));
+    }
+    QCOMPARE(fastWindow.rtoMSecs(), MAVLinkRequestWindow::kMinRtoMSecs);
+}
+
+void MAVLinkRequestWindowTest::_testLoss()
+{
+    MAVLinkRequestWindow window;
+    for (int i = 0; i < 12; i++) {
+        window.requestSent(i, 0, false);
+        (void) window.responseReceived(i, 100);
+    }
+    const int grownWindow = window.window();
+    QVERIFY(grownWindow > static_cast<int>(MAVLinkRequestWindow::kInitialWindow));
+
+    for (int i = 0; i < grownWindow; i++) {
+        window.requestSent(i, 1000, false);
+    }
+    QCOMPARE(window.nextExpiryMSecs(), 1000 + window.rtoMSecs());
+
+    // Nothing has expired yet
+    QVERIFY(window.takeExpired(1001).isEmpty());
+    QCOMPARE(window.outstandingCount(), qsizetype(grownWindow));
+
+    // All requests of the window are lost, that halves the window only once and backs off the timeout
+    const qint64 rtoMSecs = window.rtoMSecs();
+    const QList<int> expired = window.takeExpired(window.nextExpiryMSecs());
+    QCOMPARE(expired.count(), qsizetype(grownWindow));
+    QCOMPARE(window.outstandingCount(), qsizetype(0));
+    QCOMPARE(window.nextExpiryMSecs(), -1LL);
+    QCOMPARE(window.window(), grownWindow / 2);
+    QCOMPARE(window.lostCount(), static_cast<quint64>(grownWindow));
+    QVERIFY(window.rtoMSecs() > rtoMSecs);
+
+    // takeAll counts as loss as well
+    window.requestSent(1, 100000, false);
+    window.requestSent(2, 100000, false);
+    QCOMPARE(window.takeAll(100000).count(), qsizetype(2));
+    QCOMPARE(window.window(), qMax(grownWindow / 4, 1));
+}
+
+void MAVLinkRequestWindowTest::_testRetransmissionNotSampled()
+{
+    MAVLinkRequestWindow window;
+    window.requestSent(0, 0, false);
+    QVERIFY(window.responseReceived(0, 100));
+    const double srttMSecs = window.srttMSecs();
+
+    // The response could belong to the first request, so it must not be used as a round trip sample
+    window.requestSent(1, 1000, true);
+    QVERIFY(window.responseReceived(1, 4000));
+    QCOMPARE(window.srttMSecs(), srttMSecs);
+}
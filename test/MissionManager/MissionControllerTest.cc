@@ -12,6 +12,7 @@
 #include "MissionController.h"
 #include "PlanMasterController.h"
 #include "SimpleMissionItem.h"
+#include "SurveyComplexItem.h"
 #include "MissionSettingsItem.h"
 #include "SettingsManager.h"
 #include "AppSettings.h"
@@ -19,6 +20,7 @@
 #include "MultiSignalSpy.h"
 
 #include <QtTest/QTest>
+#include <QtTest/QSignalSpy>
 
 MissionControllerTest::MissionControllerTest(void)
 {
@@ -232,6 +234,82 @@ void MissionControllerTest::_testVehicleYawRecalc(void)
     }
 }
 
+/// Checks the distances calculated by the controller against the item coordinates of a waypoint only mission
+bool MissionControllerTest::_flightDistancesMatchCoordinates(void)
+{
+    QmlObjectListModel* visualItems = _missionController->visualItems();
+
+    double distanceFromStart = 0;
+    for (int i=2; i<visualItems->count(); i++) {
+        VisualMissionItem* prevItem = visualItems->value<VisualMissionItem*>(i - 1);
+        VisualMissionItem* visualItem = visualItems->value<VisualMissionItem*>(i);
+        double distance = prevItem->coordinate().distanceTo(visualItem->coordinate());
+        distanceFromStart += distance;
+        if (!qFuzzyCompare(visualItem->distance(), distance) || !qFuzzyCompare(visualItem->distanceFromStart(), distanceFromStart)) {
+            qDebug() << "Distance mismatch - index:distance:expected" << i << visualItem->distance() << distance;
+            return false;
+        }
+    }
+
+    return qFuzzyCompare(_missionController->missionTotalDistance(), distanceFromStart);
+}
+
+// Editing a single item should only update what follows it, without resetting the flight path models
+void MissionControllerTest::_testIncrementalRecalc(void)
+{
+    _initForFirmwareType(MAV_AUTOPILOT_PX4);
+
+    int cMissionItems = 10;
+    QGeoCoordinate currentCoord(47.3977, 8.5456);
+    for (int i=1; i<=cMissionItems; i++) {
+        _missionController->insertSimpleMissionItem(currentCoord, i);
+        currentCoord = currentCoord.atDistanceAndAzimuth(100, 0);
+    }
+
+    QTest::qWait(500); // Recalcs in MissionController are queued to remove dups. Allow return to main message loop.
+    QVERIFY(_flightDistancesMatchCoordinates());
+
+    QmlObjectListModel* visualItems = _missionController->visualItems();
+    QmlObjectListModel* segments    = _missionController->simpleFlightPathSegments();
+    QList<QObject*>     segmentList = *segments->objectList();
+    QVERIFY(segmentList.count() > 5);
+
+    QSignalSpy spyReset(segments,   &QAbstractItemModel::modelReset);
+    QSignalSpy spyRemoved(segments, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy spyInserted(segments, &QAbstractItemModel::rowsInserted);
+
+    // Moving a waypoint keeps all segments, only the distances change
+    VisualMissionItem* movedItem = visualItems->value<VisualMissionItem*>(5);
+    movedItem->setCoordinate(movedItem->coordinate().atDistanceAndAzimuth(100, 90));
+    QTest::qWait(500);
+    QVERIFY(_flightDistancesMatchCoordinates());
+    QCOMPARE(*segments->objectList(), segmentList);
+    QCOMPARE(spyReset.count(), 0);
+    QCOMPARE(spyRemoved.count(), 0);
+    QCOMPARE(spyInserted.count(), 0);
+
+    // Removing a waypoint replaces its two segments with a single one, segments ahead of it are untouched
+    QGeoCoordinate movedCoord = movedItem->coordinate();
+    _missionController->removeVisualItem(5);
+    QTest::qWait(500);
+    QVERIFY(_flightDistancesMatchCoordinates());
+    QCOMPARE(segments->count(), segmentList.count() - 1);
+    QCOMPARE(spyReset.count(), 0);
+    QCOMPARE(spyRemoved.count(), 1);
+    QCOMPARE(spyInserted.count(), 1);
+    for (int i=0; i<3; i++) {
+        QCOMPARE(segments->get(i), segmentList[i]);
+    }
+    QCOMPARE(segments->get(segments->count() - 1), segmentList.last());
+
+    // Adding it back in
+    _missionController->insertSimpleMissionItem(movedCoord, 5);
+    QTest::qWait(500);
+    QVERIFY(_flightDistancesMatchCoordinates());
+    QCOMPARE(segments->count(), segmentList.count());
+    QCOMPARE(spyReset.count(), 0);
+}
+
 void MissionControllerTest::_testLoadJsonSectionAvailable(void)
 {
     _initForFirmwareType(MAV_AUTOPILOT_PX4);
@@ -291,3 +369,41 @@ void MissionControllerTest::_testGlobalAltMode(void)
         }
     }
 }
+
+// Saving must use the sequence numbers for the current survey settings, not the results of an older transects job
+void MissionControllerTest::_testTransectsJobSave(void)
+{
+    _initForFirmwareType(MAV_AUTOPILOT_PX4);
+
+    const QGeoCoordinate origin(47.6, -122.3);
+    SurveyComplexItem* surveyItem = qobject_cast<SurveyComplexItem*>(_missionController->insertComplexMissionItem(SurveyComplexItem::name, origin, 1));
+    QVERIFY(surveyItem);
+    surveyItem->cameraCalc()->adjustedFootprintSide()->setRawValue(25);
+    surveyItem->cameraCalc()->adjustedFootprintFrontal()->setRawValue(25);
+    surveyItem->surveyAreaPolygon()->clear();
+    surveyItem->surveyAreaPolygon()->appendVertices(QList<QGeoCoordinate>({
+        origin,
+        origin.atDistanceAndAzimuth(400, 90),
+        origin.atDistanceAndAzimuth(400, 90).atDistanceAndAzimuth(150, 0),
+        origin.atDistanceAndAzimuth(150, 0),
+    }));
+    SimpleMissionItem* simpleItem = qobject_cast<SimpleMissionItem*>(_missionController->insertSimpleMissionItem(origin, 2));
+    QVERIFY(simpleItem);
+
+    // Reference sequence numbers from the synchronous path
+    surveyItem->gridAngle()->setRawValue(90);
+    const int expectedLastSequenceNumber = surveyItem->lastSequenceNumber();
+    surveyItem->gridAngle()->setRawValue(0);
+    QVERIFY(surveyItem->lastSequenceNumber() != expectedLastSequenceNumber);
+    QCOMPARE(simpleItem->sequenceNumber(), surveyItem->lastSequenceNumber() + 1);
+
+    surveyItem->_setAsyncTransects(true);
+    surveyItem->gridAngle()->setRawValue(90);
+    QVERIFY(surveyItem->_transectsJobPending());
+
+    QJsonObject json;
+    _missionController->save(json);
+    QVERIFY(!surveyItem->_transectsJobPending());
+    QCOMPARE(surveyItem->lastSequenceNumber(), expectedLastSequenceNumber);
+    QCOMPARE(simpleItem->sequenceNumber(), expectedLastSequenceNumber + 1);
+}
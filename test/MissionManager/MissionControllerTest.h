@@ -32,6 +32,8 @@ private slots:
     void _testGlobalAltMode             (void);
     void _testGimbalRecalc              (void);
     void _testVehicleYawRecalc          (void);
+    void _testIncrementalRecalc         (void);
+    void _testTransectsJobSave          (void);
 
 private:
 #if 0
@@ -47,6 +49,7 @@ private slots:
     void _testOfflineToOnlineWorker(MAV_AUTOPILOT firmwareType);
 #endif
     void _setupVisualItemSignals(VisualMissionItem* visualItem);
+    bool _flightDistancesMatchCoordinates(void);
 
     // MissiomItems signals
 
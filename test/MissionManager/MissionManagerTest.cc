@@ -10,8 +10,13 @@
 
 #include "MissionManagerTest.h"
 #include "MissionManager.h"
+#include "FTPManager.h"
+#include "MockLink.h"
+#include "MockLinkFTP.h"
 #include "MultiSignalSpy.h"
+#include "Vehicle.h"
 
+#include <QtCore/QElapsedTimer>
 #include <QtTest/QTest>
 #include <QtTest/QSignalSpy>
 
@@ -355,3 +360,166 @@ void MissionManagerTest::_testErrorAckFailureStrings(void)
     }
 
 }
+
+void MissionManagerTest::_testReadLatency(void)
+{
+    // Only ArduPilot serves items in any order, so only there item requests are pipelined
+    _initForFirmwareType(MAV_AUTOPILOT_ARDUPILOTMEGA);
+
+    const int cItems = 200;
+    const int latencyMSecs = 100;
+
+    // Editor has a home position item on the front, so we do the same
+    QList<MissionItem*> missionItems;
+    for (int i=0; i<=cItems; i++) {
+        missionItems.append(new MissionItem(i, MAV_CMD_NAV_WAYPOINT, MAV_FRAME_GLOBAL_RELATIVE_ALT, 0, 0, 0, 0, 47.3769 + (i * 0.0001), 8.549444, 50, true, false, this));
+    }
+
+    _missionManager->writeMissionItems(missionItems);
+    QVERIFY(_multiSpyMissionManager->waitForSignalByIndex(sendCompleteSignalIndex, _missionManagerSignalWaitTime));
+    QCOMPARE(_multiSpyMissionManager->pullBoolFromSignalIndex(sendCompleteSignalIndex), false);
+    _multiSpyMissionManager->clearAllSignals();
+
+    // Item requests are pipelined, so the read needs far fewer round trips than there are items
+    _mockLink->setResponseLatencyMSecs(latencyMSecs);
+    QElapsedTimer readTimer;
+    readTimer.start();
+    _missionManager->loadFromVehicle();
+    QVERIFY(_multiSpyMissionManager->waitForSignalByIndex(newMissionItemsAvailableSignalIndex, _missionManagerSignalWaitTime));
+    const qint64 readMSecs = readTimer.elapsed();
+    _mockLink->setResponseLatencyMSecs(0);
+
+    qCDebug(UnitTestLog) << "Read" << cItems << "items with" << latencyMSecs << "msecs latency in" << readMSecs << "msecs";
+    QCOMPARE(_multiSpyMissionManager->checkNoSignalByMask(errorSignalMask), true);
+    QVERIFY(readMSecs < ((cItems * latencyMSecs) / 4));
+
+    // Home position at position 0 comes from vehicle
+    QCOMPARE(_missionManager->missionItems().count(), cItems + 1);
+    for (int i=0; i<=cItems; i++) {
+        QCOMPARE(_missionManager->missionItems()[i]->sequenceNumber(), i);
+    }
+}
+
+void MissionManagerTest::_testReadSequencePX4(void)
+{
+    _initForFirmwareType(MAV_AUTOPILOT_PX4);
+
+    const int cItems = 20;
+    const int latencyMSecs = 50;
+
+    // Editor has a home position item on the front, so we do the same
+    QList<MissionItem*> missionItems;
+    for (int i=0; i<=cItems; i++) {
+        missionItems.append(new MissionItem(i, MAV_CMD_NAV_WAYPOINT, MAV_FRAME_GLOBAL_RELATIVE_ALT, 0, 0, 0, 0, 47.3769 + (i * 0.0001), 8.549444, 50, true, false, this));
+    }
+
+    _missionManager->writeMissionItems(missionItems);
+    QVERIFY(_multiSpyMissionManager->waitForSignalByIndex(sendCompleteSignalIndex, _missionManagerSignalWaitTime));
+    QCOMPARE(_multiSpyMissionManager->pullBoolFromSignalIndex(sendCompleteSignalIndex), false);
+    _multiSpyMissionManager->clearAllSignals();
+
+    // MockLink answers anything but the next item or a repeat of the previous one with MAV_MISSION_ERROR like PX4,
+    // so the items have to be requested one at a time even when the link is slow
+    _mockLink->setResponseLatencyMSecs(latencyMSecs);
+    QElapsedTimer readTimer;
+    readTimer.start();
+    _missionManager->loadFromVehicle();
+    QVERIFY(_multiSpyMissionManager->waitForSignalByIndex(newMissionItemsAvailableSignalIndex, _missionManagerSignalWaitTime));
+    const qint64 readMSecs = readTimer.elapsed();
+    _mockLink->setResponseLatencyMSecs(0);
+
+    QCOMPARE(_multiSpyMissionManager->checkNoSignalByMask(errorSignalMask), true);
+    QVERIFY(readMSecs >= (cItems * latencyMSecs));
+
+    QCOMPARE(_missionManager->missionItems().count(), cItems);
+    for (int i=0; i<cItems; i++) {
+        QCOMPARE(_missionManager->missionItems()[i]->sequenceNumber(), i);
+    }
+}
+
+void MissionManagerTest::_testFTPTransfer(void)
+{
+    _initForFirmwareType(MAV_AUTOPILOT_ARDUPILOTMEGA);
+    _mockLink->mockLinkFTP()->enableMissionFiles(true);
+
+    const int cItems = 500;
+
+    QSignalSpy spyUpload(_vehicle->ftpManager(), &FTPManager::uploadComplete);
+    QSignalSpy spyDownload(_vehicle->ftpManager(), &FTPManager::downloadComplete);
+
+    // Editor has a home position item on the front, so we do the same
+    QList<MissionItem*> missionItems;
+    for (int i=0; i<=cItems; i++) {
+        missionItems.append(new MissionItem(i, MAV_CMD_NAV_WAYPOINT, MAV_FRAME_GLOBAL_RELATIVE_ALT, i, 0, 0, 0, 47.3769 + (i * 0.0001), 8.549444, 50, true, false, this));
+    }
+
+    // The whole mission is written as a single plan file
+    _missionManager->writeMissionItems(missionItems);
+    QVERIFY(_multiSpyMissionManager->waitForSignalByIndex(sendCompleteSignalIndex, _missionManagerSignalWaitTime));
+    QCOMPARE(_multiSpyMissionManager->pullBoolFromSignalIndex(sendCompleteSignalIndex), false);
+    QCOMPARE(spyUpload.count(), 1);
+    QCOMPARE(spyUpload[0][1].toString(), QString());
+    QCOMPARE(_mockLink->missionItemHandler()->missionItems(MAV_MISSION_TYPE_MISSION).count(), cItems + 1);
+    _multiSpyMissionManager->clearAllSignals();
+
+    // And read back with a burst download of the plan file
+    _missionManager->loadFromVehicle();
+    QVERIFY(_multiSpyMissionManager->waitForSignalByIndex(newMissionItemsAvailableSignalIndex, _missionManagerSignalWaitTime));
+    QCOMPARE(_multiSpyMissionManager->checkNoSignalByMask(errorSignalMask), true);
+    QCOMPARE(spyDownload.count(), 1);
+    QCOMPARE(spyDownload[0][1].toString(), QString());
+
+    QCOMPARE(_missionManager->missionItems().count(), cItems + 1);
+    for (int i=0; i<=cItems; i++) {
+        const MissionItem* item = _missionManager->missionItems()[i];
+        QCOMPARE(item->sequenceNumber(), i);
+        QCOMPARE(item->command(), MAV_CMD_NAV_WAYPOINT);
+        QCOMPARE(item->frame(), MAV_FRAME_GLOBAL_RELATIVE_ALT);
+        QCOMPARE(item->param1(), static_cast<double>(i));
+        QVERIFY(qAbs(item->param5() - (47.3769 + (i * 0.0001))) < 1e-6);
+        QCOMPARE(item->param7(), 50.0);
+    }
+}
+
+void MissionManagerTest::_testFTPWriteNak(void)
+{
+    _initForFirmwareType(MAV_AUTOPILOT_ARDUPILOTMEGA);
+    _mockLink->mockLinkFTP()->enableMissionFiles(true);
+    _mockLink->mockLinkFTP()->setErrorMode(MockLinkFTP::errModeNakWriteOnce);
+
+    const int cItems = 50;
+
+    QSignalSpy spyUpload(_vehicle->ftpManager(), &FTPManager::uploadComplete);
+
+    // Editor has a home position item on the front, so we do the same
+    QList<MissionItem*> missionItems;
+    for (int i=0; i<=cItems; i++) {
+        missionItems.append(new MissionItem(i, MAV_CMD_NAV_WAYPOINT, MAV_FRAME_GLOBAL_RELATIVE_ALT, i, 0, 0, 0, 47.3769 + (i * 0.0001), 8.549444, 50, true, false, this));
+    }
+
+    // The failed upload falls back to the mission protocol
+    _missionManager->writeMissionItems(missionItems);
+    QVERIFY(_multiSpyMissionManager->waitForSignalByIndex(sendCompleteSignalIndex, _missionManagerSignalWaitTime));
+    QCOMPARE(_multiSpyMissionManager->pullBoolFromSignalIndex(sendCompleteSignalIndex), false);
+    QCOMPARE(spyUpload.count(), 1);
+    QVERIFY(!spyUpload[0][1].toString().isEmpty());
+    QCOMPARE(_mockLink->missionItemHandler()->missionItems(MAV_MISSION_TYPE_MISSION).count(), cItems + 1);
+    _multiSpyMissionManager->clearAllSignals();
+
+    // The session of the failed upload was closed, so the next upload gets one
+    missionItems.clear();
+    for (int i=0; i<=cItems; i++) {
+        missionItems.append(new MissionItem(i, MAV_CMD_NAV_WAYPOINT, MAV_FRAME_GLOBAL_RELATIVE_ALT, i + 1, 0, 0, 0, 47.3769 + (i * 0.0001), 8.549444, 50, true, false, this));
+    }
+    _missionManager->writeMissionItems(missionItems);
+    QVERIFY(_multiSpyMissionManager->waitForSignalByIndex(sendCompleteSignalIndex, _missionManagerSignalWaitTime));
+    QCOMPARE(_multiSpyMissionManager->pullBoolFromSignalIndex(sendCompleteSignalIndex), false);
+    QCOMPARE(spyUpload.count(), 2);
+    QCOMPARE(spyUpload[1][1].toString(), QString());
+
+    const QList<mavlink_mission_item_int_t> vehicleItems = _mockLink->missionItemHandler()->missionItems(MAV_MISSION_TYPE_MISSION);
+    QCOMPARE(vehicleItems.count(), cItems + 1);
+    for (int i=1; i<=cItems; i++) {
+        QCOMPARE(vehicleItems[i].param1, static_cast<float>(i + 1));
+    }
+}
@@ -24,6 +24,10 @@ private slots:
     void _testReadFailureHandlingPX4(void);
     //void _testReadFailureHandlingAPM(void);
     //void _testErrorAckFailureStrings(void);
+    void _testReadLatency(void);
+    void _testReadSequencePX4(void);
+    void _testFTPTransfer(void);
+    void _testFTPWriteNak(void);
 
 private:
     void _testWriteFailureHandlingPX4(void);
@@ -0,0 +1,380 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#include "MissionPlanningBenchmark.h"
+#include "CorridorScanComplexItem.h"
+#include "KMLPlanDomDocument.h"
+#include "MissionController.h"
+#include "MissionItem.h"
+#include "MissionManager.h"
+#include "MultiVehicleManager.h"
+#include "PlanMasterController.h"
+#include "QGCMapPolygon.h"
+#include "QGCMapPolyline.h"
+#include "QmlObjectListModel.h"
+#include "StructureScanComplexItem.h"
+#include "SurveyComplexItem.h"
+#include "Vehicle.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QTextStream>
+#include <QtPositioning/QGeoCoordinate>
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+namespace
+{
+
+constexpr int kWaypointsPerRow = 100;
+constexpr double kRowSpacingDegrees = 0.0002;
+constexpr double kColumnSpacingDegrees = 0.0003;
+constexpr double kWaypointAltitude = 50;
+constexpr int kUploadTimeoutMSecs = 10 * 60 * 1000;
+const QGeoCoordinate kOrigin(47.3977, 8.5456, 0);
+
+/// Recalcs and terrain updates are queued through compressed signals. A recalc can queue the next one, e.g. the flight
+/// path segments queue the mission flight status, so deliver them the way a few event loop passes would.
+void _flushQueuedSignals()
+{
+    for (int i = 0; i < 3; i++) {
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::MetaCall);
+    }
+}
+
+void _reportResult(qint64 elapsedNSecs, qint64 iterations)
+{
+    const double msecs = (iterations > 0) ? (static_cast<double>(elapsedNSecs) / static_cast<double>(iterations) / 1e6) : 0;
+    const QString benchmark = QString::fromLatin1(QTest::currentTestFunction());
+    const QString row = QString::fromLatin1(QTest::currentDataTag());
+
+    qInfo().noquote() << QStringLiteral("planbench benchmark:%1 row:\"%2\" msecs_per_iteration:%3 iterations:%4")
+        .arg(benchmark, row)
+        .arg(msecs, 0, 'f', 3)
+        .arg(iterations);
+
+    const QString resultsFileName = qEnvironmentVariable("QGC_BENCHMARK_RESULTS");
+    if (resultsFileName.isEmpty()) {
+        return;
+    }
+
+    QFile resultsFile(resultsFileName);
+    if (!resultsFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+        qWarning() << "Unable to open benchmark results file" << resultsFileName << resultsFile.errorString();
+        return;
+    }
+
+    QTextStream stream(&resultsFile);
+    if (resultsFile.size() == 0) {
+        stream << "suite,benchmark,row,msecs_per_iteration,iterations\n";
+    }
+    stream << "MissionPlanningBenchmark," << benchmark << ",\"" << row << "\"," << QString::number(msecs, 'f', 3) << "," << iterations << "\n";
+}
+
+/// Star shaped so the survey area is concave and transects are split
+QList<QGeoCoordinate> _polygonVertices(int vertexCount)
+{
+    QList<QGeoCoordinate> vertices;
+    vertices.reserve(vertexCount);
+    for (int i = 0; i < vertexCount; i++) {
+        const double radius = ((i % 2) ? 500.0 : 800.0) + ((i % 7) * 20.0);
+        vertices.append(kOrigin.atDistanceAndAzimuth(radius, (360.0 * i) / vertexCount));
+    }
+    return vertices;
+}
+
+QList<QGeoCoordinate> _polylineVertices(int vertexCount)
+{
+    QList<QGeoCoordinate> vertices;
+    vertices.reserve(vertexCount);
+    for (int i = 0; i < vertexCount; i++) {
+        const QGeoCoordinate alongTrack = kOrigin.atDistanceAndAzimuth(i * 30.0, 90);
+        vertices.append(alongTrack.atDistanceAndAzimuth(((i % 2) ? 40.0 : 0.0) + ((i % 5) * 10.0), 0));
+    }
+    return vertices;
+}
+
+} // namespace
+
+void MissionPlanningBenchmark::init()
+{
+    UnitTest::init();
+
+    _tempDir = new QTemporaryDir();
+    QVERIFY(_tempDir->isValid());
+
+    _connectMockLink(MAV_AUTOPILOT_PX4);
+
+    _masterController = new PlanMasterController(this);
+    _masterController->setFlyView(false);
+    _masterController->start();
+    QTRY_VERIFY_WITH_TIMEOUT(!_masterController->syncInProgress(), 10000);
+}
+
+void MissionPlanningBenchmark::cleanup()
+{
+    delete _masterController;
+    _masterController = nullptr;
+
+    delete _tempDir;
+    _tempDir = nullptr;
+
+    UnitTest::cleanup();
+}
+
+void MissionPlanningBenchmark::_addItemCountRows()
+{
+    QTest::addColumn<int>("itemCount");
+
+    QTest::newRow("1k items") << 1000;
+    QTest::newRow("5k items") << 5000;
+    QTest::newRow("10k items") << 10000;
+    QTest::newRow("50k items") << 50000;
+}
+
+QString MissionPlanningBenchmark::_loadPlan(int itemCount)
+{
+    const QString waypointsFileName = _tempDir->filePath(QStringLiteral("%1.waypoints").arg(itemCount));
+    QFile waypointsFile(waypointsFileName);
+    if (!waypointsFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return QString();
+    }
+
+    // Lawnmower pattern, the first line is the planned home position
+    QTextStream stream(&waypointsFile);
+    stream << "QGC WPL 110\n";
+    stream << "0\t1\t0\t16\t0\t0\t0\t0\t" << QString::number(kOrigin.latitude(), 'f', 7) << "\t" << QString::number(kOrigin.longitude(), 'f', 7) << "\t0\t1\n";
+    for (int i = 0; i < itemCount; i++) {
+        const int row = i / kWaypointsPerRow;
+        const int column = (row % 2) ? (kWaypointsPerRow - 1 - (i % kWaypointsPerRow)) : (i % kWaypointsPerRow);
+        const double latitude = kOrigin.latitude() + (row * kRowSpacingDegrees);
+        const double longitude = kOrigin.longitude() + (column * kColumnSpacingDegrees);
+        stream << (i + 1) << "\t0\t3\t16\t0\t0\t0\t0\t" << QString::number(latitude, 'f', 7) << "\t" << QString::number(longitude, 'f', 7) << "\t" << kWaypointAltitude << "\t1\n";
+    }
+    stream.flush();
+    waypointsFile.close();
+
+    // Round trip through a plan file so the benchmarks use the regular json load path
+    _masterController->loadFromFile(waypointsFileName);
+    const QString planFileName = _tempDir->filePath(QStringLiteral("%1.%2").arg(itemCount).arg(_masterController->fileExtension()));
+    _masterController->saveToFile(planFileName);
+    _masterController->loadFromFile(planFileName);
+    _flushQueuedSignals();
+
+    if (_masterController->missionController()->visualItems()->count() != (itemCount + 1)) {
+        return QString();
+    }
+
+    return planFileName;
+}
+
+void MissionPlanningBenchmark::_benchmarkLoad()
+{
+    QFETCH(int, itemCount);
+
+    const QString planFileName = _loadPlan(itemCount);
+    QVERIFY(!planFileName.isEmpty());
+
+    QElapsedTimer timer;
+    qint64 iterations = 0;
+    timer.start();
+    QBENCHMARK {
+        _masterController->loadFromFile(planFileName);
+        _flushQueuedSignals();
+        iterations++;
+    }
+    _reportResult(timer.nsecsElapsed(), iterations);
+
+    QCOMPARE(_masterController->missionController()->visualItems()->count(), itemCount + 1);
+}
+
+void MissionPlanningBenchmark::_benchmarkSave()
+{
+    QFETCH(int, itemCount);
+
+    QVERIFY(!_loadPlan(itemCount).isEmpty());
+
+    QElapsedTimer timer;
+    qint64 iterations = 0;
+    timer.start();
+    QBENCHMARK {
+        const QByteArray bytes = _masterController->saveToJson().toJson();
+        QVERIFY(!bytes.isEmpty());
+        iterations++;
+    }
+    _reportResult(timer.nsecsElapsed(), iterations);
+}
+
+void MissionPlanningBenchmark::_benchmarkRecalc_data()
+{
+    QTest::addColumn<int>("itemCount");
+    QTest::addColumn<bool>("moveFirstItem");
+
+    // Moving the first item recalcs the whole flight path, a later item only what follows it
+    const QList<int> itemCounts = { 1000, 5000, 10000, 50000 };
+    for (const int itemCount : itemCounts) {
+        QTest::addRow("%dk items, first item moved", itemCount / 1000) << itemCount << true;
+        QTest::addRow("%dk items, middle item moved", itemCount / 1000) << itemCount << false;
+    }
+}
+
+void MissionPlanningBenchmark::_benchmarkRecalc()
+{
+    QFETCH(int, itemCount);
+    QFETCH(bool, moveFirstItem);
+
+    QVERIFY(!_loadPlan(itemCount).isEmpty());
+
+    MissionController *const missionController = _masterController->missionController();
+    VisualMissionItem *const item = missionController->visualItems()->value<VisualMissionItem*>(moveFirstItem ? 1 : (itemCount / 2));
+    QVERIFY(item);
+    const QGeoCoordinate originalCoordinate = item->coordinate();
+    const QGeoCoordinate movedCoordinate = originalCoordinate.atDistanceAndAzimuth(50, 45);
+    const double missionDistance = missionController->missionTotalDistance();
+
+    QElapsedTimer timer;
+    qint64 iterations = 0;
+    timer.start();
+    QBENCHMARK {
+        item->setCoordinate((iterations % 2) ? originalCoordinate : movedCoordinate);
+        _flushQueuedSignals();
+        iterations++;
+    }
+    _reportResult(timer.nsecsElapsed(), iterations);
+
+    item->setCoordinate(originalCoordinate);
+    _flushQueuedSignals();
+    QCOMPARE(missionController->missionTotalDistance(), missionDistance);
+}
+
+void MissionPlanningBenchmark::_benchmarkConvertToMissionItems()
+{
+    QFETCH(int, itemCount);
+
+    QVERIFY(!_loadPlan(itemCount).isEmpty());
+
+    QmlObjectListModel *const visualItems = _masterController->missionController()->visualItems();
+
+    QElapsedTimer timer;
+    qint64 iterations = 0;
+    timer.start();
+    QBENCHMARK {
+        QObject missionItemParent;
+        QList<MissionItem*> missionItems;
+        (void) MissionController::_convertToMissionItems(visualItems, missionItems, &missionItemParent);
+        QCOMPARE(missionItems.count(), itemCount + 1);
+        iterations++;
+    }
+    _reportResult(timer.nsecsElapsed(), iterations);
+}
+
+void MissionPlanningBenchmark::_benchmarkKmlExport()
+{
+    QFETCH(int, itemCount);
+
+    QVERIFY(!_loadPlan(itemCount).isEmpty());
+
+    MissionController *const missionController = _masterController->missionController();
+
+    QElapsedTimer timer;
+    qint64 iterations = 0;
+    timer.start();
+    QBENCHMARK {
+        KMLPlanDomDocument planKML;
+        missionController->addMissionToKML(planKML);
+        QVERIFY(!planKML.toString().isEmpty());
+        // addMissionToKML releases its mission items through deleteLater
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+        iterations++;
+    }
+    _reportResult(timer.nsecsElapsed(), iterations);
+}
+
+void MissionPlanningBenchmark::_benchmarkUpload()
+{
+    QFETCH(int, itemCount);
+
+    QVERIFY(!_loadPlan(itemCount).isEmpty());
+
+    Vehicle *const vehicle = MultiVehicleManager::instance()->activeVehicle();
+    QVERIFY(vehicle);
+    MissionManager *const missionManager = vehicle->missionManager();
+    QmlObjectListModel *const visualItems = _masterController->missionController()->visualItems();
+
+    QElapsedTimer timer;
+    qint64 iterations = 0;
+    timer.start();
+    QBENCHMARK {
+        QSignalSpy spySendComplete(missionManager, &PlanManager::sendComplete);
+        MissionController::sendItemsToVehicle(vehicle, visualItems);
+        QVERIFY(spySendComplete.wait(kUploadTimeoutMSecs));
+        QCOMPARE(spySendComplete.takeFirst().at(0).toBool(), false);
+        iterations++;
+    }
+    _reportResult(timer.nsecsElapsed(), iterations);
+
+    QCOMPARE(missionManager->missionItems().count(), itemCount + 1);
+}
+
+void MissionPlanningBenchmark::_benchmarkComplexItem_data()
+{
+    QTest::addColumn<QString>("itemName");
+    QTest::addColumn<int>("vertexCount");
+
+    QTest::newRow("survey, 500 vertices") << SurveyComplexItem::name << 500;
+    QTest::newRow("corridor scan, 500 vertices") << CorridorScanComplexItem::name << 500;
+    QTest::newRow("structure scan, 500 vertices") << StructureScanComplexItem::name << 500;
+}
+
+void MissionPlanningBenchmark::_benchmarkComplexItem()
+{
+    QFETCH(QString, itemName);
+    QFETCH(int, vertexCount);
+
+    MissionController *const missionController = _masterController->missionController();
+    VisualMissionItem *const item = missionController->insertComplexMissionItem(itemName, kOrigin, missionController->visualItems()->count());
+    QVERIFY(item);
+
+    QGCMapPolygon *polygon = nullptr;
+    QGCMapPolyline *polyline = nullptr;
+    if (SurveyComplexItem *const survey = qobject_cast<SurveyComplexItem*>(item)) {
+        survey->cameraCalc()->adjustedFootprintSide()->setRawValue(25);
+        survey->cameraCalc()->adjustedFootprintFrontal()->setRawValue(25);
+        polygon = survey->surveyAreaPolygon();
+    } else if (CorridorScanComplexItem *const corridor = qobject_cast<CorridorScanComplexItem*>(item)) {
+        corridor->cameraCalc()->adjustedFootprintSide()->setRawValue(25);
+        corridor->cameraCalc()->adjustedFootprintFrontal()->setRawValue(25);
+        polyline = corridor->corridorPolyline();
+    } else if (StructureScanComplexItem *const structure = qobject_cast<StructureScanComplexItem*>(item)) {
+        polygon = structure->structurePolygon();
+    }
+    QVERIFY(polygon || polyline);
+
+    const QList<QGeoCoordinate> vertices = polygon ? _polygonVertices(vertexCount) : _polylineVertices(vertexCount);
+
+    QElapsedTimer timer;
+    qint64 iterations = 0;
+    timer.start();
+    QBENCHMARK {
+        if (polygon) {
+            polygon->clear();
+            polygon->appendVertices(vertices);
+        } else {
+            polyline->clear();
+            polyline->appendVertices(vertices);
+        }
+        _flushQueuedSignals();
+        iterations++;
+    }
+    _reportResult(timer.nsecsElapsed(), iterations);
+
+    QVERIFY(missionController->visualItems()->count() > 1);
+}
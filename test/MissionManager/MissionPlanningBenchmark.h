@@ -0,0 +1,54 @@
+/****************************************************************************
+ *
+ * (c) 2009-2024 QGROUNDCONTROL PROJECT <http://www.qgroundcontrol.org>
+ *
+ * QGroundControl is licensed according to the terms in the file
+ * COPYING.md in the root of the source code directory.
+ *
+ ****************************************************************************/
+
+#pragma once
+
+#include "UnitTest.h"
+
+class PlanMasterController;
+class QTemporaryDir;
+
+/// Plan View performance with synthetic plans of 1k to 50k waypoints and complex items over 500 vertex polygons.
+/// Measures MissionController load, save, flight path recalc, mission item conversion, KML export and the upload to
+/// a MockLink vehicle. Every measurement is also logged as a single planbench line and, if the environment variable
+/// QGC_BENCHMARK_RESULTS names a file, appended to it as a CSV row so results can be tracked per commit.
+/// Standalone, run with the benchmark build target or --unittest:MissionPlanningBenchmark.
+class MissionPlanningBenchmark : public UnitTest
+{
+    Q_OBJECT
+
+private slots:
+    void init() final;
+    void cleanup() final;
+
+    void _benchmarkLoad_data() { _addItemCountRows(); }
+    void _benchmarkLoad();
+    void _benchmarkSave_data() { _addItemCountRows(); }
+    void _benchmarkSave();
+    void _benchmarkRecalc_data();
+    void _benchmarkRecalc();
+    void _benchmarkConvertToMissionItems_data() { _addItemCountRows(); }
+    void _benchmarkConvertToMissionItems();
+    void _benchmarkKmlExport_data() { _addItemCountRows(); }
+    void _benchmarkKmlExport();
+    void _benchmarkUpload_data() { _addItemCountRows(); }
+    void _benchmarkUpload();
+    void _benchmarkComplexItem_data();
+    void _benchmarkComplexItem();
+
+private:
+    static void _addItemCountRows();
+
+    /// Writes a plan file with itemCount waypoints and loads it
+    ///     @return Plan file name, empty on failure
+    QString _loadPlan(int itemCount);
+
+    PlanMasterController *_masterController = nullptr;
+    QTemporaryDir *_tempDir = nullptr;
+};
@@ -12,6 +12,8 @@
 #include "PlanViewSettings.h"
 #include "MultiSignalSpy.h"
 
+#include <QtCore/QJsonArray>
+#include <QtTest/QSignalSpy>
 #include <QtTest/QTest>
 
 SurveyComplexItemTest::SurveyComplexItemTest(void)
@@ -357,3 +359,41 @@ void SurveyComplexItemTest::_testHoverCaptureItemGeneration(void)
     _testItemGenerationWorker(false /* imagesInTurnaround */, true /* hasTurnaround */, true /* useConditionGate */, expectedCommands);
     _testItemGenerationWorker(false /* imagesInTurnaround */, true /* hasTurnaround */, false /* useConditionGate */, expectedCommands);
 }
+
+void SurveyComplexItemTest::_testAsyncTransects(void)
+{
+    // Reference transects from the synchronous path
+    _surveyItem->gridAngle()->setRawValue(45);
+    const QVariantList expectedGridPoints = _surveyItem->visualTransectPoints();
+    _surveyItem->gridAngle()->setRawValue(0);
+    const QVariantList originalGridPoints = _surveyItem->visualTransectPoints();
+    QVERIFY(expectedGridPoints != originalGridPoints);
+
+    _surveyItem->_setAsyncTransects(true);
+    QSignalSpy visualTransectPointsSpy(_surveyItem, &SurveyComplexItem::visualTransectPointsChanged);
+
+    // Each change supersedes the previous one, only the final transects are published
+    for (double gridAngle=5; gridAngle<=45; gridAngle+=5) {
+        _surveyItem->gridAngle()->setRawValue(gridAngle);
+        QVERIFY(_surveyItem->_transectsJobPending());
+        QCOMPARE(_surveyItem->visualTransectPoints(), originalGridPoints);
+    }
+    QTRY_VERIFY(!_surveyItem->_transectsJobPending());
+    QCOMPARE(visualTransectPointsSpy.count(), 1);
+    QCOMPARE(_surveyItem->visualTransectPoints(), expectedGridPoints);
+    int expectedTransectCount = _expectedTransectCount;
+    QCOMPARE(_surveyItem->_transectCount(), expectedTransectCount);
+
+    // Saving needs the transects for the current settings so it must not use stale results
+    _surveyItem->gridAngle()->setRawValue(0);
+    QVERIFY(_surveyItem->_transectsJobPending());
+    QJsonArray planItems;
+    _surveyItem->save(planItems);
+    QVERIFY(!_surveyItem->_transectsJobPending());
+    QCOMPARE(_surveyItem->visualTransectPoints(), originalGridPoints);
+
+    // The pending finished notification for the already published job must not publish again
+    visualTransectPointsSpy.clear();
+    QTest::qWait(100);
+    QCOMPARE(visualTransectPointsSpy.count(), 0);
+}
@@ -37,6 +37,7 @@ private slots:
     void _testItemGeneration(void);
     void _testItemCount(void);
     void _testHoverCaptureItemGeneration(void);
+    void _testAsyncTransects(void);
 #else
     // Handy mechanism to to a single test
 private slots:
@@ -47,6 +48,7 @@ private slots:
     void _testEntryLocation(void);
     void _testItemGeneration(void);
     void _testHoverCaptureItemGeneration(void);
+    void _testAsyncTransects(void);
 #endif
 
 private:
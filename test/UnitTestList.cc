@@ -19,7 +19,10 @@
 // #include "GeoTagControllerTest.h"
 // #include "MavlinkLogTest.h"
 #include "LogDownloadTest.h"
+#include "MAVLinkSeriesBufferBenchmark.h"
+#include "MAVLinkSeriesBufferTest.h"
 #include "PX4LogParserTest.h"
+#include "TLogAnalyzerTest.h"
 // #include "ULogParserTest.h"
 
 // AutoPilotPlugins
@@ -29,11 +32,29 @@
 #include "QGCCameraManagerTest.h"
 
 // Comms
+#include "LinkMetricsTest.h"
+#include "LinkSendQueueTest.h"
+#include "LogReplayLinkTest.h"
+#include "MAVLinkDecodeWorkerTest.h"
+#include "MAVLinkForwardFilterTest.h"
+#include "MAVLinkLogWriterTest.h"
+#include "MockLinkSwarmBenchmark.h"
+#include "MockLinkSwarmTest.h"
 #include "QGCSerialPortInfoTest.h"
+#include "TLogIndexTest.h"
+#include "UDPLinkBenchmark.h"
+#include "UDPLinkTest.h"
 
 // FactSystem
+#include "FactBenchmark.h"
 #include "FactSystemTestGeneric.h"
 #include "FactSystemTestPX4.h"
+#include "FactTest.h"
+#include "FactUpdateSchedulerTest.h"
+#include "ParamCacheFileTest.h"
+#include "ParamMetaDataBlobBenchmark.h"
+#include "ParamMetaDataBlobTest.h"
+#include "ParamWriteQueueTest.h"
 #include "ParameterManagerTest.h"
 
 // FollowMe
@@ -43,6 +64,11 @@
 #include "GpsTest.h"
 
 // MAVLink
+#include "MAVLinkFrameDecoderBenchmark.h"
+#include "MAVLinkFrameDecoderTest.h"
+#include "MAVLinkMessageDispatcherBenchmark.h"
+#include "MAVLinkMessageDispatcherTest.h"
+#include "MAVLinkRequestWindowTest.h"
 #include "StatusTextHandlerTest.h"
 #include "SigningTest.h"
 
@@ -58,6 +84,7 @@
 #include "MissionControllerTest.h"
 #include "MissionItemTest.h"
 #include "MissionManagerTest.h"
+#include "MissionPlanningBenchmark.h"
 #include "MissionSettingsTest.h"
 #include "PlanMasterControllerTest.h"
 #include "QGCMapPolygonTest.h"
@@ -124,7 +151,10 @@ int QGCUnitTest::runTests(bool stress, const QStringList& unitTests)
     // UT_REGISTER_TEST(GeoTagControllerTest)
     // UT_REGISTER_TEST(MavlinkLogTest)
     UT_REGISTER_TEST(LogDownloadTest)
+    UT_REGISTER_TEST_STANDALONE(MAVLinkSeriesBufferBenchmark)
+    UT_REGISTER_TEST(MAVLinkSeriesBufferTest)
     UT_REGISTER_TEST(PX4LogParserTest)
+    UT_REGISTER_TEST(TLogAnalyzerTest)
     // UT_REGISTER_TEST(ULogParserTest)
 
     // AutoPilotPlugins
@@ -134,11 +164,29 @@ int QGCUnitTest::runTests(bool stress, const QStringList& unitTests)
     UT_REGISTER_TEST(QGCCameraManagerTest)
 
     // Comms
+    UT_REGISTER_TEST(LinkMetricsTest)
+    UT_REGISTER_TEST(LinkSendQueueTest)
+    UT_REGISTER_TEST(LogReplayLinkTest)
+    UT_REGISTER_TEST(MAVLinkDecodeWorkerTest)
+    UT_REGISTER_TEST(MAVLinkForwardFilterTest)
+    UT_REGISTER_TEST(MAVLinkLogWriterTest)
+    UT_REGISTER_TEST_STANDALONE(MockLinkSwarmBenchmark)
+    UT_REGISTER_TEST(MockLinkSwarmTest)
     UT_REGISTER_TEST(QGCSerialPortInfoTest)
+    UT_REGISTER_TEST(TLogIndexTest)
+    UT_REGISTER_TEST_STANDALONE(UDPLinkBenchmark)
+    UT_REGISTER_TEST(UDPLinkTest)
 
     // FactSystem
     UT_REGISTER_TEST(FactSystemTestGeneric)
     UT_REGISTER_TEST(FactSystemTestPX4)
+    UT_REGISTER_TEST_STANDALONE(FactBenchmark)
+    UT_REGISTER_TEST(FactTest)
+    UT_REGISTER_TEST(FactUpdateSchedulerTest)
+    UT_REGISTER_TEST(ParamCacheFileTest)
+    UT_REGISTER_TEST_STANDALONE(ParamMetaDataBlobBenchmark)
+    UT_REGISTER_TEST(ParamMetaDataBlobTest)
+    UT_REGISTER_TEST(ParamWriteQueueTest)
     UT_REGISTER_TEST(ParameterManagerTest)
 
     // FollowMe
@@ -148,6 +196,11 @@ int QGCUnitTest::runTests(bool stress, const QStringList& unitTests)
     // UT_REGISTER_TEST(GpsTest)
 
     // MAVLink
+    UT_REGISTER_TEST_STANDALONE(MAVLinkFrameDecoderBenchmark)
+    UT_REGISTER_TEST(MAVLinkFrameDecoderTest)
+    UT_REGISTER_TEST_STANDALONE(MAVLinkMessageDispatcherBenchmark)
+    UT_REGISTER_TEST(MAVLinkMessageDispatcherTest)
+    UT_REGISTER_TEST(MAVLinkRequestWindowTest)
     UT_REGISTER_TEST(StatusTextHandlerTest)
     UT_REGISTER_TEST(SigningTest)
 
@@ -163,6 +216,7 @@ int QGCUnitTest::runTests(bool stress, const QStringList& unitTests)
     UT_REGISTER_TEST(MissionControllerTest)
     UT_REGISTER_TEST(MissionItemTest)
     UT_REGISTER_TEST(MissionManagerTest)
+    UT_REGISTER_TEST_STANDALONE(MissionPlanningBenchmark)
     UT_REGISTER_TEST(MissionSettingsTest)
     UT_REGISTER_TEST(PlanMasterControllerTest)
     UT_REGISTER_TEST(QGCMapPolygonTest)